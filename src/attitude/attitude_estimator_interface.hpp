@@ -0,0 +1,52 @@
+#ifndef SRC_ATTITUDE_ESTIMATOR_INTERFACE_HPP_
+#define SRC_ATTITUDE_ESTIMATOR_INTERFACE_HPP_
+
+#include "attitude_types.hpp"
+#include "error_types.hpp"
+
+namespace attitude {
+
+/**
+ * @brief Interface of an attitude estimator, which fuses gyroscope, accelerometer and magnetometer
+ *        samples into the rotation from the body frame into the earth frame (X north, Z up).
+ * 
+ */
+class AttitudeEstimatorInterface {
+ public:
+  virtual ~AttitudeEstimatorInterface() = default;
+
+  /**
+   * @brief Feeds one sample into the estimation. The first sample after construction or Reset
+   *        aligns the attitude with gravity and magnetic field instead of integrating.
+   * 
+   * @param sample Measurements with their timestamp
+   * @return types::DriverStatus INPUT_ERROR if the sample can not be used, e.g. no gravity for the
+   *         alignment or a timestamp which did not advance or jumped too far. The next sample is
+   *         integrated from the timestamp of this one.
+   */
+  virtual auto Update(const types::ImuSample& sample) noexcept -> types::DriverStatus = 0;
+
+  /**
+   * @brief Returns the current attitude
+   * @return types::Quaternion<float> Unit quaternion of the rotation from body into earth frame
+   * 
+   */
+  virtual auto GetQuaternion(void) noexcept -> types::Quaternion<float> = 0;
+
+  /**
+   * @brief Returns the current attitude
+   * @return types::EulerAngles Roll, pitch and yaw in radians
+   * 
+   */
+  virtual auto GetEulerAngles(void) noexcept -> types::EulerAngles = 0;
+
+  /**
+   * @brief Discards the attitude, the next sample aligns it again
+   * 
+   */
+  virtual auto Reset(void) noexcept -> void = 0;
+};
+
+}  // namespace attitude
+
+#endif
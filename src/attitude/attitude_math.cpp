@@ -0,0 +1,70 @@
+#include "attitude_math.hpp"
+#include <cmath>
+
+namespace attitude {
+
+auto QuaternionToEulerAngles(const types::Quaternion<float>& quaternion) noexcept -> types::EulerAngles {
+  const auto w = quaternion.w;
+  const auto x = quaternion.x;
+  const auto y = quaternion.y;
+  const auto z = quaternion.z;
+
+  auto sin_pitch = 2.0f * (w * y - z * x);
+  if (sin_pitch > 1.0f)
+    sin_pitch = 1.0f;
+  if (sin_pitch < -1.0f)
+    sin_pitch = -1.0f;
+
+  return types::EulerAngles{std::atan2(2.0f * (w * x + y * z), 1.0f - 2.0f * (x * x + y * y)),
+                            std::asin(sin_pitch),
+                            std::atan2(2.0f * (w * z + x * y), 1.0f - 2.0f * (y * y + z * z))};
+}
+
+auto EulerAnglesToQuaternion(const types::EulerAngles& euler_angles) noexcept -> types::Quaternion<float> {
+  const auto cos_roll = std::cos(0.5f * euler_angles.roll);
+  const auto sin_roll = std::sin(0.5f * euler_angles.roll);
+  const auto cos_pitch = std::cos(0.5f * euler_angles.pitch);
+  const auto sin_pitch = std::sin(0.5f * euler_angles.pitch);
+  const auto cos_yaw = std::cos(0.5f * euler_angles.yaw);
+  const auto sin_yaw = std::sin(0.5f * euler_angles.yaw);
+
+  return types::Quaternion<float>{cos_roll * cos_pitch * cos_yaw + sin_roll * sin_pitch * sin_yaw,
+                                  sin_roll * cos_pitch * cos_yaw - cos_roll * sin_pitch * sin_yaw,
+                                  cos_roll * sin_pitch * cos_yaw + sin_roll * cos_pitch * sin_yaw,
+                                  cos_roll * cos_pitch * sin_yaw - sin_roll * sin_pitch * cos_yaw};
+}
+
+auto EulerAnglesFromGravityAndMagneticField(const types::EuclideanVector<float>& accelerometer,
+                                            const types::EuclideanVector<float>& magnetometer) noexcept -> types::EulerAngles {
+  const auto roll = std::atan2(accelerometer.y, accelerometer.z);
+  const auto pitch = std::atan2(-accelerometer.x, std::sqrt(accelerometer.y * accelerometer.y + accelerometer.z * accelerometer.z));
+
+  if (IsZero(magnetometer))
+    return types::EulerAngles{roll, pitch, 0.0f};
+
+  // Rotate the magnetic field back into the horizontal plane before taking its heading
+  const auto sin_roll = std::sin(roll);
+  const auto cos_roll = std::cos(roll);
+  const auto sin_pitch = std::sin(pitch);
+  const auto cos_pitch = std::cos(pitch);
+  const auto horizontal_x = magnetometer.x * cos_pitch + (magnetometer.y * sin_roll + magnetometer.z * cos_roll) * sin_pitch;
+  const auto horizontal_y = magnetometer.y * cos_roll - magnetometer.z * sin_roll;
+
+  return types::EulerAngles{roll, pitch, std::atan2(-horizontal_y, horizontal_x)};
+}
+
+auto RotateBySmallAngle(const types::Quaternion<float>& quaternion, const float half_angle_x, const float half_angle_y, const float half_angle_z) noexcept -> types::Quaternion<float> {
+  const auto w = quaternion.w - quaternion.x * half_angle_x - quaternion.y * half_angle_y - quaternion.z * half_angle_z;
+  const auto x = quaternion.x + quaternion.w * half_angle_x + quaternion.y * half_angle_z - quaternion.z * half_angle_y;
+  const auto y = quaternion.y + quaternion.w * half_angle_y - quaternion.x * half_angle_z + quaternion.z * half_angle_x;
+  const auto z = quaternion.z + quaternion.w * half_angle_z + quaternion.x * half_angle_y - quaternion.y * half_angle_x;
+
+  const auto inverse_norm = 1.0f / std::sqrt(w * w + x * x + y * y + z * z);
+  return types::Quaternion<float>{w * inverse_norm, x * inverse_norm, y * inverse_norm, z * inverse_norm};
+}
+
+auto IsZero(const types::EuclideanVector<float>& vector) noexcept -> bool {
+  return vector.x == 0.0f && vector.y == 0.0f && vector.z == 0.0f;
+}
+
+}  // namespace attitude
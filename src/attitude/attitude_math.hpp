@@ -0,0 +1,49 @@
+#ifndef SRC_ATTITUDE_MATH_HPP_
+#define SRC_ATTITUDE_MATH_HPP_
+
+#include "attitude_types.hpp"
+
+namespace attitude {
+
+/**
+ * @brief Converts a unit quaternion into Euler angles (Z-Y-X). Pitch is clamped at +-pi/2.
+ */
+auto QuaternionToEulerAngles(const types::Quaternion<float>& quaternion) noexcept -> types::EulerAngles;
+
+/**
+ * @brief Converts Euler angles (Z-Y-X) into a unit quaternion
+ */
+auto EulerAnglesToQuaternion(const types::EulerAngles& euler_angles) noexcept -> types::Quaternion<float>;
+
+/**
+ * @brief Attitude of a resting body from its accelerometer and magnetometer.
+ *        Roll and pitch follow from gravity, yaw from the tilt compensated magnetic field.
+ *        Yaw is zero if the magnetic field is all zero.
+ * 
+ * @param accelerometer Specific force in the body frame, must not be all zero
+ * @param magnetometer Magnetic field in the body frame
+ * @return types::EulerAngles Attitude of the body
+ */
+auto EulerAnglesFromGravityAndMagneticField(const types::EuclideanVector<float>& accelerometer,
+                                            const types::EuclideanVector<float>& magnetometer) noexcept -> types::EulerAngles;
+
+/**
+ * @brief Rotates a unit quaternion by a small rotation given in the body frame,
+ *        using the first order approximation q * [1, half_angle] and normalizing the result
+ * 
+ * @param quaternion Unit quaternion of the rotation from body into earth frame
+ * @param half_angle_x Half of the rotation angle around the X axis of the body in radians
+ * @param half_angle_y Half of the rotation angle around the Y axis of the body in radians
+ * @param half_angle_z Half of the rotation angle around the Z axis of the body in radians
+ * @return types::Quaternion<float> Rotated unit quaternion
+ */
+auto RotateBySmallAngle(const types::Quaternion<float>& quaternion, const float half_angle_x, const float half_angle_y, const float half_angle_z) noexcept -> types::Quaternion<float>;
+
+/**
+ * @brief Checks whether all elements of a vector are zero, which marks a missing measurement
+ */
+auto IsZero(const types::EuclideanVector<float>& vector) noexcept -> bool;
+
+}  // namespace attitude
+
+#endif
@@ -0,0 +1,270 @@
+#include "error_state_kalman_filter.hpp"
+#include <cmath>
+#include "attitude_math.hpp"
+
+namespace attitude {
+
+constexpr std::uint32_t ErrorStateKalmanFilter::MAX_SAMPLE_INTERVAL_IN_US;
+constexpr float ErrorStateKalmanFilter::INITIAL_ATTITUDE_DEVIATION;
+constexpr float ErrorStateKalmanFilter::INITIAL_GYROSCOPE_BIAS_DEVIATION;
+
+namespace {
+
+using Matrix3x3 = utilities::Matrix<3, 3>;
+using Vector3 = utilities::Matrix<3, 1>;
+
+/// Matrix of the cross product, SkewSymmetric(a) * b = a x b
+auto SkewSymmetric(const Vector3& vector) noexcept -> Matrix3x3 {
+  Matrix3x3 skew_symmetric;
+  skew_symmetric(0, 1) = -vector(2, 0);
+  skew_symmetric(0, 2) = vector(1, 0);
+  skew_symmetric(1, 0) = vector(2, 0);
+  skew_symmetric(1, 2) = -vector(0, 0);
+  skew_symmetric(2, 0) = -vector(1, 0);
+  skew_symmetric(2, 1) = vector(0, 0);
+  return skew_symmetric;
+}
+
+auto AddToDiagonal(Matrix3x3& matrix, const float value) noexcept -> void {
+  for (std::uint16_t index = 0; index < 3; index++)
+    matrix(index, index) += value;
+}
+
+/// Removes the rounding errors which would otherwise let a covariance block drift away from symmetry
+auto Symmetrize(Matrix3x3& matrix) noexcept -> void {
+  for (std::uint16_t row = 0; row < 3; row++) {
+    for (std::uint16_t column = static_cast<std::uint16_t>(row + 1); column < 3; column++) {
+      const auto mean = 0.5f * (matrix(row, column) + matrix(column, row));
+      matrix(row, column) = mean;
+      matrix(column, row) = mean;
+    }
+  }
+}
+
+auto Normalized(const types::EuclideanVector<float>& vector) noexcept -> Vector3 {
+  const auto inverse_norm = 1.0f / std::sqrt(vector.x * vector.x + vector.y * vector.y + vector.z * vector.z);
+  Vector3 normalized;
+  normalized(0, 0) = vector.x * inverse_norm;
+  normalized(1, 0) = vector.y * inverse_norm;
+  normalized(2, 0) = vector.z * inverse_norm;
+  return normalized;
+}
+
+}  // namespace
+
+auto ErrorStateKalmanFilter::Update(const types::ImuSample& sample) noexcept -> types::DriverStatus {
+  if (!aligned_)
+    return Align(sample);
+
+  // Unsigned difference stays correct when the timestamp wraps around
+  const std::uint32_t sample_interval_in_us = sample.timestamp_in_us - last_timestamp_in_us_;
+  last_timestamp_in_us_ = sample.timestamp_in_us;
+
+  if (sample_interval_in_us == 0 || sample_interval_in_us > MAX_SAMPLE_INTERVAL_IN_US)
+    return types::DriverStatus::INPUT_ERROR;
+
+  Predict(sample.gyroscope_in_rad_per_s, static_cast<float>(sample_interval_in_us) * 1.0e-6f);
+
+  if (!IsZero(sample.accelerometer))
+    CorrectWithGravity(sample.accelerometer);
+
+  if (!IsZero(sample.magnetometer))
+    CorrectWithHeading(sample.magnetometer);
+
+  return types::DriverStatus::OK;
+}
+
+auto ErrorStateKalmanFilter::Align(const types::ImuSample& sample) noexcept -> types::DriverStatus {
+  if (IsZero(sample.accelerometer))
+    return types::DriverStatus::INPUT_ERROR;
+
+  quaternion_ = EulerAnglesToQuaternion(EulerAnglesFromGravityAndMagneticField(sample.accelerometer, sample.magnetometer));
+  last_timestamp_in_us_ = sample.timestamp_in_us;
+  aligned_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto ErrorStateKalmanFilter::Predict(const types::EuclideanVector<float>& gyroscope_in_rad_per_s, const float sample_interval_in_s) noexcept -> void {
+  Vector3 rotation;
+  rotation(0, 0) = (gyroscope_in_rad_per_s.x - gyroscope_bias_(0, 0)) * sample_interval_in_s;
+  rotation(1, 0) = (gyroscope_in_rad_per_s.y - gyroscope_bias_(1, 0)) * sample_interval_in_s;
+  rotation(2, 0) = (gyroscope_in_rad_per_s.z - gyroscope_bias_(2, 0)) * sample_interval_in_s;
+  quaternion_ = RotateBySmallAngle(quaternion_, 0.5f * rotation(0, 0), 0.5f * rotation(1, 0), 0.5f * rotation(2, 0));
+
+  // Error transition F = [A, -dt*I; 0, I] with A = I - [w*dt]x, expanded into the blocks of F*P*F^T
+  Matrix3x3 transition;
+  utilities::Subtract(Matrix3x3::Identity(), SkewSymmetric(rotation), transition);
+  Matrix3x3 transition_transposed;
+  utilities::Transpose(transition, transition_transposed);
+
+  Matrix3x3 transition_times_covariance;
+  utilities::Multiply(transition, covariance_attitude_, transition_times_covariance);
+  Matrix3x3 transition_times_covariance_attitude_bias;
+  utilities::Multiply(transition, covariance_attitude_bias_, transition_times_covariance_attitude_bias);
+  Matrix3x3 coupling;
+  utilities::Transpose(transition_times_covariance_attitude_bias, coupling);
+  utilities::Add(coupling, transition_times_covariance_attitude_bias, coupling);
+  utilities::Scale(coupling, -sample_interval_in_s, coupling);
+
+  Matrix3x3 bias_term;
+  utilities::Scale(covariance_bias_, sample_interval_in_s * sample_interval_in_s, bias_term);
+
+  utilities::Multiply(transition_times_covariance, transition_transposed, covariance_attitude_);
+  utilities::Add(covariance_attitude_, coupling, covariance_attitude_);
+  utilities::Add(covariance_attitude_, bias_term, covariance_attitude_);
+  AddToDiagonal(covariance_attitude_, noise_.gyroscope_noise_density * noise_.gyroscope_noise_density * sample_interval_in_s);
+
+  Matrix3x3 scaled_covariance_bias;
+  utilities::Scale(covariance_bias_, sample_interval_in_s, scaled_covariance_bias);
+  utilities::Subtract(transition_times_covariance_attitude_bias, scaled_covariance_bias, covariance_attitude_bias_);
+
+  AddToDiagonal(covariance_bias_, noise_.gyroscope_bias_random_walk * noise_.gyroscope_bias_random_walk * sample_interval_in_s);
+}
+
+auto ErrorStateKalmanFilter::CorrectWithGravity(const types::EuclideanVector<float>& accelerometer) noexcept -> void {
+  const auto gravity = GravityInBody();
+  Vector3 innovation;
+  utilities::Subtract(Normalized(accelerometer), gravity, innovation);
+
+  // The measurement only depends on the attitude error, the bias columns of H are zero
+  const auto jacobian = SkewSymmetric(gravity);
+  Matrix3x3 jacobian_transposed;
+  utilities::Transpose(jacobian, jacobian_transposed);
+
+  Matrix3x3 jacobian_times_covariance_attitude;
+  utilities::Multiply(jacobian, covariance_attitude_, jacobian_times_covariance_attitude);
+  Matrix3x3 jacobian_times_covariance_attitude_bias;
+  utilities::Multiply(jacobian, covariance_attitude_bias_, jacobian_times_covariance_attitude_bias);
+
+  Matrix3x3 innovation_covariance;
+  utilities::Multiply(jacobian_times_covariance_attitude, jacobian_transposed, innovation_covariance);
+  AddToDiagonal(innovation_covariance, noise_.accelerometer_direction * noise_.accelerometer_direction);
+
+  Matrix3x3 inverse_innovation_covariance;
+  if (utilities::Inverse(innovation_covariance, inverse_innovation_covariance) != types::DriverStatus::OK)
+    return;
+
+  // P*H^T equals (H*P)^T, because the covariance is symmetric
+  Matrix3x3 transposed;
+  Matrix3x3 gain_attitude;
+  utilities::Transpose(jacobian_times_covariance_attitude, transposed);
+  utilities::Multiply(transposed, inverse_innovation_covariance, gain_attitude);
+  Matrix3x3 gain_bias;
+  utilities::Transpose(jacobian_times_covariance_attitude_bias, transposed);
+  utilities::Multiply(transposed, inverse_innovation_covariance, gain_bias);
+
+  Vector3 attitude_error;
+  utilities::Multiply(gain_attitude, innovation, attitude_error);
+  Vector3 bias_error;
+  utilities::Multiply(gain_bias, innovation, bias_error);
+
+  Matrix3x3 reduction;
+  utilities::Multiply(gain_attitude, jacobian_times_covariance_attitude, reduction);
+  utilities::Subtract(covariance_attitude_, reduction, covariance_attitude_);
+  utilities::Multiply(gain_attitude, jacobian_times_covariance_attitude_bias, reduction);
+  utilities::Subtract(covariance_attitude_bias_, reduction, covariance_attitude_bias_);
+  utilities::Multiply(gain_bias, jacobian_times_covariance_attitude_bias, reduction);
+  utilities::Subtract(covariance_bias_, reduction, covariance_bias_);
+  Symmetrize(covariance_attitude_);
+  Symmetrize(covariance_bias_);
+
+  Inject(attitude_error, bias_error);
+}
+
+auto ErrorStateKalmanFilter::CorrectWithHeading(const types::EuclideanVector<float>& magnetometer) noexcept -> void {
+  const auto magnetic_field = Normalized(magnetometer);
+  const auto w = quaternion_.w;
+  const auto x = quaternion_.x;
+  const auto y = quaternion_.y;
+  const auto z = quaternion_.z;
+
+  // Horizontal magnetic field in the earth frame, which points north (along X) for the true attitude
+  const auto north = (1.0f - 2.0f * (y * y + z * z)) * magnetic_field(0, 0) + 2.0f * (x * y - w * z) * magnetic_field(1, 0) + 2.0f * (x * z + w * y) * magnetic_field(2, 0);
+  const auto west = 2.0f * (x * y + w * z) * magnetic_field(0, 0) + (1.0f - 2.0f * (x * x + z * z)) * magnetic_field(1, 0) + 2.0f * (y * z - w * x) * magnetic_field(2, 0);
+  if (north == 0.0f && west == 0.0f)
+    return;
+
+  const auto innovation = -std::atan2(west, north);
+
+  // Heading changes with the attitude error around the vertical axis, which is gravity in the body frame
+  const auto jacobian = GravityInBody();
+  Vector3 covariance_attitude_times_jacobian;
+  utilities::Multiply(covariance_attitude_, jacobian, covariance_attitude_times_jacobian);
+  Matrix3x3 covariance_bias_attitude;
+  utilities::Transpose(covariance_attitude_bias_, covariance_bias_attitude);
+  Vector3 covariance_bias_times_jacobian;
+  utilities::Multiply(covariance_bias_attitude, jacobian, covariance_bias_times_jacobian);
+
+  auto innovation_variance = noise_.magnetometer_heading * noise_.magnetometer_heading;
+  for (std::uint16_t index = 0; index < 3; index++)
+    innovation_variance += jacobian(index, 0) * covariance_attitude_times_jacobian(index, 0);
+
+  // Scalar measurement, the gain needs a division instead of an inversion
+  Vector3 gain_attitude;
+  utilities::Scale(covariance_attitude_times_jacobian, 1.0f / innovation_variance, gain_attitude);
+  Vector3 gain_bias;
+  utilities::Scale(covariance_bias_times_jacobian, 1.0f / innovation_variance, gain_bias);
+
+  Vector3 attitude_error;
+  utilities::Scale(gain_attitude, innovation, attitude_error);
+  Vector3 bias_error;
+  utilities::Scale(gain_bias, innovation, bias_error);
+
+  utilities::Matrix<1, 3> transposed;
+  Matrix3x3 reduction;
+  utilities::Transpose(covariance_attitude_times_jacobian, transposed);
+  utilities::Multiply(gain_attitude, transposed, reduction);
+  utilities::Subtract(covariance_attitude_, reduction, covariance_attitude_);
+  utilities::Transpose(covariance_bias_times_jacobian, transposed);
+  utilities::Multiply(gain_attitude, transposed, reduction);
+  utilities::Subtract(covariance_attitude_bias_, reduction, covariance_attitude_bias_);
+  utilities::Multiply(gain_bias, transposed, reduction);
+  utilities::Subtract(covariance_bias_, reduction, covariance_bias_);
+  Symmetrize(covariance_attitude_);
+  Symmetrize(covariance_bias_);
+
+  Inject(attitude_error, bias_error);
+}
+
+auto ErrorStateKalmanFilter::Inject(const Vector3& attitude_error, const Vector3& bias_error) noexcept -> void {
+  quaternion_ = RotateBySmallAngle(quaternion_, 0.5f * attitude_error(0, 0), 0.5f * attitude_error(1, 0), 0.5f * attitude_error(2, 0));
+  utilities::Add(gyroscope_bias_, bias_error, gyroscope_bias_);
+}
+
+auto ErrorStateKalmanFilter::GravityInBody(void) const noexcept -> Vector3 {
+  const auto w = quaternion_.w;
+  const auto x = quaternion_.x;
+  const auto y = quaternion_.y;
+  const auto z = quaternion_.z;
+
+  Vector3 gravity;
+  gravity(0, 0) = 2.0f * (x * z - w * y);
+  gravity(1, 0) = 2.0f * (y * z + w * x);
+  gravity(2, 0) = 1.0f - 2.0f * (x * x + y * y);
+  return gravity;
+}
+
+auto ErrorStateKalmanFilter::GetQuaternion(void) noexcept -> types::Quaternion<float> {
+  return quaternion_;
+}
+
+auto ErrorStateKalmanFilter::GetEulerAngles(void) noexcept -> types::EulerAngles {
+  return QuaternionToEulerAngles(quaternion_);
+}
+
+auto ErrorStateKalmanFilter::GetGyroscopeBias(void) noexcept -> types::EuclideanVector<float> {
+  return types::EuclideanVector<float>(gyroscope_bias_(0, 0), gyroscope_bias_(1, 0), gyroscope_bias_(2, 0));
+}
+
+auto ErrorStateKalmanFilter::Reset(void) noexcept -> void {
+  aligned_ = false;
+  quaternion_ = types::Quaternion<float>{1.0f, 0.0f, 0.0f, 0.0f};
+  gyroscope_bias_ = Vector3();
+  covariance_attitude_ = Matrix3x3::Identity();
+  utilities::Scale(covariance_attitude_, INITIAL_ATTITUDE_DEVIATION * INITIAL_ATTITUDE_DEVIATION, covariance_attitude_);
+  covariance_attitude_bias_ = Matrix3x3();
+  covariance_bias_ = Matrix3x3::Identity();
+  utilities::Scale(covariance_bias_, INITIAL_GYROSCOPE_BIAS_DEVIATION * INITIAL_GYROSCOPE_BIAS_DEVIATION, covariance_bias_);
+}
+
+}  // namespace attitude
@@ -0,0 +1,93 @@
+#ifndef SRC_ATTITUDE_ERROR_STATE_KALMAN_FILTER_HPP_
+#define SRC_ATTITUDE_ERROR_STATE_KALMAN_FILTER_HPP_
+
+#include <cstdint>
+#include "attitude_estimator_interface.hpp"
+#include "matrix.hpp"
+
+namespace attitude {
+
+/**
+ * @brief Noise model of the error state Kalman filter
+ * 
+ */
+struct ErrorStateKalmanFilterNoise {
+  /// Angular random walk of the gyroscope in rad/s/sqrt(Hz)
+  float gyroscope_noise_density = 0.001f;
+
+  /// Rate random walk of the gyroscope bias in rad/s^2/sqrt(Hz)
+  float gyroscope_bias_random_walk = 0.0005f;
+
+  /// Standard deviation of the normalized accelerometer direction, including linear acceleration
+  float accelerometer_direction = 0.05f;
+
+  /// Standard deviation of the tilt compensated magnetometer heading in rad
+  float magnetometer_heading = 0.1f;
+};
+
+/**
+ * @brief Error state (multiplicative) extended Kalman filter for the attitude and the gyroscope bias.
+ *        The nominal attitude is a quaternion integrated from the bias corrected gyroscope, the
+ *        filter estimates the small rotation error in the body frame and the bias error.
+ *        Gravity corrects roll and pitch, the magnetometer only the heading.
+ * 
+ *        The symmetric 6x6 covariance is kept as its three distinct 3x3 blocks, so the transition
+ *        is applied block wise without multiplying the zero and identity blocks of F, and the
+ *        measurement Jacobians only touch the attitude columns. All matrix products run on
+ *        CMSIS-DSP on target.
+ * 
+ */
+class ErrorStateKalmanFilter final : public AttitudeEstimatorInterface {
+ public:
+  ~ErrorStateKalmanFilter() = default;
+
+  explicit ErrorStateKalmanFilter(const ErrorStateKalmanFilterNoise& noise = ErrorStateKalmanFilterNoise()) : noise_(noise) {
+    Reset();
+  }
+
+  auto Update(const types::ImuSample& sample) noexcept -> types::DriverStatus override;
+  auto GetQuaternion(void) noexcept -> types::Quaternion<float> override;
+  auto GetEulerAngles(void) noexcept -> types::EulerAngles override;
+  auto Reset(void) noexcept -> void override;
+
+  /**
+   * @brief Returns the estimated gyroscope bias, which is subtracted from the gyroscope samples
+   * @return types::EuclideanVector<float> Bias in rad/s
+   * 
+   */
+  auto GetGyroscopeBias(void) noexcept -> types::EuclideanVector<float>;
+
+  static constexpr std::uint32_t MAX_SAMPLE_INTERVAL_IN_US = 100000;
+
+  /// Standard deviation of the attitude right after the alignment in rad
+  static constexpr float INITIAL_ATTITUDE_DEVIATION = 0.05f;
+
+  /// Standard deviation of the gyroscope bias before any estimation in rad/s
+  static constexpr float INITIAL_GYROSCOPE_BIAS_DEVIATION = 0.05f;
+
+ private:
+  using Matrix3x3 = utilities::Matrix<3, 3>;
+  using Vector3 = utilities::Matrix<3, 1>;
+
+  auto Align(const types::ImuSample& sample) noexcept -> types::DriverStatus;
+  auto Predict(const types::EuclideanVector<float>& gyroscope_in_rad_per_s, const float sample_interval_in_s) noexcept -> void;
+  auto CorrectWithGravity(const types::EuclideanVector<float>& accelerometer) noexcept -> void;
+  auto CorrectWithHeading(const types::EuclideanVector<float>& magnetometer) noexcept -> void;
+  auto Inject(const Vector3& attitude_error, const Vector3& bias_error) noexcept -> void;
+  auto GravityInBody(void) const noexcept -> Vector3;
+
+  ErrorStateKalmanFilterNoise noise_;
+  bool aligned_ = false;
+  std::uint32_t last_timestamp_in_us_ = 0;
+  types::Quaternion<float> quaternion_{1.0f, 0.0f, 0.0f, 0.0f};
+  Vector3 gyroscope_bias_;
+
+  /// Covariance blocks of attitude error, attitude and bias error, bias error
+  Matrix3x3 covariance_attitude_;
+  Matrix3x3 covariance_attitude_bias_;
+  Matrix3x3 covariance_bias_;
+};
+
+}  // namespace attitude
+
+#endif
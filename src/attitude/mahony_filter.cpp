@@ -0,0 +1,125 @@
+#include "mahony_filter.hpp"
+#include <cmath>
+#include "attitude_math.hpp"
+
+namespace attitude {
+
+constexpr float MahonyFilter::DEFAULT_PROPORTIONAL_GAIN;
+constexpr float MahonyFilter::DEFAULT_INTEGRAL_GAIN;
+constexpr std::uint32_t MahonyFilter::MAX_SAMPLE_INTERVAL_IN_US;
+
+auto MahonyFilter::Update(const types::ImuSample& sample) noexcept -> types::DriverStatus {
+  if (!aligned_)
+    return Align(sample);
+
+  // Unsigned difference stays correct when the timestamp wraps around
+  const std::uint32_t sample_interval_in_us = sample.timestamp_in_us - last_timestamp_in_us_;
+  last_timestamp_in_us_ = sample.timestamp_in_us;
+
+  if (sample_interval_in_us == 0 || sample_interval_in_us > MAX_SAMPLE_INTERVAL_IN_US)
+    return types::DriverStatus::INPUT_ERROR;
+
+  Integrate(sample, static_cast<float>(sample_interval_in_us) * 1.0e-6f);
+  return types::DriverStatus::OK;
+}
+
+auto MahonyFilter::Align(const types::ImuSample& sample) noexcept -> types::DriverStatus {
+  if (IsZero(sample.accelerometer))
+    return types::DriverStatus::INPUT_ERROR;
+
+  quaternion_ = EulerAnglesToQuaternion(EulerAnglesFromGravityAndMagneticField(sample.accelerometer, sample.magnetometer));
+  last_timestamp_in_us_ = sample.timestamp_in_us;
+  aligned_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto MahonyFilter::Integrate(const types::ImuSample& sample, const float sample_interval_in_s) noexcept -> void {
+  const auto q0 = quaternion_.w;
+  const auto q1 = quaternion_.x;
+  const auto q2 = quaternion_.y;
+  const auto q3 = quaternion_.z;
+  auto gx = sample.gyroscope_in_rad_per_s.x;
+  auto gy = sample.gyroscope_in_rad_per_s.y;
+  auto gz = sample.gyroscope_in_rad_per_s.z;
+  auto ax = sample.accelerometer.x;
+  auto ay = sample.accelerometer.y;
+  auto az = sample.accelerometer.z;
+  auto mx = sample.magnetometer.x;
+  auto my = sample.magnetometer.y;
+  auto mz = sample.magnetometer.z;
+
+  if (Normalize(ax, ay, az)) {
+    // Half of the gravity direction expected in the body frame
+    const auto half_vx = q1 * q3 - q0 * q2;
+    const auto half_vy = q0 * q1 + q2 * q3;
+    const auto half_vz = q0 * q0 - 0.5f + q3 * q3;
+
+    auto half_ex = ay * half_vz - az * half_vy;
+    auto half_ey = az * half_vx - ax * half_vz;
+    auto half_ez = ax * half_vy - ay * half_vx;
+
+    if (Normalize(mx, my, mz)) {
+      // Magnetic field in the earth frame, reduced to its north and vertical component
+      const auto hx = 2.0f * (mx * (0.5f - q2 * q2 - q3 * q3) + my * (q1 * q2 - q0 * q3) + mz * (q1 * q3 + q0 * q2));
+      const auto hy = 2.0f * (mx * (q1 * q2 + q0 * q3) + my * (0.5f - q1 * q1 - q3 * q3) + mz * (q2 * q3 - q0 * q1));
+      const auto bx = std::sqrt(hx * hx + hy * hy);
+      const auto bz = 2.0f * (mx * (q1 * q3 - q0 * q2) + my * (q2 * q3 + q0 * q1) + mz * (0.5f - q1 * q1 - q2 * q2));
+
+      // Half of the magnetic field direction expected in the body frame
+      const auto half_wx = bx * (0.5f - q2 * q2 - q3 * q3) + bz * (q1 * q3 - q0 * q2);
+      const auto half_wy = bx * (q1 * q2 - q0 * q3) + bz * (q0 * q1 + q2 * q3);
+      const auto half_wz = bx * (q0 * q2 + q1 * q3) + bz * (0.5f - q1 * q1 - q2 * q2);
+
+      half_ex += my * half_wz - mz * half_wy;
+      half_ey += mz * half_wx - mx * half_wz;
+      half_ez += mx * half_wy - my * half_wx;
+    }
+
+    if (integral_gain_ > 0.0f) {
+      integral_feedback_x_ += 2.0f * integral_gain_ * half_ex * sample_interval_in_s;
+      integral_feedback_y_ += 2.0f * integral_gain_ * half_ey * sample_interval_in_s;
+      integral_feedback_z_ += 2.0f * integral_gain_ * half_ez * sample_interval_in_s;
+      gx += integral_feedback_x_;
+      gy += integral_feedback_y_;
+      gz += integral_feedback_z_;
+    }
+
+    gx += 2.0f * proportional_gain_ * half_ex;
+    gy += 2.0f * proportional_gain_ * half_ey;
+    gz += 2.0f * proportional_gain_ * half_ez;
+  }
+
+  // Half of the rotation angle during the sample interval
+  const auto half_interval = 0.5f * sample_interval_in_s;
+  quaternion_ = RotateBySmallAngle(quaternion_, gx * half_interval, gy * half_interval, gz * half_interval);
+}
+
+auto MahonyFilter::Normalize(float& x, float& y, float& z) noexcept -> bool {
+  const auto squared_norm = x * x + y * y + z * z;
+  if (squared_norm == 0.0f)
+    return false;
+
+  const auto inverse_norm = 1.0f / std::sqrt(squared_norm);
+  x *= inverse_norm;
+  y *= inverse_norm;
+  z *= inverse_norm;
+  return true;
+}
+
+auto MahonyFilter::GetQuaternion(void) noexcept -> types::Quaternion<float> {
+  return quaternion_;
+}
+
+auto MahonyFilter::GetEulerAngles(void) noexcept -> types::EulerAngles {
+  return QuaternionToEulerAngles(quaternion_);
+}
+
+auto MahonyFilter::Reset(void) noexcept -> void {
+  aligned_ = false;
+  quaternion_ = types::Quaternion<float>{1.0f, 0.0f, 0.0f, 0.0f};
+  integral_feedback_x_ = 0.0f;
+  integral_feedback_y_ = 0.0f;
+  integral_feedback_z_ = 0.0f;
+}
+
+}  // namespace attitude
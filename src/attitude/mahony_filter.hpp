@@ -0,0 +1,53 @@
+#ifndef SRC_ATTITUDE_MAHONY_FILTER_HPP_
+#define SRC_ATTITUDE_MAHONY_FILTER_HPP_
+
+#include <cstdint>
+#include "attitude_estimator_interface.hpp"
+
+namespace attitude {
+
+/**
+ * @brief Mahony complementary filter in single precision float, which maps onto the FPU of the Cortex-M4F.
+ *        The gyroscope is integrated and corrected by a proportional and integral feedback
+ *        of the error between measured and estimated gravity and magnetic field direction.
+ * 
+ */
+class MahonyFilter final : public AttitudeEstimatorInterface {
+ public:
+  ~MahonyFilter() = default;
+
+  /**
+   * @brief Construct a new Mahony filter
+   * 
+   * @param proportional_gain Feedback gain of the direction error in rad/s, higher values trust the gyroscope less
+   * @param integral_gain Feedback gain of the integrated direction error, estimates the gyroscope bias. Zero disables it.
+   */
+  explicit MahonyFilter(const float proportional_gain = DEFAULT_PROPORTIONAL_GAIN, const float integral_gain = DEFAULT_INTEGRAL_GAIN) : proportional_gain_(proportional_gain), integral_gain_(integral_gain) {}
+
+  auto Update(const types::ImuSample& sample) noexcept -> types::DriverStatus override;
+  auto GetQuaternion(void) noexcept -> types::Quaternion<float> override;
+  auto GetEulerAngles(void) noexcept -> types::EulerAngles override;
+  auto Reset(void) noexcept -> void override;
+
+  static constexpr float DEFAULT_PROPORTIONAL_GAIN = 0.5f;
+  static constexpr float DEFAULT_INTEGRAL_GAIN = 0.0f;
+  static constexpr std::uint32_t MAX_SAMPLE_INTERVAL_IN_US = 100000;
+
+ private:
+  auto Align(const types::ImuSample& sample) noexcept -> types::DriverStatus;
+  auto Integrate(const types::ImuSample& sample, const float sample_interval_in_s) noexcept -> void;
+  auto Normalize(float& x, float& y, float& z) noexcept -> bool;
+
+  float proportional_gain_;
+  float integral_gain_;
+  bool aligned_ = false;
+  std::uint32_t last_timestamp_in_us_ = 0;
+  types::Quaternion<float> quaternion_{1.0f, 0.0f, 0.0f, 0.0f};
+  float integral_feedback_x_ = 0.0f;
+  float integral_feedback_y_ = 0.0f;
+  float integral_feedback_z_ = 0.0f;
+};
+
+}  // namespace attitude
+
+#endif
@@ -0,0 +1,182 @@
+#include "mahony_filter_fixed_point.hpp"
+#include "attitude_math.hpp"
+#include "fixed_point.hpp"
+
+namespace attitude {
+
+constexpr float MahonyFilterFixedPoint::DEFAULT_PROPORTIONAL_GAIN;
+constexpr float MahonyFilterFixedPoint::DEFAULT_INTEGRAL_GAIN;
+constexpr std::uint32_t MahonyFilterFixedPoint::MAX_SAMPLE_INTERVAL_IN_US;
+constexpr std::int32_t MahonyFilterFixedPoint::ONE_Q30;
+constexpr std::int32_t MahonyFilterFixedPoint::HALF_Q30;
+
+namespace {
+
+/// Rounded 2^46 / 10^6, turns microseconds into Q30 seconds after a shift by 16
+constexpr std::int64_t SECONDS_PER_MICROSECOND_Q46 = (static_cast<std::int64_t>(1) << 46) / 1000000;
+
+inline auto MultiplyQ30(const std::int32_t first_factor, const std::int32_t second_factor) noexcept -> std::int32_t {
+  return utilities::MultiplyFixedPoint<30>(first_factor, second_factor);
+}
+
+}  // namespace
+
+MahonyFilterFixedPoint::MahonyFilterFixedPoint(const float proportional_gain, const float integral_gain)
+    : two_proportional_gain_q16_(utilities::ToFixedPoint<16>(2.0f * proportional_gain)),
+      two_integral_gain_q16_(utilities::ToFixedPoint<16>(2.0f * integral_gain)) {}
+
+auto MahonyFilterFixedPoint::Update(const types::ImuSample& sample) noexcept -> types::DriverStatus {
+  if (!aligned_)
+    return Align(sample);
+
+  // Unsigned difference stays correct when the timestamp wraps around
+  const std::uint32_t sample_interval_in_us = sample.timestamp_in_us - last_timestamp_in_us_;
+  last_timestamp_in_us_ = sample.timestamp_in_us;
+
+  if (sample_interval_in_us == 0 || sample_interval_in_us > MAX_SAMPLE_INTERVAL_IN_US)
+    return types::DriverStatus::INPUT_ERROR;
+
+  Integrate(sample, sample_interval_in_us);
+  return types::DriverStatus::OK;
+}
+
+auto MahonyFilterFixedPoint::Align(const types::ImuSample& sample) noexcept -> types::DriverStatus {
+  if (IsZero(sample.accelerometer))
+    return types::DriverStatus::INPUT_ERROR;
+
+  // Alignment happens once, so it reuses the float math
+  const auto quaternion = EulerAnglesToQuaternion(EulerAnglesFromGravityAndMagneticField(sample.accelerometer, sample.magnetometer));
+  quaternion_q30_.w = utilities::ToFixedPoint<30>(quaternion.w);
+  quaternion_q30_.x = utilities::ToFixedPoint<30>(quaternion.x);
+  quaternion_q30_.y = utilities::ToFixedPoint<30>(quaternion.y);
+  quaternion_q30_.z = utilities::ToFixedPoint<30>(quaternion.z);
+  last_timestamp_in_us_ = sample.timestamp_in_us;
+  aligned_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto MahonyFilterFixedPoint::Integrate(const types::ImuSample& sample, const std::uint32_t sample_interval_in_us) noexcept -> void {
+  const auto q0 = quaternion_q30_.w;
+  const auto q1 = quaternion_q30_.x;
+  const auto q2 = quaternion_q30_.y;
+  const auto q3 = quaternion_q30_.z;
+  const auto sample_interval_q30 = static_cast<std::int32_t>((static_cast<std::int64_t>(sample_interval_in_us) * SECONDS_PER_MICROSECOND_Q46) >> 16);
+
+  auto gx = utilities::ToFixedPoint<20>(sample.gyroscope_in_rad_per_s.x);
+  auto gy = utilities::ToFixedPoint<20>(sample.gyroscope_in_rad_per_s.y);
+  auto gz = utilities::ToFixedPoint<20>(sample.gyroscope_in_rad_per_s.z);
+
+  std::int32_t ax, ay, az;
+  if (Normalize(sample.accelerometer, ax, ay, az)) {
+    // Half of the gravity direction expected in the body frame
+    const auto half_vx = MultiplyQ30(q1, q3) - MultiplyQ30(q0, q2);
+    const auto half_vy = MultiplyQ30(q0, q1) + MultiplyQ30(q2, q3);
+    const auto half_vz = MultiplyQ30(q0, q0) - HALF_Q30 + MultiplyQ30(q3, q3);
+
+    auto half_ex = MultiplyQ30(ay, half_vz) - MultiplyQ30(az, half_vy);
+    auto half_ey = MultiplyQ30(az, half_vx) - MultiplyQ30(ax, half_vz);
+    auto half_ez = MultiplyQ30(ax, half_vy) - MultiplyQ30(ay, half_vx);
+
+    std::int32_t mx, my, mz;
+    if (Normalize(sample.magnetometer, mx, my, mz)) {
+      const auto q0q1 = MultiplyQ30(q0, q1);
+      const auto q0q2 = MultiplyQ30(q0, q2);
+      const auto q0q3 = MultiplyQ30(q0, q3);
+      const auto q1q1 = MultiplyQ30(q1, q1);
+      const auto q1q2 = MultiplyQ30(q1, q2);
+      const auto q1q3 = MultiplyQ30(q1, q3);
+      const auto q2q2 = MultiplyQ30(q2, q2);
+      const auto q2q3 = MultiplyQ30(q2, q3);
+      const auto q3q3 = MultiplyQ30(q3, q3);
+
+      // Magnetic field in the earth frame, reduced to its north and vertical component
+      const auto hx = 2 * (MultiplyQ30(mx, HALF_Q30 - q2q2 - q3q3) + MultiplyQ30(my, q1q2 - q0q3) + MultiplyQ30(mz, q1q3 + q0q2));
+      const auto hy = 2 * (MultiplyQ30(mx, q1q2 + q0q3) + MultiplyQ30(my, HALF_Q30 - q1q1 - q3q3) + MultiplyQ30(mz, q2q3 - q0q1));
+      const auto bx = static_cast<std::int32_t>(utilities::SquareRoot(static_cast<std::uint64_t>(static_cast<std::int64_t>(hx) * hx + static_cast<std::int64_t>(hy) * hy)));
+      const auto bz = 2 * (MultiplyQ30(mx, q1q3 - q0q2) + MultiplyQ30(my, q2q3 + q0q1) + MultiplyQ30(mz, HALF_Q30 - q1q1 - q2q2));
+
+      // Half of the magnetic field direction expected in the body frame
+      const auto half_wx = MultiplyQ30(bx, HALF_Q30 - q2q2 - q3q3) + MultiplyQ30(bz, q1q3 - q0q2);
+      const auto half_wy = MultiplyQ30(bx, q1q2 - q0q3) + MultiplyQ30(bz, q0q1 + q2q3);
+      const auto half_wz = MultiplyQ30(bx, q0q2 + q1q3) + MultiplyQ30(bz, HALF_Q30 - q1q1 - q2q2);
+
+      half_ex += MultiplyQ30(my, half_wz) - MultiplyQ30(mz, half_wy);
+      half_ey += MultiplyQ30(mz, half_wx) - MultiplyQ30(mx, half_wz);
+      half_ez += MultiplyQ30(mx, half_wy) - MultiplyQ30(my, half_wx);
+    }
+
+    // Q16 gain times Q30 error results in a Q20 angular rate
+    if (two_integral_gain_q16_ > 0) {
+      integral_feedback_x_q20_ += MultiplyQ30(utilities::MultiplyFixedPoint<26>(two_integral_gain_q16_, half_ex), sample_interval_q30);
+      integral_feedback_y_q20_ += MultiplyQ30(utilities::MultiplyFixedPoint<26>(two_integral_gain_q16_, half_ey), sample_interval_q30);
+      integral_feedback_z_q20_ += MultiplyQ30(utilities::MultiplyFixedPoint<26>(two_integral_gain_q16_, half_ez), sample_interval_q30);
+      gx += integral_feedback_x_q20_;
+      gy += integral_feedback_y_q20_;
+      gz += integral_feedback_z_q20_;
+    }
+
+    gx += utilities::MultiplyFixedPoint<26>(two_proportional_gain_q16_, half_ex);
+    gy += utilities::MultiplyFixedPoint<26>(two_proportional_gain_q16_, half_ey);
+    gz += utilities::MultiplyFixedPoint<26>(two_proportional_gain_q16_, half_ez);
+  }
+
+  // Q20 rate times Q30 interval shifted by 21 is half of the rotation angle in Q30
+  const auto half_angle_x = utilities::MultiplyFixedPoint<21>(gx, sample_interval_q30);
+  const auto half_angle_y = utilities::MultiplyFixedPoint<21>(gy, sample_interval_q30);
+  const auto half_angle_z = utilities::MultiplyFixedPoint<21>(gz, sample_interval_q30);
+
+  const auto w = q0 - MultiplyQ30(q1, half_angle_x) - MultiplyQ30(q2, half_angle_y) - MultiplyQ30(q3, half_angle_z);
+  const auto x = q1 + MultiplyQ30(q0, half_angle_x) + MultiplyQ30(q2, half_angle_z) - MultiplyQ30(q3, half_angle_y);
+  const auto y = q2 + MultiplyQ30(q0, half_angle_y) - MultiplyQ30(q1, half_angle_z) + MultiplyQ30(q3, half_angle_x);
+  const auto z = q3 + MultiplyQ30(q0, half_angle_z) + MultiplyQ30(q1, half_angle_y) - MultiplyQ30(q2, half_angle_x);
+
+  // The quaternion stays close to unit length, so one Newton step of 1/sqrt around 1 normalizes it
+  const auto squared_norm_q30 = (static_cast<std::int64_t>(w) * w + static_cast<std::int64_t>(x) * x +
+                                 static_cast<std::int64_t>(y) * y + static_cast<std::int64_t>(z) * z) >>
+                                30;
+  const auto inverse_norm_q30 = utilities::SaturateToInt32((3 * static_cast<std::int64_t>(ONE_Q30) - squared_norm_q30) / 2);
+
+  quaternion_q30_.w = MultiplyQ30(w, inverse_norm_q30);
+  quaternion_q30_.x = MultiplyQ30(x, inverse_norm_q30);
+  quaternion_q30_.y = MultiplyQ30(y, inverse_norm_q30);
+  quaternion_q30_.z = MultiplyQ30(z, inverse_norm_q30);
+}
+
+auto MahonyFilterFixedPoint::Normalize(const types::EuclideanVector<float>& vector, std::int32_t& x, std::int32_t& y, std::int32_t& z) noexcept -> bool {
+  const auto x_q16 = static_cast<std::int64_t>(utilities::ToFixedPoint<16>(vector.x));
+  const auto y_q16 = static_cast<std::int64_t>(utilities::ToFixedPoint<16>(vector.y));
+  const auto z_q16 = static_cast<std::int64_t>(utilities::ToFixedPoint<16>(vector.z));
+
+  // Unsigned, because three squares of the full std::int32_t range exceed std::int64_t
+  const auto norm = utilities::SquareRoot(static_cast<std::uint64_t>(x_q16 * x_q16) + static_cast<std::uint64_t>(y_q16 * y_q16) + static_cast<std::uint64_t>(z_q16 * z_q16));
+  if (norm == 0)
+    return false;
+
+  // Every element is at most the norm, so the product with the reciprocal stays below 2^62
+  const auto reciprocal = static_cast<std::int64_t>((static_cast<std::uint64_t>(1) << 62) / norm);
+  x = static_cast<std::int32_t>((x_q16 * reciprocal) >> 32);
+  y = static_cast<std::int32_t>((y_q16 * reciprocal) >> 32);
+  z = static_cast<std::int32_t>((z_q16 * reciprocal) >> 32);
+  return true;
+}
+
+auto MahonyFilterFixedPoint::GetQuaternion(void) noexcept -> types::Quaternion<float> {
+  return types::Quaternion<float>{utilities::ToFloat<30>(quaternion_q30_.w),
+                                  utilities::ToFloat<30>(quaternion_q30_.x),
+                                  utilities::ToFloat<30>(quaternion_q30_.y),
+                                  utilities::ToFloat<30>(quaternion_q30_.z)};
+}
+
+auto MahonyFilterFixedPoint::GetEulerAngles(void) noexcept -> types::EulerAngles {
+  return QuaternionToEulerAngles(GetQuaternion());
+}
+
+auto MahonyFilterFixedPoint::Reset(void) noexcept -> void {
+  aligned_ = false;
+  quaternion_q30_ = types::Quaternion<std::int32_t>{ONE_Q30, 0, 0, 0};
+  integral_feedback_x_q20_ = 0;
+  integral_feedback_y_q20_ = 0;
+  integral_feedback_z_q20_ = 0;
+}
+
+}  // namespace attitude
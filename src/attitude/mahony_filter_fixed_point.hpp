@@ -0,0 +1,61 @@
+#ifndef SRC_ATTITUDE_MAHONY_FILTER_FIXED_POINT_HPP_
+#define SRC_ATTITUDE_MAHONY_FILTER_FIXED_POINT_HPP_
+
+#include <cstdint>
+#include "attitude_estimator_interface.hpp"
+
+namespace attitude {
+
+/**
+ * @brief Mahony complementary filter in fixed point arithmetic, for cores without FPU
+ *        or to keep the FPU context out of the interrupt which feeds the samples.
+ *        The update itself uses 32 bit integers with 64 bit products only, floats are
+ *        converted at the interface.
+ * 
+ *        Quaternion, normalized directions and their errors are Q30, angular rates Q20 in rad/s,
+ *        the sample interval Q30 in seconds and the gains Q16.
+ *        Accelerometer and magnetometer elements have to be within +-32767 in their unit.
+ * 
+ */
+class MahonyFilterFixedPoint final : public AttitudeEstimatorInterface {
+ public:
+  ~MahonyFilterFixedPoint() = default;
+
+  /**
+   * @brief Construct a new fixed point Mahony filter
+   * 
+   * @param proportional_gain Feedback gain of the direction error in rad/s, higher values trust the gyroscope less
+   * @param integral_gain Feedback gain of the integrated direction error, estimates the gyroscope bias. Zero disables it.
+   */
+  explicit MahonyFilterFixedPoint(const float proportional_gain = DEFAULT_PROPORTIONAL_GAIN, const float integral_gain = DEFAULT_INTEGRAL_GAIN);
+
+  auto Update(const types::ImuSample& sample) noexcept -> types::DriverStatus override;
+  auto GetQuaternion(void) noexcept -> types::Quaternion<float> override;
+  auto GetEulerAngles(void) noexcept -> types::EulerAngles override;
+  auto Reset(void) noexcept -> void override;
+
+  static constexpr float DEFAULT_PROPORTIONAL_GAIN = 0.5f;
+  static constexpr float DEFAULT_INTEGRAL_GAIN = 0.0f;
+  static constexpr std::uint32_t MAX_SAMPLE_INTERVAL_IN_US = 100000;
+
+ private:
+  auto Align(const types::ImuSample& sample) noexcept -> types::DriverStatus;
+  auto Integrate(const types::ImuSample& sample, const std::uint32_t sample_interval_in_us) noexcept -> void;
+  auto Normalize(const types::EuclideanVector<float>& vector, std::int32_t& x, std::int32_t& y, std::int32_t& z) noexcept -> bool;
+
+  static constexpr std::int32_t ONE_Q30 = static_cast<std::int32_t>(1) << 30;
+  static constexpr std::int32_t HALF_Q30 = static_cast<std::int32_t>(1) << 29;
+
+  std::int32_t two_proportional_gain_q16_;
+  std::int32_t two_integral_gain_q16_;
+  bool aligned_ = false;
+  std::uint32_t last_timestamp_in_us_ = 0;
+  types::Quaternion<std::int32_t> quaternion_q30_{ONE_Q30, 0, 0, 0};
+  std::int32_t integral_feedback_x_q20_ = 0;
+  std::int32_t integral_feedback_y_q20_ = 0;
+  std::int32_t integral_feedback_z_q20_ = 0;
+};
+
+}  // namespace attitude
+
+#endif
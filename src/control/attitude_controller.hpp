@@ -0,0 +1,141 @@
+#ifndef SRC_CONTROL_ATTITUDE_CONTROLLER_HPP_
+#define SRC_CONTROL_ATTITUDE_CONTROLLER_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include "attitude_types.hpp"
+#include "basic_types.hpp"
+#include "control_types.hpp"
+#include "error_types.hpp"
+#include "pid_controller.hpp"
+#include "pid_controller_fixed_point.hpp"
+
+namespace control {
+
+static constexpr std::uint8_t ROLL_AXIS = 0;
+static constexpr std::uint8_t PITCH_AXIS = 1;
+static constexpr std::uint8_t YAW_AXIS = 2;
+
+/**
+ * @brief Gains of one axis. The angle loop outputs the rate setpoint in rad/s, its output limit
+ *        is the highest rate it commands. The rate loop outputs the torque of the ThrustAndTorque,
+ *        so its output limit must not exceed 1.
+ *
+ */
+struct AxisGains {
+  PidGains angle;
+  PidGains rate;
+};
+
+/// Gains of roll, pitch and yaw
+using AttitudeGains = std::array<AxisGains, 3>;
+
+/**
+ * @brief Cascaded attitude controller: per axis an angle loop commands the rate setpoint of a
+ *        rate loop, which commands the torque for the MotorMixer. Both loops run with every
+ *        sample of the same rate. Angle errors take the short way around, so a yaw setpoint
+ *        of 3 rad turns from -3 rad through +-pi.
+ *
+ * @tparam PID PidController or PidControllerFixedPoint
+ */
+template <typename PID>
+class CascadedAttitudeController {
+ public:
+  CascadedAttitudeController(const AttitudeGains& gains, const std::uint32_t sample_frequency_in_hz) noexcept
+      : angle_{{PID(gains[ROLL_AXIS].angle, sample_frequency_in_hz),
+                PID(gains[PITCH_AXIS].angle, sample_frequency_in_hz),
+                PID(gains[YAW_AXIS].angle, sample_frequency_in_hz)}},
+        rate_{{PID(gains[ROLL_AXIS].rate, sample_frequency_in_hz),
+               PID(gains[PITCH_AXIS].rate, sample_frequency_in_hz),
+               PID(gains[YAW_AXIS].rate, sample_frequency_in_hz)}} {}
+
+  ~CascadedAttitudeController() = default;
+
+  /**
+   * @brief Computes the demand of one sample in angle mode
+   *
+   * @param setpoint Attitude to reach, in rad
+   * @param attitude Estimated attitude, in rad
+   * @param rate Angular rate of the gyroscope, in rad/s around X, Y and Z
+   * @param thrust Collective thrust between 0 and 1, passed to the demand and used for the gain schedules
+   * @return types::DriverStatus INPUT_ERROR on a thrust out of range or a value which is not finite, the demand and the loops are unchanged then
+   */
+  auto Update(const types::EulerAngles& setpoint, const types::EulerAngles& attitude, const types::EuclideanVector<float>& rate, const float thrust, types::ThrustAndTorque& demand) noexcept -> types::DriverStatus {
+    const bool angles_are_valid = IsFinite(setpoint.roll, setpoint.pitch, setpoint.yaw) && IsFinite(attitude.roll, attitude.pitch, attitude.yaw);
+    if (!angles_are_valid || !IsValidRateInput(rate, thrust))
+      return types::DriverStatus::INPUT_ERROR;
+
+    const types::EuclideanVector<float> rate_setpoint(angle_[ROLL_AXIS].Update(GetShortWayTarget(setpoint.roll, attitude.roll), attitude.roll, thrust),
+                                                      angle_[PITCH_AXIS].Update(GetShortWayTarget(setpoint.pitch, attitude.pitch), attitude.pitch, thrust),
+                                                      angle_[YAW_AXIS].Update(GetShortWayTarget(setpoint.yaw, attitude.yaw), attitude.yaw, thrust));
+    return UpdateRate(rate_setpoint, rate, thrust, demand);
+  }
+
+  /**
+   * @brief Computes the demand of one sample in rate mode, the angle loops are bypassed
+   *
+   * @param rate_setpoint Angular rate to reach, in rad/s around X, Y and Z
+   */
+  auto UpdateRate(const types::EuclideanVector<float>& rate_setpoint, const types::EuclideanVector<float>& rate, const float thrust, types::ThrustAndTorque& demand) noexcept -> types::DriverStatus {
+    if (!IsFinite(rate_setpoint.x, rate_setpoint.y, rate_setpoint.z) || !IsValidRateInput(rate, thrust))
+      return types::DriverStatus::INPUT_ERROR;
+
+    rate_setpoint_.x = rate_setpoint.x;
+    rate_setpoint_.y = rate_setpoint.y;
+    rate_setpoint_.z = rate_setpoint.z;
+    demand.thrust = thrust;
+    demand.roll = rate_[ROLL_AXIS].Update(rate_setpoint.x, rate.x, thrust);
+    demand.pitch = rate_[PITCH_AXIS].Update(rate_setpoint.y, rate.y, thrust);
+    demand.yaw = rate_[YAW_AXIS].Update(rate_setpoint.z, rate.z, thrust);
+    return types::DriverStatus::OK;
+  }
+
+  /// Clears all loops, e.g. while the motors are disarmed
+  auto Reset(void) noexcept -> void {
+    for (auto& loop : angle_)
+      loop.Reset();
+    for (auto& loop : rate_)
+      loop.Reset();
+  }
+
+  /// Rate setpoint of the last sample, the output of the angle loops in angle mode
+  auto GetRateSetpoint(void) const noexcept -> const types::EuclideanVector<float>& {
+    return rate_setpoint_;
+  }
+
+ private:
+  static constexpr float PI = 3.14159265358979323846f;
+
+  static auto IsFinite(const float x, const float y, const float z) noexcept -> bool {
+    return std::isfinite(x) && std::isfinite(y) && std::isfinite(z);
+  }
+
+  static auto IsValidRateInput(const types::EuclideanVector<float>& rate, const float thrust) noexcept -> bool {
+    return IsFinite(rate.x, rate.y, rate.z) && thrust >= 0.0f && thrust <= 1.0f;
+  }
+
+  /// Setpoint within pi of the measurement, single additions keep it the same on every build
+  static auto GetShortWayTarget(const float setpoint, const float measurement) noexcept -> float {
+    auto error = setpoint - measurement;
+    if (error > PI)
+      error -= 2.0f * PI;
+    else if (error < -PI)
+      error += 2.0f * PI;
+    return measurement + error;
+  }
+
+  std::array<PID, 3> angle_;
+  std::array<PID, 3> rate_;
+  types::EuclideanVector<float> rate_setpoint_{0.0f, 0.0f, 0.0f};
+};
+
+template <typename PID>
+constexpr float CascadedAttitudeController<PID>::PI;
+
+using AttitudeController = CascadedAttitudeController<PidController>;
+using AttitudeControllerFixedPoint = CascadedAttitudeController<PidControllerFixedPoint>;
+
+}  // namespace control
+
+#endif
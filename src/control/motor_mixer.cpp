@@ -0,0 +1,48 @@
+#include "motor_mixer.hpp"
+#include <algorithm>
+
+namespace control {
+
+auto MotorMixer::Mix(const types::ThrustAndTorque& demand, std::array<float, NUMBER_OF_MOTORS>& throttle_in_percent) const noexcept -> types::DriverStatus {
+  const bool demand_is_valid = IsWithin(demand.thrust, 0.0f, 1.0f) &&
+                               IsWithin(demand.roll, -1.0f, 1.0f) &&
+                               IsWithin(demand.pitch, -1.0f, 1.0f) &&
+                               IsWithin(demand.yaw, -1.0f, 1.0f);
+  if (!demand_is_valid)
+    return types::DriverStatus::INPUT_ERROR;
+
+  float torque[NUMBER_OF_MOTORS] = {
+      mixing_[0].roll * demand.roll + mixing_[0].pitch * demand.pitch + mixing_[0].yaw * demand.yaw,
+      mixing_[1].roll * demand.roll + mixing_[1].pitch * demand.pitch + mixing_[1].yaw * demand.yaw,
+      mixing_[2].roll * demand.roll + mixing_[2].pitch * demand.pitch + mixing_[2].yaw * demand.yaw,
+      mixing_[3].roll * demand.roll + mixing_[3].pitch * demand.pitch + mixing_[3].yaw * demand.yaw};
+
+  if (!airmode_) {
+    for (std::uint8_t motor = 0; motor < NUMBER_OF_MOTORS; motor++)
+      throttle_in_percent[motor] = 100.0f * std::min(std::max(demand.thrust + torque[motor], 0.0f), 1.0f);
+    return types::DriverStatus::OK;
+  }
+
+  const auto lowest = std::min(std::min(torque[0], torque[1]), std::min(torque[2], torque[3]));
+  const auto highest = std::max(std::max(torque[0], torque[1]), std::max(torque[2], torque[3]));
+  const auto span = highest - lowest;
+
+  // Torques spanning more than the motor range are scaled to fill it, which leaves a single thrust
+  float thrust = std::min(std::max(demand.thrust, -lowest), 1.0f - highest);
+  if (span > 1.0f) {
+    const auto scale = 1.0f / span;
+    for (std::uint8_t motor = 0; motor < NUMBER_OF_MOTORS; motor++)
+      torque[motor] *= scale;
+    thrust = -lowest * scale;
+  }
+
+  for (std::uint8_t motor = 0; motor < NUMBER_OF_MOTORS; motor++)
+    throttle_in_percent[motor] = 100.0f * std::min(std::max(thrust + torque[motor], 0.0f), 1.0f);
+  return types::DriverStatus::OK;
+}
+
+auto MotorMixer::IsWithin(const float value, const float lower_limit, const float upper_limit) noexcept -> bool {
+  return value >= lower_limit && value <= upper_limit;
+}
+
+}  // namespace control
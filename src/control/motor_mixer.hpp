@@ -0,0 +1,92 @@
+#ifndef SRC_CONTROL_MOTOR_MIXER_HPP_
+#define SRC_CONTROL_MOTOR_MIXER_HPP_
+
+#include <array>
+#include <cstdint>
+#include "control_types.hpp"
+#include "error_types.hpp"
+
+namespace control {
+
+static constexpr std::uint8_t NUMBER_OF_MOTORS = 4;
+
+/**
+ * @brief Share of roll, pitch and yaw torque of one motor
+ * 
+ */
+struct MixerRow {
+  float roll;
+  float pitch;
+  float yaw;
+};
+
+using MixingMatrix = std::array<MixerRow, NUMBER_OF_MOTORS>;
+
+/**
+ * @brief Quad in X configuration, motors clockwise from front left. Front left and rear
+ *        right spin clockwise, front right and rear left counter clockwise.
+ * 
+ */
+static constexpr MixingMatrix QUAD_X_MIXING{{{1.0f, 1.0f, -1.0f},
+                                             {-1.0f, 1.0f, 1.0f},
+                                             {-1.0f, -1.0f, -1.0f},
+                                             {1.0f, -1.0f, 1.0f}}};
+
+/**
+ * @brief Quad in + configuration, motors clockwise from front. Front and rear
+ *        spin clockwise, right and left counter clockwise.
+ * 
+ */
+static constexpr MixingMatrix QUAD_PLUS_MIXING{{{0.0f, 1.0f, -1.0f},
+                                                {-1.0f, 0.0f, 1.0f},
+                                                {0.0f, -1.0f, -1.0f},
+                                                {1.0f, 0.0f, 1.0f}}};
+
+/**
+ * @brief Maps thrust and torque demand to the throttles of four motors.
+ *        The fixed size mix is written out per motor, it needs 12 multiply accumulates.
+ *        With airmode the thrust is shifted, so that the torques fit into the motor range
+ *        even at zero or full thrust. Torques which span more than the whole range are scaled
+ *        down together, which keeps the direction of the demanded rotation.
+ *        Without airmode every motor is clipped on its own.
+ * 
+ */
+class MotorMixer {
+ public:
+  /**
+   * @brief Construct a new motor mixer
+   * 
+   * @param mixing Share of the torques per motor, e.g. QUAD_X_MIXING
+   * @param airmode Keeps attitude authority at zero and full thrust
+   */
+  explicit MotorMixer(const MixingMatrix& mixing = QUAD_X_MIXING, const bool airmode = true) noexcept : mixing_(mixing), airmode_(airmode) {}
+
+  ~MotorMixer() = default;
+
+  /**
+   * @brief Computes the throttles of one control loop tick
+   * 
+   * @param demand Thrust between 0 and 1, torques between -1 and 1
+   * @param throttle_in_percent Throttle of every motor between 0 and 100, e.g. for MotorGroupOutput::SetThrottle()
+   * @return types::DriverStatus INPUT_ERROR if the demand is out of range, the throttles are unchanged then
+   */
+  auto Mix(const types::ThrustAndTorque& demand, std::array<float, NUMBER_OF_MOTORS>& throttle_in_percent) const noexcept -> types::DriverStatus;
+
+  auto SetAirmode(const bool airmode) noexcept -> void {
+    airmode_ = airmode;
+  }
+
+  auto IsAirmode(void) const noexcept -> bool {
+    return airmode_;
+  }
+
+ private:
+  static auto IsWithin(const float value, const float lower_limit, const float upper_limit) noexcept -> bool;
+
+  MixingMatrix mixing_;
+  bool airmode_;
+};
+
+}  // namespace control
+
+#endif
@@ -0,0 +1,61 @@
+#include "pid_controller.hpp"
+#include <algorithm>
+
+namespace control {
+
+namespace {
+
+constexpr float TWO_PI = 6.28318530717958647692f;
+
+}  // namespace
+
+PidController::PidController(const PidGains& gains, const std::uint32_t sample_frequency_in_hz) noexcept
+    : gains_(gains),
+      integral_per_sample_(gains.integral / static_cast<float>(sample_frequency_in_hz)),
+      derivative_per_sample_(gains.derivative * static_cast<float>(sample_frequency_in_hz)),
+      derivative_smoothing_(1.0f) {
+  // Backward Euler low-pass, the same the fixed point controller uses
+  if (gains.derivative_cutoff_in_hz > 0.0f) {
+    const auto cutoff_in_rad_per_s = TWO_PI * gains.derivative_cutoff_in_hz;
+    derivative_smoothing_ = cutoff_in_rad_per_s / (cutoff_in_rad_per_s + static_cast<float>(sample_frequency_in_hz));
+  }
+}
+
+auto PidController::Update(const float setpoint, const float measurement, const float thrust) noexcept -> float {
+  const auto error = setpoint - measurement;
+  const auto factor = GetScheduleFactor(thrust);
+
+  if (!has_measurement_) {
+    last_measurement_ = measurement;
+    has_measurement_ = true;
+  }
+
+  if (!(is_saturated_high_ && error > 0.0f) && !(is_saturated_low_ && error < 0.0f))
+    integral_ = std::min(std::max(integral_ + integral_per_sample_ * error, -gains_.integral_limit), gains_.integral_limit);
+
+  const auto raw_derivative = -derivative_per_sample_ * (measurement - last_measurement_);
+  derivative_ += derivative_smoothing_ * (raw_derivative - derivative_);
+  last_measurement_ = measurement;
+
+  const auto output = factor * (gains_.proportional * error + derivative_) + integral_ + gains_.feed_forward * setpoint;
+  is_saturated_high_ = output > gains_.output_limit;
+  is_saturated_low_ = output < -gains_.output_limit;
+  return std::min(std::max(output, -gains_.output_limit), gains_.output_limit);
+}
+
+auto PidController::Reset(void) noexcept -> void {
+  integral_ = 0.0f;
+  derivative_ = 0.0f;
+  has_measurement_ = false;
+  is_saturated_high_ = false;
+  is_saturated_low_ = false;
+}
+
+auto PidController::GetScheduleFactor(const float thrust) const noexcept -> float {
+  const auto position = std::min(std::max(thrust, 0.0f), 1.0f) * static_cast<float>(GAIN_SCHEDULE_POINTS - 1);
+  const auto index = std::min(static_cast<std::uint8_t>(position), static_cast<std::uint8_t>(GAIN_SCHEDULE_POINTS - 2));
+  const auto fraction = position - static_cast<float>(index);
+  return gains_.schedule[index] + fraction * (gains_.schedule[index + 1] - gains_.schedule[index]);
+}
+
+}  // namespace control
@@ -0,0 +1,85 @@
+#ifndef SRC_CONTROL_PID_CONTROLLER_HPP_
+#define SRC_CONTROL_PID_CONTROLLER_HPP_
+
+#include <array>
+#include <cstdint>
+
+namespace control {
+
+static constexpr std::uint8_t GAIN_SCHEDULE_POINTS = 5;
+
+/**
+ * @brief Factor on the proportional and derivative gain at the thrusts 0, 0.25, 0.5, 0.75 and 1,
+ *        linear in between. Factors below 1 at high thrust take back the gains where the motors
+ *        have more authority.
+ *
+ */
+using GainSchedule = std::array<float, GAIN_SCHEDULE_POINTS>;
+
+static constexpr GainSchedule FLAT_GAIN_SCHEDULE{{1.0f, 1.0f, 1.0f, 1.0f, 1.0f}};
+
+/**
+ * @brief Gains of a PID loop, the output is in the unit its limit is given in
+ *
+ */
+struct PidGains {
+  float proportional;
+  /// Per second of the error
+  float integral;
+  /// In seconds, acts on the change of the measurement only, so setpoint steps do not kick
+  float derivative;
+  /// Share of the setpoint which goes to the output directly
+  float feed_forward;
+  /// Cut-off frequency of the first order low-pass on the derivative term, 0 disables the low-pass
+  float derivative_cutoff_in_hz;
+  /// Largest magnitude of the integral term
+  float integral_limit;
+  /// Largest magnitude of the output
+  float output_limit;
+  GainSchedule schedule;
+};
+
+/**
+ * @brief PID loop for a fixed sample rate in single precision.
+ *        Anti-windup is conditional integration: while the output is saturated, errors which
+ *        would drive it further into saturation are not integrated. The integral term is
+ *        clamped to its own limit in addition.
+ *
+ */
+class PidController {
+ public:
+  PidController(const PidGains& gains, const std::uint32_t sample_frequency_in_hz) noexcept;
+  ~PidController() = default;
+
+  /**
+   * @brief Computes the output of one sample
+   *
+   * @param thrust Collective thrust between 0 and 1, selects the point of the gain schedule
+   */
+  auto Update(const float setpoint, const float measurement, const float thrust) noexcept -> float;
+
+  /// Clears integral and derivative, the next sample starts the loop like the first one
+  auto Reset(void) noexcept -> void;
+
+  auto GetIntegral(void) const noexcept -> float {
+    return integral_;
+  }
+
+ private:
+  auto GetScheduleFactor(const float thrust) const noexcept -> float;
+
+  PidGains gains_;
+  float integral_per_sample_;
+  float derivative_per_sample_;
+  float derivative_smoothing_;
+  float integral_ = 0.0f;
+  float derivative_ = 0.0f;
+  float last_measurement_ = 0.0f;
+  bool has_measurement_ = false;
+  bool is_saturated_high_ = false;
+  bool is_saturated_low_ = false;
+};
+
+}  // namespace control
+
+#endif
@@ -0,0 +1,95 @@
+#include "pid_controller_fixed_point.hpp"
+#include <algorithm>
+#include "fixed_point.hpp"
+
+namespace control {
+
+namespace {
+
+constexpr std::int32_t ONE_Q16 = static_cast<std::int32_t>(1) << 16;
+constexpr std::int32_t TWO_PI_Q28 = utilities::ToFixedPoint<28>(6.28318530717958647692f);
+
+/// Product of two fixed point numbers like utilities::MultiplyFixedPoint(), saturated instead of wrapped
+template <int SHIFT>
+auto MultiplySaturated(const std::int32_t first_factor, const std::int32_t second_factor) noexcept -> std::int32_t {
+  const auto product = static_cast<std::int64_t>(first_factor) * second_factor;
+  return utilities::SaturateToInt32((product + (static_cast<std::int64_t>(1) << (SHIFT - 1))) >> SHIFT);
+}
+
+auto Clamp(const std::int64_t value, const std::int64_t limit) noexcept -> std::int64_t {
+  return std::min(std::max(value, -limit), limit);
+}
+
+}  // namespace
+
+constexpr int PidControllerFixedPoint::INTEGRAL_SHIFT;
+
+PidControllerFixedPoint::PidControllerFixedPoint(const PidGains& gains, const std::uint32_t sample_frequency_in_hz) noexcept
+    : proportional_q16_(utilities::ToFixedPoint<16>(gains.proportional)),
+      integral_per_sample_q30_(utilities::SaturateToInt32((static_cast<std::int64_t>(utilities::ToFixedPoint<16>(gains.integral)) << (INTEGRAL_SHIFT - 16)) / sample_frequency_in_hz)),
+      derivative_per_sample_q16_(utilities::SaturateToInt32((static_cast<std::int64_t>(utilities::ToFixedPoint<24>(gains.derivative)) * sample_frequency_in_hz) >> 8)),
+      feed_forward_q16_(utilities::ToFixedPoint<16>(gains.feed_forward)),
+      derivative_smoothing_q16_(ONE_Q16),
+      integral_limit_q46_(static_cast<std::int64_t>(utilities::ToFixedPoint<16>(gains.integral_limit)) << INTEGRAL_SHIFT),
+      output_limit_q16_(utilities::ToFixedPoint<16>(gains.output_limit)),
+      schedule_q16_() {
+  for (std::uint8_t point = 0; point < GAIN_SCHEDULE_POINTS; point++)
+    schedule_q16_[point] = utilities::ToFixedPoint<16>(gains.schedule[point]);
+
+  const auto cutoff_q16 = utilities::ToFixedPoint<16>(gains.derivative_cutoff_in_hz);
+  if (cutoff_q16 > 0) {
+    const std::int64_t cutoff_in_rad_per_s_q16 = MultiplySaturated<28>(cutoff_q16, TWO_PI_Q28);
+    derivative_smoothing_q16_ = static_cast<std::int32_t>((cutoff_in_rad_per_s_q16 << 16) / (cutoff_in_rad_per_s_q16 + (static_cast<std::int64_t>(sample_frequency_in_hz) << 16)));
+  }
+}
+
+auto PidControllerFixedPoint::Update(const float setpoint, const float measurement, const float thrust) noexcept -> float {
+  return utilities::ToFloat<16>(UpdateFixedPoint(utilities::ToFixedPoint<16>(setpoint), utilities::ToFixedPoint<16>(measurement), utilities::ToFixedPoint<16>(thrust)));
+}
+
+auto PidControllerFixedPoint::UpdateFixedPoint(const std::int32_t setpoint_q16, const std::int32_t measurement_q16, const std::int32_t thrust_q16) noexcept -> std::int32_t {
+  const auto error_q16 = utilities::SaturateToInt32(static_cast<std::int64_t>(setpoint_q16) - measurement_q16);
+  const auto factor_q16 = GetScheduleFactor(thrust_q16);
+
+  if (!has_measurement_) {
+    last_measurement_q16_ = measurement_q16;
+    has_measurement_ = true;
+  }
+
+  if (!(is_saturated_high_ && error_q16 > 0) && !(is_saturated_low_ && error_q16 < 0))
+    integral_q46_ = Clamp(integral_q46_ + static_cast<std::int64_t>(error_q16) * integral_per_sample_q30_, integral_limit_q46_);
+
+  const auto change_q16 = utilities::SaturateToInt32(static_cast<std::int64_t>(measurement_q16) - last_measurement_q16_);
+  const auto raw_derivative_q16 = utilities::SaturateToInt32(-static_cast<std::int64_t>(MultiplySaturated<16>(derivative_per_sample_q16_, change_q16)));
+  derivative_q16_ = utilities::SaturateToInt32(derivative_q16_ + static_cast<std::int64_t>(MultiplySaturated<16>(derivative_smoothing_q16_, utilities::SaturateToInt32(static_cast<std::int64_t>(raw_derivative_q16) - derivative_q16_))));
+  last_measurement_q16_ = measurement_q16;
+
+  const auto integral_q16 = static_cast<std::int32_t>((integral_q46_ + (static_cast<std::int64_t>(1) << (INTEGRAL_SHIFT - 1))) >> INTEGRAL_SHIFT);
+  const auto proportional_and_derivative_q16 = utilities::SaturateToInt32(static_cast<std::int64_t>(MultiplySaturated<16>(proportional_q16_, error_q16)) + derivative_q16_);
+  const auto output_q16 = static_cast<std::int64_t>(MultiplySaturated<16>(factor_q16, proportional_and_derivative_q16)) + integral_q16 + MultiplySaturated<16>(feed_forward_q16_, setpoint_q16);
+
+  is_saturated_high_ = output_q16 > output_limit_q16_;
+  is_saturated_low_ = output_q16 < -static_cast<std::int64_t>(output_limit_q16_);
+  return static_cast<std::int32_t>(Clamp(output_q16, output_limit_q16_));
+}
+
+auto PidControllerFixedPoint::Reset(void) noexcept -> void {
+  integral_q46_ = 0;
+  derivative_q16_ = 0;
+  has_measurement_ = false;
+  is_saturated_high_ = false;
+  is_saturated_low_ = false;
+}
+
+auto PidControllerFixedPoint::GetIntegral(void) const noexcept -> float {
+  return utilities::ToFloat<16>(static_cast<std::int32_t>((integral_q46_ + (static_cast<std::int64_t>(1) << (INTEGRAL_SHIFT - 1))) >> INTEGRAL_SHIFT));
+}
+
+auto PidControllerFixedPoint::GetScheduleFactor(const std::int32_t thrust_q16) const noexcept -> std::int32_t {
+  const auto position_q16 = std::min(std::max(thrust_q16, 0), ONE_Q16) * (GAIN_SCHEDULE_POINTS - 1);
+  const auto index = std::min(position_q16 >> 16, GAIN_SCHEDULE_POINTS - 2);
+  const auto fraction_q16 = position_q16 - (index << 16);
+  return schedule_q16_[index] + MultiplySaturated<16>(fraction_q16, schedule_q16_[index + 1] - schedule_q16_[index]);
+}
+
+}  // namespace control
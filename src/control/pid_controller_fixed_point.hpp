@@ -0,0 +1,59 @@
+#ifndef SRC_CONTROL_PID_CONTROLLER_FIXED_POINT_HPP_
+#define SRC_CONTROL_PID_CONTROLLER_FIXED_POINT_HPP_
+
+#include <array>
+#include <cstdint>
+#include "pid_controller.hpp"
+
+namespace control {
+
+/**
+ * @brief PID loop of the PidController in fixed point arithmetic. The update uses 32 bit integers
+ *        with 64 bit products only, so the target and the host compute the same bits.
+ *        The gains are converted once in the constructor, every float is rounded to fixed point
+ *        on its own and everything derived from it is computed in integers, which keeps even
+ *        the conversion independent of how the compiler contracts float operations.
+ *
+ *        Setpoint, measurement, output, limits, thrust, the proportional and feed forward gain
+ *        and the schedule are Q16. The integral gain per sample is Q30 and the integral is
+ *        accumulated in Q46, so even small errors at high sample rates add up.
+ *
+ */
+class PidControllerFixedPoint {
+ public:
+  PidControllerFixedPoint(const PidGains& gains, const std::uint32_t sample_frequency_in_hz) noexcept;
+  ~PidControllerFixedPoint() = default;
+
+  /// Converts at the interface, see PidController::Update()
+  auto Update(const float setpoint, const float measurement, const float thrust) noexcept -> float;
+
+  auto UpdateFixedPoint(const std::int32_t setpoint_q16, const std::int32_t measurement_q16, const std::int32_t thrust_q16) noexcept -> std::int32_t;
+
+  auto Reset(void) noexcept -> void;
+
+  auto GetIntegral(void) const noexcept -> float;
+
+ private:
+  auto GetScheduleFactor(const std::int32_t thrust_q16) const noexcept -> std::int32_t;
+
+  static constexpr int INTEGRAL_SHIFT = 30;
+
+  std::int32_t proportional_q16_;
+  std::int32_t integral_per_sample_q30_;
+  std::int32_t derivative_per_sample_q16_;
+  std::int32_t feed_forward_q16_;
+  std::int32_t derivative_smoothing_q16_;
+  std::int64_t integral_limit_q46_;
+  std::int32_t output_limit_q16_;
+  std::array<std::int32_t, GAIN_SCHEDULE_POINTS> schedule_q16_;
+  std::int64_t integral_q46_ = 0;
+  std::int32_t derivative_q16_ = 0;
+  std::int32_t last_measurement_q16_ = 0;
+  bool has_measurement_ = false;
+  bool is_saturated_high_ = false;
+  bool is_saturated_low_ = false;
+};
+
+}  // namespace control
+
+#endif
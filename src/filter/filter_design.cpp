@@ -0,0 +1,103 @@
+#include "filter_design.hpp"
+#include <cmath>
+
+namespace filter {
+
+namespace {
+
+constexpr float PI = 3.14159265358979f;
+constexpr float Q15 = 32768.0f;
+constexpr float BUTTERWORTH_QUALITY = 0.70710678f;
+
+auto AreFrequenciesValid(const float cutoff_frequency_in_hz, const float sample_frequency_in_hz) noexcept -> bool {
+  return sample_frequency_in_hz > 0.0f && cutoff_frequency_in_hz > 0.0f && cutoff_frequency_in_hz < 0.5f * sample_frequency_in_hz;
+}
+
+auto Quantize(const float value, const std::uint8_t gain_shift) noexcept -> std::int16_t {
+  return static_cast<std::int16_t>(std::lround(value * Q15 / static_cast<float>(1 << gain_shift)));
+}
+
+/// Smallest shift which brings every coefficient into the range of q1.15 after rounding
+auto GainShift(const float* values, const std::uint8_t length, std::uint8_t& gain_shift) noexcept -> types::DriverStatus {
+  float largest = 0.0f;
+  for (std::uint8_t index = 0; index < length; index++)
+    largest = std::fmax(largest, std::fabs(values[index]));
+
+  for (gain_shift = 0; gain_shift <= MAX_GAIN_SHIFT; gain_shift++)
+    if (largest * Q15 / static_cast<float>(1 << gain_shift) < 32767.5f)
+      return types::DriverStatus::OK;
+
+  return types::DriverStatus::INPUT_ERROR;
+}
+
+}  // namespace
+
+auto DesignLowPassBiquad(float cutoff_frequency_in_hz, float sample_frequency_in_hz, FilterCoefficients& coefficients) noexcept -> types::DriverStatus {
+  if (!AreFrequenciesValid(cutoff_frequency_in_hz, sample_frequency_in_hz))
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto omega = 2.0f * PI * cutoff_frequency_in_hz / sample_frequency_in_hz;
+  const auto cosine = std::cos(omega);
+  const auto alpha = std::sin(omega) / (2.0f * BUTTERWORTH_QUALITY);
+  const auto normalization = 1.0f / (1.0f + alpha);
+
+  // b0, b1, b2 and the feedback a1, a2 with the sign the FMAC adds them with
+  const float values[5] = {
+      0.5f * (1.0f - cosine) * normalization,
+      (1.0f - cosine) * normalization,
+      0.5f * (1.0f - cosine) * normalization,
+      2.0f * cosine * normalization,
+      -(1.0f - alpha) * normalization};
+
+  std::uint8_t gain_shift = 0;
+  if (GainShift(values, 5, gain_shift) != types::DriverStatus::OK)
+    return types::DriverStatus::INPUT_ERROR;
+
+  coefficients = FilterCoefficients{};
+  coefficients.structure = FilterStructure::IIR_DIRECT_FORM_1;
+  coefficients.feedforward_taps = 3;
+  coefficients.feedback_taps = 2;
+  coefficients.gain_shift = gain_shift;
+  for (std::uint8_t index = 0; index < 3; index++)
+    coefficients.feedforward[index] = Quantize(values[index], gain_shift);
+  for (std::uint8_t index = 0; index < 2; index++)
+    coefficients.feedback[index] = Quantize(values[3 + index], gain_shift);
+
+  return types::DriverStatus::OK;
+}
+
+auto DesignLowPassFir(float cutoff_frequency_in_hz, float sample_frequency_in_hz, std::uint8_t taps, FilterCoefficients& coefficients) noexcept -> types::DriverStatus {
+  if (!AreFrequenciesValid(cutoff_frequency_in_hz, sample_frequency_in_hz) || taps == 0 || taps > MAX_FEEDFORWARD_TAPS)
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto normalized_cutoff = cutoff_frequency_in_hz / sample_frequency_in_hz;
+  const auto center = 0.5f * static_cast<float>(taps - 1);
+
+  float values[MAX_FEEDFORWARD_TAPS];
+  float sum = 0.0f;
+  for (std::uint8_t tap = 0; tap < taps; tap++) {
+    const auto offset = static_cast<float>(tap) - center;
+    const auto sinc = (offset == 0.0f) ? 2.0f * normalized_cutoff : std::sin(2.0f * PI * normalized_cutoff * offset) / (PI * offset);
+    const auto window = (taps == 1) ? 1.0f : 0.54f - 0.46f * std::cos(2.0f * PI * static_cast<float>(tap) / static_cast<float>(taps - 1));
+    values[tap] = sinc * window;
+    sum += values[tap];
+  }
+
+  for (std::uint8_t tap = 0; tap < taps; tap++)
+    values[tap] /= sum;
+
+  std::uint8_t gain_shift = 0;
+  if (GainShift(values, taps, gain_shift) != types::DriverStatus::OK)
+    return types::DriverStatus::INPUT_ERROR;
+
+  coefficients = FilterCoefficients{};
+  coefficients.structure = FilterStructure::FIR;
+  coefficients.feedforward_taps = taps;
+  coefficients.gain_shift = gain_shift;
+  for (std::uint8_t tap = 0; tap < taps; tap++)
+    coefficients.feedforward[tap] = Quantize(values[tap], gain_shift);
+
+  return types::DriverStatus::OK;
+}
+
+}  // namespace filter
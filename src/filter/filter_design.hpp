@@ -0,0 +1,33 @@
+#ifndef SRC_FILTER_FILTER_DESIGN_HPP_
+#define SRC_FILTER_FILTER_DESIGN_HPP_
+
+#include "error_types.hpp"
+#include "filter_types.hpp"
+
+namespace filter {
+
+/**
+ * @brief Designs a second order Butterworth low pass as IIR biquad in direct form 1.
+ *        The coefficients are quantized to q1.15 with the smallest gain shift they fit into.
+ * 
+ * @param cutoff_frequency_in_hz -3 dB frequency, has to be below half of the sample frequency
+ * @param sample_frequency_in_hz Rate of the filtered stream
+ * @param coefficients Designed filter
+ * @return types::DriverStatus INPUT_ERROR if the frequencies are out of range
+ */
+auto DesignLowPassBiquad(float cutoff_frequency_in_hz, float sample_frequency_in_hz, FilterCoefficients& coefficients) noexcept -> types::DriverStatus;
+
+/**
+ * @brief Designs a linear phase FIR low pass as Hamming windowed sinc with unity gain at DC
+ * 
+ * @param cutoff_frequency_in_hz -6 dB frequency, has to be below half of the sample frequency
+ * @param sample_frequency_in_hz Rate of the filtered stream
+ * @param taps Amount of coefficients, at most MAX_FEEDFORWARD_TAPS
+ * @param coefficients Designed filter
+ * @return types::DriverStatus INPUT_ERROR if the frequencies or the amount of taps are out of range
+ */
+auto DesignLowPassFir(float cutoff_frequency_in_hz, float sample_frequency_in_hz, std::uint8_t taps, FilterCoefficients& coefficients) noexcept -> types::DriverStatus;
+
+}  // namespace filter
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef SRC_FILTER_FILTER_ENGINE_INTERFACE_HPP_
+#define SRC_FILTER_FILTER_ENGINE_INTERFACE_HPP_
+
+#include "error_types.hpp"
+#include "filter_types.hpp"
+
+namespace filter {
+
+/**
+ * @brief Interface of an engine which runs blocks of one q1.15 stream through a FIR or IIR filter.
+ *        The engine itself is stateless, the history of every stream is passed in, so one
+ *        engine serves any number of streams one after another.
+ * 
+ */
+class FilterEngineInterface {
+ public:
+  virtual ~FilterEngineInterface() = default;
+
+  /**
+   * @brief Filters one block of samples and advances the history of the stream
+   * 
+   * @param coefficients Filter in the layout of the FMAC
+   * @param state History of the stream, updated for the next block
+   * @param input Samples in q1.15
+   * @param output Filtered samples in q1.15, saturated
+   * @param length Amount of samples, at most MAX_FILTER_BLOCK_LENGTH
+   * @return types::DriverStatus INPUT_ERROR for invalid coefficients, missing buffers or a too long block
+   */
+  virtual auto Filter(const FilterCoefficients& coefficients, FilterState& state, const std::int16_t* input, std::int16_t* output, std::uint16_t length) noexcept -> types::DriverStatus = 0;
+
+  static constexpr std::uint16_t MAX_FILTER_BLOCK_LENGTH = 64;
+};
+
+}  // namespace filter
+
+#endif
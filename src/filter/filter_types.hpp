@@ -0,0 +1,84 @@
+#ifndef SRC_FILTER_FILTER_TYPES_HPP_
+#define SRC_FILTER_FILTER_TYPES_HPP_
+
+#include <array>
+#include <cstdint>
+
+namespace filter {
+
+static constexpr std::uint8_t MAX_FEEDFORWARD_TAPS = 16;
+static constexpr std::uint8_t MAX_FEEDBACK_TAPS = 8;
+static constexpr std::uint8_t MAX_GAIN_SHIFT = 7;
+
+enum class FilterStructure : int {
+  FIR,
+  IIR_DIRECT_FORM_1
+};
+
+/**
+ * @brief Coefficients of a FIR or IIR filter in q1.15, laid out as the FMAC uses them:
+ *        y[n] = 2^gain_shift * (sum b[k] * x[n-k] + sum a[k] * y[n-1-k])
+ *        The feedback coefficients have the opposite sign of the usual denominator notation.
+ * 
+ */
+struct FilterCoefficients {
+  FilterStructure structure = FilterStructure::FIR;
+
+  /// b[0] to b[feedforward_taps-1]
+  std::array<std::int16_t, MAX_FEEDFORWARD_TAPS> feedforward{};
+  std::uint8_t feedforward_taps = 0;
+
+  /// a[0] to a[feedback_taps-1], weighting y[n-1] to y[n-feedback_taps]
+  std::array<std::int16_t, MAX_FEEDBACK_TAPS> feedback{};
+  std::uint8_t feedback_taps = 0;
+
+  /// Left shift of the sum, so coefficients with a magnitude up to 2^gain_shift fit into q1.15
+  std::uint8_t gain_shift = 0;
+};
+
+/**
+ * @brief History of one filtered stream between two blocks, oldest sample first
+ * 
+ */
+struct FilterState {
+  std::array<std::int16_t, MAX_FEEDFORWARD_TAPS - 1> inputs{};
+  std::array<std::int16_t, MAX_FEEDBACK_TAPS> outputs{};
+};
+
+/**
+ * @brief Checks the limits of the FMAC: an IIR needs at least two feedforward taps
+ *        and fewer feedback than feedforward taps, a FIR has no feedback
+ */
+inline auto AreCoefficientsValid(const FilterCoefficients& coefficients) noexcept -> bool {
+  if (coefficients.feedforward_taps == 0 || coefficients.feedforward_taps > MAX_FEEDFORWARD_TAPS ||
+      coefficients.feedback_taps > MAX_FEEDBACK_TAPS || coefficients.gain_shift > MAX_GAIN_SHIFT)
+    return false;
+
+  if (coefficients.structure == FilterStructure::FIR)
+    return coefficients.feedback_taps == 0;
+
+  return coefficients.feedforward_taps >= 2 && coefficients.feedback_taps >= 1 &&
+         coefficients.feedback_taps < coefficients.feedforward_taps;
+}
+
+/**
+ * @brief Moves a block of inputs and outputs into the history for the next block
+ */
+inline auto AdvanceState(const FilterCoefficients& coefficients, FilterState& state, const std::int16_t* input, const std::int16_t* output, const std::uint16_t length) noexcept -> void {
+  const std::uint16_t input_history = static_cast<std::uint16_t>(coefficients.feedforward_taps - 1);
+  const std::uint16_t output_history = coefficients.feedback_taps;
+
+  for (std::uint16_t index = 0; index < input_history; index++) {
+    const auto age = input_history - index;
+    state.inputs[index] = (age <= length) ? input[length - age] : state.inputs[index + length];
+  }
+
+  for (std::uint16_t index = 0; index < output_history; index++) {
+    const auto age = output_history - index;
+    state.outputs[index] = (age <= length) ? output[length - age] : state.outputs[index + length];
+  }
+}
+
+}  // namespace filter
+
+#endif
@@ -0,0 +1,105 @@
+#include "fmac_filter_engine.hpp"
+
+namespace filter {
+
+constexpr std::uint32_t FmacFilterEngine::FMAC_TIMEOUT_IN_MS;
+constexpr std::uint8_t FmacFilterEngine::BUFFER_HEADROOM;
+
+auto FmacFilterEngine::Filter(const FilterCoefficients& coefficients, FilterState& state, const std::int16_t* input, std::int16_t* output, std::uint16_t length) noexcept -> types::DriverStatus {
+  if (input == nullptr || output == nullptr || length > MAX_FILTER_BLOCK_LENGTH || !AreCoefficientsValid(coefficients))
+    return types::DriverStatus::INPUT_ERROR;
+
+  if (length == 0)
+    return types::DriverStatus::OK;
+
+  auto fmac_status = Configure(coefficients);
+  if (fmac_status != types::DriverStatus::OK)
+    return fmac_status;
+
+  const auto input_history = static_cast<std::uint8_t>(coefficients.feedforward_taps - 1);
+  const auto output_history = coefficients.feedback_taps;
+
+  for (std::uint8_t index = 0; index < input_history; index++)
+    preload_inputs_[index] = state.inputs[index];
+  for (std::uint8_t index = 0; index < output_history; index++)
+    preload_outputs_[index] = state.outputs[index];
+  for (std::uint16_t index = 0; index < length; index++)
+    input_[index] = input[index];
+
+  fmac_status = GetFmacStatus(HAL_FMAC_FilterPreload(&hfmac, input_history > 0 ? preload_inputs_.data() : nullptr, input_history,
+                                                     output_history > 0 ? preload_outputs_.data() : nullptr, output_history));
+  if (fmac_status != types::DriverStatus::OK)
+    return fmac_status;
+
+  std::uint16_t output_size = length;
+  fmac_status = GetFmacStatus(HAL_FMAC_FilterStart(&hfmac, output, &output_size));
+  if (fmac_status != types::DriverStatus::OK)
+    return fmac_status;
+
+  std::uint16_t input_size = length;
+  fmac_status = GetFmacStatus(HAL_FMAC_AppendFilterData(&hfmac, input_.data(), &input_size));
+  if (fmac_status == types::DriverStatus::OK)
+    fmac_status = GetFmacStatus(HAL_FMAC_PollFilterData(&hfmac, FMAC_TIMEOUT_IN_MS));
+
+  // The FMAC has to be stopped even after a failed block, otherwise the next configuration is refused
+  const auto stop_status = GetFmacStatus(HAL_FMAC_FilterStop(&hfmac));
+  if (fmac_status != types::DriverStatus::OK)
+    return fmac_status;
+  if (stop_status != types::DriverStatus::OK)
+    return stop_status;
+
+  AdvanceState(coefficients, state, input, output, length);
+  return types::DriverStatus::OK;
+}
+
+auto FmacFilterEngine::Configure(const FilterCoefficients& coefficients) noexcept -> types::DriverStatus {
+  const auto is_iir = coefficients.structure == FilterStructure::IIR_DIRECT_FORM_1;
+  const auto feedforward_taps = coefficients.feedforward_taps;
+  const auto feedback_taps = coefficients.feedback_taps;
+
+  for (std::uint8_t index = 0; index < feedforward_taps; index++)
+    feedforward_[index] = coefficients.feedforward[index];
+  for (std::uint8_t index = 0; index < feedback_taps; index++)
+    feedback_[index] = coefficients.feedback[index];
+
+  // Memory of the FMAC: coefficients, then the input buffer, then the output buffer
+  const auto coefficient_size = static_cast<std::uint8_t>(feedforward_taps + feedback_taps);
+  const auto input_size = static_cast<std::uint8_t>(feedforward_taps + BUFFER_HEADROOM);
+  const auto output_size = static_cast<std::uint8_t>((is_iir ? feedback_taps : 1) + BUFFER_HEADROOM);
+
+  FMAC_FilterConfigTypeDef configuration;
+  configuration.CoeffBaseAddress = 0;
+  configuration.CoeffBufferSize = coefficient_size;
+  configuration.InputBaseAddress = coefficient_size;
+  configuration.InputBufferSize = input_size;
+  configuration.InputThreshold = FMAC_THRESHOLD_1;
+  configuration.OutputBaseAddress = static_cast<std::uint8_t>(coefficient_size + input_size);
+  configuration.OutputBufferSize = output_size;
+  configuration.OutputThreshold = FMAC_THRESHOLD_1;
+  configuration.pCoeffB = feedforward_.data();
+  configuration.CoeffBSize = feedforward_taps;
+  configuration.pCoeffA = is_iir ? feedback_.data() : nullptr;
+  configuration.CoeffASize = is_iir ? feedback_taps : 0;
+  configuration.InputAccess = FMAC_BUFFER_ACCESS_POLLING;
+  configuration.OutputAccess = FMAC_BUFFER_ACCESS_POLLING;
+  configuration.Clip = FMAC_CLIP_ENABLED;
+  configuration.Filter = is_iir ? FMAC_FUNC_IIR_DIRECT_FORM_1 : FMAC_FUNC_CONVO_FIR;
+  configuration.P = feedforward_taps;
+  configuration.Q = is_iir ? feedback_taps : 0;
+  configuration.R = coefficients.gain_shift;
+
+  return GetFmacStatus(HAL_FMAC_FilterConfig(&hfmac, &configuration));
+}
+
+auto FmacFilterEngine::GetFmacStatus(HAL_StatusTypeDef hal_status) noexcept -> types::DriverStatus {
+  switch (hal_status) {
+    case HAL_OK:
+      return types::DriverStatus::OK;
+    case HAL_TIMEOUT:
+      return types::DriverStatus::TIMEOUT;
+    default:
+      return types::DriverStatus::HAL_ERROR;
+  }
+}
+
+}  // namespace filter
@@ -0,0 +1,45 @@
+#ifndef SRC_FILTER_FMAC_FILTER_ENGINE_HPP_
+#define SRC_FILTER_FMAC_FILTER_ENGINE_HPP_
+
+#include <array>
+#include "stm32g4xx_hal.h"
+
+#include "filter_engine_interface.hpp"
+#include "fmac_config.h"
+
+namespace filter {
+
+/**
+ * @brief Filter engine on the FMAC of the STM32G4. The FMAC holds one filter at a time,
+ *        so every block reloads the coefficients and preloads the history of its stream,
+ *        which lets one FMAC serve several streams. The samples are exchanged by polling,
+ *        the FMAC computes while the CPU feeds the input buffer and drains the output buffer.
+ * 
+ */
+class FmacFilterEngine final : public FilterEngineInterface {
+ public:
+  ~FmacFilterEngine() = default;
+  FmacFilterEngine() = default;
+
+  auto Filter(const FilterCoefficients& coefficients, FilterState& state, const std::int16_t* input, std::int16_t* output, std::uint16_t length) noexcept -> types::DriverStatus override;
+
+  static constexpr std::uint32_t FMAC_TIMEOUT_IN_MS = 1;
+
+  /// Free space of the input and output buffer on top of the history, lets the FMAC run ahead of the CPU
+  static constexpr std::uint8_t BUFFER_HEADROOM = 4;
+
+ private:
+  auto Configure(const FilterCoefficients& coefficients) noexcept -> types::DriverStatus;
+  auto GetFmacStatus(HAL_StatusTypeDef hal_status) noexcept -> types::DriverStatus;
+
+  /// The HAL takes all buffers as non const pointers
+  std::array<std::int16_t, MAX_FEEDFORWARD_TAPS> feedforward_{};
+  std::array<std::int16_t, MAX_FEEDBACK_TAPS> feedback_{};
+  std::array<std::int16_t, MAX_FEEDFORWARD_TAPS - 1> preload_inputs_{};
+  std::array<std::int16_t, MAX_FEEDBACK_TAPS> preload_outputs_{};
+  std::array<std::int16_t, MAX_FILTER_BLOCK_LENGTH> input_{};
+};
+
+}  // namespace filter
+
+#endif
@@ -0,0 +1,86 @@
+#include "imu_filter_pipeline.hpp"
+
+namespace filter {
+
+constexpr std::uint8_t ImuFilterPipeline::NUMBER_OF_CHANNELS;
+
+auto ImuFilterPipeline::SetFilter(ImuChannel channel, const FilterCoefficients& coefficients) noexcept -> types::DriverStatus {
+  if (!AreCoefficientsValid(coefficients))
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto index = static_cast<std::uint8_t>(channel);
+  coefficients_[index] = coefficients;
+  states_[index] = FilterState{};
+  return types::DriverStatus::OK;
+}
+
+auto ImuFilterPipeline::SetGyroscopeFilter(const FilterCoefficients& coefficients) noexcept -> types::DriverStatus {
+  if (!AreCoefficientsValid(coefficients))
+    return types::DriverStatus::INPUT_ERROR;
+
+  SetFilter(ImuChannel::GYROSCOPE_X, coefficients);
+  SetFilter(ImuChannel::GYROSCOPE_Y, coefficients);
+  return SetFilter(ImuChannel::GYROSCOPE_Z, coefficients);
+}
+
+auto ImuFilterPipeline::SetAccelerometerFilter(const FilterCoefficients& coefficients) noexcept -> types::DriverStatus {
+  if (!AreCoefficientsValid(coefficients))
+    return types::DriverStatus::INPUT_ERROR;
+
+  SetFilter(ImuChannel::ACCELEROMETER_X, coefficients);
+  SetFilter(ImuChannel::ACCELEROMETER_Y, coefficients);
+  return SetFilter(ImuChannel::ACCELEROMETER_Z, coefficients);
+}
+
+auto ImuFilterPipeline::Reset(void) noexcept -> void {
+  states_.fill(FilterState{});
+}
+
+auto ImuFilterPipeline::Filter(ImuChannel channel, const std::int16_t* input, std::int16_t* output, std::uint16_t length) noexcept -> types::DriverStatus {
+  if (input == nullptr || output == nullptr)
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto index = static_cast<std::uint8_t>(channel);
+  if (!AreCoefficientsValid(coefficients_[index])) {
+    for (std::uint16_t sample = 0; sample < length; sample++)
+      output[sample] = input[sample];
+    return types::DriverStatus::OK;
+  }
+
+  return engine_.Filter(coefficients_[index], states_[index], input, output, length);
+}
+
+auto ImuFilterPipeline::Filter(types::EuclideanVector<std::int16_t>* gyroscope, types::EuclideanVector<std::int16_t>* accelerometer, std::uint16_t length) noexcept -> types::DriverStatus {
+  if (gyroscope == nullptr || accelerometer == nullptr || length > FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH)
+    return types::DriverStatus::INPUT_ERROR;
+
+  const ImuChannel channels[NUMBER_OF_CHANNELS] = {ImuChannel::GYROSCOPE_X, ImuChannel::GYROSCOPE_Y, ImuChannel::GYROSCOPE_Z,
+                                                   ImuChannel::ACCELEROMETER_X, ImuChannel::ACCELEROMETER_Y, ImuChannel::ACCELEROMETER_Z};
+  const Axis axes[NUMBER_OF_CHANNELS / 2] = {&types::EuclideanVector<std::int16_t>::x, &types::EuclideanVector<std::int16_t>::y,
+                                              &types::EuclideanVector<std::int16_t>::z};
+
+  for (std::uint8_t index = 0; index < NUMBER_OF_CHANNELS; index++) {
+    auto samples = (index < NUMBER_OF_CHANNELS / 2) ? gyroscope : accelerometer;
+    const auto filter_status = FilterAxis(channels[index], samples, axes[index % (NUMBER_OF_CHANNELS / 2)], length);
+    if (filter_status != types::DriverStatus::OK)
+      return filter_status;
+  }
+
+  return types::DriverStatus::OK;
+}
+
+auto ImuFilterPipeline::FilterAxis(ImuChannel channel, types::EuclideanVector<std::int16_t>* samples, Axis axis, std::uint16_t length) noexcept -> types::DriverStatus {
+  for (std::uint16_t sample = 0; sample < length; sample++)
+    channel_input_[sample] = samples[sample].*axis;
+
+  const auto filter_status = Filter(channel, channel_input_.data(), channel_output_.data(), length);
+  if (filter_status != types::DriverStatus::OK)
+    return filter_status;
+
+  for (std::uint16_t sample = 0; sample < length; sample++)
+    samples[sample].*axis = channel_output_[sample];
+
+  return types::DriverStatus::OK;
+}
+
+}  // namespace filter
@@ -0,0 +1,82 @@
+#ifndef SRC_FILTER_IMU_FILTER_PIPELINE_HPP_
+#define SRC_FILTER_IMU_FILTER_PIPELINE_HPP_
+
+#include <array>
+#include "basic_types.hpp"
+#include "filter_engine_interface.hpp"
+
+namespace filter {
+
+enum class ImuChannel : int {
+  GYROSCOPE_X = 0,
+  GYROSCOPE_Y,
+  GYROSCOPE_Z,
+  ACCELEROMETER_X,
+  ACCELEROMETER_Y,
+  ACCELEROMETER_Z
+};
+
+/**
+ * @brief Filters the raw gyroscope and accelerometer streams of the IMU, each axis is an own
+ *        channel with its own filter and history, all running on one filter engine.
+ *        Filtering blocks of samples per channel keeps the reconfiguration of the engine
+ *        per sample low. Channels without a filter pass their samples through unchanged.
+ * 
+ */
+class ImuFilterPipeline {
+ public:
+  ImuFilterPipeline() = delete;
+  ~ImuFilterPipeline() = default;
+
+  explicit ImuFilterPipeline(FilterEngineInterface& engine) : engine_(engine){};
+
+  /**
+   * @brief Sets the filter of a channel and clears its history
+   * 
+   * @return types::DriverStatus INPUT_ERROR for coefficients the FMAC can not run
+   */
+  auto SetFilter(ImuChannel channel, const FilterCoefficients& coefficients) noexcept -> types::DriverStatus;
+
+  /// Sets the same filter for all three axes of the gyroscope
+  auto SetGyroscopeFilter(const FilterCoefficients& coefficients) noexcept -> types::DriverStatus;
+
+  /// Sets the same filter for all three axes of the accelerometer
+  auto SetAccelerometerFilter(const FilterCoefficients& coefficients) noexcept -> types::DriverStatus;
+
+  /// Clears the history of all channels, e.g. after a gap in the streams
+  auto Reset(void) noexcept -> void;
+
+  /**
+   * @brief Filters a block of samples of one channel
+   * 
+   * @param length Amount of samples, at most FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH
+   */
+  auto Filter(ImuChannel channel, const std::int16_t* input, std::int16_t* output, std::uint16_t length) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Filters a block of gyroscope and accelerometer samples in place, e.g. read from the FIFO
+   *        of the IMU. Every channel runs once through the engine for the whole block.
+   * 
+   * @param length Amount of samples in both arrays, at most FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH
+   */
+  auto Filter(types::EuclideanVector<std::int16_t>* gyroscope, types::EuclideanVector<std::int16_t>* accelerometer, std::uint16_t length) noexcept -> types::DriverStatus;
+
+  static constexpr std::uint8_t NUMBER_OF_CHANNELS = 6;
+
+ private:
+  using Axis = std::int16_t types::EuclideanVector<std::int16_t>::*;
+
+  auto FilterAxis(ImuChannel channel, types::EuclideanVector<std::int16_t>* samples, Axis axis, std::uint16_t length) noexcept -> types::DriverStatus;
+
+  FilterEngineInterface& engine_;
+  std::array<FilterCoefficients, NUMBER_OF_CHANNELS> coefficients_{};
+  std::array<FilterState, NUMBER_OF_CHANNELS> states_{};
+
+  /// One axis of a block gathered into a contiguous stream for the engine
+  std::array<std::int16_t, FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH> channel_input_{};
+  std::array<std::int16_t, FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH> channel_output_{};
+};
+
+}  // namespace filter
+
+#endif
@@ -0,0 +1,69 @@
+#include "rpm_notch_filter_bank.hpp"
+#include <cmath>
+
+namespace filter {
+
+constexpr std::uint8_t RpmNotchFilterBank::NOTCHES;
+constexpr float RpmNotchFilterBank::MAX_NYQUIST_SHARE;
+
+namespace {
+
+constexpr float PI = 3.14159265358979f;
+
+}  // namespace
+
+auto RpmNotchFilterBank::Update(const std::array<float, RPM_NOTCH_MOTORS>& motor_frequency_in_hz) noexcept -> types::DriverStatus {
+  for (const auto frequency : motor_frequency_in_hz)
+    if (!(frequency >= 0.0f) || std::isinf(frequency))
+      return types::DriverStatus::INPUT_ERROR;
+
+  for (std::uint8_t motor = 0; motor < RPM_NOTCH_MOTORS; motor++) {
+    const auto fundamental = std::fmax(motor_frequency_in_hz[motor], min_frequency_);
+    for (std::uint8_t harmonic = 0; harmonic < RPM_NOTCH_HARMONICS; harmonic++)
+      coefficients_[motor * RPM_NOTCH_HARMONICS + harmonic] = Design(fundamental * static_cast<float>(harmonic + 1));
+  }
+
+  return types::DriverStatus::OK;
+}
+
+auto RpmNotchFilterBank::Apply(types::EuclideanVector<float>& gyroscope) noexcept -> void {
+  float* axes[RPM_NOTCH_AXES] = {&gyroscope.x, &gyroscope.y, &gyroscope.z};
+  for (std::uint8_t axis = 0; axis < RPM_NOTCH_AXES; axis++) {
+    auto sample = *axes[axis];
+    for (std::uint8_t notch = 0; notch < NOTCHES; notch++)
+      sample = Filter(coefficients_[notch], states_[axis][notch], sample);
+    *axes[axis] = sample;
+  }
+}
+
+auto RpmNotchFilterBank::Reset(void) noexcept -> void {
+  for (auto& axis_states : states_)
+    axis_states.fill(BiquadState{});
+}
+
+auto RpmNotchFilterBank::Design(const float center_frequency_in_hz) const noexcept -> BiquadCoefficients {
+  if (center_frequency_in_hz > max_frequency_)
+    return BiquadCoefficients{};
+
+  const auto omega = 2.0f * PI * center_frequency_in_hz * sample_period_;
+  const auto cosine = std::cos(omega);
+  const auto alpha = std::sin(omega) / (2.0f * quality_);
+  const auto normalization = 1.0f / (1.0f + alpha);
+
+  BiquadCoefficients coefficients;
+  coefficients.b0 = normalization;
+  coefficients.b1 = -2.0f * cosine * normalization;
+  coefficients.b2 = normalization;
+  coefficients.a1 = coefficients.b1;
+  coefficients.a2 = (1.0f - alpha) * normalization;
+  return coefficients;
+}
+
+auto RpmNotchFilterBank::Filter(const BiquadCoefficients& coefficients, BiquadState& state, const float input) noexcept -> float {
+  const auto output = coefficients.b0 * input + state.first;
+  state.first = coefficients.b1 * input - coefficients.a1 * output + state.second;
+  state.second = coefficients.b2 * input - coefficients.a2 * output;
+  return output;
+}
+
+}  // namespace filter
@@ -0,0 +1,96 @@
+#ifndef SRC_FILTER_RPM_NOTCH_FILTER_BANK_HPP_
+#define SRC_FILTER_RPM_NOTCH_FILTER_BANK_HPP_
+
+#include <array>
+#include <cstdint>
+#include "basic_types.hpp"
+#include "error_types.hpp"
+
+namespace filter {
+
+static constexpr std::uint8_t RPM_NOTCH_MOTORS = 4;
+static constexpr std::uint8_t RPM_NOTCH_HARMONICS = 3;
+static constexpr std::uint8_t RPM_NOTCH_AXES = 3;
+
+/**
+ * @brief Normalized coefficients of a biquad, y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+ *
+ */
+struct BiquadCoefficients {
+  float b0 = 1.0f;
+  float b1 = 0.0f;
+  float b2 = 0.0f;
+  float a1 = 0.0f;
+  float a2 = 0.0f;
+};
+
+/**
+ * @brief History of one biquad in transposed direct form 2
+ *
+ */
+struct BiquadState {
+  float first = 0.0f;
+  float second = 0.0f;
+};
+
+/**
+ * @brief Removes the noise of the motors from the gyroscope with one notch per motor and
+ *        harmonic of its rotation frequency on every axis. The centers follow the motor
+ *        frequencies, e.g. from the eRPM telemetry of bidirectional DShot, every control loop.
+ *        The notches run in float on the CPU: their coefficients change every sample,
+ *        which would cost a reload of the FMAC per notch.
+ *
+ */
+class RpmNotchFilterBank {
+ public:
+  RpmNotchFilterBank() = delete;
+  ~RpmNotchFilterBank() = default;
+
+  /**
+   * @brief Construct a new bank, all notches pass their input until the first update
+   *
+   * @param sample_frequency_in_hz Rate of the gyroscope samples and of the updates
+   * @param quality Center frequency divided by the width of each notch
+   * @param min_frequency_in_hz Lowest notch center, slower motors keep their notches there
+   */
+  explicit RpmNotchFilterBank(const float sample_frequency_in_hz, const float quality = 5.0f, const float min_frequency_in_hz = 80.0f) noexcept
+      : sample_period_(1.0f / sample_frequency_in_hz), quality_(quality), min_frequency_(min_frequency_in_hz), max_frequency_(MAX_NYQUIST_SHARE * 0.5f * sample_frequency_in_hz) {}
+
+  /**
+   * @brief Moves the notches to the harmonics of the motor frequencies.
+   *        Harmonics too close to half the sample frequency pass their input.
+   *
+   * @param motor_frequency_in_hz Rotation frequency of every motor
+   * @return types::DriverStatus INPUT_ERROR for negative or invalid frequencies, the notches are unchanged then
+   */
+  auto Update(const std::array<float, RPM_NOTCH_MOTORS>& motor_frequency_in_hz) noexcept -> types::DriverStatus;
+
+  /// Filters one gyroscope sample in place
+  auto Apply(types::EuclideanVector<float>& gyroscope) noexcept -> void;
+
+  /// Clears the history of all notches, e.g. after a gap in the samples
+  auto Reset(void) noexcept -> void;
+
+  auto GetCoefficients(const std::uint8_t motor, const std::uint8_t harmonic) const noexcept -> const BiquadCoefficients& {
+    return coefficients_[motor * RPM_NOTCH_HARMONICS + harmonic];
+  }
+
+ private:
+  static constexpr std::uint8_t NOTCHES = RPM_NOTCH_MOTORS * RPM_NOTCH_HARMONICS;
+  /// Notches closer to the Nyquist frequency get too narrow to be accurate in float
+  static constexpr float MAX_NYQUIST_SHARE = 0.96f;
+
+  auto Design(float center_frequency_in_hz) const noexcept -> BiquadCoefficients;
+  static auto Filter(const BiquadCoefficients& coefficients, BiquadState& state, float input) noexcept -> float;
+
+  const float sample_period_;
+  const float quality_;
+  const float min_frequency_;
+  const float max_frequency_;
+  std::array<BiquadCoefficients, NOTCHES> coefficients_{};
+  std::array<std::array<BiquadState, NOTCHES>, RPM_NOTCH_AXES> states_{};
+};
+
+}  // namespace filter
+
+#endif
@@ -0,0 +1,67 @@
+#include "software_filter_engine.hpp"
+#include <limits>
+
+namespace filter {
+
+constexpr std::uint16_t FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH;
+
+namespace {
+
+constexpr int ACCUMULATOR_BITS = 26;
+constexpr int PRODUCT_TRUNCATION_BITS = 8;
+constexpr int OUTPUT_TRUNCATION_BITS = 7;
+
+/// Product of two q1.15 values in q3.22, the 8 least significant bits of q2.30 are dropped
+inline auto Product(const std::int16_t coefficient, const std::int16_t sample) noexcept -> std::int32_t {
+  return (static_cast<std::int32_t>(coefficient) * sample) >> PRODUCT_TRUNCATION_BITS;
+}
+
+inline auto WrapToAccumulator(const std::int32_t sum) noexcept -> std::int32_t {
+  const auto shift = 32 - ACCUMULATOR_BITS;
+  return static_cast<std::int32_t>(static_cast<std::uint32_t>(sum) << shift) >> shift;
+}
+
+inline auto ToOutput(const std::int32_t accumulator, const std::uint8_t gain_shift) noexcept -> std::int16_t {
+  const auto output = (static_cast<std::int64_t>(accumulator) * (static_cast<std::int64_t>(1) << gain_shift)) >> OUTPUT_TRUNCATION_BITS;
+
+  if (output > std::numeric_limits<std::int16_t>::max())
+    return std::numeric_limits<std::int16_t>::max();
+
+  if (output < std::numeric_limits<std::int16_t>::min())
+    return std::numeric_limits<std::int16_t>::min();
+
+  return static_cast<std::int16_t>(output);
+}
+
+}  // namespace
+
+auto SoftwareFilterEngine::Filter(const FilterCoefficients& coefficients, FilterState& state, const std::int16_t* input, std::int16_t* output, std::uint16_t length) noexcept -> types::DriverStatus {
+  if (input == nullptr || output == nullptr || length > MAX_FILTER_BLOCK_LENGTH || !AreCoefficientsValid(coefficients))
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto input_history = coefficients.feedforward_taps - 1;
+  const auto output_history = coefficients.feedback_taps;
+
+  for (std::uint16_t sample = 0; sample < length; sample++) {
+    // Sums of 26 bit values stay exact in 32 bits for all taps, so wrapping once at the end is the same as after every addition
+    std::int32_t sum = 0;
+    for (int tap = 0; tap < coefficients.feedforward_taps; tap++) {
+      const auto age = tap;
+      const auto x = (age <= sample) ? input[sample - age] : state.inputs[input_history - (age - sample)];
+      sum += Product(coefficients.feedforward[tap], x);
+    }
+
+    for (int tap = 0; tap < output_history; tap++) {
+      const auto age = tap + 1;
+      const auto y = (age <= sample) ? output[sample - age] : state.outputs[output_history - (age - sample)];
+      sum += Product(coefficients.feedback[tap], y);
+    }
+
+    output[sample] = ToOutput(WrapToAccumulator(sum), coefficients.gain_shift);
+  }
+
+  AdvanceState(coefficients, state, input, output, length);
+  return types::DriverStatus::OK;
+}
+
+}  // namespace filter
@@ -0,0 +1,26 @@
+#ifndef SRC_FILTER_SOFTWARE_FILTER_ENGINE_HPP_
+#define SRC_FILTER_SOFTWARE_FILTER_ENGINE_HPP_
+
+#include "filter_engine_interface.hpp"
+
+namespace filter {
+
+/**
+ * @brief Filter engine on the CPU with the arithmetic of the FMAC as described in RM0440:
+ *        every q2.30 product is truncated to q3.22 before it is accumulated into 26 bits,
+ *        which wrap on overflow. The sum is shifted by the gain and truncated to q1.15 with saturation.
+ *        The host tests check it against hand computed reference vectors; the simulated FMAC
+ *        of the tests uses the same arithmetic, agreement with the silicon is not tested on the host.
+ * 
+ */
+class SoftwareFilterEngine final : public FilterEngineInterface {
+ public:
+  ~SoftwareFilterEngine() = default;
+  SoftwareFilterEngine() = default;
+
+  auto Filter(const FilterCoefficients& coefficients, FilterState& state, const std::int16_t* input, std::int16_t* output, std::uint16_t length) noexcept -> types::DriverStatus override;
+};
+
+}  // namespace filter
+
+#endif
@@ -38,6 +38,23 @@ auto I2C::ReadContentFromRegister(std::uint8_t address, std::uint8_t register_,
   return {i2c_status, content_of_register};
 }
 
+auto I2C::ReadContentFromRegisterIntoBuffer(std::uint8_t address, std::uint8_t register_, std::uint8_t* buffer, std::uint16_t byte_size, std::uint32_t timeout) noexcept -> types::DriverStatus {
+  if (buffer == nullptr || !CheckForValidInputRead(address, byte_size, timeout)) {
+    return types::DriverStatus::INPUT_ERROR;
+  }
+
+  address = ModifyAddressForI2C7Bit(address);
+
+  HAL_StatusTypeDef hal_status = HAL_I2C_Master_Transmit(&hi2c2, address, &register_, 1, timeout);
+  if (hal_status != HAL_OK) {
+    return GetI2CStatus(hal_status);
+  }
+
+  hal_status = HAL_I2C_Master_Receive(&hi2c2, address, buffer, byte_size, timeout);
+
+  return GetI2CStatus(hal_status);
+}
+
 auto I2C::Write(std::uint8_t address, const std::vector<std::uint8_t>& data, std::uint32_t timeout) noexcept -> types::DriverStatus {
   if (!CheckForValidInputWrite(address, data, timeout)) {
     return types::DriverStatus::INPUT_ERROR;
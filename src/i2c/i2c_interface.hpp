@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <vector>
 #include "error_types.hpp"
+#include "register_transport_interface.hpp"
 
 namespace i2c {
 
@@ -11,10 +12,10 @@ namespace i2c {
  * @brief Interface of I2C package
  * 
  */
-class I2CInterface {
+class I2CInterface : public transport::RegisterTransportInterface {
  public:
   virtual ~I2CInterface() = default;
-  explicit I2CInterface(void){};
+  explicit I2CInterface(void) : transport::RegisterTransportInterface(){};
 
   /**
    * @brief Reads data from I2C Bus
@@ -39,7 +40,7 @@ class I2CInterface {
    *                Allowed range of Timeout is between 1 and HAL_MAX_DELAY (0xFFFFFFFF, see stm32g4xx_hal_def.h).
    * @return std::pair<#types::DriverStatus, std::vector<uint8_t>> Status of I2C Interface and Data read as std::vector. Each element is a Byte read.
    */
-  virtual auto ReadContentFromRegister(std::uint8_t address, std::uint8_t register_, std::uint16_t byte_size, std::uint32_t timeout = I2C_STANDARD_TIMEOUT_IN_MS) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> = 0;
+  virtual auto ReadContentFromRegister(std::uint8_t address, std::uint8_t register_, std::uint16_t byte_size, std::uint32_t timeout = I2C_STANDARD_TIMEOUT_IN_MS) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> override = 0;
 
   /**
    * @brief Writes data to I2C participant
@@ -51,7 +52,7 @@ class I2CInterface {
    *                Allowed range of Timeout is between 1 and HAL_MAX_DELAY (0xFFFFFFFF, see stm32g4xx_hal_def.h).
    * @return #types::DriverStatus Status of I2C Interface
    */
-  virtual auto Write(std::uint8_t address, const std::vector<std::uint8_t>& data, std::uint32_t timeout = I2C_STANDARD_TIMEOUT_IN_MS) noexcept -> types::DriverStatus = 0;
+  virtual auto Write(std::uint8_t address, const std::vector<std::uint8_t>& data, std::uint32_t timeout = I2C_STANDARD_TIMEOUT_IN_MS) noexcept -> types::DriverStatus override = 0;
 
  protected:
   /// @brief Standard timeout of I2C Interface in milliseconds
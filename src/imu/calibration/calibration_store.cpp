@@ -0,0 +1,83 @@
+#include "calibration_store.hpp"
+#include <cstddef>
+#include <cstring>
+
+namespace imu {
+
+namespace {
+
+constexpr std::uint32_t CALIBRATION_MAGIC = 0x43414C31;
+constexpr std::uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
+constexpr std::uint8_t VALUES_PER_CALIBRATION = 6;
+
+struct PersistentCalibration {
+  std::uint32_t magic;
+  float values[2 * VALUES_PER_CALIBRATION];
+  std::uint32_t checksum;
+};
+
+#ifdef UNIT_TEST
+PersistentCalibration persistent_calibration;
+#else
+__attribute__((section(".noinit"))) PersistentCalibration persistent_calibration;
+#endif
+
+auto Crc32(const std::uint8_t* data, const std::size_t length) noexcept -> std::uint32_t {
+  std::uint32_t crc = 0xFFFFFFFF;
+  for (std::size_t index = 0; index < length; index++) {
+    crc ^= data[index];
+    for (int bit = 0; bit < 8; bit++)
+      crc = (crc >> 1) ^ (CRC32_POLYNOMIAL & (0u - (crc & 1u)));
+  }
+  return ~crc;
+}
+
+auto Checksum(const PersistentCalibration& calibration) noexcept -> std::uint32_t {
+  return Crc32(reinterpret_cast<const std::uint8_t*>(&calibration), offsetof(PersistentCalibration, checksum));
+}
+
+auto Pack(const types::SensorCalibration& calibration, float* values) noexcept -> void {
+  values[0] = calibration.bias.x;
+  values[1] = calibration.bias.y;
+  values[2] = calibration.bias.z;
+  values[3] = calibration.scale.x;
+  values[4] = calibration.scale.y;
+  values[5] = calibration.scale.z;
+}
+
+auto Unpack(const float* values, types::SensorCalibration& calibration) noexcept -> void {
+  calibration.bias.x = values[0];
+  calibration.bias.y = values[1];
+  calibration.bias.z = values[2];
+  calibration.scale.x = values[3];
+  calibration.scale.y = values[4];
+  calibration.scale.z = values[5];
+}
+
+}  // namespace
+
+auto StoreCalibration(const types::SensorCalibration& gyroscope, const types::SensorCalibration& accelerometer) noexcept -> void {
+  PersistentCalibration calibration;
+  std::memset(&calibration, 0, sizeof(calibration));
+  calibration.magic = CALIBRATION_MAGIC;
+  Pack(gyroscope, &calibration.values[0]);
+  Pack(accelerometer, &calibration.values[VALUES_PER_CALIBRATION]);
+  calibration.checksum = Checksum(calibration);
+
+  persistent_calibration = calibration;
+}
+
+auto LoadCalibration(types::SensorCalibration& gyroscope, types::SensorCalibration& accelerometer) noexcept -> types::DriverStatus {
+  if (persistent_calibration.magic != CALIBRATION_MAGIC || persistent_calibration.checksum != Checksum(persistent_calibration))
+    return types::DriverStatus::INPUT_ERROR;
+
+  Unpack(&persistent_calibration.values[0], gyroscope);
+  Unpack(&persistent_calibration.values[VALUES_PER_CALIBRATION], accelerometer);
+  return types::DriverStatus::OK;
+}
+
+auto InvalidateCalibration(void) noexcept -> void {
+  persistent_calibration.magic = 0;
+}
+
+}  // namespace imu
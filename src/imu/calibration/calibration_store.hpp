@@ -0,0 +1,30 @@
+#ifndef SRC_IMU_CALIBRATION_CALIBRATION_STORE_HPP_
+#define SRC_IMU_CALIBRATION_CALIBRATION_STORE_HPP_
+
+#include <cstdint>
+#include "error_types.hpp"
+#include "imu_calibration.hpp"
+
+namespace imu {
+
+/**
+ * Keeps the last calibration of gyroscope and accelerometer in RAM which the startup code
+ * does not initialize (section .noinit), so it survives a warm reset but not a power cycle.
+ * A magic number and a CRC-32 tell a stored calibration from the random content after power up.
+ */
+
+auto StoreCalibration(const types::SensorCalibration& gyroscope, const types::SensorCalibration& accelerometer) noexcept -> void;
+
+/**
+ * @brief Reads the stored calibration
+ * 
+ * @return types::DriverStatus INPUT_ERROR if there is no valid calibration, the outputs stay untouched then
+ */
+auto LoadCalibration(types::SensorCalibration& gyroscope, types::SensorCalibration& accelerometer) noexcept -> types::DriverStatus;
+
+/// Forces the next startup to calibrate again
+auto InvalidateCalibration(void) noexcept -> void;
+
+}  // namespace imu
+
+#endif
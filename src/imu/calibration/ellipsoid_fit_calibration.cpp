@@ -0,0 +1,189 @@
+#include "ellipsoid_fit_calibration.hpp"
+#include <cmath>
+#include "matrix.hpp"
+
+namespace imu {
+
+constexpr std::uint32_t EllipsoidFitCalibration::MIN_NUMBER_OF_SAMPLES;
+constexpr std::uint8_t EllipsoidFitCalibration::NUMBER_OF_PARAMETERS;
+constexpr std::uint8_t EllipsoidFitCalibration::NUMBER_OF_PRODUCTS;
+
+namespace {
+
+constexpr int MAX_JACOBI_SWEEPS = 16;
+
+/// The fit to 1 degenerates when the origin lies on the ellipsoid
+constexpr float MIN_RIGHT_SIDE = 1.0e-6f;
+
+/**
+ * @brief Eigen decomposition of a symmetric 3x3 matrix by Jacobi rotations
+ * 
+ * @param matrix Symmetric matrix, holds the eigenvalues on its diagonal afterwards
+ * @param eigenvectors Eigenvectors as columns
+ */
+auto DecomposeSymmetric(utilities::Matrix<3, 3>& matrix, utilities::Matrix<3, 3>& eigenvectors) noexcept -> void {
+  eigenvectors = utilities::Matrix<3, 3>::Identity();
+
+  for (int sweep = 0; sweep < MAX_JACOBI_SWEEPS; sweep++) {
+    const auto off_diagonal = std::fabs(matrix(0, 1)) + std::fabs(matrix(0, 2)) + std::fabs(matrix(1, 2));
+    if (off_diagonal < 1.0e-9f)
+      return;
+
+    for (std::uint16_t p = 0; p < 2; p++) {
+      for (std::uint16_t q = static_cast<std::uint16_t>(p + 1); q < 3; q++) {
+        if (matrix(p, q) == 0.0f)
+          continue;
+
+        const auto theta = 0.5f * (matrix(q, q) - matrix(p, p)) / matrix(p, q);
+        const auto tangent = std::copysign(1.0f, theta) / (std::fabs(theta) + std::sqrt(theta * theta + 1.0f));
+        const auto cosine = 1.0f / std::sqrt(tangent * tangent + 1.0f);
+        const auto sine = tangent * cosine;
+
+        for (std::uint16_t k = 0; k < 3; k++) {
+          const auto kp = matrix(k, p);
+          const auto kq = matrix(k, q);
+          matrix(k, p) = cosine * kp - sine * kq;
+          matrix(k, q) = sine * kp + cosine * kq;
+        }
+        for (std::uint16_t k = 0; k < 3; k++) {
+          const auto pk = matrix(p, k);
+          const auto qk = matrix(q, k);
+          matrix(p, k) = cosine * pk - sine * qk;
+          matrix(q, k) = sine * pk + cosine * qk;
+        }
+        for (std::uint16_t k = 0; k < 3; k++) {
+          const auto kp = eigenvectors(k, p);
+          const auto kq = eigenvectors(k, q);
+          eigenvectors(k, p) = cosine * kp - sine * kq;
+          eigenvectors(k, q) = sine * kp + cosine * kq;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+auto EllipsoidFitCalibration::AddSample(const types::EuclideanVector<float>& magnetic_field) noexcept -> void {
+  if (sample_count_ == 0) {
+    const auto magnitude = std::sqrt(magnetic_field.x * magnetic_field.x + magnetic_field.y * magnetic_field.y + magnetic_field.z * magnetic_field.z);
+    if (magnitude == 0.0f)
+      return;
+    normalization_ = 1.0f / magnitude;
+  }
+
+  const auto x = magnetic_field.x * normalization_;
+  const auto y = magnetic_field.y * normalization_;
+  const auto z = magnetic_field.z * normalization_;
+  const float terms[NUMBER_OF_PARAMETERS] = {x * x, y * y, z * z, 2.0f * y * z, 2.0f * x * z, 2.0f * x * y, 2.0f * x, 2.0f * y, 2.0f * z};
+
+  std::uint8_t index = 0;
+  for (std::uint8_t row = 0; row < NUMBER_OF_PARAMETERS; row++) {
+    sums_[row] += terms[row];
+    for (std::uint8_t column = row; column < NUMBER_OF_PARAMETERS; column++)
+      products_[index++] += terms[row] * terms[column];
+  }
+
+  sample_count_++;
+}
+
+auto EllipsoidFitCalibration::Reset(void) noexcept -> void {
+  sample_count_ = 0;
+  normalization_ = 1.0f;
+  products_.fill(0.0f);
+  sums_.fill(0.0f);
+}
+
+auto EllipsoidFitCalibration::GetSampleCount(void) const noexcept -> std::uint32_t {
+  return sample_count_;
+}
+
+auto EllipsoidFitCalibration::Solve(types::HardAndSoftIronCalibration& calibration) const noexcept -> types::DriverStatus {
+  if (sample_count_ < MIN_NUMBER_OF_SAMPLES)
+    return types::DriverStatus::INPUT_ERROR;
+
+  utilities::Matrix<NUMBER_OF_PARAMETERS, NUMBER_OF_PARAMETERS> normal_matrix;
+  utilities::Matrix<NUMBER_OF_PARAMETERS, 1> right_hand_side;
+  for (std::uint8_t row = 0; row < NUMBER_OF_PARAMETERS; row++) {
+    right_hand_side(row, 0) = sums_[row];
+    for (std::uint8_t column = 0; column < NUMBER_OF_PARAMETERS; column++)
+      normal_matrix(row, column) = products_[ProductIndex(row, column)];
+  }
+
+  utilities::Matrix<NUMBER_OF_PARAMETERS, NUMBER_OF_PARAMETERS> inverse_normal_matrix;
+  if (utilities::Inverse(normal_matrix, inverse_normal_matrix) != types::DriverStatus::OK)
+    return types::DriverStatus::INPUT_ERROR;
+
+  utilities::Matrix<NUMBER_OF_PARAMETERS, 1> quadric;
+  utilities::Multiply(inverse_normal_matrix, right_hand_side, quadric);
+
+  // x^T A x + 2 v^T x = 1 with the center c = -A^-1 v becomes (x - c)^T A (x - c) = 1 + c^T A c.
+  // If the hard iron offset exceeds the field strength the origin lies outside of the ellipsoid,
+  // then A and the right side are both negative and their quotient is still positive definite.
+  utilities::Matrix<3, 3> shape;
+  shape(0, 0) = quadric(0, 0);
+  shape(1, 1) = quadric(1, 0);
+  shape(2, 2) = quadric(2, 0);
+  shape(1, 2) = shape(2, 1) = quadric(3, 0);
+  shape(0, 2) = shape(2, 0) = quadric(4, 0);
+  shape(0, 1) = shape(1, 0) = quadric(5, 0);
+  utilities::Matrix<3, 1> linear;
+  linear(0, 0) = quadric(6, 0);
+  linear(1, 0) = quadric(7, 0);
+  linear(2, 0) = quadric(8, 0);
+
+  auto shape_copy = shape;
+  utilities::Matrix<3, 3> inverse_shape;
+  if (utilities::Inverse(shape_copy, inverse_shape) != types::DriverStatus::OK)
+    return types::DriverStatus::INPUT_ERROR;
+
+  utilities::Matrix<3, 1> center;
+  utilities::Multiply(inverse_shape, linear, center);
+  utilities::Scale(center, -1.0f, center);
+
+  utilities::Matrix<3, 1> shape_times_center;
+  utilities::Multiply(shape, center, shape_times_center);
+  const auto right_side = 1.0f + center(0, 0) * shape_times_center(0, 0) + center(1, 0) * shape_times_center(1, 0) + center(2, 0) * shape_times_center(2, 0);
+  if (std::fabs(right_side) < MIN_RIGHT_SIDE)
+    return types::DriverStatus::INPUT_ERROR;
+
+  utilities::Scale(shape, 1.0f / right_side, shape);
+  utilities::Matrix<3, 3> eigenvectors;
+  DecomposeSymmetric(shape, eigenvectors);
+
+  float axis_product = 1.0f;
+  for (std::uint16_t axis = 0; axis < 3; axis++) {
+    if (shape(axis, axis) <= 0.0f)
+      return types::DriverStatus::INPUT_ERROR;
+    axis_product *= shape(axis, axis);
+  }
+
+  // Symmetric square root of the shape maps the ellipsoid onto the unit sphere,
+  // the geometric mean of the semi-axes 1/sqrt(eigenvalue) restores the field strength
+  const auto mean_semi_axis = std::pow(axis_product, -1.0f / 6.0f);
+  for (std::uint16_t row = 0; row < 3; row++) {
+    for (std::uint16_t column = 0; column < 3; column++) {
+      float sum = 0.0f;
+      for (std::uint16_t axis = 0; axis < 3; axis++)
+        sum += eigenvectors(row, axis) * std::sqrt(shape(axis, axis)) * eigenvectors(column, axis);
+      calibration.correction[row * 3 + column] = sum * mean_semi_axis;
+    }
+  }
+
+  calibration.offset.x = center(0, 0) / normalization_;
+  calibration.offset.y = center(1, 0) / normalization_;
+  calibration.offset.z = center(2, 0) / normalization_;
+  return types::DriverStatus::OK;
+}
+
+auto EllipsoidFitCalibration::ProductIndex(std::uint8_t row, std::uint8_t column) const noexcept -> std::uint8_t {
+  if (row > column) {
+    const auto swap = row;
+    row = column;
+    column = swap;
+  }
+  // Rows of the upper triangle are stored one after another, row r starts after r * (2n - r + 1) / 2 entries
+  return static_cast<std::uint8_t>(row * (2 * NUMBER_OF_PARAMETERS - row + 1) / 2 + column - row);
+}
+
+}  // namespace imu
@@ -0,0 +1,59 @@
+#ifndef SRC_IMU_CALIBRATION_ELLIPSOID_FIT_CALIBRATION_HPP_
+#define SRC_IMU_CALIBRATION_ELLIPSOID_FIT_CALIBRATION_HPP_
+
+#include <array>
+#include "error_types.hpp"
+#include "imu_calibration.hpp"
+
+namespace imu {
+
+/**
+ * @brief Hard and soft iron calibration of a magnetometer by a least squares ellipsoid fit.
+ *        The samples are taken while the drone is rotated in all directions. Only the sums of the
+ *        normal equations of the quadric a x^2 + b y^2 + c z^2 + 2f yz + 2g xz + 2h xy + 2p x + 2q y + 2r z = 1
+ *        are accumulated, so the memory stays constant and no sample is stored.
+ *        Solving yields the center of the ellipsoid as offset and the symmetric matrix which maps
+ *        the ellipsoid onto a sphere with the geometric mean of its semi-axes as radius.
+ *        The fit fails only if the hard iron offset is just as large as the field strength.
+ * 
+ */
+class EllipsoidFitCalibration {
+ public:
+  EllipsoidFitCalibration() = default;
+  ~EllipsoidFitCalibration() = default;
+
+  /// Adds a measurement in micro tesla without any hard or soft iron correction
+  auto AddSample(const types::EuclideanVector<float>& magnetic_field) noexcept -> void;
+
+  auto Reset(void) noexcept -> void;
+  auto GetSampleCount(void) const noexcept -> std::uint32_t;
+
+  /**
+   * @brief Fits the ellipsoid to all samples added since the last Reset()
+   * 
+   * @param calibration Offset and correction, only written on success
+   * @return types::DriverStatus INPUT_ERROR if there are too few samples or they do not span an ellipsoid
+   */
+  auto Solve(types::HardAndSoftIronCalibration& calibration) const noexcept -> types::DriverStatus;
+
+  static constexpr std::uint32_t MIN_NUMBER_OF_SAMPLES = 50;
+
+ private:
+  static constexpr std::uint8_t NUMBER_OF_PARAMETERS = 9;
+  static constexpr std::uint8_t NUMBER_OF_PRODUCTS = NUMBER_OF_PARAMETERS * (NUMBER_OF_PARAMETERS + 1) / 2;
+
+  auto ProductIndex(std::uint8_t row, std::uint8_t column) const noexcept -> std::uint8_t;
+
+  std::uint32_t sample_count_ = 0;
+
+  /// The samples are divided by the magnitude of the first one, which keeps the fourth powers in the sums well within float precision
+  float normalization_ = 1.0f;
+
+  /// Upper triangle of sum(d * d^T) and sum(d) with d the quadric terms of a sample
+  std::array<float, NUMBER_OF_PRODUCTS> products_{};
+  std::array<float, NUMBER_OF_PARAMETERS> sums_{};
+};
+
+}  // namespace imu
+
+#endif
@@ -0,0 +1,88 @@
+#include "startup_calibration.hpp"
+#include <cmath>
+
+namespace imu {
+
+constexpr std::uint16_t StartupCalibration::DEFAULT_NUMBER_OF_SAMPLES;
+constexpr float StartupCalibration::GYROSCOPE_MOTION_THRESHOLD_IN_DPS;
+constexpr float StartupCalibration::ACCELEROMETER_MOTION_THRESHOLD_IN_G;
+constexpr std::uint16_t StartupCalibration::MIN_SAMPLES_FOR_MOTION_DETECTION;
+constexpr float StartupCalibration::GRAVITY_IN_G;
+
+auto StartupCalibration::AddSample(const types::EuclideanVector<float>& gyroscope, const types::EuclideanVector<float>& accelerometer) noexcept -> types::ImuCalibrationState {
+  if (GetState() == types::ImuCalibrationState::CALIBRATED)
+    return types::ImuCalibrationState::CALIBRATED;
+
+  if (IsMoving(gyroscope_statistics_, gyroscope, GYROSCOPE_MOTION_THRESHOLD_IN_DPS) ||
+      IsMoving(accelerometer_statistics_, accelerometer, ACCELEROMETER_MOTION_THRESHOLD_IN_G)) {
+    Restart();
+    return types::ImuCalibrationState::COLLECTING;
+  }
+
+  gyroscope_statistics_[0].Add(gyroscope.x);
+  gyroscope_statistics_[1].Add(gyroscope.y);
+  gyroscope_statistics_[2].Add(gyroscope.z);
+  accelerometer_statistics_[0].Add(accelerometer.x);
+  accelerometer_statistics_[1].Add(accelerometer.y);
+  accelerometer_statistics_[2].Add(accelerometer.z);
+
+  return GetState();
+}
+
+auto StartupCalibration::Reset(void) noexcept -> void {
+  Restart();
+  restart_count_ = 0;
+}
+
+auto StartupCalibration::GetState(void) const noexcept -> types::ImuCalibrationState {
+  return (gyroscope_statistics_[0].GetCount() >= number_of_samples_) ? types::ImuCalibrationState::CALIBRATED : types::ImuCalibrationState::COLLECTING;
+}
+
+auto StartupCalibration::GetRestartCount(void) const noexcept -> std::uint16_t {
+  return restart_count_;
+}
+
+auto StartupCalibration::GetGyroscopeCalibration(void) const noexcept -> types::SensorCalibration {
+  types::SensorCalibration calibration;
+  calibration.bias.x = gyroscope_statistics_[0].GetMean();
+  calibration.bias.y = gyroscope_statistics_[1].GetMean();
+  calibration.bias.z = gyroscope_statistics_[2].GetMean();
+  return calibration;
+}
+
+auto StartupCalibration::GetAccelerometerCalibration(void) const noexcept -> types::SensorCalibration {
+  float mean[3] = {accelerometer_statistics_[0].GetMean(), accelerometer_statistics_[1].GetMean(), accelerometer_statistics_[2].GetMean()};
+
+  std::uint8_t vertical_axis = 0;
+  for (std::uint8_t axis = 1; axis < 3; axis++)
+    if (std::fabs(mean[axis]) > std::fabs(mean[vertical_axis]))
+      vertical_axis = axis;
+  mean[vertical_axis] -= std::copysign(GRAVITY_IN_G, mean[vertical_axis]);
+
+  types::SensorCalibration calibration;
+  calibration.bias.x = mean[0];
+  calibration.bias.y = mean[1];
+  calibration.bias.z = mean[2];
+  return calibration;
+}
+
+auto StartupCalibration::Restart(void) noexcept -> void {
+  if (gyroscope_statistics_[0].GetCount() > 0)
+    restart_count_++;
+
+  for (auto& statistics : gyroscope_statistics_)
+    statistics.Reset();
+  for (auto& statistics : accelerometer_statistics_)
+    statistics.Reset();
+}
+
+auto StartupCalibration::IsMoving(const std::array<utilities::StreamingStatistics, 3>& statistics, const types::EuclideanVector<float>& sample, const float threshold) const noexcept -> bool {
+  if (statistics[0].GetCount() < MIN_SAMPLES_FOR_MOTION_DETECTION)
+    return false;
+
+  return std::fabs(sample.x - statistics[0].GetMean()) > threshold ||
+         std::fabs(sample.y - statistics[1].GetMean()) > threshold ||
+         std::fabs(sample.z - statistics[2].GetMean()) > threshold;
+}
+
+}  // namespace imu
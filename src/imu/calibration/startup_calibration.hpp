@@ -0,0 +1,60 @@
+#ifndef SRC_IMU_CALIBRATION_STARTUP_CALIBRATION_HPP_
+#define SRC_IMU_CALIBRATION_STARTUP_CALIBRATION_HPP_
+
+#include <array>
+#include "imu_calibration.hpp"
+#include "streaming_statistics.hpp"
+
+namespace imu {
+
+/**
+ * @brief Calibration of gyroscope and accelerometer from a stationary phase after startup.
+ *        Mean and variance of every axis are collected sample by sample, so no sample is stored.
+ *        A sample off the running mean by more than the motion threshold restarts the collection.
+ *        The gyroscope bias is its mean, the accelerometer offset its mean minus gravity along
+ *        the axis which is closest to vertical. Scales are left at 1, they need several orientations.
+ * 
+ */
+class StartupCalibration {
+ public:
+  ~StartupCalibration() = default;
+
+  explicit StartupCalibration(const std::uint16_t number_of_samples = DEFAULT_NUMBER_OF_SAMPLES) : number_of_samples_(number_of_samples){};
+
+  /**
+   * @brief Adds one sample in degree per second and g
+   * 
+   * @return types::ImuCalibrationState COLLECTING until enough stationary samples arrived, CALIBRATED afterwards
+   */
+  auto AddSample(const types::EuclideanVector<float>& gyroscope, const types::EuclideanVector<float>& accelerometer) noexcept -> types::ImuCalibrationState;
+
+  auto Reset(void) noexcept -> void;
+  auto GetState(void) const noexcept -> types::ImuCalibrationState;
+
+  /// Amount of restarts due to motion since the last Reset()
+  auto GetRestartCount(void) const noexcept -> std::uint16_t;
+
+  auto GetGyroscopeCalibration(void) const noexcept -> types::SensorCalibration;
+  auto GetAccelerometerCalibration(void) const noexcept -> types::SensorCalibration;
+
+  static constexpr std::uint16_t DEFAULT_NUMBER_OF_SAMPLES = 500;
+  static constexpr float GYROSCOPE_MOTION_THRESHOLD_IN_DPS = 3.0f;
+  static constexpr float ACCELEROMETER_MOTION_THRESHOLD_IN_G = 0.05f;
+
+ private:
+  auto Restart(void) noexcept -> void;
+  auto IsMoving(const std::array<utilities::StreamingStatistics, 3>& statistics, const types::EuclideanVector<float>& sample, const float threshold) const noexcept -> bool;
+
+  /// The running mean is too noisy for the motion detection before
+  static constexpr std::uint16_t MIN_SAMPLES_FOR_MOTION_DETECTION = 16;
+  static constexpr float GRAVITY_IN_G = 1.0f;
+
+  std::uint16_t number_of_samples_;
+  std::uint16_t restart_count_ = 0;
+  std::array<utilities::StreamingStatistics, 3> gyroscope_statistics_{};
+  std::array<utilities::StreamingStatistics, 3> accelerometer_statistics_{};
+};
+
+}  // namespace imu
+
+#endif
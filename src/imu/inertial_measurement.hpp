@@ -26,10 +26,14 @@ class InertialMeasurement final : public InertialMeasurementInterface {
   /**
    * @brief  The custom constructor is
    *          the one to be used. 
-   * @param  i2c_handler Unique pointer to I2C Handler defined by hal driver 
+   * @param  transport Shared pointer to the register transport (I2C or SPI) the IMU is connected to 
+   * @param  magnetometer_read_mode Whether the magnetometer is read directly via bypass
+   *          or mirrored into the MPU9255 burst by its auxiliary I2C master.
+   *          Over SPI the magnetometer is always read by the auxiliary I2C master.
    * 
    */
-  explicit InertialMeasurement(std::shared_ptr<i2c::I2CInterface> i2c_handler) : InertialMeasurementInterface(i2c_handler, std::make_unique<imu::Mpu9255>(i2c_handler)) {}
+  explicit InertialMeasurement(std::shared_ptr<transport::RegisterTransportInterface> transport,
+                               const types::MagnetometerReadMode magnetometer_read_mode = types::MagnetometerReadMode::BYPASS) : InertialMeasurementInterface(transport, std::make_unique<imu::ConfiguredMpu9255>(transport, magnetometer_read_mode)) {}
 
   /**
    * @brief Used for Initialization of complete Inertial Measurement Unit
@@ -45,6 +49,15 @@ class InertialMeasurement final : public InertialMeasurementInterface {
    */
   auto Update(void) noexcept -> types::DriverStatus override;
 
+  /**
+   * @brief Used to update all sensors and to record the new measurements in the sensor histories.
+   *        Every sensor which delivered a new sample is recorded, even if another one failed.
+   * @param timestamp_in_us Point in time the measurements were sampled, may wrap around
+   * @return A types::DriverStatus to indicate whether it is faulty or not
+   * 
+   */
+  auto Update(std::uint32_t timestamp_in_us) noexcept -> types::DriverStatus override;
+
   /**
    * @brief Used for setting of the gyroscopes sensitivity
    * 
@@ -71,6 +84,16 @@ class InertialMeasurement final : public InertialMeasurementInterface {
    */
   auto GetAccelerometerSensitivity(void) noexcept -> types::ImuSensitivity override;
 
+  /**
+   * @brief Used for setting output data rate and low pass filter of gyroscope and accelerometer
+   * @param output_data_rate_in_hz Output data rate, has to divide 1 kHz and be a multiple of the loop frequency
+   * @param low_pass_filter Low pass filter, its bandwidth has to be below half of the loop frequency
+   * @param loop_frequency_in_hz Frequency the measurements are consumed with
+   * @return A types::DriverStatus, INPUT_ERROR if the combination does not match the loop frequency
+   * 
+   */
+  auto SetSampleRate(std::uint16_t output_data_rate_in_hz, types::ImuLowPassFilter low_pass_filter, std::uint16_t loop_frequency_in_hz) noexcept -> types::DriverStatus override;
+
   /**
    * @brief Used for reading the gyroscopes measured values
    * @return Vector of X, Y and Z axis of the orientation in three-dimensional space
@@ -92,6 +115,27 @@ class InertialMeasurement final : public InertialMeasurementInterface {
    */
   auto GetMagnetometer(void) noexcept -> types::EuclideanVector<std::int16_t> override;
 
+  /**
+   * @brief Used for reading the gyroscopes measured values with the calibration applied
+   * @return Angular rate around X, Y and Z axis in dps, without the rounding of GetGyroscope()
+   * 
+   */
+  auto GetCalibratedGyroscope(void) noexcept -> types::EuclideanVector<float> override;
+
+  /**
+   * @brief Used for reading the accelerometers measured values with the calibration applied
+   * @return Acceleration along X, Y and Z axis in g, without the rounding of GetAccelerometer()
+   * 
+   */
+  auto GetCalibratedAccelerometer(void) noexcept -> types::EuclideanVector<float> override;
+
+  /**
+   * @brief Used for reading the magnetometers measured values with sensitivity adjustment and iron correction applied
+   * @return Magnetic field along X, Y and Z axis in uT, without the rounding of GetMagnetometer()
+   * 
+   */
+  auto GetCalibratedMagnetometer(void) noexcept -> types::EuclideanVector<float> override;
+
   /**
    * @brief Used for reading the temperature of the Inertial Measurement Unit
    * @return Temperature of Inertial Measurement Unit as Integer
@@ -99,12 +143,69 @@ class InertialMeasurement final : public InertialMeasurementInterface {
    */
   auto GetTemperature(void) noexcept -> int override;
 
+  /**
+   * @brief Starts the calibration of gyroscope and accelerometer after Init(). A calibration
+   *        kept over a warm reset is applied at once, otherwise the following calls of Update()
+   *        collect stationary samples until the calibration is done and stored.
+   * @return A types::DriverStatus, HAL_ERROR if the Inertial Measurement Unit is not initialized
+   * 
+   */
+  auto StartCalibration(void) noexcept -> types::DriverStatus override;
+
+  /**
+   * @brief Used for reading the progress of the calibration
+   * @return State of the calibration as types::ImuCalibrationState
+   * 
+   */
+  auto GetCalibrationState(void) noexcept -> types::ImuCalibrationState override;
+
+  /**
+   * @brief Starts the hard and soft iron calibration of the magnetometer, the drone has to be
+   *        rotated in all directions while Update() is called
+   * @return A types::DriverStatus, HAL_ERROR if the Inertial Measurement Unit is not initialized
+   * 
+   */
+  auto StartMagnetometerCalibration(void) noexcept -> types::DriverStatus override;
+
+  /**
+   * @brief Fits an ellipsoid to the collected magnetometer samples and applies the correction
+   * @return A types::DriverStatus, INPUT_ERROR if the samples do not cover enough directions
+   * 
+   */
+  auto FinishMagnetometerCalibration(void) noexcept -> types::DriverStatus override;
+
+  /**
+   * @brief Used for reading the recent gyroscope measurements, e.g. to compensate the latency of other sensors
+   * @return History of the calibrated gyroscope in dps, filled by Update(timestamp_in_us)
+   * 
+   */
+  auto GetGyroscopeHistory(void) const noexcept -> const ImuSensorHistory& override;
+
+  /**
+   * @brief Used for reading the recent accelerometer measurements
+   * @return History of the calibrated accelerometer in g, filled by Update(timestamp_in_us)
+   * 
+   */
+  auto GetAccelerometerHistory(void) const noexcept -> const ImuSensorHistory& override;
+
+  /**
+   * @brief Used for reading the recent magnetometer measurements
+   * @return History of the calibrated magnetometer in uT, filled by Update(timestamp_in_us)
+   * 
+   */
+  auto GetMagnetometerHistory(void) const noexcept -> const ImuSensorHistory& override;
+
   /**
   * @brief Only used for Unittests, to be able to inject a Mock Object
   * @param imu Unique Pointer to Mock Object
   * 
   */
   auto UnitTestSetImuSeam(std::unique_ptr<imu::GenericInertialMeasurementUnit> imu) noexcept -> void override;
+
+ private:
+  ImuSensorHistory gyroscope_history_;
+  ImuSensorHistory accelerometer_history_;
+  ImuSensorHistory magnetometer_history_;
 };
 
 }  // namespace imu
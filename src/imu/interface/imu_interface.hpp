@@ -2,12 +2,16 @@
 #define SRC_IMU_INTERFACE_HPP_
 
 #include "basic_types.hpp"
-#include "i2c.hpp"
 #include "imu_sensitivity.hpp"
 #include "mpu9255.hpp"
+#include "register_transport_interface.hpp"
+#include "sensor_history.hpp"
 
 namespace imu {
 
+/// History of the last calibrated measurements of one sensor, 31 samples cover 31 ms at 1 kHz
+using ImuSensorHistory = utilities::SensorHistory<float, 32>;
+
 /**
  * @brief The InertialMeasurementInterface provides an interface for the Inertial Measurement Unit.
  * 
@@ -19,21 +23,33 @@ class InertialMeasurementInterface {
 
   /**
    * @brief  The custom constructor is the one to be used. 
-   * @param  i2c_handler Unique pointer to I2C Handler defined by hal driver 
+   * @param  transport Shared pointer to the register transport (I2C or SPI) the IMU is connected to 
    * 
    */
-  explicit InertialMeasurementInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler, std::unique_ptr<imu::GenericInertialMeasurementUnit> imu) : imu_(std::move(imu)){};
+  explicit InertialMeasurementInterface(std::shared_ptr<transport::RegisterTransportInterface> transport, std::unique_ptr<imu::GenericInertialMeasurementUnit> imu) : imu_(std::move(imu)){};
 
   virtual auto Init(void) noexcept -> types::DriverStatus = 0;
   virtual auto Update(void) noexcept -> types::DriverStatus = 0;
+  virtual auto Update(std::uint32_t timestamp_in_us) noexcept -> types::DriverStatus = 0;
   virtual void SetGyroscopeSensitivity(types::ImuSensitivity gyroscope_sensitivity) noexcept = 0;
   virtual auto GetGyroscopeSensitivity(void) noexcept -> types::ImuSensitivity = 0;
   virtual void SetAccelerometerSensitivity(types::ImuSensitivity accelerometer_sensitivity) noexcept = 0;
   virtual auto GetAccelerometerSensitivity(void) noexcept -> types::ImuSensitivity = 0;
+  virtual auto SetSampleRate(std::uint16_t output_data_rate_in_hz, types::ImuLowPassFilter low_pass_filter, std::uint16_t loop_frequency_in_hz) noexcept -> types::DriverStatus = 0;
   virtual auto GetGyroscope(void) noexcept -> types::EuclideanVector<std::int16_t> = 0;
   virtual auto GetAccelerometer(void) noexcept -> types::EuclideanVector<std::int16_t> = 0;
   virtual auto GetMagnetometer(void) noexcept -> types::EuclideanVector<std::int16_t> = 0;
+  virtual auto GetCalibratedGyroscope(void) noexcept -> types::EuclideanVector<float> = 0;
+  virtual auto GetCalibratedAccelerometer(void) noexcept -> types::EuclideanVector<float> = 0;
+  virtual auto GetCalibratedMagnetometer(void) noexcept -> types::EuclideanVector<float> = 0;
   virtual auto GetTemperature(void) noexcept -> int = 0;
+  virtual auto StartCalibration(void) noexcept -> types::DriverStatus = 0;
+  virtual auto GetCalibrationState(void) noexcept -> types::ImuCalibrationState = 0;
+  virtual auto StartMagnetometerCalibration(void) noexcept -> types::DriverStatus = 0;
+  virtual auto FinishMagnetometerCalibration(void) noexcept -> types::DriverStatus = 0;
+  virtual auto GetGyroscopeHistory(void) const noexcept -> const ImuSensorHistory& = 0;
+  virtual auto GetAccelerometerHistory(void) const noexcept -> const ImuSensorHistory& = 0;
+  virtual auto GetMagnetometerHistory(void) const noexcept -> const ImuSensorHistory& = 0;
   virtual auto UnitTestSetImuSeam(std::unique_ptr<imu::GenericInertialMeasurementUnit> imu) noexcept -> void = 0;
 
  protected:
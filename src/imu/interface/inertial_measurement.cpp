@@ -10,6 +10,20 @@ auto InertialMeasurement::Update(void) noexcept -> types::DriverStatus {
   return imu_->Update();
 }
 
+auto InertialMeasurement::Update(std::uint32_t timestamp_in_us) noexcept -> types::DriverStatus {
+  const auto status = Update();
+
+  // Each history only grows with the samples of its own sensor, the magnetometer samples slower than the others
+  const auto sensor_update = imu_->GetSensorUpdate();
+  if (sensor_update.gyroscope)
+    gyroscope_history_.Push(imu_->GetCalibratedGyroscope(), timestamp_in_us);
+  if (sensor_update.accelerometer)
+    accelerometer_history_.Push(imu_->GetCalibratedAccelerometer(), timestamp_in_us);
+  if (sensor_update.magnetometer)
+    magnetometer_history_.Push(imu_->GetCalibratedMagnetometer(), timestamp_in_us);
+  return status;
+}
+
 void InertialMeasurement::SetGyroscopeSensitivity(types::ImuSensitivity gyroscope_sensitivity) noexcept {
   imu_->SetGyroscopeSensitivity(gyroscope_sensitivity);
 }
@@ -26,6 +40,10 @@ auto InertialMeasurement::GetAccelerometerSensitivity(void) noexcept -> types::I
   return imu_->GetAccelerometerSensitivity();
 }
 
+auto InertialMeasurement::SetSampleRate(std::uint16_t output_data_rate_in_hz, types::ImuLowPassFilter low_pass_filter, std::uint16_t loop_frequency_in_hz) noexcept -> types::DriverStatus {
+  return imu_->SetSampleRate(output_data_rate_in_hz, low_pass_filter, loop_frequency_in_hz);
+}
+
 auto InertialMeasurement::GetGyroscope(void) noexcept -> types::EuclideanVector<std::int16_t> {
   return imu_->GetGyroscope();
 }
@@ -38,10 +56,50 @@ auto InertialMeasurement::GetMagnetometer(void) noexcept -> types::EuclideanVect
   return imu_->GetMagnetometer();
 }
 
+auto InertialMeasurement::GetCalibratedGyroscope(void) noexcept -> types::EuclideanVector<float> {
+  return imu_->GetCalibratedGyroscope();
+}
+
+auto InertialMeasurement::GetCalibratedAccelerometer(void) noexcept -> types::EuclideanVector<float> {
+  return imu_->GetCalibratedAccelerometer();
+}
+
+auto InertialMeasurement::GetCalibratedMagnetometer(void) noexcept -> types::EuclideanVector<float> {
+  return imu_->GetCalibratedMagnetometer();
+}
+
 auto InertialMeasurement::GetTemperature(void) noexcept -> int {
   return imu_->GetTemperature();
 }
 
+auto InertialMeasurement::StartCalibration(void) noexcept -> types::DriverStatus {
+  return imu_->StartCalibration();
+}
+
+auto InertialMeasurement::GetCalibrationState(void) noexcept -> types::ImuCalibrationState {
+  return imu_->GetCalibrationState();
+}
+
+auto InertialMeasurement::StartMagnetometerCalibration(void) noexcept -> types::DriverStatus {
+  return imu_->StartMagnetometerCalibration();
+}
+
+auto InertialMeasurement::FinishMagnetometerCalibration(void) noexcept -> types::DriverStatus {
+  return imu_->FinishMagnetometerCalibration();
+}
+
+auto InertialMeasurement::GetGyroscopeHistory(void) const noexcept -> const ImuSensorHistory& {
+  return gyroscope_history_;
+}
+
+auto InertialMeasurement::GetAccelerometerHistory(void) const noexcept -> const ImuSensorHistory& {
+  return accelerometer_history_;
+}
+
+auto InertialMeasurement::GetMagnetometerHistory(void) const noexcept -> const ImuSensorHistory& {
+  return magnetometer_history_;
+}
+
 auto InertialMeasurement::UnitTestSetImuSeam(std::unique_ptr<imu::GenericInertialMeasurementUnit> imu) noexcept -> void {
   imu_ = std::move(imu);
 }
@@ -3,8 +3,11 @@
 
 #include <memory>
 #include "basic_types.hpp"
-#include "i2c.hpp"
+#include "imu_calibration.hpp"
+#include "imu_low_pass_filter.hpp"
+#include "imu_sensor_update.hpp"
 #include "imu_sensitivity.hpp"
+#include "register_transport_interface.hpp"
 
 namespace imu {
 
@@ -12,20 +15,29 @@ class GenericInertialMeasurementUnit {
  public:
   GenericInertialMeasurementUnit() = delete;
   virtual ~GenericInertialMeasurementUnit() = default;
-  explicit GenericInertialMeasurementUnit(std::shared_ptr<i2c::I2CInterface> i2c_handler) : i2c_handler_(i2c_handler) {}
+  explicit GenericInertialMeasurementUnit(std::shared_ptr<transport::RegisterTransportInterface> transport) : transport_(transport) {}
   virtual auto Init(void) noexcept -> types::DriverStatus = 0;
   virtual auto Update(void) noexcept -> types::DriverStatus = 0;
+  virtual auto GetSensorUpdate(void) noexcept -> types::ImuSensorUpdate = 0;
   virtual auto SetGyroscopeSensitivity(types::ImuSensitivity gyroscope_sensitivity) noexcept -> types::DriverStatus = 0;
   virtual auto GetGyroscopeSensitivity(void) noexcept -> types::ImuSensitivity = 0;
   virtual auto SetAccelerometerSensitivity(types::ImuSensitivity accelerometer_sensitivity) noexcept -> types::DriverStatus = 0;
   virtual auto GetAccelerometerSensitivity(void) noexcept -> types::ImuSensitivity = 0;
+  virtual auto SetSampleRate(std::uint16_t output_data_rate_in_hz, types::ImuLowPassFilter low_pass_filter, std::uint16_t loop_frequency_in_hz) noexcept -> types::DriverStatus = 0;
   virtual auto GetGyroscope(void) noexcept -> types::EuclideanVector<std::int16_t> = 0;
   virtual auto GetAccelerometer(void) noexcept -> types::EuclideanVector<std::int16_t> = 0;
   virtual auto GetMagnetometer(void) noexcept -> types::EuclideanVector<std::int16_t> = 0;
+  virtual auto GetCalibratedGyroscope(void) noexcept -> types::EuclideanVector<float> = 0;
+  virtual auto GetCalibratedAccelerometer(void) noexcept -> types::EuclideanVector<float> = 0;
+  virtual auto GetCalibratedMagnetometer(void) noexcept -> types::EuclideanVector<float> = 0;
   virtual auto GetTemperature(void) noexcept -> int = 0;
+  virtual auto StartCalibration(void) noexcept -> types::DriverStatus = 0;
+  virtual auto GetCalibrationState(void) noexcept -> types::ImuCalibrationState = 0;
+  virtual auto StartMagnetometerCalibration(void) noexcept -> types::DriverStatus = 0;
+  virtual auto FinishMagnetometerCalibration(void) noexcept -> types::DriverStatus = 0;
 
  protected:
-  std::shared_ptr<i2c::I2CInterface> i2c_handler_;
+  std::shared_ptr<transport::RegisterTransportInterface> transport_;
 };
 
 }  // namespace imu
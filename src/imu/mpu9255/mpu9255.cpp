@@ -2,155 +2,381 @@
 
 namespace imu {
 
-auto Mpu9255::Init(void) noexcept -> types::DriverStatus {
-  CreateSensorPointer();
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::Init(void) noexcept -> types::DriverStatus {
+  this->CreateSensors();
 
   SetInitConfigMPU9255();
 
   if (InitAllSensors()) {
+    if (magnetometer_read_mode_ == types::MagnetometerReadMode::AUXILIARY_I2C_MASTER &&
+        !SetInitConfigAuxiliaryI2CMaster())
+      return types::DriverStatus::HAL_ERROR;
+
     SetToInitialized();
     return types::DriverStatus::OK;
   }
   return types::DriverStatus::HAL_ERROR;
 }
 
-auto Mpu9255::CreateSensorPointer(void) noexcept -> void {
-  if (gyroscope_ == nullptr) {
-    gyroscope_ = std::make_unique<imu::Gyroscope>(i2c_handler_);
-  }
-  if (accelerometer_ == nullptr) {
-    accelerometer_ = std::make_unique<imu::Accelerometer>(i2c_handler_);
-  }
-  if (magnetometer_ == nullptr) {
-    magnetometer_ = std::make_unique<imu::Magnetometer>(i2c_handler_);
-  }
-  if (temperature_ == nullptr) {
-    temperature_ = std::make_unique<imu::Temperature>(i2c_handler_);
-  }
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::SetInitConfigMPU9255(void) noexcept -> void {
+  constexpr auto int_pin_cfg_value = utilities::Byte(0)
+                                         .Set(INT_PIN_CFG_BYPASS_EN, 1)     // Set I2C Master of MPU9255 to Bypass mode
+                                         .Set(INT_PIN_CFG_LATCH_INT_EN, 1)  // Held Pin Level until interrupt status was cleared.
+                                         .Get();
+  SetMPU9255Register(INT_PIN_CFG, int_pin_cfg_value);
+
+  constexpr auto int_enable_value = utilities::Byte(0)
+                                        .Set(INT_ENABLE_RAW_RDY_EN, 1)  // Enable Raw Sensor Data Ready interrupt to propagate to interrupt pin.
+                                        .Get();
+  SetMPU9255Register(INT_ENABLE, int_enable_value);
 }
 
-auto Mpu9255::SetInitConfigMPU9255(void) noexcept -> void {
-  auto int_pin_cfg_value = std::make_unique<utilities::Byte>(0);
-  int_pin_cfg_value->SetBit(1);  // Set I2C Master of MPU9255 to Bypass mode
-  int_pin_cfg_value->SetBit(5);  // Held Pin Level until interrupt status was cleared.
-  SetMPU9255Register(INT_PIN_CFG, int_pin_cfg_value->Get());
-
-  auto int_enable_value = std::make_unique<utilities::Byte>(0);
-  int_enable_value->SetBit(0);  // Enable Raw Sensor Data Ready interrupt to propagate to interrupt pin.
-  SetMPU9255Register(INT_ENABLE, int_enable_value->Get());
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::SetInitConfigAuxiliaryI2CMaster(void) noexcept -> bool {
+  // See MPU-9255 Register Map, Revision 1.0, p. 18 ff.
+  constexpr auto i2c_mst_ctrl_value = utilities::Byte(0)
+                                          .Set(I2C_MST_CTRL_I2C_MST_CLK, I2C_MST_CLK_400_KHZ)
+                                          .Set(I2C_MST_CTRL_WAIT_FOR_ES, 1)  // Delay Data Ready interrupt until external sensor data is loaded
+                                          .Get();
+
+  constexpr auto i2c_slv0_addr_value = utilities::Byte(0)
+                                           .Set(I2C_SLV_ADDR_I2C_ID, AK8963_ADDRESS)
+                                           .Set(I2C_SLV_ADDR_RNW, 1)  // Slave 0 transfer is a read
+                                           .Get();
+
+  constexpr auto i2c_slv0_ctrl_value = utilities::Byte(0)
+                                           .Set(I2C_SLV_CTRL_LENG, AK8963_ST1_TO_ST2_LENGTH_IN_BYTES)
+                                           .Set(I2C_SLV_CTRL_EN, 1)  // Enable reading ST1 to ST2 into EXT_SENS_DATA_00 every sample
+                                           .Get();
+
+  constexpr auto int_pin_cfg_value = utilities::Byte(0)
+                                         .Set(INT_PIN_CFG_LATCH_INT_EN, 1)  // Held Pin Level until interrupt status was cleared, Bypass mode off.
+                                         .Get();
+
+  constexpr auto user_ctrl_value = utilities::Byte(0)
+                                       .Set(USER_CTRL_I2C_MST_EN, 1)  // Enable I2C Master of MPU9255
+                                       .Get();
+
+  return (SetMPU9255Register(I2C_MST_CTRL, i2c_mst_ctrl_value) == types::DriverStatus::OK &&
+          SetMPU9255Register(I2C_SLV0_ADDR, i2c_slv0_addr_value) == types::DriverStatus::OK &&
+          SetMPU9255Register(I2C_SLV0_REG, AK8963_ST1) == types::DriverStatus::OK &&
+          SetMPU9255Register(I2C_SLV0_CTRL, i2c_slv0_ctrl_value) == types::DriverStatus::OK &&
+          SetMPU9255Register(INT_PIN_CFG, int_pin_cfg_value) == types::DriverStatus::OK &&
+          SetMPU9255Register(USER_CTRL, user_ctrl_value) == types::DriverStatus::OK &&
+          this->MagnetometerSensor().SetReadMode(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER) == types::DriverStatus::OK);
 }
 
-auto Mpu9255::SetMPU9255Register(const std::uint8_t register_, const std::uint8_t register_value) noexcept -> void {
-  i2c_handler_->Write(MPU9255_ADDRESS, {register_, register_value});
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::SetMPU9255Register(const std::uint8_t register_, const std::uint8_t register_value) noexcept -> types::DriverStatus {
+  return transport_->Write(MPU9255_ADDRESS, {register_, register_value});
 }
 
-auto Mpu9255::InitAllSensors(void) noexcept -> bool {
-  return (gyroscope_->Init(MPU9255_ADDRESS) == types::DriverStatus::OK &&
-          accelerometer_->Init(MPU9255_ADDRESS) == types::DriverStatus::OK &&
-          magnetometer_->Init(AK8963_ADDRESS) == types::DriverStatus::OK &&
-          temperature_->Init(MPU9255_ADDRESS) == types::DriverStatus::OK);
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::InitAllSensors(void) noexcept -> bool {
+  return (this->GyroscopeSensor().Init(MPU9255_ADDRESS) == types::DriverStatus::OK &&
+          this->AccelerometerSensor().Init(MPU9255_ADDRESS) == types::DriverStatus::OK &&
+          this->MagnetometerSensor().Init(AK8963_ADDRESS) == types::DriverStatus::OK &&
+          this->TemperatureSensor().Init(MPU9255_ADDRESS) == types::DriverStatus::OK);
 }
 
-auto Mpu9255::Update(void) noexcept -> types::DriverStatus {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::Update(void) noexcept -> types::DriverStatus {
+  sensor_update_ = types::ImuSensorUpdate{};
+
   if (!IsInitialized())
     return types::DriverStatus::HAL_ERROR;
 
   if (UpdateAllSensors()) {
     SetToInitialized();
+    if (calibration_state_ == types::ImuCalibrationState::COLLECTING)
+      AddCalibrationSample();
+    if (is_fitting_magnetometer_ && sensor_update_.magnetometer)
+      magnetometer_calibration_.AddSample(this->MagnetometerSensor().GetUncalibrated());
     return types::DriverStatus::OK;
   }
   return types::DriverStatus::HAL_ERROR;
 }
 
-auto Mpu9255::IsInitialized(void) noexcept -> bool {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetSensorUpdate(void) noexcept -> types::ImuSensorUpdate {
+  return sensor_update_;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::StartCalibration(void) noexcept -> types::DriverStatus {
+  if (!IsInitialized())
+    return types::DriverStatus::HAL_ERROR;
+
+  types::SensorCalibration gyroscope;
+  types::SensorCalibration accelerometer;
+  if (LoadCalibration(gyroscope, accelerometer) == types::DriverStatus::OK) {
+    ApplyCalibration(gyroscope, accelerometer);
+    calibration_state_ = types::ImuCalibrationState::CALIBRATED;
+    return types::DriverStatus::OK;
+  }
+
+  ApplyCalibration(types::SensorCalibration{}, types::SensorCalibration{});
+  startup_calibration_.Reset();
+  calibration_state_ = types::ImuCalibrationState::COLLECTING;
+  return types::DriverStatus::OK;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetCalibrationState(void) noexcept -> types::ImuCalibrationState {
+  return calibration_state_;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::StartMagnetometerCalibration(void) noexcept -> types::DriverStatus {
+  if (!IsInitialized())
+    return types::DriverStatus::HAL_ERROR;
+
+  magnetometer_calibration_.Reset();
+  is_fitting_magnetometer_ = true;
+  return types::DriverStatus::OK;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::FinishMagnetometerCalibration(void) noexcept -> types::DriverStatus {
+  if (!is_fitting_magnetometer_)
+    return types::DriverStatus::HAL_ERROR;
+
+  is_fitting_magnetometer_ = false;
+  types::HardAndSoftIronCalibration calibration;
+  if (magnetometer_calibration_.Solve(calibration) != types::DriverStatus::OK)
+    return types::DriverStatus::INPUT_ERROR;
+
+  this->MagnetometerSensor().SetHardAndSoftIronCalibration(calibration);
+  return types::DriverStatus::OK;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::AddCalibrationSample(void) noexcept -> void {
+  const auto state = startup_calibration_.AddSample(this->GyroscopeSensor().GetUncalibrated(), this->AccelerometerSensor().GetUncalibrated());
+  if (state != types::ImuCalibrationState::CALIBRATED)
+    return;
+
+  const auto gyroscope = startup_calibration_.GetGyroscopeCalibration();
+  const auto accelerometer = startup_calibration_.GetAccelerometerCalibration();
+  ApplyCalibration(gyroscope, accelerometer);
+  StoreCalibration(gyroscope, accelerometer);
+  calibration_state_ = types::ImuCalibrationState::CALIBRATED;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::ApplyCalibration(const types::SensorCalibration& gyroscope, const types::SensorCalibration& accelerometer) noexcept -> void {
+  this->GyroscopeSensor().SetCalibration(gyroscope);
+  this->AccelerometerSensor().SetCalibration(accelerometer);
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::IsInitialized(void) noexcept -> bool {
   return initialized_;
 }
 
-auto Mpu9255::SetToInitialized(void) noexcept -> void {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::SetToInitialized(void) noexcept -> void {
   initialized_ = true;
 }
 
-auto Mpu9255::UpdateAllSensors(void) noexcept -> bool {
-  return (gyroscope_->Update() == types::DriverStatus::OK &&
-          accelerometer_->Update() == types::DriverStatus::OK &&
-          magnetometer_->Update() == types::DriverStatus::OK &&
-          temperature_->Update() == types::DriverStatus::OK);
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::UpdateAllSensors(void) noexcept -> bool {
+  ReadSensorDataBurst();
+
+  // Every sensor is updated on its own, so a failing or not yet sampled magnetometer does not drop the others
+  sensor_update_.gyroscope = this->GyroscopeSensor().Update() == types::DriverStatus::OK;
+  sensor_update_.accelerometer = this->AccelerometerSensor().Update() == types::DriverStatus::OK;
+  const bool magnetometer_updated = this->MagnetometerSensor().Update() == types::DriverStatus::OK;
+  sensor_update_.magnetometer = magnetometer_updated && this->MagnetometerSensor().HasNewSample();
+  sensor_update_.temperature = this->TemperatureSensor().Update() == types::DriverStatus::OK;
+
+  return sensor_update_.gyroscope && sensor_update_.accelerometer && magnetometer_updated && sensor_update_.temperature;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::ReadSensorDataBurst(void) noexcept -> void {
+  // One read from ACCEL_XOUT_H feeds accelerometer, temperature and gyroscope, with the auxiliary I2C master
+  // the magnetometer mirrored into EXT_SENS_DATA_00 as well. If it fails, every sensor reads its own registers.
+  const auto burst_length = magnetometer_read_mode_ == types::MagnetometerReadMode::AUXILIARY_I2C_MASTER
+                                ? SENSOR_DATA_BURST_WITH_MAGNETOMETER_LENGTH_IN_BYTES
+                                : SENSOR_DATA_BURST_LENGTH_IN_BYTES;
+  const auto burst_status = transport_->ReadContentFromRegisterIntoBuffer(MPU9255_ADDRESS, SENSOR_DATA_BURST_START, sensor_data_burst_.data(), burst_length);
+  const auto valid_length = static_cast<std::uint8_t>(burst_status == types::DriverStatus::OK ? burst_length : 0);
+
+  this->GyroscopeSensor().SetRawValuesFromBurst(MPU9255_ADDRESS, SENSOR_DATA_BURST_START, sensor_data_burst_.data(), valid_length);
+  this->AccelerometerSensor().SetRawValuesFromBurst(MPU9255_ADDRESS, SENSOR_DATA_BURST_START, sensor_data_burst_.data(), valid_length);
+  this->MagnetometerSensor().SetRawValuesFromBurst(MPU9255_ADDRESS, SENSOR_DATA_BURST_START, sensor_data_burst_.data(), valid_length);
+  this->TemperatureSensor().SetRawValuesFromBurst(MPU9255_ADDRESS, SENSOR_DATA_BURST_START, sensor_data_burst_.data(), valid_length);
 }
 
-auto Mpu9255::SetGyroscopeSensitivity(const types::ImuSensitivity gyroscope_sensitivity) noexcept -> types::DriverStatus {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::SetGyroscopeSensitivity(const types::ImuSensitivity gyroscope_sensitivity) noexcept -> types::DriverStatus {
   if (!IsInitialized())
     return types::DriverStatus::HAL_ERROR;
 
-  return gyroscope_->SetSensitivity(gyroscope_sensitivity);
+  return this->GyroscopeSensor().SetSensitivity(gyroscope_sensitivity);
 }
 
-auto Mpu9255::GetGyroscopeSensitivity(void) noexcept -> types::ImuSensitivity {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetGyroscopeSensitivity(void) noexcept -> types::ImuSensitivity {
   if (!IsInitialized())
     return types::ImuSensitivity::FINEST;
 
-  return gyroscope_->GetSensitivity();
+  return this->GyroscopeSensor().GetSensitivity();
 }
 
-auto Mpu9255::SetAccelerometerSensitivity(const types::ImuSensitivity accelerometer_sensitivity) noexcept -> types::DriverStatus {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::SetAccelerometerSensitivity(const types::ImuSensitivity accelerometer_sensitivity) noexcept -> types::DriverStatus {
   if (!IsInitialized())
     return types::DriverStatus::HAL_ERROR;
 
-  return accelerometer_->SetSensitivity(accelerometer_sensitivity);
+  return this->AccelerometerSensor().SetSensitivity(accelerometer_sensitivity);
 }
 
-auto Mpu9255::GetAccelerometerSensitivity(void) noexcept -> types::ImuSensitivity {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetAccelerometerSensitivity(void) noexcept -> types::ImuSensitivity {
   if (!IsInitialized())
     return types::ImuSensitivity::FINEST;
 
-  return accelerometer_->GetSensitivity();
+  return this->AccelerometerSensor().GetSensitivity();
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::SetSampleRate(const std::uint16_t output_data_rate_in_hz, const types::ImuLowPassFilter low_pass_filter, const std::uint16_t loop_frequency_in_hz) noexcept -> types::DriverStatus {
+  if (!IsInitialized())
+    return types::DriverStatus::HAL_ERROR;
+
+  if (!IsSampleRateMatchingLoop(output_data_rate_in_hz, low_pass_filter, loop_frequency_in_hz))
+    return types::DriverStatus::INPUT_ERROR;
+
+  // See MPU-9255 Register Map, Revision 1.0, p. 12 ff.: FCHOICE_B and ACCEL_FCHOICE_B stay "0", so DLPF_CFG is active
+  const auto dlpf_cfg = static_cast<std::uint8_t>(low_pass_filter);
+  const auto config_value = utilities::Byte(0).Set(CONFIG_DLPF_CFG, dlpf_cfg).Get();
+  const auto accel_config2_value = utilities::Byte(0).Set(ACCEL_CONFIG2_A_DLPF_CFG, dlpf_cfg).Get();
+  const auto sample_rate_divider = static_cast<std::uint8_t>(INTERNAL_SAMPLE_RATE_IN_HZ / output_data_rate_in_hz - 1);
+
+  if (SetMPU9255Register(CONFIG, config_value) != types::DriverStatus::OK ||
+      SetMPU9255Register(ACCEL_CONFIG2, accel_config2_value) != types::DriverStatus::OK ||
+      SetMPU9255Register(SMPLRT_DIV, sample_rate_divider) != types::DriverStatus::OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  return types::DriverStatus::OK;
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::IsSampleRateMatchingLoop(const std::uint16_t output_data_rate_in_hz, const types::ImuLowPassFilter low_pass_filter, const std::uint16_t loop_frequency_in_hz) noexcept -> bool {
+  if (output_data_rate_in_hz == 0 || loop_frequency_in_hz == 0)
+    return false;
+
+  // Output data rate has to be an exact divider of the internal sample rate
+  if (INTERNAL_SAMPLE_RATE_IN_HZ % output_data_rate_in_hz != 0 ||
+      INTERNAL_SAMPLE_RATE_IN_HZ / output_data_rate_in_hz > MAX_SAMPLE_RATE_DIVIDER)
+    return false;
+
+  // Every loop iteration gets a new sample and no sample drifts against the loop
+  if (output_data_rate_in_hz < loop_frequency_in_hz || output_data_rate_in_hz % loop_frequency_in_hz != 0)
+    return false;
+
+  // Vibration above the Nyquist frequency of the loop would alias into the measurement
+  return 2.0f * GetAccelerometerBandwidthInHz(low_pass_filter) <= static_cast<float>(loop_frequency_in_hz);
+}
+
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetAccelerometerBandwidthInHz(const types::ImuLowPassFilter low_pass_filter) noexcept -> float {
+  auto bandwidth = static_cast<float>(INTERNAL_SAMPLE_RATE_IN_HZ);
+
+  switch (low_pass_filter) {
+    case types::ImuLowPassFilter::BANDWIDTH_184_HZ:
+      bandwidth = 218.1f;
+      break;
+    case types::ImuLowPassFilter::BANDWIDTH_92_HZ:
+      bandwidth = 99.0f;
+      break;
+    case types::ImuLowPassFilter::BANDWIDTH_41_HZ:
+      bandwidth = 44.8f;
+      break;
+    case types::ImuLowPassFilter::BANDWIDTH_20_HZ:
+      bandwidth = 21.2f;
+      break;
+    case types::ImuLowPassFilter::BANDWIDTH_10_HZ:
+      bandwidth = 10.2f;
+      break;
+    case types::ImuLowPassFilter::BANDWIDTH_5_HZ:
+      bandwidth = 5.05f;
+      break;
+  }
+  return bandwidth;
 }
 
-auto Mpu9255::GetGyroscope(void) noexcept -> types::EuclideanVector<std::int16_t> {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetGyroscope(void) noexcept -> types::EuclideanVector<std::int16_t> {
   if (!IsInitialized())
     return ReturnVectorDefault();
 
-  return gyroscope_->Get();
+  return this->GyroscopeSensor().Get();
 }
 
-auto Mpu9255::GetAccelerometer(void) noexcept -> types::EuclideanVector<std::int16_t> {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetAccelerometer(void) noexcept -> types::EuclideanVector<std::int16_t> {
   if (!IsInitialized())
     return ReturnVectorDefault();
 
-  return accelerometer_->Get();
+  return this->AccelerometerSensor().Get();
 }
 
-auto Mpu9255::GetMagnetometer(void) noexcept -> types::EuclideanVector<std::int16_t> {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetMagnetometer(void) noexcept -> types::EuclideanVector<std::int16_t> {
   if (!IsInitialized())
     return ReturnVectorDefault();
 
-  return magnetometer_->Get();
+  return this->MagnetometerSensor().Get();
 }
 
-auto Mpu9255::ReturnVectorDefault(void) noexcept -> types::EuclideanVector<std::int16_t> {
-  return types::EuclideanVector<std::int16_t>{-1, -1, -1};
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetCalibratedGyroscope(void) noexcept -> types::EuclideanVector<float> {
+  if (!IsInitialized())
+    return ReturnCalibratedVectorDefault();
+
+  return this->GyroscopeSensor().GetCalibrated();
 }
 
-auto Mpu9255::GetTemperature(void) noexcept -> int {
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetCalibratedAccelerometer(void) noexcept -> types::EuclideanVector<float> {
   if (!IsInitialized())
-    return -1;
+    return ReturnCalibratedVectorDefault();
 
-  return temperature_->Get();
+  return this->AccelerometerSensor().GetCalibrated();
 }
 
-auto Mpu9255::UnitTestSetGyroscope(std::unique_ptr<imu::GyroscopeInterface> gyroscope) noexcept -> void {
-  gyroscope_ = std::move(gyroscope);
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetCalibratedMagnetometer(void) noexcept -> types::EuclideanVector<float> {
+  if (!IsInitialized())
+    return ReturnCalibratedVectorDefault();
+
+  return this->MagnetometerSensor().GetCalibrated();
 }
 
-auto Mpu9255::UnitTestSetAccelerometer(std::unique_ptr<imu::AccelerometerInterface> accelerometer) noexcept -> void {
-  accelerometer_ = std::move(accelerometer);
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::ReturnVectorDefault(void) noexcept -> types::EuclideanVector<std::int16_t> {
+  return types::EuclideanVector<std::int16_t>{-1, -1, -1};
 }
 
-auto Mpu9255::UnitTestSetMagnetometer(std::unique_ptr<imu::MagnetometerInterface> magnetometer) noexcept -> void {
-  magnetometer_ = std::move(magnetometer);
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::ReturnCalibratedVectorDefault(void) noexcept -> types::EuclideanVector<float> {
+  return types::EuclideanVector<float>{-1.0f, -1.0f, -1.0f};
 }
 
-auto Mpu9255::UnitTestSetTemperature(std::unique_ptr<imu::TemperatureInterface> temperature) noexcept -> void {
-  temperature_ = std::move(temperature);
+template <typename SensorSet>
+auto BasicMpu9255<SensorSet>::GetTemperature(void) noexcept -> int {
+  if (!IsInitialized())
+    return -1;
+
+  return this->TemperatureSensor().Get();
 }
 
+template class BasicMpu9255<Mpu9255InterfaceSensorSet>;
+template class BasicMpu9255<Mpu9255StaticSensorSet>;
+
 }  // namespace imu
\ No newline at end of file
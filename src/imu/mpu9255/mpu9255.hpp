@@ -1,58 +1,89 @@
 #ifndef SRC_MPU9255_HPP_
 #define SRC_MPU9255_HPP_
 
-#include "accelerometer.hpp"
-#include "accelerometer_interface.hpp"
 #include "byte.hpp"
+#include "calibration_store.hpp"
+#include "ellipsoid_fit_calibration.hpp"
 #include "generic_imu.hpp"
-#include "gyroscope.hpp"
-#include "gyroscope_interface.hpp"
-#include "magnetometer.hpp"
-#include "magnetometer_interface.hpp"
-#include "temperature.hpp"
-#include "temperature_interface.hpp"
+#include "imu_magnetometer_read_mode.hpp"
+#include "mpu9255_sensor_set.hpp"
+#include "startup_calibration.hpp"
 
 namespace imu {
 
-class Mpu9255 final : public GenericInertialMeasurementUnit {
+/**
+ * @brief MPU9255 driver, composed at compile time from a sensor set.
+ *        Mpu9255InterfaceSensorSet keeps the sensors behind their interfaces for mocking,
+ *        Mpu9255StaticSensorSet holds the concrete sensors by value, so Update() binds statically.
+ * 
+ */
+template <typename SensorSet>
+class BasicMpu9255 final : public GenericInertialMeasurementUnit, public SensorSet {
  public:
-  Mpu9255() = delete;
-  virtual ~Mpu9255() = default;
-  explicit Mpu9255(std::shared_ptr<i2c::I2CInterface> i2c_handler) : GenericInertialMeasurementUnit(i2c_handler) {}
+  BasicMpu9255() = delete;
+  virtual ~BasicMpu9255() = default;
+  explicit BasicMpu9255(std::shared_ptr<transport::RegisterTransportInterface> transport,
+                        const types::MagnetometerReadMode magnetometer_read_mode = types::MagnetometerReadMode::BYPASS) : GenericInertialMeasurementUnit(transport), SensorSet(transport), magnetometer_read_mode_(transport->ReachesBypassedDevices() ? magnetometer_read_mode : types::MagnetometerReadMode::AUXILIARY_I2C_MASTER) {}
   auto Init(void) noexcept -> types::DriverStatus override;
   auto Update(void) noexcept -> types::DriverStatus override;
+  auto GetSensorUpdate(void) noexcept -> types::ImuSensorUpdate override;
   auto SetGyroscopeSensitivity(const types::ImuSensitivity gyroscope_sensitivity) noexcept -> types::DriverStatus override;
   auto GetGyroscopeSensitivity(void) noexcept -> types::ImuSensitivity override;
   auto SetAccelerometerSensitivity(const types::ImuSensitivity accelerometer_sensitivity) noexcept -> types::DriverStatus override;
   auto GetAccelerometerSensitivity(void) noexcept -> types::ImuSensitivity override;
+  auto SetSampleRate(const std::uint16_t output_data_rate_in_hz, const types::ImuLowPassFilter low_pass_filter, const std::uint16_t loop_frequency_in_hz) noexcept -> types::DriverStatus override;
   auto GetGyroscope(void) noexcept -> types::EuclideanVector<std::int16_t> override;
   auto GetAccelerometer(void) noexcept -> types::EuclideanVector<std::int16_t> override;
   auto GetMagnetometer(void) noexcept -> types::EuclideanVector<std::int16_t> override;
+  auto GetCalibratedGyroscope(void) noexcept -> types::EuclideanVector<float> override;
+  auto GetCalibratedAccelerometer(void) noexcept -> types::EuclideanVector<float> override;
+  auto GetCalibratedMagnetometer(void) noexcept -> types::EuclideanVector<float> override;
   auto GetTemperature(void) noexcept -> int override;
+  auto StartCalibration(void) noexcept -> types::DriverStatus override;
+  auto GetCalibrationState(void) noexcept -> types::ImuCalibrationState override;
+  auto StartMagnetometerCalibration(void) noexcept -> types::DriverStatus override;
+  auto FinishMagnetometerCalibration(void) noexcept -> types::DriverStatus override;
   auto IsInitialized(void) noexcept -> bool;
 
-  auto UnitTestSetGyroscope(std::unique_ptr<imu::GyroscopeInterface> gyroscope) noexcept -> void;
-  auto UnitTestSetAccelerometer(std::unique_ptr<imu::AccelerometerInterface> accelerometer) noexcept -> void;
-  auto UnitTestSetMagnetometer(std::unique_ptr<imu::MagnetometerInterface> magnetometer) noexcept -> void;
-  auto UnitTestSetTemperature(std::unique_ptr<imu::TemperatureInterface> temperature) noexcept -> void;
-
  protected:
-  auto CreateSensorPointer(void) noexcept -> void;
   auto SetInitConfigMPU9255(void) noexcept -> void;
-  auto SetInitConfigAK8963(void) noexcept -> void;
-  auto SetMPU9255Register(const std::uint8_t register_, const std::uint8_t register_value) noexcept -> void;
+  auto SetInitConfigAuxiliaryI2CMaster(void) noexcept -> bool;
+  auto SetMPU9255Register(const std::uint8_t register_, const std::uint8_t register_value) noexcept -> types::DriverStatus;
+  auto IsSampleRateMatchingLoop(const std::uint16_t output_data_rate_in_hz, const types::ImuLowPassFilter low_pass_filter, const std::uint16_t loop_frequency_in_hz) noexcept -> bool;
+  auto GetAccelerometerBandwidthInHz(const types::ImuLowPassFilter low_pass_filter) noexcept -> float;
   auto InitAllSensors(void) noexcept -> bool;
   auto UpdateAllSensors(void) noexcept -> bool;
+  auto ReadSensorDataBurst(void) noexcept -> void;
   auto SetToInitialized(void) noexcept -> void;
   auto ReturnVectorDefault(void) noexcept -> types::EuclideanVector<std::int16_t>;
+  auto ReturnCalibratedVectorDefault(void) noexcept -> types::EuclideanVector<float>;
+  auto AddCalibrationSample(void) noexcept -> void;
+  auto ApplyCalibration(const types::SensorCalibration& gyroscope, const types::SensorCalibration& accelerometer) noexcept -> void;
 
   bool initialized_ = false;
-  std::unique_ptr<imu::GyroscopeInterface> gyroscope_ = NULL;
-  std::unique_ptr<imu::AccelerometerInterface> accelerometer_ = NULL;
-  std::unique_ptr<imu::MagnetometerInterface> magnetometer_ = NULL;
-  std::unique_ptr<imu::TemperatureInterface> temperature_ = NULL;
+  types::MagnetometerReadMode magnetometer_read_mode_ = types::MagnetometerReadMode::BYPASS;
+  types::ImuCalibrationState calibration_state_ = types::ImuCalibrationState::UNCALIBRATED;
+  types::ImuSensorUpdate sensor_update_;
+  StartupCalibration startup_calibration_;
+  bool is_fitting_magnetometer_ = false;
+  EllipsoidFitCalibration magnetometer_calibration_;
+  std::array<std::uint8_t, SENSOR_DATA_BURST_WITH_MAGNETOMETER_LENGTH_IN_BYTES> sensor_data_burst_{};
+  static constexpr std::uint16_t INTERNAL_SAMPLE_RATE_IN_HZ = 1000;
+  static constexpr std::uint16_t MAX_SAMPLE_RATE_DIVIDER = 256;
 };
 
+extern template class BasicMpu9255<Mpu9255InterfaceSensorSet>;
+extern template class BasicMpu9255<Mpu9255StaticSensorSet>;
+
+using Mpu9255 = BasicMpu9255<Mpu9255InterfaceSensorSet>;
+using StaticMpu9255 = BasicMpu9255<Mpu9255StaticSensorSet>;
+
+#ifdef IMU_STATIC_COMPOSITION
+using ConfiguredMpu9255 = StaticMpu9255;
+#else
+using ConfiguredMpu9255 = Mpu9255;
+#endif
+
 }  // namespace imu
 
 #endif
\ No newline at end of file
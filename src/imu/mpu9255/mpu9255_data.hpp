@@ -2,6 +2,7 @@
 #define SRC_MPU9255_REGISTERS_HPP_
 
 #include <cstdint>
+#include "byte.hpp"
 
 namespace imu {
 
@@ -11,6 +12,23 @@ static constexpr std::uint8_t WHO_AM_I_MPU9255_VALUE = 0x73;
 static constexpr std::uint8_t WHO_AM_I_MPU9255_REGISTER = 0x75;
 static constexpr std::uint8_t INT_PIN_CFG = 0x37;
 static constexpr std::uint8_t INT_ENABLE = 0x38;
+static constexpr std::uint8_t USER_CTRL = 0x6A;
+static constexpr std::uint8_t SMPLRT_DIV = 0x19;
+static constexpr std::uint8_t CONFIG = 0x1A;
+// MPU9255 auxiliary I2C master specific register
+static constexpr std::uint8_t I2C_MST_CTRL = 0x24;
+static constexpr std::uint8_t I2C_SLV0_ADDR = 0x25;
+static constexpr std::uint8_t I2C_SLV0_REG = 0x26;
+static constexpr std::uint8_t I2C_SLV0_CTRL = 0x27;
+static constexpr std::uint8_t I2C_SLV4_ADDR = 0x31;
+static constexpr std::uint8_t I2C_SLV4_REG = 0x32;
+static constexpr std::uint8_t I2C_SLV4_DO = 0x33;
+static constexpr std::uint8_t I2C_SLV4_CTRL = 0x34;
+static constexpr std::uint8_t I2C_SLV4_DI = 0x35;
+static constexpr std::uint8_t I2C_MST_STATUS = 0x36;
+static constexpr std::uint8_t INT_STATUS = 0x3A;
+static constexpr std::uint8_t EXT_SENS_DATA_00 = 0x49;
+static constexpr std::uint8_t EXT_SENS_DATA_23 = 0x60;
 // AK8963 specific register
 static constexpr std::uint8_t AK8963_ADDRESS = 0x0C;
 static constexpr std::uint8_t WHO_AM_I_AK8963_VALUE = 0x48;
@@ -18,16 +36,51 @@ static constexpr std::uint8_t WHO_AM_I_AK8963_REGISTER = 0x00;
 static constexpr std::uint8_t AK8963_CNTL = 0x0A;
 static constexpr std::uint8_t AK8963_ASAX = 0x10;
 static constexpr std::uint8_t AK8963_ST1 = 0x02;
+static constexpr std::uint8_t AK8963_ST1_TO_ST2_LENGTH_IN_BYTES = 8;
 // Gyroscope specific register
 static constexpr std::uint8_t GYRO_CONFIG = 0x1B;
 static constexpr std::uint8_t GYRO_MEASUREMENT_DATA = 0x43;
 // Accelerometer specific register
 static constexpr std::uint8_t ACCEL_CONFIG = 0x1C;
+static constexpr std::uint8_t ACCEL_CONFIG2 = 0x1D;
 static constexpr std::uint8_t ACCEL_MEASUREMENT_DATA = 0x3B;
 // Magnetometer specific register
 static constexpr std::uint8_t MAGNETOMETER_MEASUREMENT_DATA = 0x03;
 // Temperature sensor specific register
 static constexpr std::uint8_t TEMP_MEASUREMENT_DATA = 0x41;
+// Accelerometer, temperature, gyroscope and the external sensor data follow each other from ACCEL_XOUT_H on
+static constexpr std::uint8_t SENSOR_DATA_BURST_START = ACCEL_MEASUREMENT_DATA;
+static constexpr std::uint8_t SENSOR_DATA_BURST_LENGTH_IN_BYTES = EXT_SENS_DATA_00 - ACCEL_MEASUREMENT_DATA;
+static constexpr std::uint8_t SENSOR_DATA_BURST_WITH_MAGNETOMETER_LENGTH_IN_BYTES = SENSOR_DATA_BURST_LENGTH_IN_BYTES + AK8963_ST1_TO_ST2_LENGTH_IN_BYTES;
+
+// MPU9255 register fields, see MPU-9255 Register Map, Revision 1.0
+static constexpr utilities::BitField<1> INT_PIN_CFG_BYPASS_EN{};
+static constexpr utilities::BitField<5> INT_PIN_CFG_LATCH_INT_EN{};
+static constexpr utilities::BitField<0> INT_ENABLE_RAW_RDY_EN{};
+static constexpr utilities::BitField<4> USER_CTRL_I2C_IF_DIS{};
+static constexpr utilities::BitField<5> USER_CTRL_I2C_MST_EN{};
+static constexpr utilities::BitField<0, 3> CONFIG_DLPF_CFG{};
+static constexpr utilities::BitField<0, 3> ACCEL_CONFIG2_A_DLPF_CFG{};
+static constexpr utilities::BitField<3, 2> GYRO_ACCEL_CONFIG_FS_SEL{};
+// MPU9255 auxiliary I2C master register fields
+static constexpr utilities::BitField<0, 4> I2C_MST_CTRL_I2C_MST_CLK{};
+static constexpr utilities::BitField<6> I2C_MST_CTRL_WAIT_FOR_ES{};
+static constexpr utilities::BitField<0, 7> I2C_SLV_ADDR_I2C_ID{};
+static constexpr utilities::BitField<7> I2C_SLV_ADDR_RNW{};
+static constexpr utilities::BitField<0, 4> I2C_SLV_CTRL_LENG{};
+static constexpr utilities::BitField<7> I2C_SLV_CTRL_EN{};
+static constexpr utilities::BitField<4> I2C_MST_STATUS_I2C_SLV4_NACK{};
+static constexpr utilities::BitField<6> I2C_MST_STATUS_I2C_SLV4_DONE{};
+static constexpr std::uint8_t I2C_MST_CLK_400_KHZ = 0x0D;
+// AK8963 register fields
+static constexpr utilities::BitField<0, 4> AK8963_CNTL_MODE{};
+static constexpr utilities::BitField<4> AK8963_CNTL_BIT{};
+static constexpr utilities::BitField<0> AK8963_ST1_DRDY{};
+static constexpr utilities::BitField<3> AK8963_ST2_HOFL{};
+static constexpr std::uint8_t AK8963_MODE_POWER_DOWN = 0x0;
+static constexpr std::uint8_t AK8963_MODE_CONTINUOUS_8_HZ = 0x2;
+static constexpr std::uint8_t AK8963_MODE_FUSE_ROM_ACCESS = 0xF;
+static constexpr std::uint8_t AK8963_OUTPUT_16_BIT = 0x1;
 
 }  // namespace imu
 
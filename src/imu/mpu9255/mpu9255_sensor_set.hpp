@@ -0,0 +1,97 @@
+#ifndef SRC_MPU9255_SENSOR_SET_HPP_
+#define SRC_MPU9255_SENSOR_SET_HPP_
+
+#include <memory>
+#include "accelerometer.hpp"
+#include "accelerometer_interface.hpp"
+#include "gyroscope.hpp"
+#include "gyroscope_interface.hpp"
+#include "magnetometer.hpp"
+#include "magnetometer_interface.hpp"
+#include "register_transport_interface.hpp"
+#include "temperature.hpp"
+#include "temperature_interface.hpp"
+
+namespace imu {
+
+/**
+ * @brief Sensors of the MPU9255 held behind their interfaces, so every
+ *        sensor can be replaced by a mock in the unit tests.
+ *        Each sensor access is a virtual call through a unique_ptr.
+ * 
+ */
+class Mpu9255InterfaceSensorSet {
+ public:
+  Mpu9255InterfaceSensorSet() = delete;
+  ~Mpu9255InterfaceSensorSet() = default;
+  explicit Mpu9255InterfaceSensorSet(std::shared_ptr<transport::RegisterTransportInterface> transport) : sensor_transport_(transport) {}
+
+  auto CreateSensors(void) noexcept -> void {
+    if (gyroscope_ == nullptr)
+      gyroscope_ = std::make_unique<imu::Gyroscope>(sensor_transport_);
+    if (accelerometer_ == nullptr)
+      accelerometer_ = std::make_unique<imu::Accelerometer>(sensor_transport_);
+    if (magnetometer_ == nullptr)
+      magnetometer_ = std::make_unique<imu::Magnetometer>(sensor_transport_);
+    if (temperature_ == nullptr)
+      temperature_ = std::make_unique<imu::Temperature>(sensor_transport_);
+  }
+
+  auto GyroscopeSensor(void) noexcept -> imu::GyroscopeInterface& { return *gyroscope_; }
+  auto AccelerometerSensor(void) noexcept -> imu::AccelerometerInterface& { return *accelerometer_; }
+  auto MagnetometerSensor(void) noexcept -> imu::MagnetometerInterface& { return *magnetometer_; }
+  auto TemperatureSensor(void) noexcept -> imu::TemperatureInterface& { return *temperature_; }
+
+  auto UnitTestSetGyroscope(std::unique_ptr<imu::GyroscopeInterface> gyroscope) noexcept -> void {
+    gyroscope_ = std::move(gyroscope);
+  }
+
+  auto UnitTestSetAccelerometer(std::unique_ptr<imu::AccelerometerInterface> accelerometer) noexcept -> void {
+    accelerometer_ = std::move(accelerometer);
+  }
+
+  auto UnitTestSetMagnetometer(std::unique_ptr<imu::MagnetometerInterface> magnetometer) noexcept -> void {
+    magnetometer_ = std::move(magnetometer);
+  }
+
+  auto UnitTestSetTemperature(std::unique_ptr<imu::TemperatureInterface> temperature) noexcept -> void {
+    temperature_ = std::move(temperature);
+  }
+
+ private:
+  std::shared_ptr<transport::RegisterTransportInterface> sensor_transport_;
+  std::unique_ptr<imu::GyroscopeInterface> gyroscope_ = NULL;
+  std::unique_ptr<imu::AccelerometerInterface> accelerometer_ = NULL;
+  std::unique_ptr<imu::MagnetometerInterface> magnetometer_ = NULL;
+  std::unique_ptr<imu::TemperatureInterface> temperature_ = NULL;
+};
+
+/**
+ * @brief Sensors of the MPU9255 held by value as their concrete final types.
+ *        All sensor calls bind at compile time and can be inlined, there is
+ *        no heap allocation and no pointer indirection. Mocks can not be injected.
+ * 
+ */
+class Mpu9255StaticSensorSet {
+ public:
+  Mpu9255StaticSensorSet() = delete;
+  ~Mpu9255StaticSensorSet() = default;
+  explicit Mpu9255StaticSensorSet(std::shared_ptr<transport::RegisterTransportInterface> transport) : gyroscope_(transport), accelerometer_(transport), magnetometer_(transport), temperature_(transport) {}
+
+  auto CreateSensors(void) noexcept -> void {}
+
+  auto GyroscopeSensor(void) noexcept -> imu::Gyroscope& { return gyroscope_; }
+  auto AccelerometerSensor(void) noexcept -> imu::Accelerometer& { return accelerometer_; }
+  auto MagnetometerSensor(void) noexcept -> imu::Magnetometer& { return magnetometer_; }
+  auto TemperatureSensor(void) noexcept -> imu::Temperature& { return temperature_; }
+
+ private:
+  imu::Gyroscope gyroscope_;
+  imu::Accelerometer accelerometer_;
+  imu::Magnetometer magnetometer_;
+  imu::Temperature temperature_;
+};
+
+}  // namespace imu
+
+#endif
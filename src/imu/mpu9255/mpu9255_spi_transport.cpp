@@ -0,0 +1,186 @@
+#include "mpu9255_spi_transport.hpp"
+#include "sleep.hpp"
+
+namespace imu {
+
+constexpr std::uint32_t Mpu9255SpiTransport::SPI_CLOCK_ALL_REGISTERS_IN_HZ;
+constexpr std::uint32_t Mpu9255SpiTransport::SPI_CLOCK_SENSOR_REGISTERS_IN_HZ;
+
+auto Mpu9255SpiTransport::ReadContentFromRegister(std::uint8_t address, std::uint8_t register_, std::uint16_t byte_size, std::uint32_t timeout) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> {
+  if (byte_size == 0)
+    return {types::DriverStatus::INPUT_ERROR, {}};
+
+  if (address == MPU9255_ADDRESS)
+    return ReadFromMpu9255(register_, byte_size);
+
+  if (address == AK8963_ADDRESS)
+    return ReadFromAK8963(register_, byte_size);
+
+  return {types::DriverStatus::INPUT_ERROR, {}};
+}
+
+auto Mpu9255SpiTransport::ReadContentFromRegisterIntoBuffer(std::uint8_t address, std::uint8_t register_, std::uint8_t* buffer, std::uint16_t byte_size, std::uint32_t timeout) noexcept -> types::DriverStatus {
+  if (address != MPU9255_ADDRESS || byte_size > MAX_BURST_LENGTH_IN_BYTES)
+    return transport::RegisterTransportInterface::ReadContentFromRegisterIntoBuffer(address, register_, buffer, byte_size, timeout);
+
+  if (byte_size == 0 || buffer == nullptr)
+    return types::DriverStatus::INPUT_ERROR;
+
+  // Stays within the reserved capacity, so the buffers are not reallocated
+  mosi_buffer_.assign(byte_size + 1, 0);
+  miso_buffer_.assign(byte_size + 1, 0);
+  mosi_buffer_.at(0) = static_cast<std::uint8_t>(register_ | SPI_READ_BIT);
+
+  const auto clock_status = SetClockForAccess(register_, byte_size, true);
+  if (clock_status != types::DriverStatus::OK)
+    return clock_status;
+
+  const auto spi_status = spi_->Transfer(mosi_buffer_, miso_buffer_);
+  if (spi_status != types::DriverStatus::OK)
+    return spi_status;
+
+  if (miso_buffer_.size() != mosi_buffer_.size())
+    return types::DriverStatus::HAL_ERROR;
+
+  std::copy(miso_buffer_.begin() + 1, miso_buffer_.end(), buffer);
+  return types::DriverStatus::OK;
+}
+
+auto Mpu9255SpiTransport::Write(std::uint8_t address, const std::vector<std::uint8_t>& data, std::uint32_t timeout) noexcept -> types::DriverStatus {
+  if (data.size() < 2)
+    return types::DriverStatus::INPUT_ERROR;
+
+  if (address == MPU9255_ADDRESS)
+    return WriteIntoMpu9255(data);
+
+  if (address == AK8963_ADDRESS && data.size() == 2)
+    return WriteIntoAK8963(data.at(0), data.at(1));
+
+  return types::DriverStatus::INPUT_ERROR;
+}
+
+auto Mpu9255SpiTransport::ReadFromMpu9255(const std::uint8_t register_, const std::uint16_t byte_size) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> {
+  // First Byte clocks out the register address, the following Bytes clock in its content
+  std::vector<std::uint8_t> mosi_data(byte_size + 1, 0);
+  std::vector<std::uint8_t> miso_data(byte_size + 1, 0);
+  mosi_data.at(0) = register_ | SPI_READ_BIT;
+
+  const auto clock_status = SetClockForAccess(register_, byte_size, true);
+  if (clock_status != types::DriverStatus::OK)
+    return {clock_status, {}};
+
+  const auto spi_status = spi_->Transfer(mosi_data, miso_data);
+  if (spi_status != types::DriverStatus::OK)
+    return {spi_status, {}};
+
+  return {types::DriverStatus::OK, std::vector<std::uint8_t>(miso_data.begin() + 1, miso_data.end())};
+}
+
+auto Mpu9255SpiTransport::WriteIntoMpu9255(const std::vector<std::uint8_t>& data) noexcept -> types::DriverStatus {
+  std::vector<std::uint8_t> mosi_data(data);
+  mosi_data.at(0) &= static_cast<std::uint8_t>(~SPI_READ_BIT);
+
+  if (mosi_data.at(0) == USER_CTRL) {
+    // Resetting I2C_IF_DIS would enable the I2C slave interface again, which may corrupt SPI transfers
+    mosi_data.at(1) = utilities::Byte(mosi_data.at(1)).Set(USER_CTRL_I2C_IF_DIS, 1).Get();
+  }
+
+  const auto clock_status = SetClockForAccess(mosi_data.at(0), mosi_data.size() - 1, false);
+  if (clock_status != types::DriverStatus::OK)
+    return clock_status;
+
+  const auto spi_status = spi_->Write(mosi_data);
+
+  if (spi_status == types::DriverStatus::OK && mosi_data.at(0) == USER_CTRL)
+    auxiliary_i2c_master_enabled_ = USER_CTRL_I2C_MST_EN.IsSet(mosi_data.at(1));
+
+  return spi_status;
+}
+
+auto Mpu9255SpiTransport::ReadFromAK8963(const std::uint8_t register_, const std::uint16_t byte_size) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> {
+  if (EnableAuxiliaryI2CMaster() != types::DriverStatus::OK)
+    return {types::DriverStatus::HAL_ERROR, {}};
+
+  // Slave 4 transfers a single Byte, so consecutive registers are read one after another
+  std::vector<std::uint8_t> content_of_register;
+  for (std::uint16_t offset = 0; offset < byte_size; offset++) {
+    const auto ak8963_register = static_cast<std::uint8_t>(register_ + offset);
+    constexpr auto slave4_read_address = utilities::Byte(0).Set(I2C_SLV_ADDR_I2C_ID, AK8963_ADDRESS).Set(I2C_SLV_ADDR_RNW, 1).Get();
+    if (TransferWithSlave4(slave4_read_address, ak8963_register) != types::DriverStatus::OK)
+      return {types::DriverStatus::HAL_ERROR, {}};
+
+    const auto slave4_data_in = ReadFromMpu9255(I2C_SLV4_DI, 1);
+    if (slave4_data_in.first != types::DriverStatus::OK)
+      return {slave4_data_in.first, {}};
+
+    content_of_register.push_back(slave4_data_in.second.at(0));
+  }
+
+  return {types::DriverStatus::OK, content_of_register};
+}
+
+auto Mpu9255SpiTransport::WriteIntoAK8963(const std::uint8_t register_, const std::uint8_t register_content) noexcept -> types::DriverStatus {
+  if (EnableAuxiliaryI2CMaster() != types::DriverStatus::OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  if (WriteIntoMpu9255({I2C_SLV4_DO, register_content}) != types::DriverStatus::OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  return TransferWithSlave4(AK8963_ADDRESS, register_);
+}
+
+auto Mpu9255SpiTransport::EnableAuxiliaryI2CMaster(void) noexcept -> types::DriverStatus {
+  if (auxiliary_i2c_master_enabled_)
+    return types::DriverStatus::OK;
+
+  constexpr auto i2c_mst_ctrl_value = utilities::Byte(0).Set(I2C_MST_CTRL_I2C_MST_CLK, I2C_MST_CLK_400_KHZ).Get();
+  constexpr auto user_ctrl_value = utilities::Byte(0).Set(USER_CTRL_I2C_MST_EN, 1).Get();
+
+  if (WriteIntoMpu9255({I2C_MST_CTRL, i2c_mst_ctrl_value}) != types::DriverStatus::OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  return WriteIntoMpu9255({USER_CTRL, user_ctrl_value});
+}
+
+auto Mpu9255SpiTransport::TransferWithSlave4(const std::uint8_t slave_address, const std::uint8_t register_) noexcept -> types::DriverStatus {
+  if (WriteIntoMpu9255({I2C_SLV4_ADDR, slave_address}) != types::DriverStatus::OK ||
+      WriteIntoMpu9255({I2C_SLV4_REG, register_}) != types::DriverStatus::OK ||
+      WriteIntoMpu9255({I2C_SLV4_CTRL, utilities::Byte(0).Set(I2C_SLV_CTRL_EN, 1).Get()}) != types::DriverStatus::OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  return WaitForSlave4TransferDone();
+}
+
+auto Mpu9255SpiTransport::WaitForSlave4TransferDone(void) noexcept -> types::DriverStatus {
+  // Slave 4 transfers are executed with the next sample, I2C_MST_STATUS is cleared on read
+  for (std::uint8_t poll = 0; poll < SLAVE4_MAX_POLLS; poll++) {
+    const auto i2c_mst_status = ReadFromMpu9255(I2C_MST_STATUS, 1);
+    if (i2c_mst_status.first != types::DriverStatus::OK)
+      return i2c_mst_status.first;
+
+    if (I2C_MST_STATUS_I2C_SLV4_NACK.IsSet(i2c_mst_status.second.at(0)))
+      return types::DriverStatus::HAL_ERROR;
+
+    if (I2C_MST_STATUS_I2C_SLV4_DONE.IsSet(i2c_mst_status.second.at(0)))
+      return types::DriverStatus::OK;
+
+    utilities::Sleep(SLAVE4_POLL_INTERVAL_IN_MS);
+  }
+
+  return types::DriverStatus::TIMEOUT;
+}
+
+auto Mpu9255SpiTransport::SetClockForAccess(const std::uint8_t register_, const std::uint16_t byte_size, const bool is_read) noexcept -> types::DriverStatus {
+  // Only reads which stay within the interrupt status and sensor data registers may use the fast clock
+  const bool is_sensor_read = is_read && register_ >= INT_STATUS && register_ + byte_size - 1 <= EXT_SENS_DATA_23;
+  const auto clock_in_hz = is_sensor_read ? SPI_CLOCK_SENSOR_REGISTERS_IN_HZ : SPI_CLOCK_ALL_REGISTERS_IN_HZ;
+
+  if (clock_in_hz == spi_clock_in_hz_)
+    return types::DriverStatus::OK;
+
+  const auto spi_status = spi_->SetClock(clock_in_hz);
+  spi_clock_in_hz_ = spi_status == types::DriverStatus::OK ? clock_in_hz : 0;
+  return spi_status;
+}
+
+}  // namespace imu
@@ -0,0 +1,108 @@
+#ifndef SRC_MPU9255_SPI_TRANSPORT_HPP_
+#define SRC_MPU9255_SPI_TRANSPORT_HPP_
+
+#include <algorithm>
+#include <memory>
+#include "mpu9255_data.hpp"
+#include "register_transport_interface.hpp"
+#include "spi_interface.hpp"
+
+namespace imu {
+
+/**
+ * @brief Register transport for a MPU9255 connected via SPI.
+ *        Registers of the MPU9255 are accessed directly (read bit 0x80 in the register byte),
+ *        registers of the AK8963 are tunnelled through slave 4 of the MPU9255 auxiliary I2C master,
+ *        as the AK8963 is not reachable on the SPI bus. Every tunnelled access polls slave 4 for
+ *        milliseconds, so the MPU9255 driver reads the magnetometer through the auxiliary I2C master
+ *        on this transport, even if bypass mode was requested.
+ * 
+ */
+class Mpu9255SpiTransport final : public transport::RegisterTransportInterface {
+ public:
+  Mpu9255SpiTransport() = delete;
+  ~Mpu9255SpiTransport() = default;
+
+  /**
+   * @brief Construct a new Mpu9255 SPI transport
+   * 
+   * @param spi SPI driver whose chip select is wired to the MPU9255. 
+   *            The MPU9255 allows up to 1 MHz for all registers and up to 20 MHz for reading sensor registers,
+   *            the transport sets the SPI clock accordingly before each transaction.
+   */
+  explicit Mpu9255SpiTransport(std::shared_ptr<spi::SPIInterface> spi) : transport::RegisterTransportInterface(), spi_(spi) {
+    mosi_buffer_.reserve(MAX_BURST_LENGTH_IN_BYTES + 1);
+    miso_buffer_.reserve(MAX_BURST_LENGTH_IN_BYTES + 1);
+  }
+
+  /**
+   * @brief Reads content from given register of the MPU9255 or the AK8963
+   * 
+   * @param address MPU9255_ADDRESS or AK8963_ADDRESS, any other address is an input error
+   * @param register_ The register to read the content from
+   * @param byte_size Amount of Bytes to read
+   * @param timeout Not used, the SPI driver applies its own timeout
+   * @return std::pair<#types::DriverStatus, std::vector<uint8_t>> Status of the transport and Data read
+   */
+  auto ReadContentFromRegister(std::uint8_t address, std::uint8_t register_, std::uint16_t byte_size, std::uint32_t timeout = STANDARD_TIMEOUT_IN_MS) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> override;
+
+  /**
+   * @brief Reads content from given register of the MPU9255 or the AK8963 into a buffer of the caller.
+   *        Bursts from the MPU9255 of up to MAX_BURST_LENGTH_IN_BYTES reuse the transfer buffers of the transport
+   *        and do not allocate, tunnelled AK8963 reads fall back to ReadContentFromRegister.
+   * 
+   * @param address MPU9255_ADDRESS or AK8963_ADDRESS, any other address is an input error
+   * @param register_ The register to read the content from
+   * @param buffer Buffer with space for at least byte_size Bytes, only valid if OK is returned
+   * @param byte_size Amount of Bytes to read
+   * @param timeout Not used, the SPI driver applies its own timeout
+   * @return #types::DriverStatus Status of the transport
+   */
+  auto ReadContentFromRegisterIntoBuffer(std::uint8_t address, std::uint8_t register_, std::uint8_t* buffer, std::uint16_t byte_size, std::uint32_t timeout = STANDARD_TIMEOUT_IN_MS) noexcept -> types::DriverStatus override;
+
+  /**
+   * @brief Writes data to the MPU9255 or the AK8963. Writes into USER_CTRL always keep the I2C slave interface disabled.
+   * 
+   * @param address MPU9255_ADDRESS or AK8963_ADDRESS, any other address is an input error
+   * @param data Register followed by the data to write. The AK8963 only accepts one data Byte.
+   * @param timeout Not used, the SPI driver applies its own timeout
+   * @return #types::DriverStatus Status of the transport
+   */
+  auto Write(std::uint8_t address, const std::vector<std::uint8_t>& data, std::uint32_t timeout = STANDARD_TIMEOUT_IN_MS) noexcept -> types::DriverStatus override;
+
+  /**
+   * @brief The AK8963 is not on the SPI bus, it is only reachable through slave 4
+   * 
+   * @return false
+   */
+  auto ReachesBypassedDevices(void) const noexcept -> bool override {
+    return false;
+  }
+
+ private:
+  auto ReadFromMpu9255(const std::uint8_t register_, const std::uint16_t byte_size) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>>;
+  auto WriteIntoMpu9255(const std::vector<std::uint8_t>& data) noexcept -> types::DriverStatus;
+  auto ReadFromAK8963(const std::uint8_t register_, const std::uint16_t byte_size) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>>;
+  auto WriteIntoAK8963(const std::uint8_t register_, const std::uint8_t register_content) noexcept -> types::DriverStatus;
+  auto EnableAuxiliaryI2CMaster(void) noexcept -> types::DriverStatus;
+  auto TransferWithSlave4(const std::uint8_t slave_address, const std::uint8_t register_) noexcept -> types::DriverStatus;
+  auto WaitForSlave4TransferDone(void) noexcept -> types::DriverStatus;
+  auto SetClockForAccess(const std::uint8_t register_, const std::uint16_t byte_size, const bool is_read) noexcept -> types::DriverStatus;
+
+  std::shared_ptr<spi::SPIInterface> spi_;
+  std::vector<std::uint8_t> mosi_buffer_;
+  std::vector<std::uint8_t> miso_buffer_;
+  bool auxiliary_i2c_master_enabled_ = false;
+  std::uint32_t spi_clock_in_hz_ = 0;
+
+  static constexpr std::uint8_t SPI_READ_BIT = 0x80;
+  static constexpr std::uint32_t SPI_CLOCK_ALL_REGISTERS_IN_HZ = 1000000;
+  static constexpr std::uint32_t SPI_CLOCK_SENSOR_REGISTERS_IN_HZ = 20000000;
+  static constexpr std::uint16_t MAX_BURST_LENGTH_IN_BYTES = 32;
+  static constexpr std::uint8_t SLAVE4_MAX_POLLS = 10;
+  static constexpr std::uint32_t SLAVE4_POLL_INTERVAL_IN_MS = 1;
+};
+
+}  // namespace imu
+
+#endif
@@ -13,16 +13,18 @@ auto Accelerometer::Init(const std::uint8_t i2c_address) noexcept -> types::Driv
 
 auto Accelerometer::Update(void) noexcept -> types::DriverStatus {
   if (SensorVector::Update() == types::DriverStatus::OK) {
-    auto adc_2_accel = GetFactorADC2Accelerometer();
-    sensor_values_.x = static_cast<std::int16_t>(adc_2_accel * static_cast<float>(sensor_values_.x));
-    sensor_values_.y = static_cast<std::int16_t>(adc_2_accel * static_cast<float>(sensor_values_.y));
-    sensor_values_.z = static_cast<std::int16_t>(adc_2_accel * static_cast<float>(sensor_values_.z));
+    ScaleSensorValues();
     return types::DriverStatus::OK;
   } else {
     return types::DriverStatus::HAL_ERROR;
   }
 }
 
+auto Accelerometer::UpdateScaleFactors(void) noexcept -> void {
+  const auto adc_2_accel = GetFactorADC2Accelerometer();
+  SetScaleAndOffset(types::EuclideanVector<float>{adc_2_accel, adc_2_accel, adc_2_accel}, types::EuclideanVector<float>{0.0f, 0.0f, 0.0f});
+}
+
 auto Accelerometer::GetFactorADC2Accelerometer(void) noexcept -> float {
   auto accel_resolution = 0.0f;
 
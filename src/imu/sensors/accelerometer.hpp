@@ -10,11 +10,12 @@ class Accelerometer final : public AccelerometerInterface {
   Accelerometer() = delete;
   ~Accelerometer() = default;
 
-  explicit Accelerometer(std::shared_ptr<i2c::I2CInterface> i2c_handler) : AccelerometerInterface(i2c_handler){};
+  explicit Accelerometer(std::shared_ptr<transport::RegisterTransportInterface> transport) : AccelerometerInterface(transport){};
   auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus override;
   auto Update(void) noexcept -> types::DriverStatus override;
 
  private:
+  auto UpdateScaleFactors(void) noexcept -> void override;
   auto GetFactorADC2Accelerometer(void) noexcept -> float;
 };
 
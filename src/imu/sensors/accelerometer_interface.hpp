@@ -10,7 +10,7 @@ class AccelerometerInterface : public SensorWithSensitivity {
   AccelerometerInterface() = delete;
   ~AccelerometerInterface() = default;
 
-  explicit AccelerometerInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorWithSensitivity(i2c_handler){};
+  explicit AccelerometerInterface(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorWithSensitivity(transport){};
 };
 
 }  // namespace imu
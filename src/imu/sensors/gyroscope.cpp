@@ -13,16 +13,18 @@ auto Gyroscope::Init(const std::uint8_t i2c_address) noexcept -> types::DriverSt
 
 auto Gyroscope::Update(void) noexcept -> types::DriverStatus {
   if (SensorVector::Update() == types::DriverStatus::OK) {
-    auto adc_2_gyro = GetFactorADC2Gyro();
-    sensor_values_.x = static_cast<std::int16_t>(adc_2_gyro * sensor_values_.x);
-    sensor_values_.y = static_cast<std::int16_t>(adc_2_gyro * sensor_values_.y);
-    sensor_values_.z = static_cast<std::int16_t>(adc_2_gyro * sensor_values_.z);
+    ScaleSensorValues();
     return types::DriverStatus::OK;
   } else {
     return types::DriverStatus::HAL_ERROR;
   }
 }
 
+auto Gyroscope::UpdateScaleFactors(void) noexcept -> void {
+  const auto adc_2_gyro = GetFactorADC2Gyro();
+  SetScaleAndOffset(types::EuclideanVector<float>{adc_2_gyro, adc_2_gyro, adc_2_gyro}, types::EuclideanVector<float>{0.0f, 0.0f, 0.0f});
+}
+
 auto Gyroscope::GetFactorADC2Gyro(void) noexcept -> float {
   auto gyro_resolution = 0.0f;
 
@@ -10,11 +10,12 @@ class Gyroscope final : public GyroscopeInterface {
   Gyroscope() = delete;
   ~Gyroscope() = default;
 
-  explicit Gyroscope(std::shared_ptr<i2c::I2CInterface> i2c_handler) : GyroscopeInterface(i2c_handler){};
+  explicit Gyroscope(std::shared_ptr<transport::RegisterTransportInterface> transport) : GyroscopeInterface(transport){};
   auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus override;
   auto Update(void) noexcept -> types::DriverStatus override;
 
  private:
+  auto UpdateScaleFactors(void) noexcept -> void override;
   auto GetFactorADC2Gyro(void) noexcept -> float;
 };
 
@@ -10,7 +10,7 @@ class GyroscopeInterface : public SensorWithSensitivity {
   GyroscopeInterface() = delete;
   ~GyroscopeInterface() = default;
 
-  explicit GyroscopeInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorWithSensitivity(i2c_handler){};
+  explicit GyroscopeInterface(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorWithSensitivity(transport){};
 };
 
 }  // namespace imu
@@ -26,7 +26,16 @@ auto GeneralSensor::GetRawValues(void) noexcept -> types::DriverStatus {
   if (!IsInitialized())
     return types::DriverStatus::HAL_ERROR;
 
-  raw_values_ = ReadContentFromRegister(sensor_data_register, register_data_length_in_bytes);
+  if (register_data_length_in_bytes > raw_values_.size())
+    return types::DriverStatus::INPUT_ERROR;
+
+  if (has_raw_values_from_burst_) {
+    has_raw_values_from_burst_ = false;
+    imu_status_ = types::DriverStatus::OK;
+    return types::DriverStatus::OK;
+  }
+
+  ReadContentFromRegisterIntoBuffer(sensor_data_register, raw_values_.data(), register_data_length_in_bytes);
 
   if (ImuConnectionSuccessful())
     return types::DriverStatus::OK;
@@ -34,6 +43,14 @@ auto GeneralSensor::GetRawValues(void) noexcept -> types::DriverStatus {
   return types::DriverStatus::HAL_ERROR;
 }
 
+auto GeneralSensor::SetRawValuesFromBurst(const std::uint8_t address, const std::uint8_t first_register, const std::uint8_t *burst, const std::uint8_t burst_length) noexcept -> void {
+  has_raw_values_from_burst_ = burst != nullptr && address == i2c_address_ && register_data_length_in_bytes <= raw_values_.size() &&
+                               sensor_data_register >= first_register &&
+                               sensor_data_register + register_data_length_in_bytes <= first_register + burst_length;
+  if (has_raw_values_from_burst_)
+    std::copy_n(burst + (sensor_data_register - first_register), register_data_length_in_bytes, raw_values_.begin());
+}
+
 auto GeneralSensor::Mpu9255Detected(void) noexcept -> bool {
   return CheckI2CDevice(WHO_AM_I_MPU9255_REGISTER, WHO_AM_I_MPU9255_VALUE);
 }
@@ -56,11 +73,11 @@ auto GeneralSensor::CheckI2CDevice(const std::uint8_t register_, const std::uint
 }
 
 auto GeneralSensor::ReadContentFromRegister(const std::uint8_t read_from_register, const std::uint16_t byte_size) noexcept -> std::vector<std::uint8_t> {
-  types::DriverStatus i2c_status;
+  types::DriverStatus transport_status;
   std::vector<uint8_t> content_of_register;
 
-  std::tie(i2c_status, content_of_register) = i2c_handler_->ReadContentFromRegister(i2c_address_, read_from_register, byte_size);
-  if (i2c_status == types::DriverStatus::OK && content_of_register.size() == byte_size) {
+  std::tie(transport_status, content_of_register) = transport_->ReadContentFromRegister(i2c_address_, read_from_register, byte_size);
+  if (transport_status == types::DriverStatus::OK && content_of_register.size() == byte_size) {
     imu_status_ = types::DriverStatus::OK;
   } else {
     imu_status_ = types::DriverStatus::HAL_ERROR;
@@ -69,8 +86,12 @@ auto GeneralSensor::ReadContentFromRegister(const std::uint8_t read_from_registe
   return content_of_register;
 }
 
+auto GeneralSensor::ReadContentFromRegisterIntoBuffer(const std::uint8_t read_from_register, std::uint8_t *buffer, const std::uint16_t byte_size) noexcept -> void {
+  imu_status_ = transport_->ReadContentFromRegisterIntoBuffer(i2c_address_, read_from_register, buffer, byte_size);
+}
+
 auto GeneralSensor::WriteContentIntoRegister(const std::uint8_t write_into_register, const std::uint8_t register_content) noexcept -> void {
-  imu_status_ = i2c_handler_->Write(i2c_address_, {write_into_register, register_content});
+  imu_status_ = transport_->Write(i2c_address_, {write_into_register, register_content});
 }
 
 auto GeneralSensor::ImuConnectionSuccessful(void) noexcept -> bool {
@@ -85,25 +106,6 @@ auto GeneralSensor::SetI2CAdress(std::uint8_t i2c_address) noexcept -> void {
   i2c_address_ = i2c_address;
 }
 
-auto GeneralSensor::ConvertUint8BytesIntoInt16SensorValue(const std::vector<std::uint8_t> &raw_vector) noexcept -> std::vector<std::int16_t> {
-  std::vector<std::int16_t> int16_vector;
-
-  for (size_t i = 0; i < raw_vector.size() - 1; i += 2) {
-    auto first_byte = raw_vector.at(i);
-    auto second_byte = raw_vector.at(i + 1);
-    int16_vector.push_back(ConvertUint8BytesIntoInt16(first_byte, second_byte));
-  }
-  return int16_vector;
-}
-
-auto GeneralSensor::ConvertUint8BytesIntoInt16(std::uint8_t first_byte, std::uint8_t second_byte) noexcept -> std::int16_t {
-  if (little_endian == true) {
-    std::swap(first_byte, second_byte);
-  }
-
-  return static_cast<std::int16_t>(first_byte << 8 | second_byte);
-}
-
 auto GeneralSensor::IsInitialized(void) noexcept -> bool {
   return initialized_;
 }
@@ -1,12 +1,15 @@
 #ifndef SRC_IMU_MEASUREMENT_SENSOR_HPP_
 #define SRC_IMU_MEASUREMENT_SENSOR_HPP_
 
+#include <algorithm>
+#include <array>
 #include <memory>
+#include <tuple>
 #include "basic_types.hpp"
 #include "error_types.hpp"
-#include "i2c.hpp"
 #include "imu_general_interface.hpp"
 #include "mpu9255_data.hpp"
+#include "register_transport_interface.hpp"
 
 namespace imu {
 
@@ -14,33 +17,42 @@ class GeneralSensor : public GeneralSensorInterface {
  public:
   virtual ~GeneralSensor() = default;
 
-  explicit GeneralSensor(std::shared_ptr<i2c::I2CInterface> i2c_handler) : GeneralSensorInterface(), i2c_handler_(i2c_handler){};
+  explicit GeneralSensor(std::shared_ptr<transport::RegisterTransportInterface> transport) : GeneralSensorInterface(), transport_(transport){};
   auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus override;
   auto GetRawValues(void) noexcept -> types::DriverStatus override;
 
+  /**
+   * @brief Hands the sensor its raw values out of a burst read of consecutive registers,
+   *        the next GetRawValues() takes them instead of reading the bus. A sensor whose
+   *        registers are not part of the burst keeps reading them on its own.
+   */
+  auto SetRawValuesFromBurst(const std::uint8_t address, const std::uint8_t first_register, const std::uint8_t *burst, const std::uint8_t burst_length) noexcept -> void;
+
  protected:
   auto IsHardwareConnected(void) -> bool;
   auto Mpu9255Detected(void) noexcept -> bool;
   auto AK8963Detected(void) noexcept -> bool;
   auto CheckI2CDevice(const std::uint8_t register_, const std::uint8_t value) noexcept -> bool;
   auto ReadContentFromRegister(const std::uint8_t read_from_register, const std::uint16_t byte_size) noexcept -> std::vector<std::uint8_t>;
+  auto ReadContentFromRegisterIntoBuffer(const std::uint8_t read_from_register, std::uint8_t *buffer, const std::uint16_t byte_size) noexcept -> void;
   auto WriteContentIntoRegister(const std::uint8_t write_into_register, const std::uint8_t register_content) noexcept -> void;
   auto ImuConnectionSuccessful(void) noexcept -> bool;
   auto ImuConnectionFailed(void) noexcept -> bool;
   auto SetI2CAdress(const std::uint8_t i2c_address) noexcept -> void;
-  auto ConvertUint8BytesIntoInt16SensorValue(const std::vector<std::uint8_t> &raw_vector) noexcept -> std::vector<std::int16_t>;
-  auto ConvertUint8BytesIntoInt16(std::uint8_t first_byte, std::uint8_t second_byte) noexcept -> std::int16_t;
   auto IsInitialized(void) noexcept -> bool;
 
-  std::shared_ptr<i2c::I2CInterface> i2c_handler_;
+  std::shared_ptr<transport::RegisterTransportInterface> transport_;
   bool initialized_ = false;
   std::uint8_t i2c_address_ = 0;
   types::DriverStatus imu_status_ = types::DriverStatus::HAL_ERROR;
-  std::vector<std::uint8_t> raw_values_;
+  // Longest burst is ST1 to ST2 of the AK8963 mirrored by the auxiliary I2C master
+  static constexpr std::uint8_t MAX_RAW_VALUES_LENGTH_IN_BYTES = AK8963_ST1_TO_ST2_LENGTH_IN_BYTES;
+  std::array<std::uint8_t, MAX_RAW_VALUES_LENGTH_IN_BYTES> raw_values_{};
   std::uint8_t sensor_data_register = 0;
   std::uint8_t register_data_length_in_bytes = 0;
   std::uint8_t config_register = 0;
   bool little_endian = false;
+  bool has_raw_values_from_burst_ = false;
 };
 
 }  // namespace imu
@@ -1,4 +1,5 @@
 #include "sensor_single_value.hpp"
+#include "byte_order.hpp"
 
 namespace imu {
 
@@ -6,8 +7,7 @@ auto SensorSingleValue::Update(void) noexcept -> types::DriverStatus {
   GeneralSensor::GetRawValues();
 
   if (ImuConnectionSuccessful()) {
-    SetSensorValue(
-        ConvertUint8BytesIntoInt16SensorValue(raw_values_).at(0));
+    SetSensorValue(utilities::DecodeInt16(raw_values_.data(), little_endian));
     return types::DriverStatus::OK;
   }
 
@@ -9,7 +9,7 @@ class SensorSingleValue : public SensorSingleValueInterface {
  public:
   virtual ~SensorSingleValue() = default;
 
-  explicit SensorSingleValue(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorSingleValueInterface(i2c_handler){};
+  explicit SensorSingleValue(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorSingleValueInterface(transport){};
   auto Update(void) noexcept -> types::DriverStatus override;
   auto Get(void) noexcept -> std::int16_t override;
 
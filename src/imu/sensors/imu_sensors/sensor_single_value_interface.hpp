@@ -9,7 +9,7 @@ class SensorSingleValueInterface : public GeneralSensor {
  public:
   virtual ~SensorSingleValueInterface() = default;
 
-  explicit SensorSingleValueInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler) : GeneralSensor(i2c_handler){};
+  explicit SensorSingleValueInterface(std::shared_ptr<transport::RegisterTransportInterface> transport) : GeneralSensor(transport){};
   virtual auto Get(void) noexcept -> std::int16_t = 0;
   virtual auto Update(void) noexcept -> types::DriverStatus = 0;
 };
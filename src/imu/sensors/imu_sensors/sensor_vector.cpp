@@ -1,4 +1,5 @@
 #include "sensor_vector.hpp"
+#include "byte_order.hpp"
 
 namespace imu {
 
@@ -6,8 +7,7 @@ auto SensorVector::Update(void) noexcept -> types::DriverStatus {
   GeneralSensor::GetRawValues();
 
   if (ImuConnectionSuccessful()) {
-    SetSensorValues(
-        ConvertUint8BytesIntoInt16SensorValue(raw_values_));
+    utilities::DecodeInt16Triple(raw_values_.data(), little_endian, sensor_values_);
     return types::DriverStatus::OK;
   }
 
@@ -24,4 +24,58 @@ auto SensorVector::SetSensorValues(const std::vector<std::int16_t> &sensor_value
   sensor_values_.z = sensor_values.at(POSITION_Z);
 }
 
+auto SensorVector::SetCalibration(const types::SensorCalibration &calibration) noexcept -> void {
+  calibration_.bias.x = calibration.bias.x;
+  calibration_.bias.y = calibration.bias.y;
+  calibration_.bias.z = calibration.bias.z;
+  calibration_.scale.x = calibration.scale.x;
+  calibration_.scale.y = calibration.scale.y;
+  calibration_.scale.z = calibration.scale.z;
+  CombineScaleAndOffsetWithCalibration();
+}
+
+auto SensorVector::GetCalibrated(void) noexcept -> types::EuclideanVector<float> {
+  return types::EuclideanVector<float>{calibrated_values_.x, calibrated_values_.y, calibrated_values_.z};
+}
+
+auto SensorVector::GetUncalibrated(void) noexcept -> types::EuclideanVector<float> {
+  return types::EuclideanVector<float>{static_cast<float>(unscaled_values_.x) * conversion_scale_.x + conversion_offset_.x,
+                                       static_cast<float>(unscaled_values_.y) * conversion_scale_.y + conversion_offset_.y,
+                                       static_cast<float>(unscaled_values_.z) * conversion_scale_.z + conversion_offset_.z};
+}
+
+auto SensorVector::SetScaleAndOffset(const types::EuclideanVector<float> &scale, const types::EuclideanVector<float> &offset) noexcept -> void {
+  conversion_scale_.x = scale.x;
+  conversion_scale_.y = scale.y;
+  conversion_scale_.z = scale.z;
+  conversion_offset_.x = offset.x;
+  conversion_offset_.y = offset.y;
+  conversion_offset_.z = offset.z;
+  CombineScaleAndOffsetWithCalibration();
+}
+
+auto SensorVector::CombineScaleAndOffsetWithCalibration(void) noexcept -> void {
+  // (raw * conversion_scale + conversion_offset - bias) * calibration_scale
+  scale_.x = conversion_scale_.x * calibration_.scale.x;
+  scale_.y = conversion_scale_.y * calibration_.scale.y;
+  scale_.z = conversion_scale_.z * calibration_.scale.z;
+  offset_.x = (conversion_offset_.x - calibration_.bias.x) * calibration_.scale.x;
+  offset_.y = (conversion_offset_.y - calibration_.bias.y) * calibration_.scale.y;
+  offset_.z = (conversion_offset_.z - calibration_.bias.z) * calibration_.scale.z;
+}
+
+auto SensorVector::ScaleSensorValues(void) noexcept -> void {
+  unscaled_values_.x = sensor_values_.x;
+  unscaled_values_.y = sensor_values_.y;
+  unscaled_values_.z = sensor_values_.z;
+
+  // Scale and offset are only recomputed on sensitivity or calibration changes, so this is one multiply-add per axis
+  calibrated_values_.x = static_cast<float>(sensor_values_.x) * scale_.x + offset_.x;
+  calibrated_values_.y = static_cast<float>(sensor_values_.y) * scale_.y + offset_.y;
+  calibrated_values_.z = static_cast<float>(sensor_values_.z) * scale_.z + offset_.z;
+  sensor_values_.x = static_cast<std::int16_t>(calibrated_values_.x);
+  sensor_values_.y = static_cast<std::int16_t>(calibrated_values_.y);
+  sensor_values_.z = static_cast<std::int16_t>(calibrated_values_.z);
+}
+
 }  // namespace imu
\ No newline at end of file
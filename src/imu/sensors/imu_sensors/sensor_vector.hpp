@@ -1,6 +1,7 @@
 #ifndef SRC_IMU_MEASUREMENT_SENSOR_VECTOR_HPP_
 #define SRC_IMU_MEASUREMENT_SENSOR_VECTOR_HPP_
 
+#include "imu_calibration.hpp"
 #include "sensor_vector_interface.hpp"
 
 namespace imu {
@@ -9,18 +10,46 @@ class SensorVector : public SensorVectorInterface {
  public:
   virtual ~SensorVector() = default;
 
-  explicit SensorVector(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorVectorInterface(i2c_handler){};
+  explicit SensorVector(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorVectorInterface(transport){};
   auto Update(void) noexcept -> types::DriverStatus override;
   auto Get(void) noexcept -> types::EuclideanVector<int16_t> override;
 
+  /**
+   * @brief Sets bias and scale in the physical unit of the sensor. They are folded into the
+   *        conversion of the raw values, so every later sample is calibrated at no extra cost.
+   *        Get() rounds to whole units, GetCalibrated() keeps the fraction a bias is made of.
+   */
+  auto SetCalibration(const types::SensorCalibration &calibration) noexcept -> void;
+
+  /**
+   * @brief The last sample in the physical unit of the sensor with the calibration applied and without rounding
+   */
+  auto GetCalibrated(void) noexcept -> types::EuclideanVector<float>;
+
+  /**
+   * @brief The last sample in the physical unit of the sensor without the calibration applied
+   *        and without rounding, which is what a calibration is computed from
+   */
+  auto GetUncalibrated(void) noexcept -> types::EuclideanVector<float>;
+
  protected:
   auto SetSensorValues(const std::vector<std::int16_t> &sensor_values) noexcept -> void;
+  auto SetScaleAndOffset(const types::EuclideanVector<float> &scale, const types::EuclideanVector<float> &offset) noexcept -> void;
+  auto ScaleSensorValues(void) noexcept -> void;
+  auto CombineScaleAndOffsetWithCalibration(void) noexcept -> void;
 
   static constexpr std::uint8_t POSITION_X = 0;
   static constexpr std::uint8_t POSITION_Y = 1;
   static constexpr std::uint8_t POSITION_Z = 2;
 
   types::EuclideanVector<std::int16_t> sensor_values_{-1, -1, -1};
+  types::EuclideanVector<float> scale_{1.0f, 1.0f, 1.0f};
+  types::EuclideanVector<float> offset_{0.0f, 0.0f, 0.0f};
+  types::EuclideanVector<std::int16_t> unscaled_values_{0, 0, 0};
+  types::EuclideanVector<float> calibrated_values_{0.0f, 0.0f, 0.0f};
+  types::EuclideanVector<float> conversion_scale_{1.0f, 1.0f, 1.0f};
+  types::EuclideanVector<float> conversion_offset_{0.0f, 0.0f, 0.0f};
+  types::SensorCalibration calibration_;
 };
 
 }  // namespace imu
@@ -9,7 +9,7 @@ class SensorVectorInterface : public GeneralSensor {
  public:
   virtual ~SensorVectorInterface() = default;
 
-  explicit SensorVectorInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler) : GeneralSensor(i2c_handler){};
+  explicit SensorVectorInterface(std::shared_ptr<transport::RegisterTransportInterface> transport) : GeneralSensor(transport){};
   virtual auto Get(void) noexcept -> types::EuclideanVector<int16_t> = 0;
   virtual auto Update(void) noexcept -> types::DriverStatus = 0;
 };
@@ -13,6 +13,7 @@ auto SensorWithSensitivity::Init(const std::uint8_t i2c_address) noexcept -> typ
   if (ImuConnectionFailed())
     return types::DriverStatus::HAL_ERROR;
 
+  UpdateScaleFactors();
   initialized_ = true;
   return types::DriverStatus::OK;
 }
@@ -31,6 +32,7 @@ auto SensorWithSensitivity::SetSensitivity(const types::ImuSensitivity sensitivi
 
 auto SensorWithSensitivity::SaveNewSensitivity(const types::ImuSensitivity sensitivity) noexcept -> void {
   sensitivity_ = sensitivity;
+  UpdateScaleFactors();
 }
 
 auto SensorWithSensitivity::SendSensitivityRegisterData(const types::ImuSensitivity sensitivity) noexcept -> void {
@@ -40,22 +42,19 @@ auto SensorWithSensitivity::SendSensitivityRegisterData(const types::ImuSensitiv
 
 auto SensorWithSensitivity::GetConfigRegisterDataForSensitivity(const types::ImuSensitivity sensitivity) noexcept -> std::uint8_t {
   utilities::Byte config_data(ReadContentFromRegister(config_register, 1).at(0));
+  std::uint8_t full_scale_select = 0;
 
   if (sensitivity == types::ImuSensitivity::FINEST) {
-    config_data.ClearBit(3);
-    config_data.ClearBit(4);
+    full_scale_select = 0b00;
   } else if (sensitivity == types::ImuSensitivity::FINER) {
-    config_data.SetBit(3);
-    config_data.ClearBit(4);
+    full_scale_select = 0b01;
   } else if (sensitivity == types::ImuSensitivity::ROUGHER) {
-    config_data.ClearBit(3);
-    config_data.SetBit(4);
+    full_scale_select = 0b10;
   } else if (sensitivity == types::ImuSensitivity::ROUGHEST) {
-    config_data.SetBit(3);
-    config_data.SetBit(4);
+    full_scale_select = 0b11;
   }
 
-  return config_data.Get();
+  return config_data.Set(GYRO_ACCEL_CONFIG_FS_SEL, full_scale_select).Get();
 }
 
 auto SensorWithSensitivity::GetSensitivity(void) noexcept -> types::ImuSensitivity {
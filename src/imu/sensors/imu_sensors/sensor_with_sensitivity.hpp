@@ -14,7 +14,7 @@ class SensorWithSensitivity : public SensorWithSensitivityInterface {
   SensorWithSensitivity() = delete;
   ~SensorWithSensitivity() = default;
 
-  explicit SensorWithSensitivity(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorWithSensitivityInterface(i2c_handler){};
+  explicit SensorWithSensitivity(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorWithSensitivityInterface(transport){};
 
   auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus override;
   auto GetSensitivity(void) noexcept -> types::ImuSensitivity override;
@@ -24,6 +24,7 @@ class SensorWithSensitivity : public SensorWithSensitivityInterface {
   auto GetConfigRegisterDataForSensitivity(const types::ImuSensitivity sensitivity) noexcept -> std::uint8_t;
   auto SendSensitivityRegisterData(const types::ImuSensitivity sensitivity) noexcept -> void;
   auto SaveNewSensitivity(const types::ImuSensitivity sensitivity) noexcept -> void;
+  virtual auto UpdateScaleFactors(void) noexcept -> void {}
 
   types::ImuSensitivity sensitivity_ = types::ImuSensitivity::FINEST;
 };
@@ -12,7 +12,7 @@ class SensorWithSensitivityInterface : public SensorVector {
   SensorWithSensitivityInterface() = delete;
   ~SensorWithSensitivityInterface() = default;
 
-  explicit SensorWithSensitivityInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorVector(i2c_handler){};
+  explicit SensorWithSensitivityInterface(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorVector(transport){};
 
   virtual auto Init(std::uint8_t i2c_address) noexcept -> types::DriverStatus = 0;
   virtual auto GetSensitivity(void) noexcept -> types::ImuSensitivity = 0;
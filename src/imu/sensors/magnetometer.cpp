@@ -1,11 +1,13 @@
 #include "magnetometer.hpp"
+#include "byte_order.hpp"
 
 namespace imu {
 
 auto Magnetometer::Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus {
   sensor_data_register = imu::MAGNETOMETER_MEASUREMENT_DATA;
-  register_data_length_in_bytes = 7;
+  register_data_length_in_bytes = MEASUREMENT_DATA_LENGTH_IN_BYTES;
   little_endian = true;
+  read_mode_ = types::MagnetometerReadMode::BYPASS;
 
   if (GeneralSensor::Init(i2c_address) != types::DriverStatus::OK)
     return types::DriverStatus::HAL_ERROR;
@@ -21,75 +23,185 @@ auto Magnetometer::SetInitData(void) noexcept -> void {
   PowerDownMagnetometer();
   EnterFuseROMAccessMode();
   GetCalibrationValues();
+  UpdateScaleFactors();
   PowerDownMagnetometer();
   ConfigureForContinuousRead();
 }
 
 auto Magnetometer::PowerDownMagnetometer(void) noexcept -> void {
-  auto cntl_register_value = std::make_unique<utilities::Byte>(0);
-  // MODE[3:0]: Operation mode setting -> "0000": Power-down mode
-  cntl_register_value->ClearBit(0);
-  cntl_register_value->ClearBit(1);
-  cntl_register_value->ClearBit(2);
-  cntl_register_value->ClearBit(3);
-  WriteContentIntoRegister(AK8963_CNTL, cntl_register_value->Get());
+  constexpr auto cntl_register_value = utilities::Byte(0)
+                                           .Set(AK8963_CNTL_MODE, AK8963_MODE_POWER_DOWN)
+                                           .Get();
+  WriteContentIntoRegister(AK8963_CNTL, cntl_register_value);
   utilities::Sleep(REBOOT_TIME_IN_MS);
 }
 
 auto Magnetometer::EnterFuseROMAccessMode(void) noexcept -> void {
-  auto cntl_register_value = std::make_unique<utilities::Byte>(0);
-  // MODE[3:0]: Operation mode setting -> "1111": Fuse ROM access mode
-  cntl_register_value->SetBit(0);
-  cntl_register_value->SetBit(1);
-  cntl_register_value->SetBit(2);
-  cntl_register_value->SetBit(3);
-  WriteContentIntoRegister(AK8963_CNTL, cntl_register_value->Get());
+  constexpr auto cntl_register_value = utilities::Byte(0)
+                                           .Set(AK8963_CNTL_MODE, AK8963_MODE_FUSE_ROM_ACCESS)
+                                           .Get();
+  WriteContentIntoRegister(AK8963_CNTL, cntl_register_value);
   utilities::Sleep(REBOOT_TIME_IN_MS);
 }
 
 auto Magnetometer::ConfigureForContinuousRead(void) noexcept -> void {
-  auto cntl_register_value = std::make_unique<utilities::Byte>(0);
   // See MPU-9255 Register Map, Revision 1.0, p. 51
-  cntl_register_value->SetBit(1);  // Enable continuous mode data acquisition at 8 Hz.
-  cntl_register_value->SetBit(4);  // Enable 16 bit resolution
-  WriteContentIntoRegister(AK8963_CNTL, cntl_register_value->Get());
+  constexpr auto cntl_register_value = utilities::Byte(0)
+                                           .Set(AK8963_CNTL_MODE, AK8963_MODE_CONTINUOUS_8_HZ)  // Enable continuous mode data acquisition at 8 Hz.
+                                           .Set(AK8963_CNTL_BIT, AK8963_OUTPUT_16_BIT)          // Enable 16 bit resolution
+                                           .Get();
+  WriteContentIntoRegister(AK8963_CNTL, cntl_register_value);
   utilities::Sleep(REBOOT_TIME_IN_MS);
 }
 
 auto Magnetometer::Update(void) noexcept -> types::DriverStatus {
+  has_new_sample_ = false;
+
   if (!IsInitialized())
     return types::DriverStatus::HAL_ERROR;
 
-  if (!IsMagnetometerMeasurementReady())
+  if (read_mode_ == types::MagnetometerReadMode::AUXILIARY_I2C_MASTER)
+    return UpdateFromExternalSensorData();
+
+  return UpdateFromMagnetometer();
+}
+
+auto Magnetometer::HasNewSample(void) noexcept -> bool {
+  return has_new_sample_;
+}
+
+auto Magnetometer::SetReadMode(const types::MagnetometerReadMode read_mode) noexcept -> types::DriverStatus {
+  if (!IsInitialized())
     return types::DriverStatus::HAL_ERROR;
 
-  if (SensorVector::Update() == types::DriverStatus::OK) {
-    if (HasMagnetometerOverflow(raw_values_.at(ST2_REGISTER_BYTE)))
-      return types::DriverStatus::HAL_ERROR;
+  if (read_mode == types::MagnetometerReadMode::AUXILIARY_I2C_MASTER) {
+    // ST1, measurement data and ST2 are mirrored by the MPU9255 I2C master, see Mpu9255::SetInitConfigAuxiliaryI2CMaster
+    SetI2CAdress(imu::MPU9255_ADDRESS);
+    sensor_data_register = imu::EXT_SENS_DATA_00;
+    register_data_length_in_bytes = imu::AK8963_ST1_TO_ST2_LENGTH_IN_BYTES;
+  } else {
+    SetI2CAdress(imu::AK8963_ADDRESS);
+    sensor_data_register = imu::MAGNETOMETER_MEASUREMENT_DATA;
+    register_data_length_in_bytes = MEASUREMENT_DATA_LENGTH_IN_BYTES;
+  }
 
-    if (ImuConnectionSuccessful()) {
-      SetSensorValues(
-          ConvertUint8BytesIntoInt16SensorValue(raw_values_));
+  read_mode_ = read_mode;
+  return types::DriverStatus::OK;
+}
 
-      const auto adc_2_magnetometer = GetFactorADC2Magnetometer();
-      sensor_values_.x = static_cast<std::int16_t>(adc_2_magnetometer * static_cast<float>(sensor_values_.x) * calibration_values_.x);
-      sensor_values_.y = static_cast<std::int16_t>(adc_2_magnetometer * static_cast<float>(sensor_values_.y) * calibration_values_.y);
-      sensor_values_.z = static_cast<std::int16_t>(adc_2_magnetometer * static_cast<float>(sensor_values_.z) * calibration_values_.z);
-      return types::DriverStatus::OK;
+auto Magnetometer::SetHardAndSoftIronCalibration(const types::HardAndSoftIronCalibration& calibration) noexcept -> void {
+  iron_calibration_.offset.x = calibration.offset.x;
+  iron_calibration_.offset.y = calibration.offset.y;
+  iron_calibration_.offset.z = calibration.offset.z;
+  iron_calibration_.correction = calibration.correction;
+  has_iron_correction_ = true;
+  CombineIronCorrectionWithConversion();
+}
+
+auto Magnetometer::CombineIronCorrectionWithConversion(void) noexcept -> void {
+  // correction * (raw * conversion_scale + conversion_offset - offset)
+  const float scale[3] = {conversion_scale_.x, conversion_scale_.y, conversion_scale_.z};
+  const float shift[3] = {conversion_offset_.x - iron_calibration_.offset.x,
+                          conversion_offset_.y - iron_calibration_.offset.y,
+                          conversion_offset_.z - iron_calibration_.offset.z};
+
+  for (std::uint8_t row = 0; row < 3; row++) {
+    combined_offset_[row] = 0.0f;
+    for (std::uint8_t column = 0; column < 3; column++) {
+      combined_correction_[row * 3 + column] = iron_calibration_.correction[row * 3 + column] * scale[column];
+      combined_offset_[row] += iron_calibration_.correction[row * 3 + column] * shift[column];
     }
   }
+}
+
+auto Magnetometer::ConvertSensorValues(void) noexcept -> void {
+  unscaled_values_.x = sensor_values_.x;
+  unscaled_values_.y = sensor_values_.y;
+  unscaled_values_.z = sensor_values_.z;
+
+  if (!has_iron_correction_) {
+    ApplySensitivityAdjustment();
+    return;
+  }
+
+  const float raw[3] = {static_cast<float>(sensor_values_.x), static_cast<float>(sensor_values_.y), static_cast<float>(sensor_values_.z)};
+  float corrected[3];
+  for (std::uint8_t row = 0; row < 3; row++)
+    corrected[row] = combined_correction_[row * 3 + 0] * raw[0] + combined_correction_[row * 3 + 1] * raw[1] + combined_correction_[row * 3 + 2] * raw[2] + combined_offset_[row];
+
+  calibrated_values_.x = corrected[0];
+  calibrated_values_.y = corrected[1];
+  calibrated_values_.z = corrected[2];
+  sensor_values_.x = static_cast<std::int16_t>(corrected[0]);
+  sensor_values_.y = static_cast<std::int16_t>(corrected[1]);
+  sensor_values_.z = static_cast<std::int16_t>(corrected[2]);
+}
+
+auto Magnetometer::ApplySensitivityAdjustment(void) noexcept -> void {
+  // ADC factor first, then the sensitivity adjustment. Multiplying the raw value with their
+  // cached product rounds differently and moves about 1 in 16000 outputs by one unit.
+  const auto adc_2_magnetometer = GetFactorADC2Magnetometer();
+  calibrated_values_.x = adc_2_magnetometer * static_cast<float>(sensor_values_.x) * calibration_values_.x;
+  calibrated_values_.y = adc_2_magnetometer * static_cast<float>(sensor_values_.y) * calibration_values_.y;
+  calibrated_values_.z = adc_2_magnetometer * static_cast<float>(sensor_values_.z) * calibration_values_.z;
+  sensor_values_.x = static_cast<std::int16_t>(calibrated_values_.x);
+  sensor_values_.y = static_cast<std::int16_t>(calibrated_values_.y);
+  sensor_values_.z = static_cast<std::int16_t>(calibrated_values_.z);
+}
+
+auto Magnetometer::UpdateFromExternalSensorData(void) noexcept -> types::DriverStatus {
+  if (GetRawValues() != types::DriverStatus::OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  // No new measurement since the last update is not an error, the previous one stays valid
+  if (!IsDataReadyBitSet(raw_values_.at(EXT_SENS_DATA_ST1_BYTE)))
+    return types::DriverStatus::OK;
+
+  if (HasMagnetometerOverflow(raw_values_.at(EXT_SENS_DATA_ST2_BYTE)))
+    return types::DriverStatus::HAL_ERROR;
 
-  return types::DriverStatus::HAL_ERROR;
+  utilities::DecodeInt16Triple(raw_values_.data() + EXT_SENS_DATA_MEASUREMENT_BYTE, little_endian, sensor_values_);
+  ConvertSensorValues();
+  has_new_sample_ = true;
+  return types::DriverStatus::OK;
 }
 
-auto Magnetometer::IsMagnetometerMeasurementReady(void) noexcept -> bool {
-  auto st1_register = std::make_unique<utilities::Byte>(ReadContentFromRegister(imu::AK8963_ST1, 1).at(0));
-  return st1_register->IsBitHigh(0);
+auto Magnetometer::UpdateFromMagnetometer(void) noexcept -> types::DriverStatus {
+  std::uint8_t st1_register_value = 0;
+  ReadContentFromRegisterIntoBuffer(imu::AK8963_ST1, &st1_register_value, 1);
+  if (!ImuConnectionSuccessful())
+    return types::DriverStatus::HAL_ERROR;
+
+  // No new measurement since the last update is not an error, the previous one stays valid
+  if (!IsDataReadyBitSet(st1_register_value))
+    return types::DriverStatus::OK;
+
+  if (SensorVector::Update() != types::DriverStatus::OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  if (HasMagnetometerOverflow(raw_values_.at(ST2_REGISTER_BYTE)))
+    return types::DriverStatus::HAL_ERROR;
+
+  ConvertSensorValues();
+  has_new_sample_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto Magnetometer::IsDataReadyBitSet(const std::uint8_t st1_register_value) noexcept -> bool {
+  return AK8963_ST1_DRDY.IsSet(st1_register_value);
 }
 
 auto Magnetometer::HasMagnetometerOverflow(const std::uint8_t st2_register_value) noexcept -> bool {
-  auto st2_register = std::make_unique<utilities::Byte>(st2_register_value);
-  return st2_register->IsBitHigh(3);
+  return AK8963_ST2_HOFL.IsSet(st2_register_value);
+}
+
+auto Magnetometer::UpdateScaleFactors(void) noexcept -> void {
+  const auto adc_2_magnetometer = GetFactorADC2Magnetometer();
+  SetScaleAndOffset(types::EuclideanVector<float>{adc_2_magnetometer * calibration_values_.x,
+                                                  adc_2_magnetometer * calibration_values_.y,
+                                                  adc_2_magnetometer * calibration_values_.z},
+                    types::EuclideanVector<float>{0.0f, 0.0f, 0.0f});
+  CombineIronCorrectionWithConversion();
 }
 
 auto Magnetometer::GetFactorADC2Magnetometer(void) noexcept -> float {
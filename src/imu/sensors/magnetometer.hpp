@@ -12,23 +12,49 @@ class Magnetometer final : public MagnetometerInterface {
   Magnetometer() = delete;
   ~Magnetometer() = default;
 
-  explicit Magnetometer(std::shared_ptr<i2c::I2CInterface> i2c_handler) : MagnetometerInterface(i2c_handler){};
+  explicit Magnetometer(std::shared_ptr<transport::RegisterTransportInterface> transport) : MagnetometerInterface(transport){};
   auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus override;
   auto Update(void) noexcept -> types::DriverStatus override;
+  auto SetReadMode(const types::MagnetometerReadMode read_mode) noexcept -> types::DriverStatus override;
+  auto HasNewSample(void) noexcept -> bool override;
+
+  /**
+   * @brief Replaces the per axis scaling by a full 3x3 correction of hard and soft iron.
+   *        It is combined with the conversion of the raw values once, so Update() costs
+   *        one matrix vector product per sample.
+   */
+  auto SetHardAndSoftIronCalibration(const types::HardAndSoftIronCalibration& calibration) noexcept -> void override;
 
  private:
   types::EuclideanVector<float> calibration_values_{-1, -1, -1};
+  types::MagnetometerReadMode read_mode_ = types::MagnetometerReadMode::BYPASS;
+  bool has_iron_correction_ = false;
+  bool has_new_sample_ = false;
+  types::HardAndSoftIronCalibration iron_calibration_;
+  /// Correction times the conversion of the raw values, row major
+  std::array<float, 9> combined_correction_{};
+  std::array<float, 3> combined_offset_{};
   static constexpr float MAX_MAGNETIC_FLUX_IN_MICRO_TESLA = 4912.0f;
   static constexpr float MAX_MAGNETIC_MEASUREMENT_IN_DIGIT_16BIT = 32760.0f;
   static constexpr std::uint32_t REBOOT_TIME_IN_MS = 10;
   static constexpr std::int8_t ST2_REGISTER_BYTE = 6;
+  static constexpr std::uint8_t MEASUREMENT_DATA_LENGTH_IN_BYTES = 7;
+  static constexpr std::int8_t EXT_SENS_DATA_ST1_BYTE = 0;
+  static constexpr std::int8_t EXT_SENS_DATA_MEASUREMENT_BYTE = 1;
+  static constexpr std::int8_t EXT_SENS_DATA_ST2_BYTE = 7;
 
   auto SetInitData(void) noexcept -> void;
   auto PowerDownMagnetometer(void) noexcept -> void;
   auto EnterFuseROMAccessMode(void) noexcept -> void;
   auto ConfigureForContinuousRead(void) noexcept -> void;
-  auto IsMagnetometerMeasurementReady(void) noexcept -> bool;
+  auto UpdateFromExternalSensorData(void) noexcept -> types::DriverStatus;
+  auto UpdateFromMagnetometer(void) noexcept -> types::DriverStatus;
+  auto IsDataReadyBitSet(const std::uint8_t st1_register_value) noexcept -> bool;
   auto HasMagnetometerOverflow(const std::uint8_t st2_register_value) noexcept -> bool;
+  auto UpdateScaleFactors(void) noexcept -> void;
+  auto CombineIronCorrectionWithConversion(void) noexcept -> void;
+  auto ConvertSensorValues(void) noexcept -> void;
+  auto ApplySensitivityAdjustment(void) noexcept -> void;
   auto GetFactorADC2Magnetometer(void) noexcept -> float;
   auto GetCalibrationValues(void) noexcept -> void;
   auto AdjustSensitivity(const std::uint8_t sensitivity_adjustment_value) noexcept -> float;
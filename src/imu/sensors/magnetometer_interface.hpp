@@ -1,6 +1,7 @@
 #ifndef SRC_MAGNETOMETER_INTERFACE_HPP_
 #define SRC_MAGNETOMETER_INTERFACE_HPP_
 
+#include "imu_magnetometer_read_mode.hpp"
 #include "sensor_vector.hpp"
 
 namespace imu {
@@ -10,8 +11,16 @@ class MagnetometerInterface : public SensorVector {
   MagnetometerInterface() = delete;
   ~MagnetometerInterface() = default;
 
-  explicit MagnetometerInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorVector(i2c_handler){};
+  explicit MagnetometerInterface(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorVector(transport){};
   virtual auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus = 0;
+  virtual auto SetReadMode(const types::MagnetometerReadMode read_mode) noexcept -> types::DriverStatus = 0;
+  virtual auto SetHardAndSoftIronCalibration(const types::HardAndSoftIronCalibration& calibration) noexcept -> void = 0;
+
+  /**
+   * @brief True if the last Update() read a new measurement. Update() returns OK without one
+   *        while the AK8963 has no new measurement ready, Get() keeps the previous one then.
+   */
+  virtual auto HasNewSample(void) noexcept -> bool = 0;
 };
 
 }  // namespace imu
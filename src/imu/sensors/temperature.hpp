@@ -10,7 +10,7 @@ class Temperature final : public TemperatureInterface {
   Temperature() = delete;
   ~Temperature() = default;
 
-  explicit Temperature(std::shared_ptr<i2c::I2CInterface> i2c_handler) : TemperatureInterface(i2c_handler){};
+  explicit Temperature(std::shared_ptr<transport::RegisterTransportInterface> transport) : TemperatureInterface(transport){};
   auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus override;
   auto Update(void) noexcept -> types::DriverStatus override;
 
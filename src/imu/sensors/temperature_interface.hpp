@@ -10,7 +10,7 @@ class TemperatureInterface : public SensorSingleValue {
   TemperatureInterface() = delete;
   ~TemperatureInterface() = default;
 
-  explicit TemperatureInterface(std::shared_ptr<i2c::I2CInterface> i2c_handler) : SensorSingleValue(i2c_handler){};
+  explicit TemperatureInterface(std::shared_ptr<transport::RegisterTransportInterface> transport) : SensorSingleValue(transport){};
   virtual auto Init(const std::uint8_t i2c_address) noexcept -> types::DriverStatus = 0;
   virtual auto Update(void) noexcept -> types::DriverStatus = 0;
 };
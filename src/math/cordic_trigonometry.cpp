@@ -0,0 +1,159 @@
+#include "cordic_trigonometry.hpp"
+
+namespace math {
+
+constexpr std::uint32_t CordicTrigonometry::CORDIC_PRECISION;
+constexpr std::uint32_t CordicTrigonometry::CORDIC_TIMEOUT_IN_MS;
+constexpr std::uint32_t CordicTrigonometry::UNCONFIGURED;
+
+namespace {
+
+/// The CORDIC square root is only accurate for arguments in [0.027, 0.75) without scaling
+constexpr std::int32_t SQUARE_ROOT_LOWER_BOUND = static_cast<std::int32_t>(3) << 27;
+constexpr std::int32_t SQUARE_ROOT_UPPER_BOUND = static_cast<std::int32_t>(3) << 29;
+
+/// Modulus of the cosine function, the largest q1.31 value stands for 1
+constexpr std::int32_t UNIT_MODULUS = INT32_MAX;
+
+}  // namespace
+
+auto CordicTrigonometry::SineCosine(const std::int32_t* angles, std::int32_t* sines, std::int32_t* cosines, std::uint32_t length) noexcept -> types::DriverStatus {
+  if (angles == nullptr || length > MAX_TRIGONOMETRY_BATCH_LENGTH)
+    return types::DriverStatus::INPUT_ERROR;
+
+  // The cosine function delivers the cosine first and the sine as second result. ARG2 keeps the
+  // last value written to it, which is the y of a previous phase batch, so the modulus is
+  // written with every angle instead of relying on its reset value.
+  auto cordic_status = Configure(CORDIC_FUNCTION_COSINE, CORDIC_NBWRITE_2, CORDIC_NBREAD_2);
+  if (cordic_status != types::DriverStatus::OK)
+    return cordic_status;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    arguments_[2 * index] = angles[index];
+    arguments_[2 * index + 1] = UNIT_MODULUS;
+  }
+
+  cordic_status = Calculate(length);
+  if (cordic_status != types::DriverStatus::OK)
+    return cordic_status;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    if (cosines != nullptr)
+      cosines[index] = results_[2 * index];
+    if (sines != nullptr)
+      sines[index] = results_[2 * index + 1];
+  }
+
+  return types::DriverStatus::OK;
+}
+
+auto CordicTrigonometry::PhaseMagnitude(const std::int32_t* x, const std::int32_t* y, std::int32_t* phases, std::int32_t* magnitudes, std::uint32_t length) noexcept -> types::DriverStatus {
+  if (x == nullptr || y == nullptr || length > MAX_TRIGONOMETRY_BATCH_LENGTH)
+    return types::DriverStatus::INPUT_ERROR;
+
+  auto cordic_status = Configure(CORDIC_FUNCTION_PHASE, CORDIC_NBWRITE_2, CORDIC_NBREAD_2);
+  if (cordic_status != types::DriverStatus::OK)
+    return cordic_status;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    arguments_[2 * index] = x[index];
+    arguments_[2 * index + 1] = y[index];
+  }
+
+  cordic_status = Calculate(length);
+  if (cordic_status != types::DriverStatus::OK)
+    return cordic_status;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    if (phases != nullptr)
+      phases[index] = results_[2 * index];
+    if (magnitudes != nullptr)
+      magnitudes[index] = results_[2 * index + 1];
+  }
+
+  return types::DriverStatus::OK;
+}
+
+auto CordicTrigonometry::SquareRoot(const std::int32_t* values, std::int32_t* roots, std::uint32_t length) noexcept -> types::DriverStatus {
+  if (values == nullptr || roots == nullptr || length > MAX_TRIGONOMETRY_BATCH_LENGTH)
+    return types::DriverStatus::INPUT_ERROR;
+
+  auto cordic_status = Configure(CORDIC_FUNCTION_SQUAREROOT, CORDIC_NBWRITE_1, CORDIC_NBREAD_1);
+  if (cordic_status != types::DriverStatus::OK)
+    return cordic_status;
+
+  // Every value is normalized by an even shift into [0.1875, 0.75), which one scale covers,
+  // so the batch needs no reconfiguration. The root is shifted back by half of it afterwards.
+  std::array<std::int8_t, MAX_TRIGONOMETRY_BATCH_LENGTH> half_shifts;
+  for (std::uint32_t index = 0; index < length; index++) {
+    auto value = values[index];
+    if (value < 0)
+      return types::DriverStatus::INPUT_ERROR;
+
+    std::int8_t half_shift = 0;
+    if (value >= SQUARE_ROOT_UPPER_BOUND) {
+      value >>= 2;
+      half_shift = -1;
+    }
+    while (value != 0 && value < SQUARE_ROOT_LOWER_BOUND) {
+      value <<= 2;
+      half_shift++;
+    }
+
+    arguments_[index] = value;
+    half_shifts[index] = half_shift;
+  }
+
+  cordic_status = Calculate(length);
+  if (cordic_status != types::DriverStatus::OK)
+    return cordic_status;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    if (arguments_[index] == 0)
+      roots[index] = 0;
+    else if (half_shifts[index] < 0)
+      roots[index] = results_[index] << 1;
+    else
+      roots[index] = results_[index] >> half_shifts[index];
+  }
+
+  return types::DriverStatus::OK;
+}
+
+auto CordicTrigonometry::Configure(std::uint32_t function, std::uint32_t number_of_arguments, std::uint32_t number_of_results) noexcept -> types::DriverStatus {
+  if (configured_function_ == function)
+    return types::DriverStatus::OK;
+
+  CORDIC_ConfigTypeDef configuration;
+  configuration.Function = function;
+  configuration.Scale = CORDIC_SCALE_0;
+  configuration.InSize = CORDIC_INSIZE_32BITS;
+  configuration.OutSize = CORDIC_OUTSIZE_32BITS;
+  configuration.NbWrite = number_of_arguments;
+  configuration.NbRead = number_of_results;
+  configuration.Precision = CORDIC_PRECISION;
+
+  const auto cordic_status = GetCordicStatus(HAL_CORDIC_Configure(&hcordic, &configuration));
+  configured_function_ = (cordic_status == types::DriverStatus::OK) ? function : UNCONFIGURED;
+  return cordic_status;
+}
+
+auto CordicTrigonometry::Calculate(std::uint32_t length) noexcept -> types::DriverStatus {
+  if (length == 0)
+    return types::DriverStatus::OK;
+
+  return GetCordicStatus(HAL_CORDIC_CalculateZO(&hcordic, arguments_.data(), results_.data(), length, CORDIC_TIMEOUT_IN_MS));
+}
+
+auto CordicTrigonometry::GetCordicStatus(HAL_StatusTypeDef hal_status) noexcept -> types::DriverStatus {
+  switch (hal_status) {
+    case HAL_OK:
+      return types::DriverStatus::OK;
+    case HAL_TIMEOUT:
+      return types::DriverStatus::TIMEOUT;
+    default:
+      return types::DriverStatus::HAL_ERROR;
+  }
+}
+
+}  // namespace math
@@ -0,0 +1,50 @@
+#ifndef SRC_MATH_CORDIC_TRIGONOMETRY_HPP_
+#define SRC_MATH_CORDIC_TRIGONOMETRY_HPP_
+
+#include <array>
+#include "stm32g4xx_hal.h"
+
+#include "cordic_config.h"
+#include "trigonometry_interface.hpp"
+
+namespace math {
+
+/**
+ * @brief Trigonometry service on the CORDIC coprocessor of the STM32G4 in q1.31.
+ *        A batch is computed in zero-overhead mode: the arguments are written back to back
+ *        and every read of the result stalls the bus until the CORDIC is done, so there is
+ *        neither polling nor an interrupt. The coprocessor is only reconfigured when the
+ *        function changes between two batches.
+ * 
+ */
+class CordicTrigonometry final : public TrigonometryInterface {
+ public:
+  ~CordicTrigonometry() = default;
+  CordicTrigonometry() = default;
+
+  auto SineCosine(const std::int32_t* angles, std::int32_t* sines, std::int32_t* cosines, std::uint32_t length) noexcept -> types::DriverStatus override;
+  auto PhaseMagnitude(const std::int32_t* x, const std::int32_t* y, std::int32_t* phases, std::int32_t* magnitudes, std::uint32_t length) noexcept -> types::DriverStatus override;
+  auto SquareRoot(const std::int32_t* values, std::int32_t* roots, std::uint32_t length) noexcept -> types::DriverStatus override;
+
+  /// 24 iterations, the error of the results is in the order of 2^-20
+  static constexpr std::uint32_t CORDIC_PRECISION = CORDIC_PRECISION_6CYCLES;
+  static constexpr std::uint32_t CORDIC_TIMEOUT_IN_MS = 1;
+
+ private:
+  auto Configure(std::uint32_t function, std::uint32_t number_of_arguments, std::uint32_t number_of_results) noexcept -> types::DriverStatus;
+  auto Calculate(std::uint32_t length) noexcept -> types::DriverStatus;
+  auto GetCordicStatus(HAL_StatusTypeDef hal_status) noexcept -> types::DriverStatus;
+
+  /// Marks that no function was configured yet
+  static constexpr std::uint32_t UNCONFIGURED = 0xFFFFFFFF;
+
+  std::uint32_t configured_function_ = UNCONFIGURED;
+
+  /// Arguments and results interleaved as the CORDIC reads and writes them, two per calculation at most
+  std::array<std::int32_t, 2 * MAX_TRIGONOMETRY_BATCH_LENGTH> arguments_{};
+  std::array<std::int32_t, 2 * MAX_TRIGONOMETRY_BATCH_LENGTH> results_{};
+};
+
+}  // namespace math
+
+#endif
@@ -0,0 +1,118 @@
+#include "polynomial_trigonometry.hpp"
+#include <cmath>
+#include "fixed_point.hpp"
+
+namespace math {
+
+namespace {
+
+constexpr float PI = 3.14159265358979323846f;
+constexpr float SQUARE_ROOT_OF_3 = 1.73205080756887729353f;
+constexpr float TANGENT_OF_PI_DIVIDED_BY_12 = 0.26794919243112270647f;
+constexpr std::int32_t QUARTER_TURN = static_cast<std::int32_t>(1) << 30;
+constexpr std::int32_t EIGHTH_TURN = static_cast<std::int32_t>(1) << 29;
+
+/// Taylor polynomials, within [-pi/4, pi/4] their truncation error is below 2e-9
+auto SinePolynomial(const float x) noexcept -> float {
+  const auto x2 = x * x;
+  return x * (1.0f - x2 / 6.0f * (1.0f - x2 / 20.0f * (1.0f - x2 / 42.0f * (1.0f - x2 / 72.0f))));
+}
+
+auto CosinePolynomial(const float x) noexcept -> float {
+  const auto x2 = x * x;
+  return 1.0f - x2 / 2.0f * (1.0f - x2 / 12.0f * (1.0f - x2 / 30.0f * (1.0f - x2 / 56.0f * (1.0f - x2 / 90.0f))));
+}
+
+/// atan within [0, 1]: above tan(pi/12) the argument is shifted by pi/6, so the Taylor polynomial stays below 1e-8
+auto ArcTangentOfUnitInterval(const float x) noexcept -> float {
+  auto offset = 0.0f;
+  auto reduced = x;
+  if (x > TANGENT_OF_PI_DIVIDED_BY_12) {
+    offset = PI / 6.0f;
+    reduced = (x * SQUARE_ROOT_OF_3 - 1.0f) / (x + SQUARE_ROOT_OF_3);
+  }
+
+  const auto x2 = reduced * reduced;
+  return offset + reduced * (1.0f - x2 * (1.0f / 3.0f - x2 * (1.0f / 5.0f - x2 * (1.0f / 7.0f - x2 / 9.0f))));
+}
+
+auto RadiansToQ31(const float radians) noexcept -> std::int32_t {
+  return utilities::ToFixedPoint<31>(radians / PI);
+}
+
+}  // namespace
+
+auto PolynomialTrigonometry::SineCosine(const std::int32_t* angles, std::int32_t* sines, std::int32_t* cosines, std::uint32_t length) noexcept -> types::DriverStatus {
+  if (angles == nullptr || length > MAX_TRIGONOMETRY_BATCH_LENGTH)
+    return types::DriverStatus::INPUT_ERROR;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    // Rounding to the nearest quarter turn is exact in integers and leaves at most an eighth turn for the polynomials
+    const auto shifted = static_cast<std::uint32_t>(angles[index]) + static_cast<std::uint32_t>(EIGHTH_TURN);
+    const auto quadrant = shifted >> 30;
+    const auto remainder = static_cast<std::int32_t>(shifted & static_cast<std::uint32_t>(QUARTER_TURN - 1)) - EIGHTH_TURN;
+    const auto radians = AngleToRadians(remainder);
+
+    const auto sine = SinePolynomial(radians);
+    const auto cosine = CosinePolynomial(radians);
+    const float quadrant_sines[4] = {sine, cosine, -sine, -cosine};
+    const float quadrant_cosines[4] = {cosine, -sine, -cosine, sine};
+
+    if (sines != nullptr)
+      sines[index] = utilities::ToFixedPoint<31>(quadrant_sines[quadrant]);
+    if (cosines != nullptr)
+      cosines[index] = utilities::ToFixedPoint<31>(quadrant_cosines[quadrant]);
+  }
+
+  return types::DriverStatus::OK;
+}
+
+auto PolynomialTrigonometry::PhaseMagnitude(const std::int32_t* x, const std::int32_t* y, std::int32_t* phases, std::int32_t* magnitudes, std::uint32_t length) noexcept -> types::DriverStatus {
+  if (x == nullptr || y == nullptr || length > MAX_TRIGONOMETRY_BATCH_LENGTH)
+    return types::DriverStatus::INPUT_ERROR;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    const auto x_value = utilities::ToFloat<31>(x[index]);
+    const auto y_value = utilities::ToFloat<31>(y[index]);
+    const auto x_absolute = std::fabs(x_value);
+    const auto y_absolute = std::fabs(y_value);
+
+    if (phases != nullptr) {
+      // Octant reduction, the polynomial only sees the ratio of the smaller to the larger element
+      auto phase = 0.0f;
+      if (x_absolute >= y_absolute && x_absolute > 0.0f)
+        phase = ArcTangentOfUnitInterval(y_absolute / x_absolute);
+      else if (y_absolute > x_absolute)
+        phase = PI / 2.0f - ArcTangentOfUnitInterval(x_absolute / y_absolute);
+
+      if (x_value < 0.0f)
+        phase = PI - phase;
+      if (y_value < 0.0f)
+        phase = -phase;
+
+      phases[index] = RadiansToQ31(phase);
+    }
+
+    if (magnitudes != nullptr)
+      magnitudes[index] = utilities::ToFixedPoint<31>(std::sqrt(x_value * x_value + y_value * y_value));
+  }
+
+  return types::DriverStatus::OK;
+}
+
+auto PolynomialTrigonometry::SquareRoot(const std::int32_t* values, std::int32_t* roots, std::uint32_t length) noexcept -> types::DriverStatus {
+  if (values == nullptr || roots == nullptr || length > MAX_TRIGONOMETRY_BATCH_LENGTH)
+    return types::DriverStatus::INPUT_ERROR;
+
+  for (std::uint32_t index = 0; index < length; index++) {
+    if (values[index] < 0)
+      return types::DriverStatus::INPUT_ERROR;
+
+    // A square root needs no polynomial, the FPU has an instruction for it
+    roots[index] = utilities::ToFixedPoint<31>(std::sqrt(utilities::ToFloat<31>(values[index])));
+  }
+
+  return types::DriverStatus::OK;
+}
+
+}  // namespace math
@@ -0,0 +1,26 @@
+#ifndef SRC_MATH_POLYNOMIAL_TRIGONOMETRY_HPP_
+#define SRC_MATH_POLYNOMIAL_TRIGONOMETRY_HPP_
+
+#include "trigonometry_interface.hpp"
+
+namespace math {
+
+/**
+ * @brief Portable implementation of the trigonometry service with polynomial approximations
+ *        in single precision float after an exact integer range reduction.
+ *        Serves the host build and targets without CORDIC, errors stay below 1e-6.
+ * 
+ */
+class PolynomialTrigonometry final : public TrigonometryInterface {
+ public:
+  ~PolynomialTrigonometry() = default;
+  PolynomialTrigonometry() = default;
+
+  auto SineCosine(const std::int32_t* angles, std::int32_t* sines, std::int32_t* cosines, std::uint32_t length) noexcept -> types::DriverStatus override;
+  auto PhaseMagnitude(const std::int32_t* x, const std::int32_t* y, std::int32_t* phases, std::int32_t* magnitudes, std::uint32_t length) noexcept -> types::DriverStatus override;
+  auto SquareRoot(const std::int32_t* values, std::int32_t* roots, std::uint32_t length) noexcept -> types::DriverStatus override;
+};
+
+}  // namespace math
+
+#endif
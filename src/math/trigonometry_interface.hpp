@@ -0,0 +1,76 @@
+#ifndef SRC_MATH_TRIGONOMETRY_INTERFACE_HPP_
+#define SRC_MATH_TRIGONOMETRY_INTERFACE_HPP_
+
+#include <cstdint>
+#include "error_types.hpp"
+
+namespace math {
+
+/// Amount of calculations one request may contain
+static constexpr std::uint32_t MAX_TRIGONOMETRY_BATCH_LENGTH = 64;
+
+/**
+ * @brief Interface of a service for trigonometric functions, which works on batches of q1.31 values,
+ *        so one request can carry all sines, cosines or phases a control loop needs.
+ *        Angles are q1.31 in units of pi, so INT32_MIN is -pi and INT32_MAX is just below pi.
+ * 
+ */
+class TrigonometryInterface {
+ public:
+  virtual ~TrigonometryInterface() = default;
+
+  /**
+   * @brief Calculates sine and cosine of every angle
+   * 
+   * @param angles Angles in q1.31 units of pi
+   * @param sines Sines in q1.31, may be nullptr if not needed
+   * @param cosines Cosines in q1.31, may be nullptr if not needed
+   * @param length Amount of angles, at most MAX_TRIGONOMETRY_BATCH_LENGTH
+   * @return types::DriverStatus INPUT_ERROR for missing angles or a too long batch
+   */
+  virtual auto SineCosine(const std::int32_t* angles, std::int32_t* sines, std::int32_t* cosines, std::uint32_t length) noexcept -> types::DriverStatus = 0;
+
+  /**
+   * @brief Calculates phase and magnitude of every vector (x, y)
+   * 
+   * @param x X elements in q1.31
+   * @param y Y elements in q1.31, every vector has to be shorter than 1
+   * @param phases atan2(y, x) in q1.31 units of pi, may be nullptr if not needed
+   * @param magnitudes Length of the vectors in q1.31, may be nullptr if not needed
+   * @param length Amount of vectors, at most MAX_TRIGONOMETRY_BATCH_LENGTH
+   * @return types::DriverStatus INPUT_ERROR for missing elements or a too long batch
+   */
+  virtual auto PhaseMagnitude(const std::int32_t* x, const std::int32_t* y, std::int32_t* phases, std::int32_t* magnitudes, std::uint32_t length) noexcept -> types::DriverStatus = 0;
+
+  /**
+   * @brief Calculates the square root of every value
+   * 
+   * @param values Non negative values in q1.31
+   * @param roots Square roots in q1.31
+   * @param length Amount of values, at most MAX_TRIGONOMETRY_BATCH_LENGTH
+   * @return types::DriverStatus INPUT_ERROR for missing buffers, negative values or a too long batch
+   */
+  virtual auto SquareRoot(const std::int32_t* values, std::int32_t* roots, std::uint32_t length) noexcept -> types::DriverStatus = 0;
+};
+
+/**
+ * @brief Converts an angle in radians into q1.31 units of pi, wrapped into [-pi, pi)
+ */
+inline auto RadiansToAngle(const float radians) noexcept -> std::int32_t {
+  constexpr float TWO_TO_THE_31_DIVIDED_BY_PI = 683565275.6f;
+  // Wrapping through int64 and uint32 drops whole turns, which the float to int32 conversion would saturate
+  const auto turns_q31 = static_cast<std::int64_t>(radians * TWO_TO_THE_31_DIVIDED_BY_PI);
+  return static_cast<std::int32_t>(static_cast<std::uint32_t>(turns_q31));
+}
+
+/**
+ * @brief Converts an angle in q1.31 units of pi into radians
+ */
+inline auto AngleToRadians(const std::int32_t angle) noexcept -> float {
+  constexpr float PI_DIVIDED_BY_TWO_TO_THE_31 = 1.4629180792671596e-09f;
+  return static_cast<float>(angle) * PI_DIVIDED_BY_TWO_TO_THE_31;
+}
+
+}  // namespace math
+
+#endif
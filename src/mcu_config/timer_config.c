@@ -5,11 +5,27 @@
 TIM_HandleTypeDef htim2;
 TIM_HandleTypeDef htim3;
 TIM_HandleTypeDef htim4;
+TIM_HandleTypeDef htim6;
 TIM_HandleTypeDef htim16;
 TIM_HandleTypeDef htim17;
 
 void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
 
+/**
+  * @brief Clock of the timers on APB1 as set by SystemClock_Config
+  * @note  The timers run at twice PCLK1 as soon as APB1 is divided
+  * @retval Clock in Hz
+  */
+static uint32_t GetApb1TimerClock(void)
+{
+  RCC_ClkInitTypeDef clock_configuration = {0};
+  uint32_t flash_latency = 0;
+  HAL_RCC_GetClockConfig(&clock_configuration, &flash_latency);
+
+  const uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+  return (clock_configuration.APB1CLKDivider == RCC_HCLK_DIV1) ? pclk1 : 2U * pclk1;
+}
+
 /**
   * @brief TIM2 Initialization Function
   * @param None
@@ -167,6 +183,44 @@ void MX_TIM4_Init(void)
 
 }
 
+/**
+  * @brief TIM6 Initialization Function
+  * @param None
+  * @retval None
+  */
+void MX_TIM6_Init(void)
+{
+
+  /* USER CODE BEGIN TIM6_Init 0 */
+
+  /* USER CODE END TIM6_Init 0 */
+
+  TIM_MasterConfigTypeDef sMasterConfig = {0};
+
+  /* USER CODE BEGIN TIM6_Init 1 */
+
+  /* USER CODE END TIM6_Init 1 */
+  htim6.Instance = TIM6;
+  htim6.Init.Prescaler = __HAL_TIM_CALC_PSC(GetApb1TimerClock(), SCHEDULER_TIMER_CLOCK_IN_HZ);
+  htim6.Init.CounterMode = TIM_COUNTERMODE_UP;
+  htim6.Init.Period = SCHEDULER_TICK_PERIOD_IN_US - 1;
+  htim6.Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_DISABLE;
+  if (HAL_TIM_Base_Init(&htim6) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  sMasterConfig.MasterOutputTrigger = TIM_TRGO_RESET;
+  sMasterConfig.MasterSlaveMode = TIM_MASTERSLAVEMODE_DISABLE;
+  if (HAL_TIMEx_MasterConfigSynchronization(&htim6, &sMasterConfig) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  /* USER CODE BEGIN TIM6_Init 2 */
+
+  /* USER CODE END TIM6_Init 2 */
+
+}
+
 /**
   * @brief TIM16 Initialization Function
   * @param None
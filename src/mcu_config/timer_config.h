@@ -6,15 +6,21 @@
 	extern "C" {
 #endif
 
+/* Base rate of the scheduler, TIM6 counts at 1 MHz and interrupts once per period */
+#define SCHEDULER_TIMER_CLOCK_IN_HZ 1000000U
+#define SCHEDULER_TICK_PERIOD_IN_US 1000U
+
 extern TIM_HandleTypeDef htim2;
 extern TIM_HandleTypeDef htim3;
 extern TIM_HandleTypeDef htim4;
+extern TIM_HandleTypeDef htim6;
 extern TIM_HandleTypeDef htim16;
 extern TIM_HandleTypeDef htim17;
 
 void MX_TIM2_Init(void);
 void MX_TIM3_Init(void);
 void MX_TIM4_Init(void);
+void MX_TIM6_Init(void);
 void MX_TIM16_Init(void);
 void MX_TIM17_Init(void);
 
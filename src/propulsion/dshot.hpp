@@ -0,0 +1,209 @@
+#ifndef SRC_PROPULSION_DSHOT_HPP_
+#define SRC_PROPULSION_DSHOT_HPP_
+
+#include <array>
+#include <cstdint>
+#include "propulsion_hardware_types.hpp"
+
+namespace propulsion {
+
+/// Values 1 - 47 of the 11 throttle bits are commands, 0 disarms the motor
+static constexpr std::uint16_t DSHOT_MIN_THROTTLE = 48;
+static constexpr std::uint16_t DSHOT_MAX_THROTTLE = 2047;
+static constexpr std::uint8_t DSHOT_FRAME_BITS = 16;
+/// Bit times with low output after a frame, so the ESC detects its end
+static constexpr std::uint8_t DSHOT_RESET_BITS = 2;
+static constexpr std::uint8_t DSHOT_BIT_SLOTS = DSHOT_FRAME_BITS + DSHOT_RESET_BITS;
+/// Bits of the answer of a bidirectional ESC: a start bit and the GCR coded telemetry value
+static constexpr std::uint8_t DSHOT_TELEMETRY_BITS = 21;
+/// Every bit may change the level, the line may return to idle after the last bit
+static constexpr std::uint8_t DSHOT_TELEMETRY_MAX_EDGES = DSHOT_TELEMETRY_BITS + 1;
+/// Telemetry value of a motor which stands still, the longest period the exponent and mantissa hold
+static constexpr std::uint16_t DSHOT_TELEMETRY_MOTOR_STOPPED = 0x0FFF;
+
+/**
+ * @brief Timer ticks of one DShot bit. Every bit starts high, a one stays high for 3/4
+ *        of the bit time, a zero for 3/8.
+ * 
+ */
+struct DshotBitTiming {
+  std::uint32_t period_in_ticks;
+  std::uint32_t zero_high_ticks;
+  std::uint32_t one_high_ticks;
+};
+
+constexpr auto GetDshotBitRate(const types::DshotSpeed speed) noexcept -> std::uint32_t {
+  return speed == types::DshotSpeed::DSHOT_600 ? 600000u : 300000u;
+}
+
+/**
+ * @brief Rounds the bit timing to whole ticks of a timer running without prescaler
+ * @param timer_clock_in_hz Input clock of the timer
+ * @param speed Bit rate of the ESC
+ * 
+ */
+constexpr auto GetDshotBitTiming(const std::uint32_t timer_clock_in_hz, const types::DshotSpeed speed) noexcept -> DshotBitTiming {
+  const auto period = (timer_clock_in_hz + GetDshotBitRate(speed) / 2) / GetDshotBitRate(speed);
+  return DshotBitTiming{period, (period * 3 + 4) / 8, (period * 3 + 2) / 4};
+}
+
+/// CRC over the 12 bits of throttle and telemetry request, the XOR of their three nibbles
+constexpr auto GetDshotChecksum(const std::uint16_t throttle_and_telemetry) noexcept -> std::uint16_t {
+  return static_cast<std::uint16_t>((throttle_and_telemetry ^ (throttle_and_telemetry >> 4) ^ (throttle_and_telemetry >> 8)) & 0x0F);
+}
+
+/**
+ * @brief Builds a frame: 11 bits throttle, 1 bit telemetry request and 4 bits CRC, MSB first
+ * @param throttle DShot value, 0 to disarm, 1 - 47 for commands, 48 - 2047 for throttle
+ * @param request_telemetry Asks the ESC to answer on its telemetry wire
+ * 
+ */
+constexpr auto EncodeDshotFrame(const std::uint16_t throttle, const bool request_telemetry) noexcept -> std::uint16_t {
+  const auto throttle_and_telemetry = static_cast<std::uint16_t>(((throttle & 0x07FF) << 1) | (request_telemetry ? 1 : 0));
+  return static_cast<std::uint16_t>((throttle_and_telemetry << 4) | GetDshotChecksum(throttle_and_telemetry));
+}
+
+/**
+ * @brief Builds a frame for a bidirectional ESC, which recognizes it by its inverted CRC.
+ *        The line of a bidirectional ESC is inverted as well, it idles high.
+ * 
+ */
+constexpr auto EncodeBidirectionalDshotFrame(const std::uint16_t throttle, const bool request_telemetry) noexcept -> std::uint16_t {
+  return static_cast<std::uint16_t>(EncodeDshotFrame(throttle, request_telemetry) ^ 0x0F);
+}
+
+/**
+ * @brief Splits a frame into its fields
+ * @return True if the CRC matches, the fields are not valid otherwise
+ * 
+ */
+constexpr auto DecodeDshotFrame(const std::uint16_t frame, std::uint16_t& throttle, bool& request_telemetry) noexcept -> bool {
+  const auto throttle_and_telemetry = static_cast<std::uint16_t>(frame >> 4);
+  throttle = static_cast<std::uint16_t>(throttle_and_telemetry >> 1);
+  request_telemetry = (throttle_and_telemetry & 1) != 0;
+  return GetDshotChecksum(throttle_and_telemetry) == (frame & 0x0F);
+}
+
+/**
+ * @brief Compare values of all bit slots of a frame, followed by the low reset slots
+ * 
+ */
+inline auto EncodeDshotBits(const std::uint16_t frame, const DshotBitTiming& timing) noexcept -> std::array<std::uint32_t, DSHOT_BIT_SLOTS> {
+  std::array<std::uint32_t, DSHOT_BIT_SLOTS> compare_values{};
+  for (std::uint8_t bit = 0; bit < DSHOT_FRAME_BITS; bit++) {
+    const bool is_one = ((frame >> (DSHOT_FRAME_BITS - 1 - bit)) & 1) != 0;
+    compare_values[bit] = is_one ? timing.one_high_ticks : timing.zero_high_ticks;
+  }
+  return compare_values;
+}
+
+/**
+ * @brief Length of one answer bit of a bidirectional ESC in 1/16 ticks of a timer running without
+ *        prescaler. The answer has 5/4 of the bit rate of the frames.
+ * 
+ */
+constexpr auto GetDshotTelemetryBitTicksInSixteenths(const std::uint32_t timer_clock_in_hz, const types::DshotSpeed speed) noexcept -> std::uint32_t {
+  const auto divisor = static_cast<std::uint64_t>(GetDshotBitRate(speed)) * 5;
+  return static_cast<std::uint32_t>((static_cast<std::uint64_t>(timer_clock_in_hz) * 64 + divisor / 2) / divisor);
+}
+
+/**
+ * @brief Rebuilds the 21 answer bits from the captured times of the level changes.
+ *        The answer is NRZI coded: every 1 bit changes the level, starting with the falling
+ *        edge of the start bit, so each interval between edges is a 1 followed by zeros.
+ *        The interval after the last edge reaches up to the end of the answer.
+ * @param edges Counter values of both edges, the counter has to run through 16 bits
+ * @param edge_count Amount of captured edges
+ * @param bit_ticks_in_sixteenths See GetDshotTelemetryBitTicksInSixteenths()
+ * @param bits The 21 answer bits, MSB first
+ * @return True if the intervals add up to an answer
+ * 
+ */
+inline auto DecodeDshotTelemetryEdges(const std::uint32_t* edges, const std::uint8_t edge_count, const std::uint32_t bit_ticks_in_sixteenths, std::uint32_t& bits) noexcept -> bool {
+  // GCR has at most two zeros in a row, so no interval is longer than three bits
+  constexpr std::uint8_t LONGEST_INTERVAL = 3;
+  if (edges == nullptr || edge_count == 0 || bit_ticks_in_sixteenths == 0)
+    return false;
+
+  std::uint32_t value = 0;
+  std::uint8_t bit_count = 0;
+  for (std::uint8_t edge = 1; edge < edge_count && bit_count < DSHOT_TELEMETRY_BITS; edge++) {
+    const auto interval = (edges[edge] - edges[edge - 1]) & 0xFFFF;
+    const auto length = (interval * 16 + bit_ticks_in_sixteenths / 2) / bit_ticks_in_sixteenths;
+    if (length == 0 || length > LONGEST_INTERVAL)
+      return false;
+
+    value = (value << length) | (1u << (length - 1));
+    bit_count = static_cast<std::uint8_t>(bit_count + length);
+  }
+
+  if (bit_count > DSHOT_TELEMETRY_BITS || DSHOT_TELEMETRY_BITS - bit_count > LONGEST_INTERVAL)
+    return false;
+
+  const auto remaining = static_cast<std::uint8_t>(DSHOT_TELEMETRY_BITS - bit_count);
+  if (remaining > 0)
+    value = (value << remaining) | (1u << (remaining - 1));
+
+  bits = value;
+  return true;
+}
+
+/**
+ * @brief Nibbles of the 5 bit GCR symbols, indexed by the symbol. 0xFF marks symbols which are no GCR code.
+ * 
+ */
+static constexpr std::uint8_t DSHOT_GCR_NIBBLES[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9, 0xA, 0xB, 0xFF, 0xD, 0xE, 0xF,
+    0xFF, 0xFF, 0x2, 0x3, 0xFF, 0x5, 0x6, 0x7,
+    0xFF, 0x0, 0x8, 0x1, 0xFF, 0x4, 0xC, 0xFF};
+
+/**
+ * @brief Decodes the 20 GCR bits after the start bit into the 16 bit telemetry value
+ *        eeem mmmm mmmm cccc and checks its inverted CRC
+ * @param bits The 21 answer bits of DecodeDshotTelemetryEdges()
+ * @param telemetry The 12 bits of exponent and mantissa
+ * @return True if all symbols are GCR codes and the CRC matches
+ * 
+ */
+constexpr auto DecodeDshotTelemetryBits(const std::uint32_t bits, std::uint16_t& telemetry) noexcept -> bool {
+  std::uint16_t value = 0;
+  for (std::uint8_t symbol = 0; symbol < 4; symbol++) {
+    const auto nibble = DSHOT_GCR_NIBBLES[(bits >> (5 * (3 - symbol))) & 0x1F];
+    if (nibble > 0x0F)
+      return false;
+    value = static_cast<std::uint16_t>((value << 4) | nibble);
+  }
+
+  if (((value ^ (value >> 4) ^ (value >> 8) ^ (value >> 12)) & 0x0F) != 0x0F)
+    return false;
+
+  telemetry = static_cast<std::uint16_t>(value >> 4);
+  return true;
+}
+
+/**
+ * @brief Electrical revolutions per minute of a telemetry value, which holds the
+ *        electrical period in microseconds as 9 bit mantissa shifted by a 3 bit exponent
+ * @return 0 if the motor stands still or the period is empty
+ * 
+ */
+constexpr auto GetDshotErpm(const std::uint16_t telemetry) noexcept -> std::uint32_t {
+  const auto period_in_us = static_cast<std::uint32_t>(telemetry & 0x01FF) << (telemetry >> 9);
+  if (telemetry == DSHOT_TELEMETRY_MOTOR_STOPPED || period_in_us == 0)
+    return 0;
+  return 60000000u / period_in_us;
+}
+
+/**
+ * @brief Rotation frequency of the motor, e.g. as center of the notch filters of its noise
+ * @param pole_pairs Half the amount of magnet poles of the motor, 7 for the usual 12N14P motors
+ * 
+ */
+constexpr auto GetMotorFrequencyInHz(const std::uint32_t erpm, const std::uint8_t pole_pairs) noexcept -> float {
+  return static_cast<float>(erpm) / (60.0f * static_cast<float>(pole_pairs));
+}
+
+}  // namespace propulsion
+
+#endif
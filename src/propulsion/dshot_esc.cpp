@@ -0,0 +1,34 @@
+#include "dshot_esc.hpp"
+#include <cmath>
+
+namespace propulsion {
+
+auto DshotEsc::SetPulseDuration(float pulse_duration, int /* repetition_period */) noexcept -> const types::DriverStatus {
+  const bool throttle_limit_breach =
+      !(pulse_duration <= static_cast<float>(DSHOT_MAX_THROTTLE)) ||
+      !(pulse_duration >= static_cast<float>(DSHOT_MIN_THROTTLE));
+  if (throttle_limit_breach || channel_status_ != types::DriverStatus::OK) {
+    return types::DriverStatus::INPUT_ERROR;
+  }
+  return dshot_timer_->SetFrame(channel_, EncodeFrame(static_cast<std::uint16_t>(std::lround(pulse_duration)), false));
+}
+
+auto DshotEsc::SetCommand(std::uint16_t command, bool request_telemetry) noexcept -> types::DriverStatus {
+  if (command >= DSHOT_MIN_THROTTLE || channel_status_ != types::DriverStatus::OK) {
+    return types::DriverStatus::INPUT_ERROR;
+  }
+  return dshot_timer_->SetFrame(channel_, EncodeFrame(command, request_telemetry));
+}
+
+auto DshotEsc::GetErpm(std::uint32_t& erpm) const noexcept -> types::DriverStatus {
+  if (channel_status_ != types::DriverStatus::OK) {
+    return types::DriverStatus::INPUT_ERROR;
+  }
+  return dshot_timer_->GetErpm(channel_, erpm);
+}
+
+auto DshotEsc::EncodeFrame(std::uint16_t throttle, bool request_telemetry) const noexcept -> std::uint16_t {
+  return dshot_timer_->IsBidirectional() ? EncodeBidirectionalDshotFrame(throttle, request_telemetry) : EncodeDshotFrame(throttle, request_telemetry);
+}
+
+}  // namespace propulsion
@@ -0,0 +1,102 @@
+#ifndef SRC_PROPULSION_DSHOT_ESC_HPP_
+#define SRC_PROPULSION_DSHOT_ESC_HPP_
+
+#include <cstdint>
+#include <memory>
+#include "dshot_timer.hpp"
+#include "esc.hpp"
+
+namespace propulsion {
+
+/**
+ * @brief The concrete class implementation of the abstract Esc class for ESCs
+ * with the digital DShot protocol. The ESC needs no calibration, its frames are
+ * sent together with the other ESCs of the same timer.
+ * 
+ */
+class DshotEsc final : public Esc {
+ public:
+  /// @brief Default constructor is deleted, because implementation needs a DShot timer
+  DshotEsc() = delete;
+
+  /// @brief Destructor is set to default, because there is nothing out of the ordinary to do
+  ~DshotEsc() = default;
+
+  /**
+   * @brief Custom constructor, adds the channel to the DShot timer
+   * @param dshot_timer DShot timer shared with the other ESCs of the timer
+   * @param channel TIM_CHANNEL_1 to TIM_CHANNEL_4
+   * 
+   */
+  explicit DshotEsc(std::shared_ptr<DshotTimer> dshot_timer, std::uint32_t channel)
+      : Esc(dshot_timer->GetTimer(), channel), dshot_timer_(std::move(dshot_timer)), channel_status_(dshot_timer_->AddChannel(channel)) {}
+
+  /**
+   * @brief Custom constructor for a bidirectional ESC, adds the channel with eRPM telemetry to the DShot timer
+   * @param dshot_timer Bidirectional DShot timer shared with the other ESCs of the timer
+   * @param channel TIM_CHANNEL_1 to TIM_CHANNEL_4
+   * @param capture_dma DMA channel triggered by the capture of the channel
+   * 
+   */
+  explicit DshotEsc(std::shared_ptr<DshotTimer> dshot_timer, std::uint32_t channel, const DshotDmaConfig& capture_dma)
+      : Esc(dshot_timer->GetTimer(), channel), dshot_timer_(std::move(dshot_timer)), channel_status_(dshot_timer_->AddChannel(channel, capture_dma)) {}
+
+  /**
+   * @brief DShot has no pulse duration, the throttle value takes its place.
+   * @return Throttle value for full throttle
+   * 
+   */
+  auto GetMaxPulseDurationInMicroSeconds() const noexcept -> const int override {
+    return DSHOT_MAX_THROTTLE;
+  }
+
+  /**
+   * @brief DShot has no pulse duration, the throttle value takes its place.
+   * @return Throttle value for no throttle
+   * 
+   */
+  auto GetMinPulseDurationInMicroSeconds() const noexcept -> const int override {
+    return DSHOT_MIN_THROTTLE;
+  }
+
+  /**
+   * @brief Sets the throttle of the next frame. The frame is sent as soon as
+   *        all ESCs of the timer got their new throttle.
+   * @param pulse_duration The DShot throttle value (48 - 2047), rounded to the nearest step
+   * @param repetition_period Unused, the frames are sent at the rate of this call
+   * @return types::DriverStatus::OK if there is no error
+   *         types::DriverStatus::INPUT_ERROR if the throttle or the channel is invalid
+   *         types::DriverStatus::TIMEOUT if the previous frames are still being sent
+   *         types::DriverStatus::HAL_ERROR if timer config didn't work
+   * 
+   */
+  auto SetPulseDuration(float pulse_duration, int repetition_period) noexcept -> const types::DriverStatus override;
+
+  /**
+   * @brief Sends a special command instead of a throttle value, e.g. 0 to disarm
+   * @param command Command between 0 and 47
+   * @param request_telemetry Asks the ESC to answer on its telemetry wire
+   * @return See SetPulseDuration()
+   * 
+   */
+  auto SetCommand(std::uint16_t command, bool request_telemetry = false) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Reads the eRPM the ESC answered to its last frame
+   * @param erpm Electrical revolutions per minute, 0 if the motor stands still
+   * @return See DshotTimer::GetErpm()
+   * 
+   */
+  auto GetErpm(std::uint32_t& erpm) const noexcept -> types::DriverStatus;
+
+ private:
+  /// Bidirectional ESCs expect their frames with inverted CRC
+  auto EncodeFrame(std::uint16_t throttle, bool request_telemetry) const noexcept -> std::uint16_t;
+
+  std::shared_ptr<DshotTimer> dshot_timer_;
+  types::DriverStatus channel_status_;
+};
+
+}  // namespace propulsion
+
+#endif
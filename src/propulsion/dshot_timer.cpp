@@ -0,0 +1,224 @@
+#include "dshot_timer.hpp"
+#include "globals.hpp"
+
+namespace propulsion {
+
+constexpr std::uint8_t DshotTimer::CHANNELS_PER_BURST;
+constexpr std::uint32_t DshotTimer::CAPTURE_AUTO_RELOAD;
+
+namespace {
+
+/// The lower byte of CCMR1 holds all settings of channel 1, the other channels use the same layout
+constexpr std::uint32_t CHANNEL_MODE_MASK = 0xFF;
+constexpr std::uint32_t OUTPUT_MODE = TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE;
+constexpr std::uint32_t INPUT_MODE = TIM_CCMR1_CC1S_0;
+constexpr std::uint32_t CCER_BITS_PER_CHANNEL = 4;
+
+inline auto ToAddress(const volatile void* pointer) noexcept -> std::uint32_t {
+  return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(pointer));
+}
+
+}  // namespace
+
+DshotTimer::DshotTimer(TIM_HandleTypeDef* timer, const DshotDmaConfig& dma, types::DshotSpeed speed, bool bidirectional) noexcept
+    : timer_(timer),
+      dma_(dma),
+      bit_timing_(GetDshotBitTiming(TIMER_CLOCK, speed)),
+      telemetry_bit_ticks_in_sixteenths_(GetDshotTelemetryBitTicksInSixteenths(TIMER_CLOCK, speed)),
+      bidirectional_(bidirectional) {}
+
+auto DshotTimer::AddChannel(std::uint32_t channel) noexcept -> types::DriverStatus {
+  const auto index = GetChannelIndex(channel);
+  if (index >= CHANNELS_PER_BURST || timer_is_configured_)
+    return types::DriverStatus::INPUT_ERROR;
+
+  added_channels_ = static_cast<std::uint8_t>(added_channels_ | (1u << index));
+  return types::DriverStatus::OK;
+}
+
+auto DshotTimer::AddChannel(std::uint32_t channel, const DshotDmaConfig& capture_dma) noexcept -> types::DriverStatus {
+  if (!bidirectional_ || capture_dma.channel == nullptr || capture_dma.request_router == nullptr)
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto status = AddChannel(channel);
+  if (status != types::DriverStatus::OK)
+    return status;
+
+  const auto index = GetChannelIndex(channel);
+  capture_dma_[index] = capture_dma;
+  telemetry_channels_ = static_cast<std::uint8_t>(telemetry_channels_ | (1u << index));
+  return types::DriverStatus::OK;
+}
+
+auto DshotTimer::SetFrame(std::uint32_t channel, std::uint16_t frame) noexcept -> types::DriverStatus {
+  const auto index = GetChannelIndex(channel);
+  if (index >= CHANNELS_PER_BURST || (added_channels_ & (1u << index)) == 0)
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto compare_values = EncodeDshotBits(frame, bit_timing_);
+  for (std::uint8_t slot = 0; slot < DSHOT_BIT_SLOTS; slot++)
+    burst_buffer_[slot * CHANNELS_PER_BURST + index] = compare_values[slot];
+
+  updated_channels_ = static_cast<std::uint8_t>(updated_channels_ | (1u << index));
+  if (updated_channels_ != added_channels_)
+    return types::DriverStatus::OK;
+
+  updated_channels_ = 0;
+  return Transmit();
+}
+
+auto DshotTimer::Transmit(void) noexcept -> types::DriverStatus {
+  if (!timer_is_configured_) {
+    if (ConfigureTimer() != types::DriverStatus::OK)
+      return types::DriverStatus::HAL_ERROR;
+  }
+
+  auto* dma_channel = dma_.channel;
+  if ((dma_channel->CCR & DMA_CCR_EN) != 0 && dma_channel->CNDTR != 0)
+    return types::DriverStatus::TIMEOUT;
+
+  if (is_capturing_)
+    RestoreOutputs();
+
+  dma_channel->CCR &= ~DMA_CCR_EN;
+  dma_channel->CNDTR = static_cast<std::uint32_t>(burst_buffer_.size());
+  dma_channel->CMAR = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(burst_buffer_.data()));
+  dma_channel->CCR |= DMA_CCR_EN;
+  return types::DriverStatus::OK;
+}
+
+auto DshotTimer::ConfigureTimer(void) noexcept -> types::DriverStatus {
+  if (added_channels_ == 0)
+    return types::DriverStatus::INPUT_ERROR;
+
+  timer_->Init.Prescaler = 0;
+  timer_->Init.Period = bit_timing_.period_in_ticks - 1;
+  timer_->Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_PWM_Init(timer_) != HAL_OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  TIM_OC_InitTypeDef channel_configuration = {0};
+  channel_configuration.OCMode = TIM_OCMODE_PWM1;
+  channel_configuration.Pulse = 0;
+  channel_configuration.OCPolarity = bidirectional_ ? TIM_OCPOLARITY_LOW : TIM_OCPOLARITY_HIGH;
+  channel_configuration.OCFastMode = TIM_OCFAST_DISABLE;
+  const std::uint32_t channels[CHANNELS_PER_BURST] = {TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3, TIM_CHANNEL_4};
+  for (std::uint8_t index = 0; index < CHANNELS_PER_BURST; index++) {
+    if ((added_channels_ & (1u << index)) == 0)
+      continue;
+    if (HAL_TIM_PWM_ConfigChannel(timer_, &channel_configuration, channels[index]) != HAL_OK)
+      return types::DriverStatus::HAL_ERROR;
+    if (HAL_TIM_PWM_Start(timer_, channels[index]) != HAL_OK)
+      return types::DriverStatus::HAL_ERROR;
+  }
+
+  // Every update requests a burst of four words into CCR1 - CCR4 via DMAR
+  auto* dma_channel = dma_.channel;
+  dma_channel->CCR = DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1;
+  dma_channel->CPAR = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&timer_->Instance->DMAR));
+  dma_.request_router->CCR = dma_.request & DMAMUX_CxCR_DMAREQ_ID;
+  timer_->Instance->DCR = TIM_DMABASE_CCR1 | TIM_DMABURSTLENGTH_4TRANSFERS;
+  timer_->Instance->DIER |= TIM_DMA_UPDATE;
+
+  timer_is_configured_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto DshotTimer::StartTelemetryCapture(void) noexcept -> types::DriverStatus {
+  if (!bidirectional_ || !timer_is_configured_)
+    return types::DriverStatus::INPUT_ERROR;
+
+  auto* registers = timer_->Instance;
+  registers->CR1 &= ~TIM_CR1_CEN;
+  registers->DIER &= ~TIM_DIER_UDE;
+
+  for (std::uint8_t index = 0; index < CHANNELS_PER_BURST; index++) {
+    if ((telemetry_channels_ & (1u << index)) == 0)
+      continue;
+
+    const auto shift = index * CCER_BITS_PER_CHANNEL;
+    registers->CCER &= ~(TIM_CCER_CC1E << shift);
+    SetChannelMode(index, INPUT_MODE);
+    registers->CCER |= (TIM_CCER_CC1P | TIM_CCER_CC1NP | TIM_CCER_CC1E) << shift;
+
+    // Every edge copies the counter from the compare register into the edge buffer
+    const auto& dma = capture_dma_[index];
+    dma.channel->CCR = DMA_CCR_MINC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1;
+    dma.channel->CPAR = ToAddress(GetCompareRegister(registers, index));
+    dma.channel->CMAR = ToAddress(captured_edges_[index].data());
+    dma.channel->CNDTR = DSHOT_TELEMETRY_MAX_EDGES;
+    dma.request_router->CCR = dma.request & DMAMUX_CxCR_DMAREQ_ID;
+    dma.channel->CCR |= DMA_CCR_EN;
+    registers->DIER |= TIM_DIER_CC1DE << index;
+  }
+
+  // The answer takes longer than a bit period, so the counter must not wrap within it
+  registers->ARR = CAPTURE_AUTO_RELOAD;
+  registers->EGR = TIM_EGR_UG;
+  registers->CR1 |= TIM_CR1_CEN;
+  is_capturing_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto DshotTimer::GetErpm(std::uint32_t channel, std::uint32_t& erpm) const noexcept -> types::DriverStatus {
+  const auto index = GetChannelIndex(channel);
+  if (index >= CHANNELS_PER_BURST || (telemetry_channels_ & (1u << index)) == 0)
+    return types::DriverStatus::INPUT_ERROR;
+
+  const auto edge_count = static_cast<std::uint8_t>(DSHOT_TELEMETRY_MAX_EDGES - capture_dma_[index].channel->CNDTR);
+  if (!is_capturing_ || edge_count == 0)
+    return types::DriverStatus::TIMEOUT;
+
+  std::uint32_t bits = 0;
+  std::uint16_t telemetry = 0;
+  if (!DecodeDshotTelemetryEdges(captured_edges_[index].data(), edge_count, telemetry_bit_ticks_in_sixteenths_, bits) ||
+      !DecodeDshotTelemetryBits(bits, telemetry))
+    return types::DriverStatus::HAL_ERROR;
+
+  erpm = GetDshotErpm(telemetry);
+  return types::DriverStatus::OK;
+}
+
+auto DshotTimer::RestoreOutputs(void) noexcept -> void {
+  auto* registers = timer_->Instance;
+  registers->CR1 &= ~TIM_CR1_CEN;
+
+  for (std::uint8_t index = 0; index < CHANNELS_PER_BURST; index++) {
+    if ((telemetry_channels_ & (1u << index)) == 0)
+      continue;
+
+    const auto shift = index * CCER_BITS_PER_CHANNEL;
+    registers->DIER &= ~(TIM_DIER_CC1DE << index);
+    capture_dma_[index].channel->CCR &= ~DMA_CCR_EN;
+    registers->CCER &= ~((TIM_CCER_CC1P | TIM_CCER_CC1NP | TIM_CCER_CC1E) << shift);
+    SetChannelMode(index, OUTPUT_MODE);
+    *GetCompareRegister(registers, index) = 0;
+    registers->CCER |= (TIM_CCER_CC1P | TIM_CCER_CC1E) << shift;
+  }
+
+  // The update event loads the bit period and the idle compare values before the burst starts
+  registers->ARR = bit_timing_.period_in_ticks - 1;
+  registers->EGR = TIM_EGR_UG;
+  registers->DIER |= TIM_DIER_UDE;
+  registers->CR1 |= TIM_CR1_CEN;
+  is_capturing_ = false;
+}
+
+auto DshotTimer::SetChannelMode(std::uint8_t index, std::uint32_t mode) noexcept -> void {
+  auto& mode_register = index < 2 ? timer_->Instance->CCMR1 : timer_->Instance->CCMR2;
+  const auto shift = (index % 2) * 8u;
+  mode_register = (mode_register & ~(CHANNEL_MODE_MASK << shift)) | (mode << shift);
+}
+
+auto DshotTimer::GetCompareRegister(TIM_TypeDef* timer, std::uint8_t index) noexcept -> volatile std::uint32_t* {
+  volatile std::uint32_t* compare_registers[CHANNELS_PER_BURST] = {&timer->CCR1, &timer->CCR2, &timer->CCR3, &timer->CCR4};
+  return compare_registers[index];
+}
+
+auto DshotTimer::GetChannelIndex(std::uint32_t channel) noexcept -> std::uint8_t {
+  if (channel % TIM_CHANNEL_2 != 0)
+    return CHANNELS_PER_BURST;
+  return static_cast<std::uint8_t>(channel / TIM_CHANNEL_2);
+}
+
+}  // namespace propulsion
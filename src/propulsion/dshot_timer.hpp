@@ -0,0 +1,161 @@
+#ifndef SRC_PROPULSION_DSHOT_TIMER_HPP_
+#define SRC_PROPULSION_DSHOT_TIMER_HPP_
+
+#include <array>
+#include <cstdint>
+#include "dshot.hpp"
+#include "error_types.hpp"
+#include "propulsion_hardware_types.hpp"
+#include "stm32g4xx.h"
+
+namespace propulsion {
+
+/**
+ * @brief DMA channel which feeds the burst of one DShot timer. The DMA and DMAMUX clocks have
+ *        to be enabled by the MCU configuration, the channel is programmed by the DshotTimer.
+ * 
+ */
+struct DshotDmaConfig {
+  /// DMA channel to be used exclusively for the timer
+  DMA_Channel_TypeDef* channel;
+
+  /// DMAMUX channel belonging to the DMA channel
+  DMAMUX_Channel_TypeDef* request_router;
+
+  /// Request of the timer, e.g. DMA_REQUEST_TIM3_UP for the burst or DMA_REQUEST_TIM3_CH1 for a capture
+  std::uint32_t request;
+};
+
+/**
+ * @brief Sends the DShot frames of all ESCs on the channels 1 - 4 of one timer at once.
+ *        The frames are kept as compare values in one buffer, interleaved per bit slot.
+ *        Each update event of the timer bursts the four compare registers of the next slot
+ *        through the DMA register DMAR, so the CPU is only involved to start a frame.
+ *        Bidirectional timers send inverted frames. After the burst their telemetry channels
+ *        turn into inputs, whose edges are captured by one DMA channel each, until the next
+ *        transmission turns them back into outputs.
+ * 
+ */
+class DshotTimer {
+ public:
+  DshotTimer() = delete;
+  ~DshotTimer() = default;
+
+  /**
+   * @brief The custom constructor is the one to be used. The timer is configured at the first transmission.
+   * @param timer HAL timer handle, all its channels used by ESCs have to be DShot
+   * @param dma DMA channel triggered by the update of the timer
+   * @param speed Bit rate of the ESCs
+   * @param bidirectional All ESCs of the timer use bidirectional DShot
+   * 
+   */
+  DshotTimer(TIM_HandleTypeDef* timer, const DshotDmaConfig& dma, types::DshotSpeed speed, bool bidirectional = false) noexcept;
+
+  /**
+   * @brief Adds an ESC channel, all added channels are sent together
+   * @param channel TIM_CHANNEL_1 to TIM_CHANNEL_4
+   * @return types::DriverStatus::INPUT_ERROR for other channels or after the first transmission
+   * 
+   */
+  auto AddChannel(std::uint32_t channel) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Adds an ESC channel, whose eRPM telemetry is captured after every burst
+   * @param channel TIM_CHANNEL_1 to TIM_CHANNEL_4
+   * @param capture_dma DMA channel triggered by the capture of the channel, e.g. DMA_REQUEST_TIM3_CH1
+   * @return types::DriverStatus::INPUT_ERROR for other channels, a timer which is not bidirectional or after the first transmission
+   * 
+   */
+  auto AddChannel(std::uint32_t channel, const DshotDmaConfig& capture_dma) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Stores the frame of a channel. As soon as every added channel got a new frame,
+   *        all of them are transmitted.
+   * @return types::DriverStatus::OK if the frame is stored or sent,
+   *         types::DriverStatus::INPUT_ERROR if the channel was not added,
+   *         otherwise the result of Transmit()
+   * 
+   */
+  auto SetFrame(std::uint32_t channel, std::uint16_t frame) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Starts the burst of the stored frames
+   * @return types::DriverStatus::OK if the burst is started,
+   *         types::DriverStatus::TIMEOUT if the previous burst is still running,
+   *         types::DriverStatus::HAL_ERROR if the timer could not be configured
+   * 
+   */
+  auto Transmit(void) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Turns the telemetry channels into inputs capturing both edges. Has to be called from
+   *        the transfer complete interrupt of the burst DMA, the ESCs answer 30 us after their frame.
+   *        The counter runs through 16 bits while capturing, the next Transmit() restores the outputs.
+   * @return types::DriverStatus::INPUT_ERROR if the timer is not bidirectional or was never started
+   * 
+   */
+  auto StartTelemetryCapture(void) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Decodes the answer captured on a telemetry channel since the last burst
+   * @param channel TIM_CHANNEL_1 to TIM_CHANNEL_4
+   * @param erpm Electrical revolutions per minute, 0 if the motor stands still
+   * @return types::DriverStatus::OK if the answer is valid,
+   *         types::DriverStatus::INPUT_ERROR if the channel has no telemetry,
+   *         types::DriverStatus::TIMEOUT if there is no complete answer,
+   *         types::DriverStatus::HAL_ERROR if the answer is corrupted
+   * 
+   */
+  auto GetErpm(std::uint32_t channel, std::uint32_t& erpm) const noexcept -> types::DriverStatus;
+
+  auto IsBidirectional(void) const noexcept -> bool {
+    return bidirectional_;
+  }
+
+  auto GetTimer(void) const noexcept -> TIM_HandleTypeDef* {
+    return timer_;
+  }
+
+  auto GetBitTiming(void) const noexcept -> const DshotBitTiming& {
+    return bit_timing_;
+  }
+
+  /// Compare values of the burst, one word per channel 1 - 4 for each bit slot
+  auto GetBurstBuffer(void) const noexcept -> const std::array<std::uint32_t, DSHOT_BIT_SLOTS * 4>& {
+    return burst_buffer_;
+  }
+
+  /// Counter values written by the capture DMA of a channel, empty for channels without telemetry
+  auto GetCaptureBuffer(std::uint32_t channel) const noexcept -> const std::array<std::uint32_t, DSHOT_TELEMETRY_MAX_EDGES>& {
+    return captured_edges_[GetChannelIndex(channel) % CHANNELS_PER_BURST];
+  }
+
+ private:
+  static constexpr std::uint8_t CHANNELS_PER_BURST = 4;
+
+  static constexpr std::uint32_t CAPTURE_AUTO_RELOAD = 0xFFFF;
+
+  auto ConfigureTimer(void) noexcept -> types::DriverStatus;
+  auto RestoreOutputs(void) noexcept -> void;
+  auto SetChannelMode(std::uint8_t index, std::uint32_t mode) noexcept -> void;
+  static auto GetChannelIndex(std::uint32_t channel) noexcept -> std::uint8_t;
+  static auto GetCompareRegister(TIM_TypeDef* timer, std::uint8_t index) noexcept -> volatile std::uint32_t*;
+
+  TIM_HandleTypeDef* timer_;
+  DshotDmaConfig dma_;
+  DshotBitTiming bit_timing_;
+  std::uint32_t telemetry_bit_ticks_in_sixteenths_;
+  bool bidirectional_;
+  std::array<std::uint32_t, DSHOT_BIT_SLOTS * CHANNELS_PER_BURST> burst_buffer_{};
+  std::array<DshotDmaConfig, CHANNELS_PER_BURST> capture_dma_{};
+  std::array<std::array<std::uint32_t, DSHOT_TELEMETRY_MAX_EDGES>, CHANNELS_PER_BURST> captured_edges_{};
+  std::uint8_t added_channels_ = 0;
+  std::uint8_t telemetry_channels_ = 0;
+  std::uint8_t updated_channels_ = 0;
+  bool timer_is_configured_ = false;
+  bool is_capturing_ = false;
+};
+
+}  // namespace propulsion
+
+#endif
@@ -55,12 +55,12 @@ class Esc {
 
   /**
    * @brief Abstract method for setting the pulse duration based on the min and max values
-   * @param pulse_duration Desired Pulse duration in microseconds
+   * @param pulse_duration Desired Pulse duration in microseconds, fractions reach the timer with its tick resolution
    * @param repetition_period Desired time until pulse is repeated
    * @return A types::DriverStatus type confirmation whether it was working or not
    * 
    */
-  virtual auto SetPulseDuration(int pulse_duration, int repetition_period) noexcept -> const types::DriverStatus = 0;
+  virtual auto SetPulseDuration(float pulse_duration, int repetition_period) noexcept -> const types::DriverStatus = 0;
 
  protected:
   /**
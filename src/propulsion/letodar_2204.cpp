@@ -17,7 +17,7 @@ auto LeTodar2204::SetSpeedInPercent(const float speed) noexcept -> types::Driver
     auto min_pulse_duration = esc_->GetMinPulseDurationInMicroSeconds();
     auto one_percent_in_ms = (max_pulse_duration - min_pulse_duration) / PERCENTAGE_FACTOR;
     auto speed_in_ms_pulse_duration = min_pulse_duration + (speed * one_percent_in_ms);
-    auto set_pulse_error = esc_->SetPulseDuration(static_cast<int>(speed_in_ms_pulse_duration), REPETITION_TIME_IN_MS);
+    auto set_pulse_error = esc_->SetPulseDuration(static_cast<float>(speed_in_ms_pulse_duration), REPETITION_TIME_IN_MS);
     if (set_pulse_error != types::DriverStatus::OK) {
       return types::DriverStatus::HAL_ERROR;
     } else {
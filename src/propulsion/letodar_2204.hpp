@@ -24,6 +24,13 @@ class LeTodar2204 final : public Motor {
    */
   explicit LeTodar2204(std::unique_ptr<Esc> esc) : Motor(std::move(esc)), speed_(0.0) {}
 
+  /**
+   * @brief Custom ctor for a motor in static storage, see StaticMotorBuilder
+   * @param esc A concrete ESC, which has to outlive the motor
+   * 
+   */
+  explicit LeTodar2204(Esc& esc) : Motor(esc), speed_(0.0) {}
+
   /**
    * @brief Returns the last known speed in percent
    * 
@@ -2,16 +2,16 @@
 #define SRC_PROPULSION_LITTLE_BEE_20_A_HPP_
 
 #include "cstdint"
-#include "esc.hpp"
+#include "pulse_esc.hpp"
 #include "stm32g4xx.h"
 
 namespace propulsion {
 /**
  * @brief The concrete class implementation of the abstract Esc class for
- * the Little Bee 20 a hardware.
- * 
+ * the Little Bee 20 a hardware, which is driven by Oneshot125 (125us - 250us).
+ *
  */
-class LittleBee20A final : public Esc {
+class LittleBee20A final : public PulseEsc {
  public:
   /// @brief Default constructor is deleted, because implementation need timer
   LittleBee20A() = delete;
@@ -24,79 +24,16 @@ class LittleBee20A final : public Esc {
    * Raw pointer will be used in order to comply with C HAL
    * @param timer See ESC.hpp
    * @param channel See ESC.hpp
-   * 
+   *
    */
-  explicit LittleBee20A(TIM_HandleTypeDef* timer, std::uint32_t channel) : Esc(timer, channel), timer_is_configured_(false) {}
+  explicit LittleBee20A(TIM_HandleTypeDef* timer, std::uint32_t channel) : PulseEsc(timer, channel, Protocol()) {}
 
-  /**
-   * @brief Implementation of abstract method for getting max pulse duration.  
-   * Needs to be defined in header, because of type deduction.
-   * @return Oneshot 125 maximum pulse duration for full throttle
-   * 
-   */
-  auto GetMaxPulseDurationInMicroSeconds() const noexcept -> const int override {
-    return ONESHOT_125_MAX_PULSE_DURATION_IN_US_;
+  /// @brief Oneshot125, the protocol of this ESC
+  static constexpr auto Protocol(void) noexcept -> PulseProtocol {
+    return ONESHOT_125_PROTOCOL;
   }
-
-  /**
-   * @brief Implementation of abstract method for getting min pulse duration.  
-   * Needs to be defined in header, because of type deduction.
-   * @return Oneshot 125 minimum pulse duration for no throttle
-   * 
-   */
-  auto GetMinPulseDurationInMicroSeconds() const noexcept -> const int override {
-    return ONESHOT_125_MIN_PULSE_DURATION_IN_US_;
-  }
-
-  /**
-   * @brief Sets the new pulse duration for he next cycle.
-   * Can be calculated using min and max pulse duration of oneshot 125.
-   *        _____               _____
-   * 1     |     |             |     |
-   * 0 ____|     |_____________|     |______
-   *       ^-----^ pulse_duration
-   *       ^-------------------^ repetition_period
-   * @param pulse_duration The Oneshot125 pulse duration (125us - 250us)
-   * @param repetition_period Time between pulses in microseconds (pulse_duration - 20ms)
-   * @return types::DriverStatus::OK if there is no error
-   *         types::DriverStatus::INPUT_ERROR if new pulse duration didn't work
-   *         types::DriverStatus::HAL_ERROR if timer config didn't work
-   * 
-   */
-  auto SetPulseDuration(int pulse_duration, int repetition_period) noexcept -> const types::DriverStatus override;
-
- private:
-  static constexpr auto ONESHOT_125_MAX_PULSE_DURATION_IN_US_ = 250;
-  static constexpr auto ONESHOT_125_MIN_PULSE_DURATION_IN_US_ = 125;
-  static constexpr auto MAX_REPETITION_PERIOD_ = 20000;
-  static constexpr auto TARGET_TIMER_CLOCK_RATE_ = 10000000;
-  static constexpr auto MICROSECONDS_PER_SECOND_ = 1000000;
-  static constexpr auto TICKS_PER_MICROSECOND_ = TARGET_TIMER_CLOCK_RATE_ / MICROSECONDS_PER_SECOND_;
-
-  /**
-   * @brief Does the initial reconfiguration based on prescaler
-   * @return types::DriverStatus::OK if everything went fine
-   *         types::DriverStatus::HAL_ERROR if an error occured
-   * 
-   */
-  auto ConfigureTimer() noexcept -> const types::DriverStatus;
-
-  /**
-   * @brief Set Oneshot125 pulse and period
-   * The actual timer period and pulse length is calculated using MCU_CLOCK and its dividers.
-   * Timer clock sources are either APB1 or APB2.
-   * __HAL_TIM_CALC_PULSE helps with calculation
-   * @param period The actual period count for setting PWM period.
-   * @param pulse The actual pulse PWM pulse count number.
-   * @return types::DriverStatus::OK if everything went fine
-   *         types::DriverStatus::HAL_ERROR if an error occured
-   * 
-   */
-  auto SetPwm(std::uint32_t period, std::uint32_t pulse) const noexcept -> const types::DriverStatus;
-
-  bool timer_is_configured_;
 };
 
 }  // namespace propulsion
 
-#endif
\ No newline at end of file
+#endif
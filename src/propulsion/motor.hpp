@@ -34,11 +34,19 @@ class Motor {
    *            to the ESC base class
    * 
    */
-  explicit Motor(std::unique_ptr<Esc> esc) : esc_(std::move(esc)) {}
+  explicit Motor(std::unique_ptr<Esc> esc) : owned_esc_(std::move(esc)), esc_(owned_esc_.get()) {}
+
+  /**
+   * @brief Custom ctor for motors in static storage, which share
+   *        the lifetime of their ESC instead of owning it
+   * @param esc The concrete ESC, it has to outlive the motor
+   * 
+   */
+  explicit Motor(Esc& esc) : esc_(&esc) {}
 
   /**
    * @brief Default behavior of Motor dtor is sufficent, because
-   *        unique_ptr gets deleted if it goes out of scope
+   *        an owned ESC gets deleted if its unique_ptr goes out of scope
    * 
    */
   virtual ~Motor() = default;
@@ -60,8 +68,11 @@ class Motor {
   virtual auto SetSpeedInPercent(const float speed) noexcept -> types::DriverStatus = 0;
 
  protected:
+  /// Keeps the ESC alive if the motor owns it, empty otherwise
+  std::unique_ptr<Esc> owned_esc_;
+
   /// Holds the local reference to a concrete ESC object
-  std::unique_ptr<Esc> esc_;
+  Esc* esc_;
 };
 }  // namespace propulsion
 
@@ -1,15 +1,17 @@
 #include "motor_builder.hpp"
 
-#include <set>
-
+#include "motor_wiring.hpp"
 #include "stm32g4xx_hal_tim.h"
 
 #ifndef UNIT_TEST
 #include "letodar_2204.hpp"
 #include "little_bee_20_a.hpp"
+#include "multishot_esc.hpp"
+#include "oneshot_42_esc.hpp"
 #else
 #include "letodar_2204_mock.hpp"
 #include "little_bee_20_a_mock.hpp"
+#include "pulse_esc_mock.hpp"
 #endif
 namespace propulsion {
 
@@ -29,9 +31,7 @@ auto MotorBuilder::Create(propulsion::PropulsionHardwareConfig& motor_config) no
 }
 
 auto MotorBuilder::MotorConfigIsValid(propulsion::PropulsionHardwareConfig& motor_config) noexcept -> const bool {
-  const std::set<std::uint32_t> possible_channels{TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3, TIM_CHANNEL_4, TIM_CHANNEL_5, TIM_CHANNEL_6};
-  const bool channel_is_in_possible_channels = possible_channels.find(motor_config.channel) != possible_channels.end();
-  return (channel_is_in_possible_channels && motor_config.timer != nullptr);
+  return (IsMotorChannel(static_cast<std::uint32_t>(motor_config.channel)) && motor_config.timer != nullptr);
 }
 
 auto MotorBuilder::GetCorrectEsc(propulsion::PropulsionHardwareConfig& config) noexcept -> std::unique_ptr<Esc> {
@@ -40,6 +40,12 @@ auto MotorBuilder::GetCorrectEsc(propulsion::PropulsionHardwareConfig& config) n
     case types::EscType::LITTLE_BEE_20_A:
       esc = std::make_unique<LittleBee20A>(config.timer, config.channel);
       break;
+    case types::EscType::ONESHOT_42:
+      esc = std::make_unique<Oneshot42Esc>(config.timer, config.channel);
+      break;
+    case types::EscType::MULTISHOT:
+      esc = std::make_unique<MultishotEsc>(config.timer, config.channel);
+      break;
     default:
       break;
   }
@@ -0,0 +1,96 @@
+#include "motor_group_output.hpp"
+#include <cmath>
+#include "globals.hpp"
+
+namespace propulsion {
+
+constexpr std::uint8_t MotorGroupOutput::NUMBER_OF_MOTORS;
+
+MotorGroupOutput::MotorGroupOutput(const std::array<MotorOutputChannel, NUMBER_OF_MOTORS>& outputs, const PulseProtocol& protocol) noexcept
+    : outputs_(outputs), protocol_(protocol) {
+  for (const auto& output : outputs_) {
+    bool is_known = false;
+    for (std::uint8_t index = 0; index < number_of_timers_; index++)
+      is_known = is_known || timers_[index] == output.timer;
+    if (!is_known)
+      timers_[number_of_timers_++] = output.timer;
+  }
+}
+
+auto MotorGroupOutput::Init(int repetition_period) noexcept -> types::DriverStatus {
+  if (repetition_period < protocol_.max_pulse_duration_in_us || repetition_period > protocol_.max_repetition_period_in_us) {
+    return types::DriverStatus::INPUT_ERROR;
+  }
+  is_initialized_ = false;
+
+  const auto period = GetAutoReload(protocol_, repetition_period);
+  for (std::uint8_t index = 0; index < number_of_timers_; index++) {
+    if (ConfigureTimer(timers_[index], period) != types::DriverStatus::OK) {
+      return types::DriverStatus::HAL_ERROR;
+    }
+  }
+
+  TIM_OC_InitTypeDef channel_configuration = {0};
+  channel_configuration.OCMode = TIM_OCMODE_PWM1;
+  channel_configuration.Pulse = ThrottleToTicks(0.0f);
+  channel_configuration.OCPolarity = TIM_OCPOLARITY_HIGH;
+  channel_configuration.OCFastMode = TIM_OCFAST_DISABLE;
+  for (const auto& output : outputs_) {
+    if (HAL_TIM_PWM_ConfigChannel(output.timer, &channel_configuration, output.channel) != HAL_OK) {
+      return types::DriverStatus::HAL_ERROR;
+    }
+    if (HAL_TIM_PWM_Start(output.timer, output.channel) != HAL_OK) {
+      return types::DriverStatus::HAL_ERROR;
+    }
+  }
+
+  // Restarts all counters back to back, so the periods of the timers begin together
+  for (std::uint8_t index = 0; index < number_of_timers_; index++)
+    timers_[index]->Instance->EGR = TIM_EGR_UG;
+
+  is_initialized_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto MotorGroupOutput::SetThrottle(const std::array<float, NUMBER_OF_MOTORS>& throttle_in_percent) noexcept -> types::DriverStatus {
+  if (!is_initialized_) {
+    return types::DriverStatus::HAL_ERROR;
+  }
+  for (const auto throttle : throttle_in_percent) {
+    if (!(throttle >= 0.0f && throttle <= 100.0f)) {
+      return types::DriverStatus::INPUT_ERROR;
+    }
+  }
+
+  for (std::uint8_t index = 0; index < number_of_timers_; index++)
+    timers_[index]->Instance->CR1 |= TIM_CR1_UDIS;
+
+  for (std::uint8_t motor = 0; motor < NUMBER_OF_MOTORS; motor++)
+    __HAL_TIM_SET_COMPARE(outputs_[motor].timer, outputs_[motor].channel, ThrottleToTicks(throttle_in_percent[motor]));
+
+  for (std::uint8_t index = 0; index < number_of_timers_; index++)
+    timers_[index]->Instance->CR1 &= ~TIM_CR1_UDIS;
+
+  return types::DriverStatus::OK;
+}
+
+auto MotorGroupOutput::ConfigureTimer(TIM_HandleTypeDef* timer, std::uint32_t period) const noexcept -> types::DriverStatus {
+  if (HAL_TIM_PWM_Stop(timer, TIM_CHANNEL_ALL) != HAL_OK) {
+    return types::DriverStatus::HAL_ERROR;
+  }
+  timer->Init.Prescaler = __HAL_TIM_CALC_PSC(TIMER_CLOCK, protocol_.timer_clock_rate);
+  timer->Init.Period = period;
+  timer->Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_PWM_Init(timer) != HAL_OK) {
+    return types::DriverStatus::HAL_ERROR;
+  }
+  return types::DriverStatus::OK;
+}
+
+auto MotorGroupOutput::ThrottleToTicks(float throttle_in_percent) const noexcept -> std::uint32_t {
+  const auto pulse_range = static_cast<float>(protocol_.max_pulse_duration_in_us - protocol_.min_pulse_duration_in_us);
+  const auto pulse_duration = static_cast<float>(protocol_.min_pulse_duration_in_us) + throttle_in_percent / 100.0f * pulse_range;
+  return static_cast<std::uint32_t>(std::lround(pulse_duration * static_cast<float>(GetTicksPerMicroSecond(protocol_))));
+}
+
+}  // namespace propulsion
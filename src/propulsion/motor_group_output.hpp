@@ -0,0 +1,87 @@
+#ifndef SRC_PROPULSION_MOTOR_GROUP_OUTPUT_HPP_
+#define SRC_PROPULSION_MOTOR_GROUP_OUTPUT_HPP_
+
+#include <array>
+#include <cstdint>
+#include "error_types.hpp"
+#include "pulse_esc.hpp"
+#include "stm32g4xx.h"
+
+namespace propulsion {
+
+/**
+ * @brief Timer and channel driving one motor of a MotorGroupOutput
+ * 
+ */
+struct MotorOutputChannel {
+  /// A pointer to a HAL timer object, several motors may share one timer
+  TIM_HandleTypeDef* timer;
+
+  /// Channel as defined in HAL, TIM_CHANNEL_1 to TIM_CHANNEL_4
+  std::uint32_t channel;
+};
+
+/**
+ * @brief Output stage of the four pulse ESCs of the drone, which share one protocol. A throttle vector is committed
+ *        to all compare registers at once: update events are disabled (UDIS) while the
+ *        preloaded compare registers are written, so every timer takes over all of its new
+ *        pulses at the same update event and never a mix of old and new ones.
+ *        Motors on one timer change in the same period. The counters of different timers are
+ *        aligned at Init() up to the few cycles between their update generations, so their
+ *        periods start together as well.
+ * 
+ */
+class MotorGroupOutput {
+ public:
+  static constexpr std::uint8_t NUMBER_OF_MOTORS = 4;
+
+  /// Deleted default constructor, the output needs its timers
+  MotorGroupOutput() = delete;
+
+  /// The default destructor is sufficent
+  ~MotorGroupOutput() = default;
+
+  /**
+   * @brief Custom constructor with the outputs of the motors
+   * @param outputs Timer and channel of every motor
+   * @param protocol Protocol of the ESCs, e.g. LittleBee20A::Protocol()
+   * 
+   */
+  explicit MotorGroupOutput(const std::array<MotorOutputChannel, NUMBER_OF_MOTORS>& outputs, const PulseProtocol& protocol) noexcept;
+
+  /**
+   * @brief Configures and starts all timers with preloaded registers and zero throttle
+   * @param repetition_period Time between pulses in microseconds (max pulse duration - max repetition period of the protocol)
+   * @return types::DriverStatus::OK if there is no error
+   *         types::DriverStatus::INPUT_ERROR if the repetition period is out of range
+   *         types::DriverStatus::HAL_ERROR if timer config didn't work
+   * 
+   */
+  auto Init(int repetition_period) noexcept -> types::DriverStatus;
+
+  /**
+   * @brief Commits new throttles of all motors, they take effect together at the next update event
+   * @param throttle_in_percent Throttle of every motor between 0 and 100
+   * @return types::DriverStatus::OK if there is no error
+   *         types::DriverStatus::INPUT_ERROR if a throttle is out of range, nothing is changed then
+   *         types::DriverStatus::HAL_ERROR if the output is not initialized
+   * 
+   */
+  auto SetThrottle(const std::array<float, NUMBER_OF_MOTORS>& throttle_in_percent) noexcept -> types::DriverStatus;
+
+ private:
+  auto ConfigureTimer(TIM_HandleTypeDef* timer, std::uint32_t period) const noexcept -> types::DriverStatus;
+  auto ThrottleToTicks(float throttle_in_percent) const noexcept -> std::uint32_t;
+
+  std::array<MotorOutputChannel, NUMBER_OF_MOTORS> outputs_;
+  const PulseProtocol protocol_;
+
+  /// Every timer of the outputs once, in the order of their first motor
+  std::array<TIM_HandleTypeDef*, NUMBER_OF_MOTORS> timers_{};
+  std::uint8_t number_of_timers_ = 0;
+  bool is_initialized_ = false;
+};
+
+}  // namespace propulsion
+
+#endif
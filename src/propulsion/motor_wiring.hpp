@@ -0,0 +1,28 @@
+#ifndef SRC_PROPULSION_MOTOR_WIRING_HPP_
+#define SRC_PROPULSION_MOTOR_WIRING_HPP_
+
+#include <cstdint>
+#include "stm32g4xx.h"
+
+namespace propulsion {
+
+/**
+ * @brief Checks for a timer channel with a compare unit, TIM_CHANNEL_1 to TIM_CHANNEL_6
+ * 
+ */
+constexpr auto IsMotorChannel(const std::uint32_t channel) noexcept -> bool {
+  return channel <= TIM_CHANNEL_6 && channel % TIM_CHANNEL_2 == 0;
+}
+
+/**
+ * @brief Checks for a timer channel with an output pin, TIM_CHANNEL_1 to TIM_CHANNEL_4.
+ *        Channels 5 and 6 only compare internally, no ESC can be wired to them.
+ * 
+ */
+constexpr auto IsOutputChannel(const std::uint32_t channel) noexcept -> bool {
+  return channel <= TIM_CHANNEL_4 && channel % TIM_CHANNEL_2 == 0;
+}
+
+}  // namespace propulsion
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef SRC_PROPULSION_MULTISHOT_ESC_HPP_
+#define SRC_PROPULSION_MULTISHOT_ESC_HPP_
+
+#include "cstdint"
+#include "pulse_esc.hpp"
+#include "stm32g4xx.h"
+
+namespace propulsion {
+/**
+ * @brief Esc driven by Multishot (5us - 25us). The timer counts at 85 MHz, 8.5x finer than for Oneshot125.
+ *
+ */
+class MultishotEsc final : public PulseEsc {
+ public:
+  /// @brief Default constructor is deleted, because implementation need timer
+  MultishotEsc() = delete;
+
+  /// @brief Destructor is set to default, because there is nothing out of the ordinary to do
+  ~MultishotEsc() = default;
+
+  /**
+   * @brief Custom constructor with needed timer pointer
+   * Raw pointer will be used in order to comply with C HAL
+   * @param timer See ESC.hpp
+   * @param channel See ESC.hpp
+   *
+   */
+  explicit MultishotEsc(TIM_HandleTypeDef* timer, std::uint32_t channel) : PulseEsc(timer, channel, Protocol()) {}
+
+  /// @brief Multishot, the protocol of this ESC
+  static constexpr auto Protocol(void) noexcept -> PulseProtocol {
+    return MULTISHOT_PROTOCOL;
+  }
+};
+
+}  // namespace propulsion
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef SRC_PROPULSION_ONESHOT_42_ESC_HPP_
+#define SRC_PROPULSION_ONESHOT_42_ESC_HPP_
+
+#include "cstdint"
+#include "pulse_esc.hpp"
+#include "stm32g4xx.h"
+
+namespace propulsion {
+/**
+ * @brief Esc driven by Oneshot42 (42us - 84us). The timer counts at 85 MHz, 8.5x finer than for Oneshot125.
+ *
+ */
+class Oneshot42Esc final : public PulseEsc {
+ public:
+  /// @brief Default constructor is deleted, because implementation need timer
+  Oneshot42Esc() = delete;
+
+  /// @brief Destructor is set to default, because there is nothing out of the ordinary to do
+  ~Oneshot42Esc() = default;
+
+  /**
+   * @brief Custom constructor with needed timer pointer
+   * Raw pointer will be used in order to comply with C HAL
+   * @param timer See ESC.hpp
+   * @param channel See ESC.hpp
+   *
+   */
+  explicit Oneshot42Esc(TIM_HandleTypeDef* timer, std::uint32_t channel) : PulseEsc(timer, channel, Protocol()) {}
+
+  /// @brief Oneshot42, the protocol of this ESC
+  static constexpr auto Protocol(void) noexcept -> PulseProtocol {
+    return ONESHOT_42_PROTOCOL;
+  }
+};
+
+}  // namespace propulsion
+
+#endif
@@ -0,0 +1,104 @@
+#include "pulse_esc.hpp"
+#include <cmath>
+#include "globals.hpp"
+
+namespace propulsion {
+
+static_assert(TIMER_CLOCK % ONESHOT_125_PROTOCOL.timer_clock_rate == 0, "Oneshot125 ticks have to be a whole number of timer clocks");
+static_assert(TIMER_CLOCK % ONESHOT_42_PROTOCOL.timer_clock_rate == 0, "Oneshot42 ticks have to be a whole number of timer clocks");
+static_assert(TIMER_CLOCK % MULTISHOT_PROTOCOL.timer_clock_rate == 0, "Multishot ticks have to be a whole number of timer clocks");
+
+auto PulseEsc::SetPulseDuration(float pulse_duration, int repetition_period) noexcept -> const types::DriverStatus {
+  types::DriverStatus error_state;
+  const bool pulse_limit_breach =
+      !(pulse_duration <= static_cast<float>(protocol_.max_pulse_duration_in_us)) ||
+      !(pulse_duration >= static_cast<float>(protocol_.min_pulse_duration_in_us));
+  const bool period_limit_breach =
+      static_cast<float>(repetition_period) < pulse_duration ||
+      repetition_period > protocol_.max_repetition_period_in_us;
+  if (pulse_limit_breach || period_limit_breach) {
+    return types::DriverStatus::INPUT_ERROR;
+  } else {
+    if (!timer_is_configured_) {
+      auto configuration_error_state = ConfigureTimer();
+      if (configuration_error_state != types::DriverStatus::OK) {
+        return configuration_error_state;
+      }
+    }
+    const std::uint32_t pulse_duration_in_ticks =
+        static_cast<std::uint32_t>(std::lround(pulse_duration * static_cast<float>(GetTicksPerMicroSecond())));
+    const std::uint32_t period = GetAutoReload(protocol_, repetition_period);
+    if (pwm_is_running_) {
+      UpdatePwm(period, pulse_duration_in_ticks);
+      return types::DriverStatus::OK;
+    }
+    error_state = SetPwm(period, pulse_duration_in_ticks);
+    pwm_is_running_ = error_state == types::DriverStatus::OK;
+  }
+  return error_state;
+}
+
+auto PulseEsc::ConfigureTimer() noexcept -> const types::DriverStatus {
+  if (IsCounterRunning()) {
+    // The prescaler stays as the ESC running the counter set it, so it has to match this protocol
+    if (timer_->Instance->PSC != __HAL_TIM_CALC_PSC(TIMER_CLOCK, protocol_.timer_clock_rate)) {
+      return types::DriverStatus::INPUT_ERROR;
+    }
+    timer_is_configured_ = true;
+    return types::DriverStatus::OK;
+  }
+  if (HAL_TIM_PWM_Stop(timer_, channel_) != HAL_OK) {
+    return types::DriverStatus::HAL_ERROR;
+  }
+  timer_->Init.Prescaler = __HAL_TIM_CALC_PSC(TIMER_CLOCK, protocol_.timer_clock_rate);  //calculate timer input clock
+  timer_->Init.AutoReloadPreload = TIM_AUTORELOAD_PRELOAD_ENABLE;
+  if (HAL_TIM_PWM_Init(timer_) != HAL_OK) {
+    return types::DriverStatus::HAL_ERROR;
+  }
+  timer_is_configured_ = true;
+  return types::DriverStatus::OK;
+}
+
+auto PulseEsc::SetPwm(std::uint32_t period, std::uint32_t pulse) const noexcept -> const types::DriverStatus {
+  const bool counter_is_shared = IsCounterRunning();
+  if (!counter_is_shared) {
+    if (HAL_TIM_PWM_Stop(timer_, channel_) != HAL_OK) {
+      return types::DriverStatus::HAL_ERROR;
+    }
+    timer_->Init.Period = period;
+    if (HAL_TIM_PWM_Init(timer_) != HAL_OK) {
+      return types::DriverStatus::HAL_ERROR;
+    }
+  } else if (__HAL_TIM_GET_AUTORELOAD(timer_) != period) {
+    // Another period would change the pulses of the ESC running the counter
+    return types::DriverStatus::INPUT_ERROR;
+  }
+  TIM_OC_InitTypeDef new_timer_configuration = {0};
+  new_timer_configuration.OCMode = TIM_OCMODE_PWM1;
+  // On a running counter the channel starts without a pulse, otherwise it would start with the remainder of the period
+  new_timer_configuration.Pulse = counter_is_shared ? 0 : pulse;
+  new_timer_configuration.OCPolarity = TIM_OCPOLARITY_HIGH;
+  new_timer_configuration.OCFastMode = TIM_OCFAST_DISABLE;
+  if (HAL_TIM_PWM_ConfigChannel(timer_, &new_timer_configuration, channel_) != HAL_OK) {
+    return types::DriverStatus::HAL_ERROR;
+  }
+  if (HAL_TIM_PWM_Start(timer_, channel_) != HAL_OK) {
+    return types::DriverStatus::HAL_ERROR;
+  }
+  if (counter_is_shared) {
+    UpdatePwm(period, pulse);
+  }
+  return types::DriverStatus::OK;
+}
+
+auto PulseEsc::UpdatePwm(std::uint32_t period, std::uint32_t pulse) const noexcept -> void {
+  if (period != timer_->Init.Period) {
+    __HAL_TIM_SET_AUTORELOAD(timer_, period);
+  }
+  __HAL_TIM_SET_COMPARE(timer_, channel_, pulse);
+}
+
+auto PulseEsc::IsCounterRunning() const noexcept -> bool {
+  return (timer_->Instance->CR1 & TIM_CR1_CEN) != 0;
+}
+}  // namespace propulsion
@@ -0,0 +1,163 @@
+#ifndef SRC_PROPULSION_PULSE_ESC_HPP_
+#define SRC_PROPULSION_PULSE_ESC_HPP_
+
+#include "cstdint"
+#include "esc.hpp"
+#include "stm32g4xx.h"
+
+namespace propulsion {
+
+/**
+ * @brief Limits and timer resolution of a one pulse per period ESC protocol
+ *
+ */
+struct PulseProtocol {
+  /// Pulse duration for no throttle
+  int min_pulse_duration_in_us;
+  /// Pulse duration for full throttle
+  int max_pulse_duration_in_us;
+  /// Longest period the timer counter can hold at its clock rate
+  int max_repetition_period_in_us;
+  /// Counter clock of the timer, has to divide TIMER_CLOCK
+  int timer_clock_rate;
+};
+
+/// Oneshot125, 125us - 250us with 100ns ticks. 16 bit counters hold 6.5ms at most, the 32 bit ones more.
+static constexpr PulseProtocol ONESHOT_125_PROTOCOL{125, 250, 20000, 10000000};
+
+/// Oneshot42, 42us - 84us with 11.8ns ticks, so a 16 bit counter holds up to 771us
+static constexpr PulseProtocol ONESHOT_42_PROTOCOL{42, 84, 750, 85000000};
+
+/// Multishot, 5us - 25us with 11.8ns ticks, so a 16 bit counter holds up to 771us
+static constexpr PulseProtocol MULTISHOT_PROTOCOL{5, 25, 750, 85000000};
+
+/**
+ * @brief Timer ticks of one microsecond at the counter clock of a protocol
+ *
+ */
+constexpr auto GetTicksPerMicroSecond(const PulseProtocol& protocol) noexcept -> std::uint32_t {
+  return static_cast<std::uint32_t>(protocol.timer_clock_rate / 1000000);
+}
+
+/**
+ * @brief Auto reload value of a repetition period. The counter runs from zero up to and
+ *        including the auto reload value, so a period of n ticks needs n - 1.
+ *
+ */
+constexpr auto GetAutoReload(const PulseProtocol& protocol, int repetition_period_in_us) noexcept -> std::uint32_t {
+  return static_cast<std::uint32_t>(repetition_period_in_us) * GetTicksPerMicroSecond(protocol) - 1;
+}
+
+/**
+ * @brief Esc driven by one high pulse per period, whose duration sets the throttle.
+ *        The concrete ESCs only differ in the limits and timer resolution of their protocol.
+ *        _____               _____
+ * 1     |     |             |     |
+ * 0 ____|     |_____________|     |______
+ *       ^-----^ pulse_duration
+ *       ^-------------------^ repetition_period
+ *
+ */
+class PulseEsc : public Esc {
+ public:
+  /// @brief Default constructor is deleted, because implementation need timer
+  PulseEsc() = delete;
+
+  /// @brief Destructor is set to default, because there is nothing out of the ordinary to do
+  ~PulseEsc() = default;
+
+  auto GetMaxPulseDurationInMicroSeconds() const noexcept -> const int override {
+    return protocol_.max_pulse_duration_in_us;
+  }
+
+  auto GetMinPulseDurationInMicroSeconds() const noexcept -> const int override {
+    return protocol_.min_pulse_duration_in_us;
+  }
+
+  /**
+   * @brief Sets the new pulse duration for the next cycle.
+   * The first call configures and starts the timer with preloaded auto reload and compare
+   * registers. Every later call only writes these registers, the new values take effect at
+   * the next update event, so a running pulse is never cut.
+   * If another ESC already runs the counter of a shared timer, the first call only configures
+   * and starts the own channel, whose first pulse follows the next update event. It has to
+   * count at the same clock and period as that ESC.
+   * @param pulse_duration The pulse duration between min and max pulse duration of the protocol,
+   *        rounded to the nearest timer tick, e.g. 1/85 us for Multishot
+   * @param repetition_period Time between pulses in microseconds (pulse_duration - max repetition period)
+   * @return types::DriverStatus::OK if there is no error
+   *         types::DriverStatus::INPUT_ERROR if new pulse duration didn't work or another ESC
+   *         runs the timer at a different clock or period
+   *         types::DriverStatus::HAL_ERROR if timer config didn't work
+   *
+   */
+  auto SetPulseDuration(float pulse_duration, int repetition_period) noexcept -> const types::DriverStatus override;
+
+  /**
+   * @brief Timer ticks of one microsecond pulse duration
+   *
+   */
+  auto GetTicksPerMicroSecond() const noexcept -> std::uint32_t {
+    return propulsion::GetTicksPerMicroSecond(protocol_);
+  }
+
+ protected:
+  /**
+   * @brief Constructor for the concrete ESCs
+   * Raw pointer will be used in order to comply with C HAL
+   * @param timer See ESC.hpp
+   * @param channel See ESC.hpp
+   * @param protocol Limits of the pulses the ESC understands
+   *
+   */
+  explicit PulseEsc(TIM_HandleTypeDef* timer, std::uint32_t channel, const PulseProtocol& protocol)
+      : Esc(timer, channel), protocol_(protocol), timer_is_configured_(false), pwm_is_running_(false) {}
+
+ private:
+  /**
+   * @brief Does the initial reconfiguration based on prescaler, unless another ESC of the timer already did
+   * @return types::DriverStatus::OK if everything went fine
+   *         types::DriverStatus::INPUT_ERROR if the running timer counts at another clock
+   *         types::DriverStatus::HAL_ERROR if an error occured
+   *
+   */
+  auto ConfigureTimer() noexcept -> const types::DriverStatus;
+
+  /**
+   * @brief Set pulse and period
+   * The actual timer period and pulse length is calculated using MCU_CLOCK and its dividers.
+   * Timer clock sources are either APB1 or APB2.
+   * __HAL_TIM_CALC_PULSE helps with calculation
+   * @param period The auto reload value of the PWM period, see GetAutoReload()
+   * @param pulse The actual pulse PWM pulse count number.
+   * @return types::DriverStatus::OK if everything went fine
+   *         types::DriverStatus::INPUT_ERROR if the running timer has another period
+   *         types::DriverStatus::HAL_ERROR if an error occured
+   *
+   */
+  auto SetPwm(std::uint32_t period, std::uint32_t pulse) const noexcept -> const types::DriverStatus;
+
+  /**
+   * @brief Changes pulse and period of the running timer by writing the preloaded
+   *        registers, which the timer takes over at its next update event
+   * @param period The auto reload value of the PWM period, see GetAutoReload()
+   * @param pulse The actual pulse PWM pulse count number.
+   *
+   */
+  auto UpdatePwm(std::uint32_t period, std::uint32_t pulse) const noexcept -> void;
+
+  /**
+   * @brief Checks whether the counter of the timer runs, e.g. for another ESC on the same timer.
+   * Initializing the timer again would restart the counter in the middle of the pulses of that ESC.
+   *
+   */
+  auto IsCounterRunning() const noexcept -> bool;
+
+  const PulseProtocol protocol_;
+  bool timer_is_configured_;
+  bool pwm_is_running_;
+};
+
+}  // namespace propulsion
+
+#endif
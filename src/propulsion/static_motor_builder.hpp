@@ -0,0 +1,161 @@
+#ifndef SRC_PROPULSION_STATIC_MOTOR_BUILDER_HPP_
+#define SRC_PROPULSION_STATIC_MOTOR_BUILDER_HPP_
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include "letodar_2204.hpp"
+#include "little_bee_20_a.hpp"
+#include "motor_wiring.hpp"
+#include "multishot_esc.hpp"
+#include "oneshot_42_esc.hpp"
+#include "propulsion_hardware_types.hpp"
+#include "stm32g4xx.h"
+
+namespace propulsion {
+
+/**
+ * @brief Concrete ESC class of an EscType, specialized for every type the StaticMotorBuilder supports
+ *
+ */
+template <types::EscType ESC_TYPE>
+struct EscOf {
+  static_assert(ESC_TYPE != ESC_TYPE, "The ESC type is not supported by the StaticMotorBuilder");
+};
+
+template <>
+struct EscOf<types::EscType::LITTLE_BEE_20_A> {
+  using Type = LittleBee20A;
+};
+
+template <>
+struct EscOf<types::EscType::ONESHOT_42> {
+  using Type = Oneshot42Esc;
+};
+
+template <>
+struct EscOf<types::EscType::MULTISHOT> {
+  using Type = MultishotEsc;
+};
+
+/**
+ * @brief Concrete Motor class of a MotorType, specialized for every type the StaticMotorBuilder supports
+ *
+ */
+template <types::MotorType MOTOR_TYPE>
+struct MotorOf {
+  static_assert(MOTOR_TYPE != MOTOR_TYPE, "The motor type is not supported by the StaticMotorBuilder");
+};
+
+template <>
+struct MotorOf<types::MotorType::LETODAR_2204> {
+  using Type = LeTodar2204;
+};
+
+/**
+ * @brief The compile time counterpart of the PropulsionHardwareConfig. Every check the
+ *        MotorBuilder does at runtime is a static_assert here, so a wrong wiring fails the build.
+ *        The timer is the address of its HAL handle, e.g. StaticMotorConfig<..., &htim3, TIM_CHANNEL_1>
+ *
+ */
+template <types::MotorType MOTOR_TYPE, types::EscType ESC_TYPE, TIM_HandleTypeDef* TIMER, std::uint32_t CHANNEL>
+struct StaticMotorConfig {
+  static_assert(TIMER != nullptr, "A motor needs a timer");
+  static_assert(IsOutputChannel(CHANNEL), "ESCs can only be wired to TIM_CHANNEL_1 - TIM_CHANNEL_4");
+
+  using EscClass = typename EscOf<ESC_TYPE>::Type;
+  using MotorClass = typename MotorOf<MOTOR_TYPE>::Type;
+
+  static_assert(std::is_base_of<Esc, EscClass>::value, "The ESC type has to implement the Esc interface");
+  static_assert(std::is_base_of<Motor, MotorClass>::value, "The motor type has to implement the Motor interface");
+  static_assert(std::is_constructible<MotorClass, Esc&>::value, "The motor type needs a constructor for an ESC it does not own");
+
+  static constexpr TIM_HandleTypeDef* timer = TIMER;
+  static constexpr std::uint32_t channel = CHANNEL;
+};
+
+template <types::MotorType MOTOR_TYPE, types::EscType ESC_TYPE, TIM_HandleTypeDef* TIMER, std::uint32_t CHANNEL>
+constexpr TIM_HandleTypeDef* StaticMotorConfig<MOTOR_TYPE, ESC_TYPE, TIMER, CHANNEL>::timer;
+
+template <types::MotorType MOTOR_TYPE, types::EscType ESC_TYPE, TIM_HandleTypeDef* TIMER, std::uint32_t CHANNEL>
+constexpr std::uint32_t StaticMotorConfig<MOTOR_TYPE, ESC_TYPE, TIMER, CHANNEL>::channel;
+
+/**
+ * @brief Checks that no two motors are wired to the same channel of the same timer
+ *
+ */
+template <typename... CONFIGS>
+constexpr auto HaveDistinctOutputs() noexcept -> bool {
+  const TIM_HandleTypeDef* timers[] = {CONFIGS::timer...};
+  const std::uint32_t channels[] = {CONFIGS::channel...};
+  for (std::size_t first = 0; first < sizeof...(CONFIGS); first++)
+    for (std::size_t second = first + 1; second < sizeof...(CONFIGS); second++)
+      if (timers[first] == timers[second] && channels[first] == channels[second])
+        return false;
+  return true;
+}
+
+/**
+ * @brief Checks that all ESCs on one timer count at the same clock and share its period range.
+ *        The first ESC sets the prescaler of a timer, the others only add their channels,
+ *        so ESCs with different protocols on one timer would get wrong pulse durations.
+ *
+ */
+template <typename... CONFIGS>
+constexpr auto HaveOneProtocolPerTimer() noexcept -> bool {
+  const TIM_HandleTypeDef* timers[] = {CONFIGS::timer...};
+  const PulseProtocol protocols[] = {CONFIGS::EscClass::Protocol()...};
+  for (std::size_t first = 0; first < sizeof...(CONFIGS); first++)
+    for (std::size_t second = first + 1; second < sizeof...(CONFIGS); second++)
+      if (timers[first] == timers[second] &&
+          (protocols[first].timer_clock_rate != protocols[second].timer_clock_rate ||
+           protocols[first].max_repetition_period_in_us != protocols[second].max_repetition_period_in_us))
+        return false;
+  return true;
+}
+
+/**
+ * @brief Motor of a StaticMotorConfig and its ESC in static storage, constructed at the first call.
+ *        The storage belongs to the config, so every builder with the same config shares the motor.
+ *
+ */
+template <typename CONFIG>
+auto GetStaticMotor(void) noexcept -> Motor& {
+  static typename CONFIG::EscClass esc(CONFIG::timer, CONFIG::channel);
+  static typename CONFIG::MotorClass motor(esc);
+  return motor;
+}
+
+/**
+ * @brief Builds the motors of a StaticMotorConfig list without heap. Each motor and its ESC
+ *        live in static storage, constructed at the first Create(), which allocates nothing.
+ *        The MotorBuilder stays the runtime alternative, e.g. to inject mocks in tests.
+ *
+ * @tparam CONFIGS One StaticMotorConfig per motor
+ */
+template <typename... CONFIGS>
+class StaticMotorBuilder {
+ public:
+  static constexpr std::size_t MOTORS = sizeof...(CONFIGS);
+
+  static_assert(MOTORS > 0, "The StaticMotorBuilder needs at least one motor");
+  static_assert(HaveDistinctOutputs<CONFIGS...>(), "Two motors are wired to the same timer channel");
+  static_assert(HaveOneProtocolPerTimer<CONFIGS...>(), "ESCs with different protocols are wired to the same timer");
+
+  StaticMotorBuilder() = delete;
+
+  /**
+   * @brief Gives the motors in the order of their configs. Every call returns the same motors.
+   *
+   */
+  static auto Create(void) noexcept -> std::array<Motor*, MOTORS> {
+    return {{&GetStaticMotor<CONFIGS>()...}};
+  }
+};
+
+template <typename... CONFIGS>
+constexpr std::size_t StaticMotorBuilder<CONFIGS...>::MOTORS;
+
+}  // namespace propulsion
+
+#endif
@@ -0,0 +1,147 @@
+#ifndef SRC_PROPULSION_THRUST_LINEARIZATION_HPP_
+#define SRC_PROPULSION_THRUST_LINEARIZATION_HPP_
+
+#include <cstdint>
+#include "error_types.hpp"
+
+namespace propulsion {
+
+/**
+ * @brief Commands between 0 and 1 for SIZE thrusts equally spaced between 0 and 1
+ *
+ * @tparam SIZE Amount of table points, at least 2
+ */
+template <std::uint16_t SIZE>
+struct ThrustCurve {
+  static_assert(SIZE >= 2, "A thrust curve needs at least its two end points");
+
+  float command[SIZE];
+};
+
+namespace thrust_curve {
+
+/// Newton iteration for the table generation only, std::sqrt is no constexpr function
+constexpr auto SquareRoot(const double value) noexcept -> double {
+  double root = value > 1.0 ? value : 1.0;
+  for (std::uint8_t iteration = 0; iteration < 64; iteration++)
+    root = 0.5 * (root + value / root);
+  return root;
+}
+
+/**
+ * @brief Command which gives the thrust, for the thrust model
+ *        thrust = (1 - quadratic_share) * command + quadratic_share * command^2
+ */
+constexpr auto CommandForThrust(const double thrust, const double quadratic_share) noexcept -> double {
+  if (quadratic_share <= 0.0)
+    return thrust;
+
+  const auto linear_share = 1.0 - quadratic_share;
+  return (SquareRoot(linear_share * linear_share + 4.0 * quadratic_share * thrust) - linear_share) / (2.0 * quadratic_share);
+}
+
+}  // namespace thrust_curve
+
+/**
+ * @brief Generates the inverse of the thrust model at compile time, e.g.
+ *        static constexpr auto CURVE = MakeThrustCurve<65>(0.7f);
+ *
+ * @param quadratic_share Share of the quadratic term in the thrust of the motor and propeller between 0 and 1.
+ *                        0 is a linear thrust curve, 1 a purely quadratic one.
+ */
+template <std::uint16_t SIZE>
+constexpr auto MakeThrustCurve(const float quadratic_share) noexcept -> ThrustCurve<SIZE> {
+  ThrustCurve<SIZE> curve{};
+  for (std::uint16_t index = 0; index < SIZE; index++)
+    curve.command[index] = static_cast<float>(thrust_curve::CommandForThrust(static_cast<double>(index) / (SIZE - 1), quadratic_share));
+  return curve;
+}
+
+/**
+ * @brief Turns a throttle linear in thrust into the motor command, which is roughly
+ *        quadratic in thrust, so control gains act the same over the whole thrust range.
+ *        The command is interpolated linearly between the points of a ThrustCurve, which
+ *        costs one multiply add and no division.
+ *        Optionally the command is raised by nominal / battery voltage, because the motor speed
+ *        and with it the thrust of a command falls with the sagging battery voltage.
+ *
+ * @tparam SIZE Amount of points of the thrust curve
+ */
+template <std::uint16_t SIZE>
+class ThrustLinearization {
+ public:
+  ThrustLinearization() = delete;
+  ~ThrustLinearization() = default;
+
+  /**
+   * @brief Linearization without voltage compensation
+   *
+   * @param curve Table from MakeThrustCurve(), it has to outlive the linearization
+   */
+  explicit ThrustLinearization(const ThrustCurve<SIZE>& curve) noexcept : curve_(curve), nominal_voltage_(0.0f), voltage_compensation_(1.0f) {}
+
+  /**
+   * @brief Linearization with voltage compensation
+   *
+   * @param curve Table from MakeThrustCurve(), it has to outlive the linearization
+   * @param nominal_voltage Battery voltage the thrust curve was measured at
+   */
+  explicit ThrustLinearization(const ThrustCurve<SIZE>& curve, const float nominal_voltage) noexcept : curve_(curve), nominal_voltage_(nominal_voltage), voltage_compensation_(1.0f) {}
+
+  /// A temporary curve would be gone after the constructor, the linearization only references it
+  explicit ThrustLinearization(const ThrustCurve<SIZE>&& curve) = delete;
+
+  /// A temporary curve would be gone after the constructor, the linearization only references it
+  explicit ThrustLinearization(const ThrustCurve<SIZE>&& curve, const float nominal_voltage) = delete;
+
+  /**
+   * @brief Updates the voltage compensation
+   *
+   * @param battery_voltage Latest, ideally filtered, battery voltage
+   * @return types::DriverStatus INPUT_ERROR if there is no nominal voltage or the battery voltage is not positive
+   */
+  auto SetBatteryVoltage(const float battery_voltage) noexcept -> types::DriverStatus {
+    if (!(nominal_voltage_ > 0.0f) || !(battery_voltage > 0.0f))
+      return types::DriverStatus::INPUT_ERROR;
+
+    voltage_compensation_ = nominal_voltage_ / battery_voltage;
+    return types::DriverStatus::OK;
+  }
+
+  /**
+   * @brief Computes the command of one motor
+   *
+   * @param thrust_in_percent Demanded share of the full thrust at nominal voltage between 0 and 100
+   * @param command_in_percent Command for the ESC between 0 and 100, clipped at full throttle
+   * @return types::DriverStatus INPUT_ERROR if the thrust is out of range, the command is unchanged then
+   */
+  auto GetCommand(const float thrust_in_percent, float& command_in_percent) const noexcept -> types::DriverStatus {
+    if (!(thrust_in_percent >= 0.0f && thrust_in_percent <= 100.0f))
+      return types::DriverStatus::INPUT_ERROR;
+
+    const auto position = thrust_in_percent * POINTS_PER_PERCENT;
+    auto index = static_cast<std::uint16_t>(position);
+    if (index > SIZE - 2)
+      index = SIZE - 2;
+    const auto fraction = position - static_cast<float>(index);
+    const auto command = curve_.command[index] + fraction * (curve_.command[index + 1] - curve_.command[index]);
+
+    const auto compensated_command = command * voltage_compensation_;
+    command_in_percent = 100.0f * (compensated_command < 1.0f ? compensated_command : 1.0f);
+    return types::DriverStatus::OK;
+  }
+
+ private:
+  static constexpr float POINTS_PER_PERCENT = static_cast<float>(SIZE - 1) / 100.0f;
+
+  const ThrustCurve<SIZE>& curve_;
+  const float nominal_voltage_;
+  float voltage_compensation_;
+};
+
+template <std::uint16_t SIZE>
+constexpr float ThrustLinearization<SIZE>::POINTS_PER_PERCENT;
+
+}  // namespace propulsion
+
+#endif
@@ -0,0 +1,21 @@
+#include "cycle_counter_time_source.hpp"
+#include "globals.hpp"
+#include "stm32g4xx.h"
+
+namespace scheduler {
+
+CycleCounterTimeSource::CycleCounterTimeSource() noexcept {
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+auto CycleCounterTimeSource::GetTicks(void) const noexcept -> std::uint32_t {
+  return DWT->CYCCNT;
+}
+
+auto CycleCounterTimeSource::GetTicksPerMicroSecond(void) const noexcept -> std::uint32_t {
+  return MCU_CLOCK / 1000000;
+}
+
+}  // namespace scheduler
@@ -0,0 +1,23 @@
+#ifndef SRC_SCHEDULER_CYCLE_COUNTER_TIME_SOURCE_HPP_
+#define SRC_SCHEDULER_CYCLE_COUNTER_TIME_SOURCE_HPP_
+
+#include "time_source.hpp"
+
+namespace scheduler {
+
+/**
+ * @brief Counts core clock cycles with the DWT cycle counter of the Cortex-M4.
+ *        It wraps every 25 s at 170 MHz, far longer than any task may run.
+ *
+ */
+class CycleCounterTimeSource final : public TimeSource {
+ public:
+  CycleCounterTimeSource() noexcept;
+
+  auto GetTicks(void) const noexcept -> std::uint32_t override;
+  auto GetTicksPerMicroSecond(void) const noexcept -> std::uint32_t override;
+};
+
+}  // namespace scheduler
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef SRC_SCHEDULER_SCHEDULER_HPP_
+#define SRC_SCHEDULER_SCHEDULER_HPP_
+
+#include <array>
+#include <cstdint>
+#include "error_types.hpp"
+#include "streaming_statistics.hpp"
+#include "time_source.hpp"
+
+namespace scheduler {
+
+using TaskFunction = auto (*)(void* context) -> types::DriverStatus;
+
+/**
+ * @brief Entry of a static task table. A task runs every divider-th tick of the scheduler,
+ *        in the tick whose number modulo the divider equals its phase. Tasks of the same
+ *        divider form a rate group, different phases spread a slow group over several ticks.
+ *        Tasks of one tick run in the order of the table.
+ *
+ */
+struct Task {
+  const char* name;
+  TaskFunction function;
+  void* context;
+  std::uint16_t divider;
+  std::uint16_t phase;
+  /// Longest execution time the task may take, 0 if it has no budget
+  std::uint32_t budget_in_us;
+};
+
+constexpr auto IsValidTask(const Task& task) noexcept -> bool {
+  return task.function != nullptr && task.divider > 0 && task.phase < task.divider;
+}
+
+template <std::size_t TASKS>
+constexpr auto IsValidTaskTable(const std::array<Task, TASKS>& tasks) noexcept -> bool {
+  for (std::size_t index = 0; index < TASKS; index++)
+    if (!IsValidTask(tasks[index]))
+      return false;
+  return true;
+}
+
+/**
+ * @brief What the scheduler measured for one task, execution times in microseconds
+ *
+ */
+struct TaskStatistics {
+  std::uint32_t runs;
+  /// Runs that did not return DriverStatus::OK
+  std::uint32_t failures;
+  /// Runs that took longer than the budget of the task
+  std::uint32_t overruns;
+  float last_in_us;
+  float max_in_us;
+  float mean_in_us;
+};
+
+/**
+ * @brief Fixed rate cooperative scheduler. A timer interrupt calls OnTick() at the base rate,
+ *        the main loop calls RunPending(), which runs the tasks due in the oldest pending tick.
+ *        The interrupt only counts ticks and the main loop only counts handled ticks, so
+ *        neither has to lock the other out.
+ *        A tick overruns if its tasks did not finish before the next tick. If more than one
+ *        tick is pending, the older ones are skipped instead of running their tasks late.
+ *
+ * @tparam TASKS Length of the static task table
+ */
+template <std::size_t TASKS>
+class Scheduler {
+ public:
+  /**
+   * @param tasks Task table, it has to outlive the scheduler
+   * @param time_source Counter for the execution times
+   * @param tick_period_in_us Period of the timer interrupt, the load refers to it
+   */
+  Scheduler(const std::array<Task, TASKS>& tasks, const TimeSource& time_source, const std::uint32_t tick_period_in_us) noexcept
+      : tasks_(tasks),
+        time_source_(time_source),
+        tick_period_in_ticks_(tick_period_in_us * time_source.GetTicksPerMicroSecond()),
+        table_is_valid_(IsValidTaskTable(tasks)) {}
+
+  /// Called by the timer interrupt of the base rate
+  auto OnTick(void) noexcept -> void {
+    tick_count_ = tick_count_ + 1;
+  }
+
+  auto HasPendingTick(void) const noexcept -> bool {
+    return tick_count_ != handled_ticks_;
+  }
+
+  /**
+   * @brief Runs the tasks of the pending tick, returns at once if there is none
+   * @return INPUT_ERROR if the task table is invalid, TIMEOUT if the tick overran, else OK
+   */
+  auto RunPending(void) noexcept -> types::DriverStatus {
+    if (!table_is_valid_)
+      return types::DriverStatus::INPUT_ERROR;
+
+    const std::uint32_t pending_ticks = tick_count_ - handled_ticks_;
+    if (pending_ticks == 0)
+      return types::DriverStatus::OK;
+    if (pending_ticks > 1) {
+      skipped_ticks_ += pending_ticks - 1;
+      handled_ticks_ += pending_ticks - 1;
+    }
+
+    const auto tick = handled_ticks_;
+    const auto start = time_source_.GetTicks();
+    for (std::size_t index = 0; index < TASKS; index++)
+      if (tick % tasks_[index].divider == tasks_[index].phase)
+        RunTask(index);
+    busy_ticks_ += time_source_.GetTicks() - start;
+    handled_ticks_++;
+
+    if (HasPendingTick()) {
+      tick_overruns_++;
+      return types::DriverStatus::TIMEOUT;
+    }
+    return types::DriverStatus::OK;
+  }
+
+  auto GetTaskStatistics(const std::size_t index) const noexcept -> TaskStatistics {
+    const auto& record = records_[index];
+    return TaskStatistics{record.runs, record.failures, record.overruns, record.last_in_us, record.max_in_us, record.execution_time.GetMean()};
+  }
+
+  /// Ticks whose tasks did not finish before the next tick
+  auto GetTickOverruns(void) const noexcept -> std::uint32_t {
+    return tick_overruns_;
+  }
+
+  /// Ticks that were not run at all because an overrun lasted longer than one tick
+  auto GetSkippedTicks(void) const noexcept -> std::uint32_t {
+    return skipped_ticks_;
+  }
+
+  /// Share of the handled ticks spent in tasks, the rest is idle time
+  auto GetLoadInPercent(void) const noexcept -> float {
+    if (handled_ticks_ == 0)
+      return 0.0f;
+    return 100.0f * static_cast<float>(busy_ticks_) / (static_cast<float>(handled_ticks_) * static_cast<float>(tick_period_in_ticks_));
+  }
+
+ private:
+  struct TaskRecord {
+    std::uint32_t runs = 0;
+    std::uint32_t failures = 0;
+    std::uint32_t overruns = 0;
+    float last_in_us = 0.0f;
+    float max_in_us = 0.0f;
+    utilities::StreamingStatistics execution_time;
+  };
+
+  auto RunTask(const std::size_t index) noexcept -> void {
+    const auto& task = tasks_[index];
+    auto& record = records_[index];
+
+    const auto start = time_source_.GetTicks();
+    const auto status = task.function(task.context);
+    const auto execution_time_in_ticks = time_source_.GetTicks() - start;
+
+    record.runs++;
+    if (status != types::DriverStatus::OK)
+      record.failures++;
+    if (task.budget_in_us != 0 && execution_time_in_ticks > task.budget_in_us * time_source_.GetTicksPerMicroSecond())
+      record.overruns++;
+    record.last_in_us = static_cast<float>(execution_time_in_ticks) / static_cast<float>(time_source_.GetTicksPerMicroSecond());
+    if (record.last_in_us > record.max_in_us)
+      record.max_in_us = record.last_in_us;
+    record.execution_time.Add(record.last_in_us);
+  }
+
+  const std::array<Task, TASKS>& tasks_;
+  const TimeSource& time_source_;
+  const std::uint32_t tick_period_in_ticks_;
+  const bool table_is_valid_;
+  std::array<TaskRecord, TASKS> records_{};
+  volatile std::uint32_t tick_count_ = 0;
+  std::uint32_t handled_ticks_ = 0;
+  std::uint32_t tick_overruns_ = 0;
+  std::uint32_t skipped_ticks_ = 0;
+  std::uint64_t busy_ticks_ = 0;
+};
+
+}  // namespace scheduler
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SRC_SCHEDULER_TIME_SOURCE_HPP_
+#define SRC_SCHEDULER_TIME_SOURCE_HPP_
+
+#include <cstdint>
+
+namespace scheduler {
+
+/**
+ * @brief Free running counter the scheduler measures execution times with.
+ *        The counter wraps at 32 bits, durations are differences of two readings.
+ *
+ */
+class TimeSource {
+ public:
+  virtual ~TimeSource() = default;
+
+  virtual auto GetTicks(void) const noexcept -> std::uint32_t = 0;
+  virtual auto GetTicksPerMicroSecond(void) const noexcept -> std::uint32_t = 0;
+};
+
+}  // namespace scheduler
+
+#endif
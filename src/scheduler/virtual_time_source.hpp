@@ -0,0 +1,85 @@
+#ifndef SRC_SCHEDULER_VIRTUAL_TIME_SOURCE_HPP_
+#define SRC_SCHEDULER_VIRTUAL_TIME_SOURCE_HPP_
+
+#include <cstdint>
+#include "error_types.hpp"
+#include "time_source.hpp"
+
+namespace scheduler {
+
+/**
+ * @brief Time source for host builds, its time only passes when it is advanced.
+ *        It also stands in for the tick timer: the attached interrupt fires at every
+ *        multiple of its period the time passes, in the middle of a task that advances
+ *        the time like the hardware interrupt would. One tick is one microsecond.
+ *
+ */
+class VirtualTimeSource final : public TimeSource {
+ public:
+  using Interrupt = auto (*)(void* context) -> void;
+
+  explicit VirtualTimeSource(const std::uint32_t interrupt_period_in_us) noexcept
+      : interrupt_period_in_us_(interrupt_period_in_us) {}
+
+  auto AttachInterrupt(const Interrupt interrupt, void* context) noexcept -> void {
+    interrupt_ = interrupt;
+    interrupt_context_ = context;
+  }
+
+  /// Lets the time pass, e.g. as the execution time of a task
+  auto Advance(const std::uint64_t microseconds) noexcept -> void {
+    const auto end = now_in_us_ + microseconds;
+    while (GetNextInterruptInUs() <= end) {
+      now_in_us_ = GetNextInterruptInUs();
+      if (interrupt_ != nullptr)
+        interrupt_(interrupt_context_);
+    }
+    now_in_us_ = end;
+  }
+
+  auto GetNextInterruptInUs(void) const noexcept -> std::uint64_t {
+    return (now_in_us_ / interrupt_period_in_us_ + 1) * interrupt_period_in_us_;
+  }
+
+  auto GetTimeInUs(void) const noexcept -> std::uint64_t {
+    return now_in_us_;
+  }
+
+  auto GetTicks(void) const noexcept -> std::uint32_t override {
+    return static_cast<std::uint32_t>(now_in_us_);
+  }
+
+  auto GetTicksPerMicroSecond(void) const noexcept -> std::uint32_t override {
+    return 1;
+  }
+
+ private:
+  const std::uint32_t interrupt_period_in_us_;
+  std::uint64_t now_in_us_ = 0;
+  Interrupt interrupt_ = nullptr;
+  void* interrupt_context_ = nullptr;
+};
+
+/**
+ * @brief The main loop of the target in virtual time: runs the pending ticks and idles
+ *        until the next interrupt when there is none. Returns once the time reached the
+ *        end and no tick is pending, or at once on an invalid task table.
+ *
+ */
+template <typename SCHEDULER>
+auto RunInVirtualTime(SCHEDULER& scheduler, VirtualTimeSource& time_source, const std::uint64_t end_in_us) noexcept -> void {
+  while (true) {
+    if (scheduler.RunPending() == types::DriverStatus::INPUT_ERROR)
+      return;
+    if (scheduler.HasPendingTick())
+      continue;
+    if (time_source.GetTimeInUs() >= end_in_us)
+      return;
+    const auto next_interrupt = time_source.GetNextInterruptInUs();
+    time_source.Advance((next_interrupt < end_in_us ? next_interrupt : end_in_us) - time_source.GetTimeInUs());
+  }
+}
+
+}  // namespace scheduler
+
+#endif
@@ -1,6 +1,8 @@
 #include "spi.hpp"
 
 namespace spi {
+constexpr std::array<std::uint32_t, 8> SPI::BAUD_RATE_PRESCALERS;
+
 auto SPI::Write(std::vector<std::uint8_t> &mosi_data_buffer) noexcept -> types::DriverStatus {
   HAL_StatusTypeDef transmit_ret_value = HAL_ERROR;
 
@@ -48,6 +50,25 @@ auto SPI::Transfer(std::vector<std::uint8_t> &mosi_data_buffer, std::vector<std:
   return CheckHALReturnValue(transmit_receive_ret_value);
 }
 
+auto SPI::SetClock(std::uint32_t clock_in_hz) noexcept -> types::DriverStatus {
+  // SPI1 is clocked by APB2, the prescalers divide it by 2 to 256
+  std::uint32_t spi_clock_in_hz = HAL_RCC_GetPCLK2Freq() / 2;
+
+  for (const auto baud_rate_prescaler : BAUD_RATE_PRESCALERS) {
+    if (spi_clock_in_hz <= clock_in_hz) {
+      if (hspi1.Init.BaudRatePrescaler == baud_rate_prescaler) {
+        return types::DriverStatus::OK;
+      }
+
+      hspi1.Init.BaudRatePrescaler = baud_rate_prescaler;
+      return CheckHALReturnValue(HAL_SPI_Init(&hspi1));
+    }
+    spi_clock_in_hz /= 2;
+  }
+
+  return types::DriverStatus::INPUT_ERROR;
+}
+
 auto SPI::IsTransactionLengthExceedingLimits(std::uint8_t transaction_length) noexcept -> bool {
   return transaction_length > types::SPI_TRANSACTION_LENGTH_LIMIT;
 }
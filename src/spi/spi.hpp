@@ -19,7 +19,7 @@ namespace spi {
  * @brief Concrete implementation of the SPI interface.
  * 
  */
-class SPI final : spi::SPIInterface {
+class SPI final : public spi::SPIInterface {
  public:
   SPI() = delete;
   explicit SPI(CSPin &chip_select) : spi::SPIInterface(), chip_select_(chip_select){};
@@ -27,6 +27,7 @@ class SPI final : spi::SPIInterface {
 
   auto Write(std::vector<std::uint8_t> &mosi_data_buffer) noexcept -> types::DriverStatus override;
   auto Transfer(std::vector<std::uint8_t> &mosi_data_buffer, std::vector<std::uint8_t> &miso_data_buffer) noexcept -> types::DriverStatus override;
+  auto SetClock(std::uint32_t clock_in_hz) noexcept -> types::DriverStatus override;
 
  private:
   CSPin &chip_select_;
@@ -34,6 +35,12 @@ class SPI final : spi::SPIInterface {
   auto IsTransactionLengthExceedingLimits(std::uint8_t transaction_length) noexcept -> bool;
   auto IsMisoBufferTooSmall(std::vector<std::uint8_t> &mosi_buffer, std::vector<std::uint8_t> &miso_buffer) noexcept -> bool;
   auto CheckHALReturnValue(HAL_StatusTypeDef hal_return_value) -> types::DriverStatus;
+
+  /// Baud rate prescalers of the SPI peripheral, from the highest to the lowest SPI clock
+  static constexpr std::array<std::uint32_t, 8> BAUD_RATE_PRESCALERS{SPI_BAUDRATEPRESCALER_2, SPI_BAUDRATEPRESCALER_4,
+                                                                     SPI_BAUDRATEPRESCALER_8, SPI_BAUDRATEPRESCALER_16,
+                                                                     SPI_BAUDRATEPRESCALER_32, SPI_BAUDRATEPRESCALER_64,
+                                                                     SPI_BAUDRATEPRESCALER_128, SPI_BAUDRATEPRESCALER_256};
 };
 
 }  // namespace spi
@@ -48,6 +48,17 @@ class SPIInterface {
    * -TIMEOUT - HAL function returns timeout.
    */
   virtual auto Transfer(std::vector<std::uint8_t> &mosi_data_buffer, std::vector<std::uint8_t> &miso_data_buffer) noexcept -> types::DriverStatus = 0;
+
+  /**
+   * @brief Set the SPI clock for the following transactions. The highest clock which does not exceed clock_in_hz is used.
+   * 
+   * @param clock_in_hz Maximum SPI clock the slave allows for the following transactions.
+   * @return types::DriverStatus Status information about the success of the clock change. Possible values: 
+   * -OK - The SPI clock is at most clock_in_hz.
+   * -HAL_ERROR - HAL function returned an error status
+   * -INPUT_ERROR - clock_in_hz is below the slowest SPI clock
+   */
+  virtual auto SetClock(std::uint32_t clock_in_hz) noexcept -> types::DriverStatus = 0;
 };
 }  // namespace spi
 
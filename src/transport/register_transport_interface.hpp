@@ -0,0 +1,89 @@
+#ifndef SRC_TRANSPORT_REGISTER_TRANSPORT_INTERFACE_HPP_
+#define SRC_TRANSPORT_REGISTER_TRANSPORT_INTERFACE_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include "error_types.hpp"
+
+namespace transport {
+
+/**
+ * @brief Bus independent access to the registers of a peripheral device.
+ *        Drivers for register based devices (e.g. the IMU) only depend on this interface,
+ *        so the same driver runs on I2C as well as on SPI.
+ * 
+ */
+class RegisterTransportInterface {
+ public:
+  virtual ~RegisterTransportInterface() = default;
+  explicit RegisterTransportInterface(void){};
+
+  /**
+   * @brief Reads content from given register of a device
+   * 
+   * @param address The address of the device. On busses without addressing it selects the device behind the transport.
+   * @param register_ The register to read the content from
+   * @param byte_size Amount of Bytes to read
+   * @param timeout Timeout in milliseconds, if supported by the bus
+   * @return std::pair<#types::DriverStatus, std::vector<uint8_t>> Status of the transport and Data read as std::vector. Each element is a Byte read.
+   */
+  virtual auto ReadContentFromRegister(std::uint8_t address, std::uint8_t register_, std::uint16_t byte_size, std::uint32_t timeout = STANDARD_TIMEOUT_IN_MS) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> = 0;
+
+  /**
+   * @brief Reads content from given register of a device into a buffer of the caller.
+   *        The default implementation copies the result of ReadContentFromRegister,
+   *        transports override it to read without heap allocation.
+   * 
+   * @param address The address of the device. On busses without addressing it selects the device behind the transport.
+   * @param register_ The register to read the content from
+   * @param buffer Buffer with space for at least byte_size Bytes, only valid if OK is returned
+   * @param byte_size Amount of Bytes to read
+   * @param timeout Timeout in milliseconds, if supported by the bus
+   * @return #types::DriverStatus Status of the transport
+   */
+  virtual auto ReadContentFromRegisterIntoBuffer(std::uint8_t address, std::uint8_t register_, std::uint8_t* buffer, std::uint16_t byte_size, std::uint32_t timeout = STANDARD_TIMEOUT_IN_MS) noexcept -> types::DriverStatus {
+    types::DriverStatus transport_status;
+    std::vector<std::uint8_t> content_of_register;
+
+    std::tie(transport_status, content_of_register) = ReadContentFromRegister(address, register_, byte_size, timeout);
+    if (transport_status != types::DriverStatus::OK)
+      return transport_status;
+
+    if (content_of_register.size() != byte_size)
+      return types::DriverStatus::HAL_ERROR;
+
+    std::copy(content_of_register.begin(), content_of_register.end(), buffer);
+    return types::DriverStatus::OK;
+  }
+
+  /**
+   * @brief Writes data to a device. The first Byte is the register to write into, the following Bytes are its new content.
+   * 
+   * @param address The address of the device. On busses without addressing it selects the device behind the transport.
+   * @param data Register followed by the data to write. std::vector with each element is one Byte.
+   * @param timeout Timeout in milliseconds, if supported by the bus
+   * @return #types::DriverStatus Status of the transport
+   */
+  virtual auto Write(std::uint8_t address, const std::vector<std::uint8_t>& data, std::uint32_t timeout = STANDARD_TIMEOUT_IN_MS) noexcept -> types::DriverStatus = 0;
+
+  /**
+   * @brief Whether the host reaches the devices behind the peripheral on this bus, e.g. the AK8963
+   *        behind the MPU9255 in bypass mode. On I2C it shares the bus, so this is true by default.
+   * 
+   * @return true if the bypassed devices are on the bus of the transport
+   */
+  virtual auto ReachesBypassedDevices(void) const noexcept -> bool {
+    return true;
+  }
+
+ protected:
+  /// @brief Standard timeout of a register transport in milliseconds
+  static constexpr int STANDARD_TIMEOUT_IN_MS = 200;
+};
+
+}  // namespace transport
+
+#endif
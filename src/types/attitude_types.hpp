@@ -0,0 +1,76 @@
+#ifndef SRC_TYPES_ATTITUDE_TYPES_HPP_
+#define SRC_TYPES_ATTITUDE_TYPES_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include "basic_types.hpp"
+
+namespace types {
+
+/**
+ * @brief A quaternion w + xi + yj + zk, meant to be used as unit quaternion for the rotation
+ *        from the body frame of the drone into the earth frame
+ * @tparam ElementType The underlying datatype of each of the four elements.
+ *                     Underlying type needs to be arithmetic and signed.
+ * 
+ */
+template <typename ElementType>
+struct Quaternion {
+  static_assert(std::is_arithmetic<ElementType>::value, "Type is not arithmetic");
+  static_assert(std::is_signed<ElementType>::value, "Unsigned type can't be used");
+
+  /// Real part
+  ElementType w;
+
+  /// Imaginary part along the X axis
+  ElementType x;
+
+  /// Imaginary part along the Y axis
+  ElementType y;
+
+  /// Imaginary part along the Z axis
+  ElementType z;
+};
+
+/**
+ * @brief Attitude as Euler angles in radians, applied in the order yaw, pitch, roll (Z-Y-X)
+ * 
+ */
+struct EulerAngles {
+  /// Rotation around the X axis, between -pi and pi
+  float roll;
+
+  /// Rotation around the Y axis, between -pi/2 and pi/2
+  float pitch;
+
+  /// Rotation around the Z axis, between -pi and pi
+  float yaw;
+};
+
+/**
+ * @brief One sample of the Inertial Measurement Unit in physical units for the attitude estimation
+ * 
+ */
+struct ImuSample {
+  /// @brief Custom constructor for all measurements
+  explicit ImuSample(const EuclideanVector<float>& gyroscope_in_rad_per_s,
+                     const EuclideanVector<float>& accelerometer,
+                     const EuclideanVector<float>& magnetometer,
+                     const std::uint32_t timestamp_in_us) : gyroscope_in_rad_per_s(gyroscope_in_rad_per_s), accelerometer(accelerometer), magnetometer(magnetometer), timestamp_in_us(timestamp_in_us){};
+
+  /// Angular rate around X, Y and Z axis in rad/s
+  EuclideanVector<float> gyroscope_in_rad_per_s;
+
+  /// Specific force in any unit, only its direction is used. All zero if not available.
+  EuclideanVector<float> accelerometer;
+
+  /// Magnetic field in any unit, only its direction is used. All zero if not available.
+  EuclideanVector<float> magnetometer;
+
+  /// Time of the measurement in microseconds, may wrap around
+  std::uint32_t timestamp_in_us;
+};
+
+}  // namespace types
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef SRC_TYPES_CONTROL_TYPES_HPP_
+#define SRC_TYPES_CONTROL_TYPES_HPP_
+
+namespace types {
+
+/**
+ * @brief Demand of the attitude controller to the motors.
+ *        thrust is the collective throttle between 0 and 1. The torques are between -1 and 1,
+ *        as fraction of the motor range they may take: positive roll lowers the right side,
+ *        positive pitch raises the nose and positive yaw turns the nose right.
+ * 
+ */
+struct ThrustAndTorque {
+  float thrust;
+  float roll;
+  float pitch;
+  float yaw;
+};
+
+}  // namespace types
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef SRC_TYPES_IMU_CALIBRATION_HPP_
+#define SRC_TYPES_IMU_CALIBRATION_HPP_
+
+#include <array>
+#include "basic_types.hpp"
+
+namespace types {
+
+/**
+ * @brief Per axis correction of a sensor in its physical unit: calibrated = (measured - bias) * scale
+ * 
+ */
+struct SensorCalibration {
+  EuclideanVector<float> bias{0.0f, 0.0f, 0.0f};
+  EuclideanVector<float> scale{1.0f, 1.0f, 1.0f};
+};
+
+/**
+ * @brief Hard iron offset and soft iron correction of a magnetometer in micro tesla:
+ *        calibrated = correction * (measured - offset), the correction is row major
+ * 
+ */
+struct HardAndSoftIronCalibration {
+  EuclideanVector<float> offset{0.0f, 0.0f, 0.0f};
+  std::array<float, 9> correction{{1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f}};
+};
+
+/**
+ * @brief A enum for the state of the startup calibration of the Inertial Measurement Unit
+ * 
+ */
+enum class ImuCalibrationState : int {
+  UNCALIBRATED,
+  COLLECTING,
+  CALIBRATED
+};
+
+}  // namespace types
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef SRC_TYPES_IMU_LOW_PASS_FILTER_HPP_
+#define SRC_TYPES_IMU_LOW_PASS_FILTER_HPP_
+
+namespace types {
+
+/**
+ * @brief A enum for the digital low pass filter of gyroscope and accelerometer of the Inertial Measurement Unit.
+ *        Both sensors are filtered with the same setting, the name is the gyroscope bandwidth,
+ *        the accelerometer bandwidth is slightly higher. All settings sample internally at 1 kHz.
+ * 
+ */
+enum class ImuLowPassFilter : int {
+  BANDWIDTH_184_HZ = 1,  ///< Accelerometer 218.1 Hz
+  BANDWIDTH_92_HZ,       ///< Accelerometer 99 Hz
+  BANDWIDTH_41_HZ,       ///< Accelerometer 44.8 Hz
+  BANDWIDTH_20_HZ,       ///< Accelerometer 21.2 Hz
+  BANDWIDTH_10_HZ,       ///< Accelerometer 10.2 Hz
+  BANDWIDTH_5_HZ         ///< Accelerometer 5.05 Hz
+};
+
+}  // namespace types
+
+#endif
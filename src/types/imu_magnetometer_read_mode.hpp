@@ -0,0 +1,20 @@
+#ifndef SRC_TYPES_IMU_MAGNETOMETER_READ_MODE_HPP_
+#define SRC_TYPES_IMU_MAGNETOMETER_READ_MODE_HPP_
+
+namespace types {
+
+/**
+ * @brief A enum for the way the magnetometer of the Inertial Measurement Unit is read
+ * 
+ */
+enum class MagnetometerReadMode : int {
+  /// The host reads the AK8963 directly, the MPU9255 I2C master is in bypass mode.
+  /// Transports that do not reach the AK8963, e.g. SPI, use the auxiliary I2C master instead.
+  BYPASS,
+  /// The MPU9255 auxiliary I2C master reads the AK8963 into its external sensor data registers
+  AUXILIARY_I2C_MASTER
+};
+
+}  // namespace types
+
+#endif
@@ -0,0 +1,20 @@
+#ifndef SRC_TYPES_IMU_SENSOR_UPDATE_HPP_
+#define SRC_TYPES_IMU_SENSOR_UPDATE_HPP_
+
+namespace types {
+
+/**
+ * @brief The sensors of the Inertial Measurement Unit which delivered a new sample with the last update
+ * 
+ */
+struct ImuSensorUpdate {
+  bool gyroscope = false;
+  bool accelerometer = false;
+  /// The AK8963 samples at 8 or 100 Hz, so most updates at the loop rate find no new magnetometer sample
+  bool magnetometer = false;
+  bool temperature = false;
+};
+
+}  // namespace types
+
+#endif
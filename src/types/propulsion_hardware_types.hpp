@@ -17,7 +17,22 @@ enum class MotorType : int {
  */
 enum class EscType : int {
   /// Little bee esc 20 a ESC with oneshot125 protocol
-  LITTLE_BEE_20_A
+  LITTLE_BEE_20_A,
+  /// Any ESC with oneshot42 protocol
+  ONESHOT_42,
+  /// Any ESC with multishot protocol
+  MULTISHOT
+};
+
+/**
+ * @brief Enum for setting the bit rate of DShot ESCs
+ * 
+ */
+enum class DshotSpeed : int {
+  /// 300 kbit/s, a frame takes 53 us
+  DSHOT_300,
+  /// 600 kbit/s, a frame takes 27 us
+  DSHOT_600
 };
 }  // namespace types
 
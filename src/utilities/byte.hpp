@@ -5,35 +5,80 @@
 
 namespace utilities {
 
+/**
+ * @brief Field of WIDTH bits starting at bit OFFSET of a register Byte.
+ *        The mask is resolved at compile time, so register fields can be
+ *        declared as constexpr objects next to the register addresses.
+ *
+ * @tparam OFFSET Number of the lowest bit of the field, between 0 and 7
+ * @tparam WIDTH Amount of bits of the field
+ */
+template <std::uint8_t OFFSET, std::uint8_t WIDTH = 1>
+struct BitField {
+  static_assert(WIDTH >= 1 && OFFSET + WIDTH <= 8, "A BitField has to fit into one Byte");
+
+  static constexpr std::uint8_t MASK = static_cast<std::uint8_t>(((1u << WIDTH) - 1u) << OFFSET);
+
+  constexpr auto Encode(const std::uint8_t value) const noexcept -> std::uint8_t {
+    return static_cast<std::uint8_t>((value << OFFSET) & MASK);
+  }
+
+  constexpr auto Decode(const std::uint8_t byte) const noexcept -> std::uint8_t {
+    return static_cast<std::uint8_t>((byte & MASK) >> OFFSET);
+  }
+
+  constexpr auto IsSet(const std::uint8_t byte) const noexcept -> bool {
+    return (byte & MASK) != 0;
+  }
+};
+
+template <std::uint8_t OFFSET, std::uint8_t WIDTH>
+constexpr std::uint8_t BitField<OFFSET, WIDTH>::MASK;
+
 class Byte {
  public:
   Byte() = delete;
   ~Byte() = default;
 
-  explicit Byte(std::uint8_t byte) : byte_(byte){};
+  constexpr explicit Byte(std::uint8_t byte) : byte_(byte){};
 
-  auto Get(void) noexcept -> std::uint8_t {
+  constexpr auto Get(void) const noexcept -> std::uint8_t {
     return byte_;
   }
 
-  auto SetBit(const std::uint8_t bit_number_between_0_and_7) noexcept -> void {
+  template <std::uint8_t OFFSET, std::uint8_t WIDTH>
+  constexpr auto Get(const BitField<OFFSET, WIDTH> field) const noexcept -> std::uint8_t {
+    return field.Decode(byte_);
+  }
+
+  /**
+   * @brief Replaces the content of a field, all other bits are kept.
+   *        Returns the Byte itself, so a register value can be composed in one expression.
+   */
+  template <std::uint8_t OFFSET, std::uint8_t WIDTH>
+  constexpr auto Set(const BitField<OFFSET, WIDTH> field, const std::uint8_t value) noexcept -> Byte& {
+    byte_ = static_cast<std::uint8_t>((byte_ & ~BitField<OFFSET, WIDTH>::MASK) | field.Encode(value));
+    return *this;
+  }
+
+  constexpr auto SetBit(const std::uint8_t bit_number_between_0_and_7) noexcept -> void {
     byte_ = SetBitInByte(byte_, bit_number_between_0_and_7);
   }
 
-  auto ClearBit(const std::uint8_t bit_number_between_0_and_7) noexcept -> void {
+  constexpr auto ClearBit(const std::uint8_t bit_number_between_0_and_7) noexcept -> void {
     byte_ = static_cast<std::uint8_t>(byte_ & ~SetBitInByte(0, bit_number_between_0_and_7));
   }
 
-  auto IsBitHigh(const std::uint8_t bit_number_between_0_and_7) noexcept -> bool {
+  constexpr auto IsBitHigh(const std::uint8_t bit_number_between_0_and_7) const noexcept -> bool {
     return static_cast<bool>(byte_ & 1 << bit_number_between_0_and_7);
   }
 
-  auto IsBitLow(const std::uint8_t bit_number_between_0_and_7) noexcept -> bool {
+  constexpr auto IsBitLow(const std::uint8_t bit_number_between_0_and_7) const noexcept -> bool {
     return !IsBitHigh(bit_number_between_0_and_7);
   }
 
  private:
-  auto SetBitInByte(const std::uint8_t byte, const std::uint8_t bit_number_between_0_and_7) noexcept -> std::uint8_t {
+  static constexpr auto SetBitInByte(const std::uint8_t byte, const std::uint8_t bit_number_between_0_and_7) noexcept -> std::uint8_t {
     return static_cast<std::uint8_t>(byte | 1 << bit_number_between_0_and_7);
   }
 
@@ -42,4 +87,4 @@ class Byte {
 
 }  // namespace utilities
 
-#endif
\ No newline at end of file
+#endif
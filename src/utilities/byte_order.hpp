@@ -0,0 +1,63 @@
+#ifndef SRC_UTILITIES_BYTE_ORDER_HPP_
+#define SRC_UTILITIES_BYTE_ORDER_HPP_
+
+#include <cstdint>
+#include <cstring>
+#include "basic_types.hpp"
+
+#if defined(__ARM_ARCH_7EM__) && !defined(UNIT_TEST)
+#include "cmsis_compiler.h"
+#define UTILITIES_BYTE_ORDER_USE_REV16
+#endif
+
+namespace utilities {
+
+/**
+ * @brief Decodes one int16 from two consecutive Bytes without branching on the byte order
+ * 
+ * @param bytes Pointer to at least two Bytes
+ * @param little_endian True if the lower Byte comes first
+ * @return std::int16_t The decoded value
+ */
+inline auto DecodeInt16(const std::uint8_t *bytes, const bool little_endian) noexcept -> std::int16_t {
+  const auto swap = static_cast<unsigned int>(little_endian);
+  const auto high_byte = bytes[swap];
+  const auto low_byte = bytes[1u - swap];
+  return static_cast<std::int16_t>(static_cast<std::uint16_t>(high_byte << 8 | low_byte));
+}
+
+/**
+ * @brief Decodes three consecutive int16 (six Bytes) into a euclidean vector without heap allocation
+ *        and without branching on the byte order. On Cortex-M4 the Bytes are loaded as words and
+ *        swapped with REV16, otherwise the portable shift based decoding is used.
+ * 
+ * @param bytes Pointer to at least six Bytes
+ * @param little_endian True if the lower Byte of each value comes first
+ * @param decoded Vector the X, Y and Z value are written into
+ */
+inline auto DecodeInt16Triple(const std::uint8_t *bytes, const bool little_endian, types::EuclideanVector<std::int16_t> &decoded) noexcept -> void {
+#ifdef UTILITIES_BYTE_ORDER_USE_REV16
+  std::uint32_t x_and_y = 0;
+  std::uint16_t z = 0;
+  std::memcpy(&x_and_y, bytes, sizeof(x_and_y));
+  std::memcpy(&z, bytes + sizeof(x_and_y), sizeof(z));
+  std::uint32_t z_word = z;
+
+  // All ones for big endian data, which has to be swapped on the little endian core
+  const std::uint32_t swap_mask = static_cast<std::uint32_t>(little_endian) - 1u;
+  x_and_y ^= (x_and_y ^ __REV16(x_and_y)) & swap_mask;
+  z_word ^= (z_word ^ __REV16(z_word)) & swap_mask;
+
+  decoded.x = static_cast<std::int16_t>(x_and_y & 0xFFFFu);
+  decoded.y = static_cast<std::int16_t>(x_and_y >> 16);
+  decoded.z = static_cast<std::int16_t>(z_word & 0xFFFFu);
+#else
+  decoded.x = DecodeInt16(bytes, little_endian);
+  decoded.y = DecodeInt16(bytes + 2, little_endian);
+  decoded.z = DecodeInt16(bytes + 4, little_endian);
+#endif
+}
+
+}  // namespace utilities
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef SRC_UTILITIES_FIXED_POINT_HPP_
+#define SRC_UTILITIES_FIXED_POINT_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace utilities {
+
+/**
+ * Helpers for signed fixed point numbers stored in std::int32_t.
+ * FRACTIONAL_BITS is the amount of bits behind the binary point, e.g. 30 for Q30 where 1.0 is 2^30.
+ * Intermediate products use std::int64_t, which the Cortex-M4 computes with a single SMULL.
+ */
+
+/**
+ * @brief Converts a float into fixed point, rounded to nearest and saturated to the range of std::int32_t
+ */
+template <int FRACTIONAL_BITS>
+constexpr auto ToFixedPoint(const float value) noexcept -> std::int32_t {
+  static_assert(FRACTIONAL_BITS > 0 && FRACTIONAL_BITS < 32, "Fractional bits have to fit into std::int32_t");
+  const auto scaled_value = value * static_cast<float>(1ULL << FRACTIONAL_BITS);
+
+  // 2^31 is exactly representable as float, in contrast to INT32_MAX
+  if (scaled_value >= 2147483648.0f)
+    return std::numeric_limits<std::int32_t>::max();
+
+  if (scaled_value <= -2147483648.0f)
+    return std::numeric_limits<std::int32_t>::min();
+
+  return static_cast<std::int32_t>(scaled_value + (scaled_value >= 0.0f ? 0.5f : -0.5f));
+}
+
+template <int FRACTIONAL_BITS>
+constexpr auto ToFloat(const std::int32_t value) noexcept -> float {
+  static_assert(FRACTIONAL_BITS > 0 && FRACTIONAL_BITS < 32, "Fractional bits have to fit into std::int32_t");
+  return static_cast<float>(value) * (1.0f / static_cast<float>(1ULL << FRACTIONAL_BITS));
+}
+
+inline auto SaturateToInt32(const std::int64_t value) noexcept -> std::int32_t {
+  if (value > std::numeric_limits<std::int32_t>::max())
+    return std::numeric_limits<std::int32_t>::max();
+
+  if (value < std::numeric_limits<std::int32_t>::min())
+    return std::numeric_limits<std::int32_t>::min();
+
+  return static_cast<std::int32_t>(value);
+}
+
+/**
+ * @brief Product of two fixed point numbers, rounded to nearest. The fractional bits of the result
+ *        are the sum of the fractional bits of both factors minus SHIFT.
+ */
+template <int SHIFT>
+inline auto MultiplyFixedPoint(const std::int32_t first_factor, const std::int32_t second_factor) noexcept -> std::int32_t {
+  static_assert(SHIFT > 0 && SHIFT < 63, "Shift has to fit into std::int64_t");
+  const auto product = static_cast<std::int64_t>(first_factor) * second_factor;
+  return static_cast<std::int32_t>((product + (static_cast<std::int64_t>(1) << (SHIFT - 1))) >> SHIFT);
+}
+
+/**
+ * @brief Integer square root, rounded down, bit by bit without division
+ * 
+ * @param value Radicand
+ * @return std::uint32_t Largest integer whose square is not greater than value
+ */
+inline auto SquareRoot(std::uint64_t value) noexcept -> std::uint32_t {
+  std::uint64_t root = 0;
+  std::uint64_t bit = static_cast<std::uint64_t>(1) << 62;
+
+  while (bit > value)
+    bit >>= 2;
+
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+    bit >>= 2;
+  }
+
+  return static_cast<std::uint32_t>(root);
+}
+
+}  // namespace utilities
+
+#endif
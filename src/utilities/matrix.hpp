@@ -0,0 +1,219 @@
+#ifndef SRC_UTILITIES_MATRIX_HPP_
+#define SRC_UTILITIES_MATRIX_HPP_
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+#include "error_types.hpp"
+
+#if defined(ARM_MATH_CM4) && !defined(UNIT_TEST)
+#define MATRIX_USE_CMSIS_DSP
+#include "arm_math.h"
+#endif
+
+namespace utilities {
+
+/**
+ * @brief Row major single precision matrix with its size fixed at compile time, so all storage
+ *        lives inside the object and mismatching sizes fail to compile.
+ *        On target the operations run on the CMSIS-DSP arm_mat_*_f32 functions,
+ *        on the host on a portable implementation whose results are equivalent within rounding.
+ *
+ * @tparam ROWS Amount of rows
+ * @tparam COLUMNS Amount of columns
+ */
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+class Matrix {
+ public:
+  static constexpr std::uint16_t NUMBER_OF_ROWS = ROWS;
+  static constexpr std::uint16_t NUMBER_OF_COLUMNS = COLUMNS;
+
+  auto operator()(const std::uint16_t row, const std::uint16_t column) noexcept -> float& {
+    return elements_[row * COLUMNS + column];
+  }
+
+  auto operator()(const std::uint16_t row, const std::uint16_t column) const noexcept -> float {
+    return elements_[row * COLUMNS + column];
+  }
+
+  auto Data(void) noexcept -> float* {
+    return elements_.data();
+  }
+
+  auto Data(void) const noexcept -> const float* {
+    return elements_.data();
+  }
+
+  static auto Identity(void) noexcept -> Matrix {
+    static_assert(ROWS == COLUMNS, "Only square matrices have an identity");
+    Matrix identity;
+    for (std::uint16_t index = 0; index < ROWS; index++)
+      identity(index, index) = 1.0f;
+    return identity;
+  }
+
+ private:
+  std::array<float, ROWS * COLUMNS> elements_{};
+};
+
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+constexpr std::uint16_t Matrix<ROWS, COLUMNS>::NUMBER_OF_ROWS;
+
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+constexpr std::uint16_t Matrix<ROWS, COLUMNS>::NUMBER_OF_COLUMNS;
+
+#ifdef MATRIX_USE_CMSIS_DSP
+namespace matrix_cmsis {
+
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+inline auto Instance(const Matrix<ROWS, COLUMNS>& matrix) noexcept -> arm_matrix_instance_f32 {
+  // CMSIS-DSP does not write through the pointer of its source operands
+  return arm_matrix_instance_f32{ROWS, COLUMNS, const_cast<float32_t*>(matrix.Data())};
+}
+
+}  // namespace matrix_cmsis
+#endif
+
+/**
+ * @brief result = first * second. result must not be one of the factors.
+ */
+template <std::uint16_t ROWS, std::uint16_t INNER, std::uint16_t COLUMNS>
+inline auto Multiply(const Matrix<ROWS, INNER>& first, const Matrix<INNER, COLUMNS>& second, Matrix<ROWS, COLUMNS>& result) noexcept -> void {
+#ifdef MATRIX_USE_CMSIS_DSP
+  const auto first_instance = matrix_cmsis::Instance(first);
+  const auto second_instance = matrix_cmsis::Instance(second);
+  auto result_instance = matrix_cmsis::Instance(result);
+  arm_mat_mult_f32(&first_instance, &second_instance, &result_instance);
+#else
+  for (std::uint16_t row = 0; row < ROWS; row++) {
+    for (std::uint16_t column = 0; column < COLUMNS; column++) {
+      float sum = 0.0f;
+      for (std::uint16_t inner = 0; inner < INNER; inner++)
+        sum += first(row, inner) * second(inner, column);
+      result(row, column) = sum;
+    }
+  }
+#endif
+}
+
+/**
+ * @brief result = first + second, result may be one of the summands
+ */
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+inline auto Add(const Matrix<ROWS, COLUMNS>& first, const Matrix<ROWS, COLUMNS>& second, Matrix<ROWS, COLUMNS>& result) noexcept -> void {
+#ifdef MATRIX_USE_CMSIS_DSP
+  const auto first_instance = matrix_cmsis::Instance(first);
+  const auto second_instance = matrix_cmsis::Instance(second);
+  auto result_instance = matrix_cmsis::Instance(result);
+  arm_mat_add_f32(&first_instance, &second_instance, &result_instance);
+#else
+  for (std::uint16_t index = 0; index < ROWS * COLUMNS; index++)
+    result.Data()[index] = first.Data()[index] + second.Data()[index];
+#endif
+}
+
+/**
+ * @brief result = first - second, result may be one of the operands
+ */
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+inline auto Subtract(const Matrix<ROWS, COLUMNS>& first, const Matrix<ROWS, COLUMNS>& second, Matrix<ROWS, COLUMNS>& result) noexcept -> void {
+#ifdef MATRIX_USE_CMSIS_DSP
+  const auto first_instance = matrix_cmsis::Instance(first);
+  const auto second_instance = matrix_cmsis::Instance(second);
+  auto result_instance = matrix_cmsis::Instance(result);
+  arm_mat_sub_f32(&first_instance, &second_instance, &result_instance);
+#else
+  for (std::uint16_t index = 0; index < ROWS * COLUMNS; index++)
+    result.Data()[index] = first.Data()[index] - second.Data()[index];
+#endif
+}
+
+/**
+ * @brief result = matrix * factor, result may be the matrix itself
+ */
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+inline auto Scale(const Matrix<ROWS, COLUMNS>& matrix, const float factor, Matrix<ROWS, COLUMNS>& result) noexcept -> void {
+#ifdef MATRIX_USE_CMSIS_DSP
+  const auto matrix_instance = matrix_cmsis::Instance(matrix);
+  auto result_instance = matrix_cmsis::Instance(result);
+  arm_mat_scale_f32(&matrix_instance, factor, &result_instance);
+#else
+  for (std::uint16_t index = 0; index < ROWS * COLUMNS; index++)
+    result.Data()[index] = matrix.Data()[index] * factor;
+#endif
+}
+
+/**
+ * @brief result = matrix^T, result must not be the matrix itself
+ */
+template <std::uint16_t ROWS, std::uint16_t COLUMNS>
+inline auto Transpose(const Matrix<ROWS, COLUMNS>& matrix, Matrix<COLUMNS, ROWS>& result) noexcept -> void {
+#ifdef MATRIX_USE_CMSIS_DSP
+  const auto matrix_instance = matrix_cmsis::Instance(matrix);
+  auto result_instance = matrix_cmsis::Instance(result);
+  arm_mat_trans_f32(&matrix_instance, &result_instance);
+#else
+  for (std::uint16_t row = 0; row < ROWS; row++)
+    for (std::uint16_t column = 0; column < COLUMNS; column++)
+      result(column, row) = matrix(row, column);
+#endif
+}
+
+/**
+ * @brief result = matrix^-1 by Gauss-Jordan elimination
+ *
+ * @param matrix Square matrix, which is consumed: its content is undefined afterwards
+ * @param result Inverse of the matrix
+ * @return types::DriverStatus INPUT_ERROR if the matrix is singular, OK otherwise
+ */
+template <std::uint16_t SIZE>
+inline auto Inverse(Matrix<SIZE, SIZE>& matrix, Matrix<SIZE, SIZE>& result) noexcept -> types::DriverStatus {
+#ifdef MATRIX_USE_CMSIS_DSP
+  auto matrix_instance = matrix_cmsis::Instance(matrix);
+  auto result_instance = matrix_cmsis::Instance(result);
+  if (arm_mat_inverse_f32(&matrix_instance, &result_instance) != ARM_MATH_SUCCESS)
+    return types::DriverStatus::INPUT_ERROR;
+#else
+  result = Matrix<SIZE, SIZE>::Identity();
+
+  for (std::uint16_t pivot = 0; pivot < SIZE; pivot++) {
+    std::uint16_t pivot_row = pivot;
+    for (std::uint16_t row = static_cast<std::uint16_t>(pivot + 1); row < SIZE; row++)
+      if (std::fabs(matrix(row, pivot)) > std::fabs(matrix(pivot_row, pivot)))
+        pivot_row = row;
+
+    if (matrix(pivot_row, pivot) == 0.0f)
+      return types::DriverStatus::INPUT_ERROR;
+
+    if (pivot_row != pivot) {
+      for (std::uint16_t column = 0; column < SIZE; column++) {
+        std::swap(matrix(pivot, column), matrix(pivot_row, column));
+        std::swap(result(pivot, column), result(pivot_row, column));
+      }
+    }
+
+    const auto inverse_pivot = 1.0f / matrix(pivot, pivot);
+    for (std::uint16_t column = 0; column < SIZE; column++) {
+      matrix(pivot, column) *= inverse_pivot;
+      result(pivot, column) *= inverse_pivot;
+    }
+
+    for (std::uint16_t row = 0; row < SIZE; row++) {
+      const auto factor = matrix(row, pivot);
+      if (row == pivot || factor == 0.0f)
+        continue;
+
+      for (std::uint16_t column = 0; column < SIZE; column++) {
+        matrix(row, column) -= factor * matrix(pivot, column);
+        result(row, column) -= factor * result(pivot, column);
+      }
+    }
+  }
+#endif
+  return types::DriverStatus::OK;
+}
+
+}  // namespace utilities
+
+#endif
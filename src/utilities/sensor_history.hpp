@@ -0,0 +1,190 @@
+#ifndef SRC_UTILITIES_SENSOR_HISTORY_HPP_
+#define SRC_UTILITIES_SENSOR_HISTORY_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include "basic_types.hpp"
+#include "error_types.hpp"
+
+namespace utilities {
+
+/**
+ * @brief Ring of the last samples of a three axis sensor with their timestamps in microseconds.
+ *        Timestamps and axes are stored as separate arrays, so the search over the timestamps
+ *        touches only them. One writer, e.g. an interrupt, pushes samples while any number of
+ *        readers interpolate without locks: the writer publishes every sample by an atomic
+ *        counter, a reader uses only the newest CAPACITY - 1 samples, which the sample in
+ *        progress can not overwrite, and repeats its read if the writer overtook it meanwhile.
+ *
+ * @tparam ElementType Type of the axes as delivered by the sensor
+ * @tparam CAPACITY Amount of slots, CAPACITY - 1 samples are readable. A power of two, so the slot
+ *                  of a sample stays the same when the sample counter wraps around.
+ */
+template <typename ElementType, std::uint16_t CAPACITY>
+class SensorHistory {
+  static_assert(CAPACITY >= 3, "A history needs at least two readable samples to interpolate");
+  static_assert((CAPACITY & (CAPACITY - 1)) == 0, "The capacity has to be a power of two to survive the wrap around of the sample counter");
+
+ public:
+  /**
+   * @brief Appends a sample, only one context may push. The timestamps have to increase,
+   *        they may wrap around.
+   */
+  auto Push(const types::EuclideanVector<ElementType>& sample, const std::uint32_t timestamp_in_us) noexcept -> void {
+    const auto count = write_count_.load(std::memory_order_relaxed);
+    const auto slot = count % CAPACITY;
+    timestamps_[slot] = timestamp_in_us;
+    x_[slot] = sample.x;
+    y_[slot] = sample.y;
+    z_[slot] = sample.z;
+    if (count + 1 == 0)
+      has_wrapped_.store(true, std::memory_order_relaxed);
+    write_count_.store(count + 1, std::memory_order_release);
+  }
+
+  /// Empties the history, must not run concurrently to Push()
+  auto Clear(void) noexcept -> void {
+    has_wrapped_.store(false, std::memory_order_relaxed);
+    write_count_.store(0, std::memory_order_release);
+  }
+
+  /// Empties the history and continues counting samples from write_count, to test the wrap around of the counter
+  auto UnitTestSetWriteCount(const std::uint32_t write_count) noexcept -> void {
+    has_wrapped_.store(false, std::memory_order_relaxed);
+    write_count_.store(write_count, std::memory_order_release);
+  }
+
+  auto GetSize(void) const noexcept -> std::uint16_t {
+    return static_cast<std::uint16_t>(GetReadableSamples(write_count_.load(std::memory_order_acquire)));
+  }
+
+  /**
+   * @brief Reads the newest sample
+   * 
+   * @return types::DriverStatus INPUT_ERROR if the history is empty, TIMEOUT if the writer overtook every attempt
+   */
+  auto GetLatest(types::EuclideanVector<float>& sample, std::uint32_t& timestamp_in_us) const noexcept -> types::DriverStatus {
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+      const auto count = write_count_.load(std::memory_order_acquire);
+      if (GetReadableSamples(count) == 0)
+        return types::DriverStatus::INPUT_ERROR;
+
+      const auto newest = count - 1;
+      timestamp_in_us = timestamps_[newest % CAPACITY];
+      Read(newest, sample);
+
+      if (IsStillValid(newest))
+        return types::DriverStatus::OK;
+    }
+    return types::DriverStatus::TIMEOUT;
+  }
+
+  /**
+   * @brief Linear interpolation between the two samples around a point in time.
+   *        The search starts where the point is expected for evenly spaced samples, so it takes
+   *        a constant amount of steps for a sensor with a fixed sample rate.
+   * 
+   * @return types::DriverStatus INPUT_ERROR if the point in time is not covered by the history,
+   *                             TIMEOUT if the writer overtook every attempt
+   */
+  auto GetAt(const std::uint32_t timestamp_in_us, types::EuclideanVector<float>& sample) const noexcept -> types::DriverStatus {
+    for (int attempt = 0; attempt < MAX_READ_ATTEMPTS; attempt++) {
+      const auto count = write_count_.load(std::memory_order_acquire);
+      if (GetReadableSamples(count) == 0)
+        return types::DriverStatus::INPUT_ERROR;
+
+      const auto size = GetReadableSamples(count);
+      const auto newest = count - 1;
+      const auto oldest = count - size;
+      const auto newest_timestamp = timestamps_[newest % CAPACITY];
+
+      // Ages relative to the newest sample stay correct when the timestamps wrap around
+      const auto age = newest_timestamp - timestamp_in_us;
+      const auto span = newest_timestamp - timestamps_[oldest % CAPACITY];
+      if (age > span) {
+        if (IsStillValid(oldest))
+          return types::DriverStatus::INPUT_ERROR;
+        continue;
+      }
+
+      // Index of the youngest sample which is at least as old as the point in time. Indices are
+      // compared by their distance to the oldest one, which stays correct when the counter wraps around.
+      auto older = (span == 0) ? newest : newest - static_cast<std::uint32_t>((static_cast<std::uint64_t>(age) * (size - 1)) / span);
+      while (older - oldest > 0 && AgeOf(older, newest_timestamp) < age)
+        older--;
+      while (older - oldest < newest - oldest && AgeOf(older + 1, newest_timestamp) >= age)
+        older++;
+
+      if (older == newest || AgeOf(older, newest_timestamp) == age) {
+        Read(older, sample);
+      } else {
+        const auto older_age = AgeOf(older, newest_timestamp);
+        const auto interval = older_age - AgeOf(older + 1, newest_timestamp);
+        const auto fraction = static_cast<float>(older_age - age) / static_cast<float>(interval);
+        Interpolate(older, fraction, sample);
+      }
+
+      if (IsStillValid(older))
+        return types::DriverStatus::OK;
+    }
+    return types::DriverStatus::TIMEOUT;
+  }
+
+  static constexpr std::uint16_t READABLE_SAMPLES = CAPACITY - 1;
+
+ private:
+  /// Once the counter wrapped around, a small count no longer means an empty history
+  auto GetReadableSamples(const std::uint32_t count) const noexcept -> std::uint32_t {
+    if (count >= READABLE_SAMPLES || has_wrapped_.load(std::memory_order_relaxed))
+      return READABLE_SAMPLES;
+    return count;
+  }
+
+  auto AgeOf(const std::uint32_t index, const std::uint32_t newest_timestamp) const noexcept -> std::uint32_t {
+    return newest_timestamp - timestamps_[index % CAPACITY];
+  }
+
+  auto Read(const std::uint32_t index, types::EuclideanVector<float>& sample) const noexcept -> void {
+    const auto slot = index % CAPACITY;
+    sample.x = static_cast<float>(x_[slot]);
+    sample.y = static_cast<float>(y_[slot]);
+    sample.z = static_cast<float>(z_[slot]);
+  }
+
+  auto Interpolate(const std::uint32_t older, const float fraction, types::EuclideanVector<float>& sample) const noexcept -> void {
+    const auto first = older % CAPACITY;
+    const auto second = (older + 1) % CAPACITY;
+    sample.x = static_cast<float>(x_[first]) + fraction * (static_cast<float>(x_[second]) - static_cast<float>(x_[first]));
+    sample.y = static_cast<float>(y_[first]) + fraction * (static_cast<float>(y_[second]) - static_cast<float>(y_[first]));
+    sample.z = static_cast<float>(z_[first]) + fraction * (static_cast<float>(z_[second]) - static_cast<float>(z_[first]));
+  }
+
+  /// True if the writer has not started to overwrite the sample with the given index since it was read
+  auto IsStillValid(const std::uint32_t oldest_read_index) const noexcept -> bool {
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const auto count = write_count_.load(std::memory_order_relaxed);
+    return count - oldest_read_index <= READABLE_SAMPLES;
+  }
+
+  static constexpr int MAX_READ_ATTEMPTS = 4;
+
+  /// Amount of completed Push() calls, wraps around after 2^32 samples
+  std::atomic<std::uint32_t> write_count_{0};
+  /// Set by the push which wraps write_count_ around, published by its release store
+  std::atomic<bool> has_wrapped_{false};
+  std::array<std::uint32_t, CAPACITY> timestamps_{};
+  std::array<ElementType, CAPACITY> x_{};
+  std::array<ElementType, CAPACITY> y_{};
+  std::array<ElementType, CAPACITY> z_{};
+};
+
+template <typename ElementType, std::uint16_t CAPACITY>
+constexpr std::uint16_t SensorHistory<ElementType, CAPACITY>::READABLE_SAMPLES;
+
+template <typename ElementType, std::uint16_t CAPACITY>
+constexpr int SensorHistory<ElementType, CAPACITY>::MAX_READ_ATTEMPTS;
+
+}  // namespace utilities
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef SRC_UTILITIES_STREAMING_STATISTICS_HPP_
+#define SRC_UTILITIES_STREAMING_STATISTICS_HPP_
+
+#include <cstdint>
+
+namespace utilities {
+
+/**
+ * @brief Mean and variance of a stream of values by Welford's algorithm.
+ *        Every value is consumed on arrival, so neither the values nor a large sum of squares
+ *        have to be stored, which keeps the result accurate in single precision.
+ * 
+ */
+class StreamingStatistics {
+ public:
+  auto Add(const float value) noexcept -> void {
+    count_++;
+    const auto delta = value - mean_;
+    mean_ += delta / static_cast<float>(count_);
+    sum_of_squared_deviations_ += delta * (value - mean_);
+  }
+
+  auto Reset(void) noexcept -> void {
+    count_ = 0;
+    mean_ = 0.0f;
+    sum_of_squared_deviations_ = 0.0f;
+  }
+
+  auto GetCount(void) const noexcept -> std::uint32_t {
+    return count_;
+  }
+
+  auto GetMean(void) const noexcept -> float {
+    return mean_;
+  }
+
+  /// Sample variance, 0 until there are two values
+  auto GetVariance(void) const noexcept -> float {
+    return (count_ < 2) ? 0.0f : sum_of_squared_deviations_ / static_cast<float>(count_ - 1);
+  }
+
+ private:
+  std::uint32_t count_ = 0;
+  float mean_ = 0.0f;
+  float sum_of_squared_deviations_ = 0.0f;
+};
+
+}  // namespace utilities
+
+#endif
@@ -1,5 +1,7 @@
 
 #include "uart_print.hpp"
+#include <algorithm>
+#include <array>
 
 namespace utilities {
 
@@ -9,4 +11,25 @@ auto UartPrint(std::string text) -> void {
   HAL_UART_Transmit(&huart2, uchar_vector.data(), (uint16_t)text.length(), HAL_MAX_DELAY);
 }
 
+auto UartPrintInBackground(const std::string &text) -> types::DriverStatus {
+  static std::array<std::uint8_t, UART_BACKGROUND_BUFFER_SIZE> buffer;
+  constexpr char line_break[] = "\r\n";
+  const auto length = text.length() + sizeof(line_break) - 1;
+
+  if (length > buffer.size())
+    return types::DriverStatus::INPUT_ERROR;
+
+  // The buffer belongs to the interrupt until the previous transmission is complete
+  if (huart2.gState != HAL_UART_STATE_READY)
+    return types::DriverStatus::HAL_ERROR;
+
+  std::copy(text.begin(), text.end(), buffer.begin());
+  std::copy(line_break, line_break + sizeof(line_break) - 1, buffer.begin() + text.length());
+
+  if (HAL_UART_Transmit_IT(&huart2, buffer.data(), static_cast<uint16_t>(length)) != HAL_OK)
+    return types::DriverStatus::HAL_ERROR;
+
+  return types::DriverStatus::OK;
+}
+
 }  // namespace utilities
\ No newline at end of file
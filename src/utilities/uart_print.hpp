@@ -5,12 +5,25 @@
 
 #include <string>
 #include <vector>
+#include "error_types.hpp"
 #include "serial_config.h"
 
 namespace utilities {
 
+/// Longest text UartPrintInBackground() takes, including the line break it appends
+static constexpr std::size_t UART_BACKGROUND_BUFFER_SIZE = 512;
+
 auto UartPrint(std::string text) -> void;
 
+/**
+ * @brief Copies the text into a static buffer and returns while the USART2 interrupt sends it,
+ *        so a task of the scheduler does not wait for the bytes on the wire.
+ *
+ * @return types::DriverStatus HAL_ERROR while the previous text is still being sent, the new one is dropped,
+ *         INPUT_ERROR if the text does not fit into the buffer
+ */
+auto UartPrintInBackground(const std::string &text) -> types::DriverStatus;
+
 }  // namespace utilities
 
 #endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+#include "error_state_kalman_filter.hpp"
+#include "mahony_filter.hpp"
+#include "mahony_filter_fixed_point.hpp"
+#include "synthetic_motion.hpp"
+
+namespace {
+
+/**
+ * Measures the host time of one Update of each attitude estimator with a magnetometer
+ * and compares their accuracy on the same synthetic trajectory with gyroscope bias.
+ * The times compare the implementations on the build machine only, the float
+ * filters profit far more from a desktop FPU than from the single precision FPU of the target.
+ */
+class AttitudeBenchmarkTests : public ::testing::Test {
+ protected:
+  static constexpr int UPDATES = 100000;
+  static constexpr std::uint32_t SAMPLE_INTERVAL_IN_US = 1000;
+
+  void SetUp() override {
+    attitude::SyntheticMotion motion(types::EulerAngles{0.2f, -0.1f, 1.0f}, SAMPLE_INTERVAL_IN_US);
+    motion.SetGyroscopeBias(0.02, -0.01, 0.015);
+    motion.SetNoise(0.005, 0.01, 0.01);
+    samples_.reserve(UPDATES + 1);
+    truth_.reserve(UPDATES + 1);
+    samples_.push_back(motion.GetSample());
+    truth_.push_back(motion.GetTruth());
+    for (int update = 0; update < UPDATES; update++) {
+      // Alternate the rotation every second to keep the estimators busy
+      const double direction = ((update / 1000) % 2 == 0) ? 1.0 : -1.0;
+      motion.SetAngularRate(direction * 0.5, direction * -0.3, direction * 1.0);
+      samples_.push_back(motion.Step());
+      truth_.push_back(motion.GetTruth());
+    }
+  }
+
+  auto MeasureUpdateInNanoSeconds(attitude::AttitudeEstimatorInterface& filter) -> double {
+    EXPECT_EQ(filter.Update(samples_.front()), types::DriverStatus::OK);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto sample = samples_.cbegin() + 1; sample != samples_.cend(); sample++)
+      filter.Update(*sample);
+    const auto stop = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / UPDATES;
+  }
+
+  /// Root mean square of the attitude error after the first ten seconds, which are left for convergence
+  auto MeasureErrorInRadian(attitude::AttitudeEstimatorInterface& filter) -> double {
+    constexpr std::size_t CONVERGENCE_SAMPLES = 10000;
+    double sum_of_squares = 0.0;
+    for (std::size_t sample = 0; sample < samples_.size(); sample++) {
+      EXPECT_EQ(filter.Update(samples_.at(sample)), types::DriverStatus::OK);
+      if (sample < CONVERGENCE_SAMPLES)
+        continue;
+
+      const auto error = attitude::AngleBetween(filter.GetQuaternion(), truth_.at(sample));
+      sum_of_squares += error * error;
+    }
+    return std::sqrt(sum_of_squares / static_cast<double>(samples_.size() - CONVERGENCE_SAMPLES));
+  }
+
+  auto Report(const std::string& name, const double value, const std::string& unit) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << value << " " << unit << std::endl;
+    RecordProperty(name, std::to_string(value));
+  }
+
+  std::vector<types::ImuSample> samples_;
+  std::vector<types::Quaternion<float>> truth_;
+};
+
+TEST_F(AttitudeBenchmarkTests, update_time_float_versus_fixed_point) {
+  attitude::MahonyFilter float_filter(1.0f, 0.1f);
+  attitude::MahonyFilterFixedPoint fixed_point_filter(1.0f, 0.1f);
+
+  const auto float_latency = MeasureUpdateInNanoSeconds(float_filter);
+  const auto fixed_point_latency = MeasureUpdateInNanoSeconds(fixed_point_filter);
+
+  Report("mahony_float", float_latency, "ns per update");
+  Report("mahony_fixed_point", fixed_point_latency, "ns per update");
+
+  EXPECT_GT(float_latency, 0.0);
+  EXPECT_GT(fixed_point_latency, 0.0);
+}
+
+TEST_F(AttitudeBenchmarkTests, update_time_kalman_filter_versus_complementary_filter) {
+  attitude::MahonyFilter complementary_filter(1.0f, 0.1f);
+  attitude::ErrorStateKalmanFilter kalman_filter;
+
+  const auto complementary_latency = MeasureUpdateInNanoSeconds(complementary_filter);
+  const auto kalman_latency = MeasureUpdateInNanoSeconds(kalman_filter);
+
+  Report("mahony_float", complementary_latency, "ns per update");
+  Report("error_state_kalman_filter", kalman_latency, "ns per update");
+
+  EXPECT_GT(kalman_latency, 0.0);
+}
+
+TEST_F(AttitudeBenchmarkTests, accuracy_kalman_filter_versus_complementary_filter) {
+  attitude::MahonyFilter complementary_filter(1.0f, 0.1f);
+  attitude::ErrorStateKalmanFilter kalman_filter;
+
+  const auto complementary_error = MeasureErrorInRadian(complementary_filter);
+  const auto kalman_error = MeasureErrorInRadian(kalman_filter);
+
+  Report("mahony_float_rms_error", complementary_error, "rad");
+  Report("error_state_kalman_filter_rms_error", kalman_error, "rad");
+
+  EXPECT_LT(kalman_error, complementary_error);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "error_state_kalman_filter.hpp"
+#include "synthetic_motion.hpp"
+
+namespace {
+
+constexpr std::uint32_t SAMPLE_INTERVAL_IN_US = 1000;
+constexpr double PI = 3.14159265358979323846;
+
+class ErrorStateKalmanFilterTests : public ::testing::Test {
+ protected:
+  auto Run(attitude::SyntheticMotion& motion, const int samples) -> double {
+    double maximum_error = 0.0;
+    for (int sample = 0; sample < samples; sample++) {
+      EXPECT_EQ(filter_.Update(motion.Step()), types::DriverStatus::OK);
+      maximum_error = std::max(maximum_error, attitude::AngleBetween(filter_.GetQuaternion(), motion.GetTruth()));
+    }
+    return maximum_error;
+  }
+
+  attitude::ErrorStateKalmanFilter filter_;
+};
+
+TEST_F(ErrorStateKalmanFilterTests, first_sample_aligns_with_gravity_and_magnetic_field) {
+  attitude::SyntheticMotion motion(types::EulerAngles{0.3f, -0.2f, 1.0f}, SAMPLE_INTERVAL_IN_US);
+
+  EXPECT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::OK);
+
+  EXPECT_LT(attitude::AngleBetween(filter_.GetQuaternion(), motion.GetTruth()), 1.0e-3);
+  EXPECT_NEAR(filter_.GetEulerAngles().yaw, 1.0f, 1.0e-3f);
+}
+
+TEST_F(ErrorStateKalmanFilterTests, alignment_without_gravity_is_rejected) {
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  const auto sample = motion.GetSample();
+
+  EXPECT_EQ(filter_.Update(types::ImuSample(sample.gyroscope_in_rad_per_s, types::EuclideanVector<float>(0.0f, 0.0f, 0.0f), sample.magnetometer, 0)), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(filter_.Update(sample), types::DriverStatus::OK);
+}
+
+TEST_F(ErrorStateKalmanFilterTests, invalid_sample_interval_is_rejected) {
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+
+  ASSERT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::OK);
+  EXPECT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::INPUT_ERROR);
+  motion.SetTimestampInMicroSeconds(attitude::ErrorStateKalmanFilter::MAX_SAMPLE_INTERVAL_IN_US + 1);
+  EXPECT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(filter_.Update(motion.Step()), types::DriverStatus::OK);
+}
+
+TEST_F(ErrorStateKalmanFilterTests, gyroscope_alone_integrates_quarter_turn) {
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetAngularRate(0.0, 0.0, PI / 2.0);
+  ASSERT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::OK);
+
+  const types::EuclideanVector<float> missing(0.0f, 0.0f, 0.0f);
+  for (int sample = 0; sample < 1000; sample++) {
+    const auto measurement = motion.Step();
+    ASSERT_EQ(filter_.Update(types::ImuSample(measurement.gyroscope_in_rad_per_s, missing, missing, measurement.timestamp_in_us)), types::DriverStatus::OK);
+  }
+
+  EXPECT_NEAR(filter_.GetEulerAngles().yaw, PI / 2.0, 1.0e-3);
+}
+
+TEST_F(ErrorStateKalmanFilterTests, estimates_gyroscope_bias_at_rest) {
+  attitude::SyntheticMotion motion(types::EulerAngles{0.2f, 0.1f, -1.0f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetGyroscopeBias(0.02, -0.03, 0.01);
+  motion.SetNoise(0.005, 0.01, 0.01);
+  ASSERT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::OK);
+
+  Run(motion, 20000);
+
+  EXPECT_NEAR(filter_.GetGyroscopeBias().x, 0.02f, 0.003f);
+  EXPECT_NEAR(filter_.GetGyroscopeBias().y, -0.03f, 0.003f);
+  EXPECT_NEAR(filter_.GetGyroscopeBias().z, 0.01f, 0.003f);
+}
+
+TEST_F(ErrorStateKalmanFilterTests, tracks_synthetic_trajectory_with_noise_and_gyroscope_bias) {
+  attitude::SyntheticMotion motion(types::EulerAngles{0.1f, 0.2f, -0.5f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetGyroscopeBias(0.02, -0.01, 0.015);
+  motion.SetNoise(0.005, 0.01, 0.01);
+  ASSERT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::OK);
+
+  Run(motion, 20000);
+  double maximum_error = 0.0;
+  for (int segment = 0; segment < 8; segment++) {
+    const double direction = (segment % 2 == 0) ? 1.0 : -1.0;
+    motion.SetAngularRate(direction * 1.0, direction * -0.5, direction * 2.0);
+    maximum_error = std::max(maximum_error, Run(motion, 1000));
+  }
+
+  EXPECT_LT(maximum_error, 0.03);
+}
+
+TEST_F(ErrorStateKalmanFilterTests, reset_forgets_bias_and_aligns_again) {
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetGyroscopeBias(0.05, 0.0, 0.0);
+  ASSERT_EQ(filter_.Update(motion.GetSample()), types::DriverStatus::OK);
+  Run(motion, 1000);
+  ASSERT_NE(filter_.GetGyroscopeBias().x, 0.0f);
+
+  filter_.Reset();
+
+  EXPECT_EQ(filter_.GetGyroscopeBias().x, 0.0f);
+  attitude::SyntheticMotion tilted(types::EulerAngles{-0.7f, 0.3f, 2.0f}, SAMPLE_INTERVAL_IN_US);
+  EXPECT_EQ(filter_.Update(tilted.GetSample()), types::DriverStatus::OK);
+  EXPECT_LT(attitude::AngleBetween(filter_.GetQuaternion(), tilted.GetTruth()), 1.0e-3);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,163 @@
+#include <algorithm>
+#include "gtest/gtest.h"
+#include "mahony_filter.hpp"
+#include "mahony_filter_fixed_point.hpp"
+#include "synthetic_motion.hpp"
+
+namespace {
+
+constexpr std::uint32_t SAMPLE_INTERVAL_IN_US = 1000;
+constexpr double PI = 3.14159265358979323846;
+
+template <typename Filter>
+class MahonyFilterTests : public ::testing::Test {
+ protected:
+  auto Run(attitude::AttitudeEstimatorInterface& filter, attitude::SyntheticMotion& motion, const int samples) -> double {
+    double maximum_error = 0.0;
+    for (int sample = 0; sample < samples; sample++) {
+      EXPECT_EQ(filter.Update(motion.Step()), types::DriverStatus::OK);
+      maximum_error = std::max(maximum_error, attitude::AngleBetween(filter.GetQuaternion(), motion.GetTruth()));
+    }
+    return maximum_error;
+  }
+
+  auto ZeroVector(void) -> types::EuclideanVector<float> {
+    return types::EuclideanVector<float>(0.0f, 0.0f, 0.0f);
+  }
+};
+
+using Filters = ::testing::Types<attitude::MahonyFilter, attitude::MahonyFilterFixedPoint>;
+TYPED_TEST_CASE(MahonyFilterTests, Filters);
+
+TYPED_TEST(MahonyFilterTests, first_sample_aligns_with_gravity_and_magnetic_field) {
+  TypeParam filter;
+  attitude::SyntheticMotion motion(types::EulerAngles{0.3f, -0.2f, 1.0f}, SAMPLE_INTERVAL_IN_US);
+
+  EXPECT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::OK);
+
+  EXPECT_LT(attitude::AngleBetween(filter.GetQuaternion(), motion.GetTruth()), 1.0e-3);
+  EXPECT_NEAR(filter.GetEulerAngles().roll, 0.3f, 1.0e-3f);
+  EXPECT_NEAR(filter.GetEulerAngles().pitch, -0.2f, 1.0e-3f);
+  EXPECT_NEAR(filter.GetEulerAngles().yaw, 1.0f, 1.0e-3f);
+}
+
+TYPED_TEST(MahonyFilterTests, alignment_without_gravity_is_rejected) {
+  TypeParam filter;
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  const auto sample = motion.GetSample();
+
+  EXPECT_EQ(filter.Update(types::ImuSample(sample.gyroscope_in_rad_per_s, this->ZeroVector(), sample.magnetometer, 0)), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(filter.Update(sample), types::DriverStatus::OK);
+}
+
+TYPED_TEST(MahonyFilterTests, timestamp_which_did_not_advance_is_rejected) {
+  TypeParam filter;
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+
+  ASSERT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::OK);
+  EXPECT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(filter.Update(motion.Step()), types::DriverStatus::OK);
+}
+
+TYPED_TEST(MahonyFilterTests, timestamp_which_jumped_too_far_is_rejected) {
+  TypeParam filter;
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+
+  ASSERT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::OK);
+  motion.SetTimestampInMicroSeconds(TypeParam::MAX_SAMPLE_INTERVAL_IN_US + 1);
+  EXPECT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(filter.Update(motion.Step()), types::DriverStatus::OK);
+}
+
+TYPED_TEST(MahonyFilterTests, timestamp_wrap_around_is_integrated) {
+  TypeParam filter;
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetTimestampInMicroSeconds(UINT32_MAX - SAMPLE_INTERVAL_IN_US / 2);
+
+  ASSERT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::OK);
+  EXPECT_EQ(filter.Update(motion.Step()), types::DriverStatus::OK);
+}
+
+TYPED_TEST(MahonyFilterTests, gyroscope_alone_integrates_quarter_turn) {
+  TypeParam filter;
+  attitude::SyntheticMotion motion(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetAngularRate(0.0, 0.0, PI / 2.0);
+  ASSERT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::OK);
+
+  for (int sample = 0; sample < 1000; sample++) {
+    const auto measurement = motion.Step();
+    ASSERT_EQ(filter.Update(types::ImuSample(measurement.gyroscope_in_rad_per_s, this->ZeroVector(), this->ZeroVector(), measurement.timestamp_in_us)), types::DriverStatus::OK);
+  }
+
+  EXPECT_NEAR(filter.GetEulerAngles().yaw, PI / 2.0, 1.0e-3);
+  EXPECT_NEAR(filter.GetEulerAngles().roll, 0.0, 1.0e-3);
+  EXPECT_LT(attitude::AngleBetween(filter.GetQuaternion(), motion.GetTruth()), 1.0e-3);
+}
+
+TYPED_TEST(MahonyFilterTests, converges_from_wrong_attitude_at_rest) {
+  TypeParam filter(2.0f);
+  attitude::SyntheticMotion level(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  attitude::SyntheticMotion tilted(types::EulerAngles{0.5f, -0.4f, 0.8f}, SAMPLE_INTERVAL_IN_US);
+  ASSERT_EQ(filter.Update(level.GetSample()), types::DriverStatus::OK);
+
+  this->Run(filter, tilted, 20000);
+
+  EXPECT_LT(attitude::AngleBetween(filter.GetQuaternion(), tilted.GetTruth()), 0.01);
+}
+
+TYPED_TEST(MahonyFilterTests, tracks_synthetic_trajectory_with_noise_and_gyroscope_bias) {
+  TypeParam filter(1.0f, 0.1f);
+  attitude::SyntheticMotion motion(types::EulerAngles{0.1f, 0.2f, -0.5f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetGyroscopeBias(0.02, -0.01, 0.015);
+  motion.SetNoise(0.005, 0.01, 0.01);
+  ASSERT_EQ(filter.Update(motion.GetSample()), types::DriverStatus::OK);
+
+  // Settle the bias estimation, then roll, pitch and yaw back and forth
+  this->Run(filter, motion, 20000);
+  double maximum_error = 0.0;
+  for (int segment = 0; segment < 8; segment++) {
+    const double direction = (segment % 2 == 0) ? 1.0 : -1.0;
+    motion.SetAngularRate(direction * 1.0, direction * -0.5, direction * 2.0);
+    maximum_error = std::max(maximum_error, this->Run(filter, motion, 1000));
+  }
+
+  EXPECT_LT(maximum_error, 0.05);
+}
+
+TYPED_TEST(MahonyFilterTests, reset_aligns_again) {
+  TypeParam filter;
+  attitude::SyntheticMotion level(types::EulerAngles{0.0f, 0.0f, 0.0f}, SAMPLE_INTERVAL_IN_US);
+  attitude::SyntheticMotion tilted(types::EulerAngles{-0.7f, 0.3f, 2.0f}, SAMPLE_INTERVAL_IN_US);
+  ASSERT_EQ(filter.Update(level.GetSample()), types::DriverStatus::OK);
+
+  filter.Reset();
+
+  EXPECT_EQ(filter.Update(tilted.GetSample()), types::DriverStatus::OK);
+  EXPECT_LT(attitude::AngleBetween(filter.GetQuaternion(), tilted.GetTruth()), 1.0e-3);
+}
+
+TEST(MahonyFilterFixedPointTests, agrees_with_float_implementation) {
+  attitude::MahonyFilter float_filter(1.0f, 0.1f);
+  attitude::MahonyFilterFixedPoint fixed_point_filter(1.0f, 0.1f);
+  attitude::SyntheticMotion motion(types::EulerAngles{0.4f, 0.1f, 2.5f}, SAMPLE_INTERVAL_IN_US);
+  motion.SetGyroscopeBias(0.01, 0.01, -0.02);
+  motion.SetNoise(0.005, 0.01, 0.01);
+  motion.SetAngularRate(0.5, -1.0, 1.5);
+
+  double maximum_difference = 0.0;
+  for (int sample = 0; sample < 10000; sample++) {
+    const auto measurement = motion.Step();
+    ASSERT_EQ(float_filter.Update(measurement), types::DriverStatus::OK);
+    ASSERT_EQ(fixed_point_filter.Update(measurement), types::DriverStatus::OK);
+    maximum_difference = std::max(maximum_difference, attitude::AngleBetween(float_filter.GetQuaternion(), fixed_point_filter.GetQuaternion()));
+  }
+
+  EXPECT_LT(maximum_difference, 1.0e-3);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
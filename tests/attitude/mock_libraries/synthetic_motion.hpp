@@ -0,0 +1,152 @@
+#ifndef SYNTHETIC_MOTION_HPP_
+#define SYNTHETIC_MOTION_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include "attitude_types.hpp"
+
+namespace attitude {
+
+/**
+ * @brief Generates IMU samples of a rigid body from its true attitude. The truth is integrated
+ *        exactly in double precision from the angular rate, gravity and magnetic field are
+ *        rotated into the body frame. Gyroscope bias and white noise can be added.
+ * 
+ */
+class SyntheticMotion {
+ public:
+  /// Magnetic field with 60 degree inclination, pointing north and down like in central Europe
+  static constexpr double MAGNETIC_NORTH = 0.5;
+  static constexpr double MAGNETIC_UP = -0.8660254037844386;
+
+  SyntheticMotion(const types::EulerAngles& initial_attitude, const std::uint32_t sample_interval_in_us, const unsigned int seed = 1)
+      : sample_interval_in_us_(sample_interval_in_us), random_generator_(seed) {
+    const double cos_roll = std::cos(0.5 * initial_attitude.roll);
+    const double sin_roll = std::sin(0.5 * initial_attitude.roll);
+    const double cos_pitch = std::cos(0.5 * initial_attitude.pitch);
+    const double sin_pitch = std::sin(0.5 * initial_attitude.pitch);
+    const double cos_yaw = std::cos(0.5 * initial_attitude.yaw);
+    const double sin_yaw = std::sin(0.5 * initial_attitude.yaw);
+    w_ = cos_roll * cos_pitch * cos_yaw + sin_roll * sin_pitch * sin_yaw;
+    x_ = sin_roll * cos_pitch * cos_yaw - cos_roll * sin_pitch * sin_yaw;
+    y_ = cos_roll * sin_pitch * cos_yaw + sin_roll * cos_pitch * sin_yaw;
+    z_ = cos_roll * cos_pitch * sin_yaw - sin_roll * sin_pitch * cos_yaw;
+  }
+
+  auto SetAngularRate(const double x_in_rad_per_s, const double y_in_rad_per_s, const double z_in_rad_per_s) -> void {
+    rate_x_ = x_in_rad_per_s;
+    rate_y_ = y_in_rad_per_s;
+    rate_z_ = z_in_rad_per_s;
+  }
+
+  auto SetGyroscopeBias(const double x_in_rad_per_s, const double y_in_rad_per_s, const double z_in_rad_per_s) -> void {
+    bias_x_ = x_in_rad_per_s;
+    bias_y_ = y_in_rad_per_s;
+    bias_z_ = z_in_rad_per_s;
+  }
+
+  auto SetNoise(const double gyroscope_in_rad_per_s, const double accelerometer, const double magnetometer) -> void {
+    gyroscope_noise_ = std::normal_distribution<double>(0.0, gyroscope_in_rad_per_s);
+    accelerometer_noise_ = std::normal_distribution<double>(0.0, accelerometer);
+    magnetometer_noise_ = std::normal_distribution<double>(0.0, magnetometer);
+    noise_enabled_ = true;
+  }
+
+  /**
+   * @brief Rotates the body with the current angular rate for one sample interval
+   * @return types::ImuSample Measurement at the end of the interval
+   */
+  auto Step(void) -> types::ImuSample {
+    const double rate = std::sqrt(rate_x_ * rate_x_ + rate_y_ * rate_y_ + rate_z_ * rate_z_);
+    const double half_angle = 0.5 * rate * sample_interval_in_us_ * 1.0e-6;
+
+    if (rate > 0.0) {
+      const double dw = std::cos(half_angle);
+      const double scale = std::sin(half_angle) / rate;
+      const double dx = rate_x_ * scale;
+      const double dy = rate_y_ * scale;
+      const double dz = rate_z_ * scale;
+      const double w = w_ * dw - x_ * dx - y_ * dy - z_ * dz;
+      const double x = w_ * dx + x_ * dw + y_ * dz - z_ * dy;
+      const double y = w_ * dy - x_ * dz + y_ * dw + z_ * dx;
+      const double z = w_ * dz + x_ * dy - y_ * dx + z_ * dw;
+      w_ = w;
+      x_ = x;
+      y_ = y;
+      z_ = z;
+    }
+
+    timestamp_in_us_ += sample_interval_in_us_;
+    return GetSample();
+  }
+
+  /**
+   * @brief Measurement of the current attitude without moving the body
+   */
+  auto GetSample(void) -> types::ImuSample {
+    double gravity_x, gravity_y, gravity_z;
+    double magnetic_x, magnetic_y, magnetic_z;
+    RotateIntoBody(0.0, 0.0, 1.0, gravity_x, gravity_y, gravity_z);
+    RotateIntoBody(MAGNETIC_NORTH, 0.0, MAGNETIC_UP, magnetic_x, magnetic_y, magnetic_z);
+
+    return types::ImuSample(types::EuclideanVector<float>(Measure(rate_x_ + bias_x_, gyroscope_noise_),
+                                                          Measure(rate_y_ + bias_y_, gyroscope_noise_),
+                                                          Measure(rate_z_ + bias_z_, gyroscope_noise_)),
+                            types::EuclideanVector<float>(Measure(gravity_x, accelerometer_noise_),
+                                                          Measure(gravity_y, accelerometer_noise_),
+                                                          Measure(gravity_z, accelerometer_noise_)),
+                            types::EuclideanVector<float>(Measure(magnetic_x, magnetometer_noise_),
+                                                          Measure(magnetic_y, magnetometer_noise_),
+                                                          Measure(magnetic_z, magnetometer_noise_)),
+                            timestamp_in_us_);
+  }
+
+  auto GetTruth(void) const -> types::Quaternion<float> {
+    return types::Quaternion<float>{static_cast<float>(w_), static_cast<float>(x_), static_cast<float>(y_), static_cast<float>(z_)};
+  }
+
+  auto GetTimestampInMicroSeconds(void) const -> std::uint32_t {
+    return timestamp_in_us_;
+  }
+
+  auto SetTimestampInMicroSeconds(const std::uint32_t timestamp_in_us) -> void {
+    timestamp_in_us_ = timestamp_in_us;
+  }
+
+ private:
+  /// v_body = q* v_earth q
+  auto RotateIntoBody(const double x, const double y, const double z, double& body_x, double& body_y, double& body_z) const -> void {
+    body_x = (1.0 - 2.0 * (y_ * y_ + z_ * z_)) * x + 2.0 * (x_ * y_ + w_ * z_) * y + 2.0 * (x_ * z_ - w_ * y_) * z;
+    body_y = 2.0 * (x_ * y_ - w_ * z_) * x + (1.0 - 2.0 * (x_ * x_ + z_ * z_)) * y + 2.0 * (y_ * z_ + w_ * x_) * z;
+    body_z = 2.0 * (x_ * z_ + w_ * y_) * x + 2.0 * (y_ * z_ - w_ * x_) * y + (1.0 - 2.0 * (x_ * x_ + y_ * y_)) * z;
+  }
+
+  auto Measure(const double value, std::normal_distribution<double>& noise) -> float {
+    return static_cast<float>(noise_enabled_ ? value + noise(random_generator_) : value);
+  }
+
+  std::uint32_t sample_interval_in_us_;
+  std::uint32_t timestamp_in_us_ = 0;
+  double w_ = 1.0, x_ = 0.0, y_ = 0.0, z_ = 0.0;
+  double rate_x_ = 0.0, rate_y_ = 0.0, rate_z_ = 0.0;
+  double bias_x_ = 0.0, bias_y_ = 0.0, bias_z_ = 0.0;
+  bool noise_enabled_ = false;
+  std::mt19937 random_generator_;
+  std::normal_distribution<double> gyroscope_noise_;
+  std::normal_distribution<double> accelerometer_noise_;
+  std::normal_distribution<double> magnetometer_noise_;
+};
+
+/**
+ * @brief Angle of the rotation between two unit quaternions in radians
+ */
+inline auto AngleBetween(const types::Quaternion<float>& first, const types::Quaternion<float>& second) -> double {
+  const double dot = std::fabs(static_cast<double>(first.w) * second.w + static_cast<double>(first.x) * second.x +
+                               static_cast<double>(first.y) * second.y + static_cast<double>(first.z) * second.z);
+  return 2.0 * std::acos(dot > 1.0 ? 1.0 : dot);
+}
+
+}  // namespace attitude
+
+#endif
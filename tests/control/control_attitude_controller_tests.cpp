@@ -0,0 +1,202 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include "attitude_controller.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+constexpr std::uint32_t SAMPLE_FREQUENCY_IN_HZ = 1000;
+constexpr float SAMPLE_INTERVAL_IN_S = 1.0f / SAMPLE_FREQUENCY_IN_HZ;
+constexpr float THRUST = 0.5f;
+
+/**
+ * @brief Rigid body with decoupled axes for small angles. The motors follow the torque demand
+ *        with a first order lag, full torque accelerates by TORQUE_AUTHORITY, a disturbance
+ *        adds a constant angular acceleration. Integrated with the sample interval.
+ *
+ */
+struct SimulatedPlant {
+  static constexpr float TORQUE_AUTHORITY_IN_RAD_PER_S2 = 150.0f;
+  static constexpr float MOTOR_TIME_CONSTANT_IN_S = 0.02f;
+
+  auto Step(const types::ThrustAndTorque& demand) -> void {
+    const float torque_demand[3] = {demand.roll, demand.pitch, demand.yaw};
+    for (std::uint8_t axis = 0; axis < 3; axis++) {
+      torque[axis] += (torque_demand[axis] - torque[axis]) * SAMPLE_INTERVAL_IN_S / MOTOR_TIME_CONSTANT_IN_S;
+      rate[axis] += (TORQUE_AUTHORITY_IN_RAD_PER_S2 * torque[axis] + disturbance_in_rad_per_s2[axis]) * SAMPLE_INTERVAL_IN_S;
+      angle[axis] += rate[axis] * SAMPLE_INTERVAL_IN_S;
+    }
+  }
+
+  auto GetAttitude(void) const -> types::EulerAngles {
+    return types::EulerAngles{angle[0], angle[1], angle[2]};
+  }
+
+  auto GetRate(void) const -> types::EuclideanVector<float> {
+    return types::EuclideanVector<float>(rate[0], rate[1], rate[2]);
+  }
+
+  float angle[3] = {0.0f, 0.0f, 0.0f};
+  float rate[3] = {0.0f, 0.0f, 0.0f};
+  float torque[3] = {0.0f, 0.0f, 0.0f};
+  float disturbance_in_rad_per_s2[3] = {0.0f, 0.0f, 0.0f};
+};
+
+constexpr float SimulatedPlant::TORQUE_AUTHORITY_IN_RAD_PER_S2;
+constexpr float SimulatedPlant::MOTOR_TIME_CONSTANT_IN_S;
+
+/**
+ * @brief Result of a step of one axis
+ *
+ */
+struct StepResponse {
+  float overshoot;
+  /// Time after which the response stays within the band around the step
+  float settling_time_in_s;
+  float final_value;
+};
+
+constexpr control::PidGains ANGLE_GAINS{8.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 8.0f, control::FLAT_GAIN_SCHEDULE};
+constexpr control::PidGains RATE_GAINS{0.25f, 1.0f, 0.005f, 0.0f, 100.0f, 0.3f, 1.0f, control::FLAT_GAIN_SCHEDULE};
+constexpr control::AttitudeGains GAINS{{{ANGLE_GAINS, RATE_GAINS}, {ANGLE_GAINS, RATE_GAINS}, {ANGLE_GAINS, RATE_GAINS}}};
+
+template <class T>
+class AttitudeControllerTests : public ::testing::Test {
+ protected:
+  static auto GetResponse(const float* values, const int samples, const float step, const float band) -> StepResponse {
+    float largest = 0.0f;
+    int last_outside = -1;
+    for (int sample = 0; sample < samples; sample++) {
+      largest = std::fmax(largest, values[sample]);
+      if (std::fabs(values[sample] - step) > band * step)
+        last_outside = sample;
+    }
+    return StepResponse{(largest - step) / step, static_cast<float>(last_outside + 1) * SAMPLE_INTERVAL_IN_S, values[samples - 1]};
+  }
+
+  /// Angle mode step of the roll axis, records the roll angle
+  auto RunAngleStep(const float step_in_rad, const float band) -> StepResponse {
+    for (int sample = 0; sample < SAMPLES; sample++) {
+      types::ThrustAndTorque demand{};
+      EXPECT_EQ(controller_.Update(types::EulerAngles{step_in_rad, 0.0f, 0.0f}, plant_.GetAttitude(), plant_.GetRate(), THRUST, demand), types::DriverStatus::OK);
+      plant_.Step(demand);
+      values_[sample] = plant_.angle[control::ROLL_AXIS];
+      largest_rate_setpoint_ = std::fmax(largest_rate_setpoint_, controller_.GetRateSetpoint().x);
+    }
+    return GetResponse(values_, SAMPLES, step_in_rad, band);
+  }
+
+  /// Rate mode step of the pitch axis, records the pitch rate
+  auto RunRateStep(const float step_in_rad_per_s, const float band) -> StepResponse {
+    for (int sample = 0; sample < SAMPLES; sample++) {
+      types::ThrustAndTorque demand{};
+      EXPECT_EQ(controller_.UpdateRate(types::EuclideanVector<float>(0.0f, step_in_rad_per_s, 0.0f), plant_.GetRate(), THRUST, demand), types::DriverStatus::OK);
+      plant_.Step(demand);
+      values_[sample] = plant_.rate[control::PITCH_AXIS];
+    }
+    return GetResponse(values_, SAMPLES, step_in_rad_per_s, band);
+  }
+
+  static constexpr int SAMPLES = 2 * SAMPLE_FREQUENCY_IN_HZ;
+
+  T controller_{GAINS, SAMPLE_FREQUENCY_IN_HZ};
+  SimulatedPlant plant_;
+  float values_[SAMPLES];
+  float largest_rate_setpoint_ = 0.0f;
+};
+
+template <class T>
+constexpr int AttitudeControllerTests<T>::SAMPLES;
+
+using Controllers = ::testing::Types<control::AttitudeController, control::AttitudeControllerFixedPoint>;
+TYPED_TEST_CASE(AttitudeControllerTests, Controllers);
+
+TYPED_TEST(AttitudeControllerTests, rate_step_settles_fast_with_little_overshoot) {
+  const auto response = this->RunRateStep(2.0f, 0.05f);
+
+  // The zero of the integral overshoots a little on the integrating plant
+  EXPECT_LT(response.overshoot, 0.15f);
+  EXPECT_LT(response.settling_time_in_s, 0.45f);
+  EXPECT_NEAR(response.final_value, 2.0f, 0.01f);
+}
+
+TYPED_TEST(AttitudeControllerTests, angle_step_settles_without_overshoot) {
+  const auto response = this->RunAngleStep(0.3f, 0.02f);
+
+  EXPECT_LT(response.overshoot, 0.02f);
+  EXPECT_LT(response.settling_time_in_s, 0.7f);
+  EXPECT_NEAR(response.final_value, 0.3f, 0.003f);
+}
+
+TYPED_TEST(AttitudeControllerTests, large_angle_step_is_rate_limited_and_settles_without_overshoot) {
+  const auto response = this->RunAngleStep(1.5f, 0.02f);
+
+  // The angle loop commands its limit of 8 rad/s, which saturates the torque of the rate loop at first
+  EXPECT_FLOAT_EQ(this->largest_rate_setpoint_, 8.0f);
+  EXPECT_LT(response.overshoot, 0.02f);
+  EXPECT_LT(response.settling_time_in_s, 0.8f);
+  EXPECT_NEAR(response.final_value, 1.5f, 0.015f);
+}
+
+TYPED_TEST(AttitudeControllerTests, integral_removes_the_error_of_a_constant_disturbance) {
+  this->plant_.disturbance_in_rad_per_s2[control::ROLL_AXIS] = 20.0f;
+
+  const auto response = this->RunAngleStep(0.2f, 0.02f);
+
+  EXPECT_NEAR(response.final_value, 0.2f, 0.002f);
+  EXPECT_NEAR(this->plant_.torque[control::ROLL_AXIS], -20.0f / SimulatedPlant::TORQUE_AUTHORITY_IN_RAD_PER_S2, 1e-3f);
+}
+
+TYPED_TEST(AttitudeControllerTests, yaw_turns_the_short_way_around) {
+  types::ThrustAndTorque demand{};
+
+  EXPECT_EQ(this->controller_.Update(types::EulerAngles{0.0f, 0.0f, 3.0f}, types::EulerAngles{0.0f, 0.0f, -3.0f}, types::EuclideanVector<float>(0.0f, 0.0f, 0.0f), THRUST, demand),
+            types::DriverStatus::OK);
+
+  EXPECT_LT(this->controller_.GetRateSetpoint().z, 0.0f);
+  EXPECT_LT(demand.yaw, 0.0f);
+}
+
+TYPED_TEST(AttitudeControllerTests, invalid_input_is_rejected_and_changes_nothing) {
+  const auto not_a_number = std::numeric_limits<float>::quiet_NaN();
+  const types::EuclideanVector<float> rate(0.0f, 0.0f, 0.0f);
+  types::ThrustAndTorque demand{0.1f, 0.2f, 0.3f, 0.4f};
+
+  EXPECT_EQ(this->controller_.Update(types::EulerAngles{not_a_number, 0.0f, 0.0f}, types::EulerAngles{0.0f, 0.0f, 0.0f}, rate, THRUST, demand), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(this->controller_.Update(types::EulerAngles{0.0f, 0.0f, 0.0f}, types::EulerAngles{0.0f, 0.0f, 0.0f}, rate, 1.5f, demand), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(this->controller_.UpdateRate(rate, types::EuclideanVector<float>(0.0f, std::numeric_limits<float>::infinity(), 0.0f), THRUST, demand), types::DriverStatus::INPUT_ERROR);
+
+  EXPECT_FLOAT_EQ(demand.thrust, 0.1f);
+  EXPECT_FLOAT_EQ(demand.roll, 0.2f);
+  EXPECT_FLOAT_EQ(demand.pitch, 0.3f);
+  EXPECT_FLOAT_EQ(demand.yaw, 0.4f);
+}
+
+TEST(AttitudeControllerBackendTests, fixed_point_follows_the_float_controller) {
+  control::AttitudeController float_controller(GAINS, SAMPLE_FREQUENCY_IN_HZ);
+  control::AttitudeControllerFixedPoint fixed_point_controller(GAINS, SAMPLE_FREQUENCY_IN_HZ);
+  SimulatedPlant plant;
+
+  float largest_difference = 0.0f;
+  for (std::uint32_t sample = 0; sample < SAMPLE_FREQUENCY_IN_HZ; sample++) {
+    const types::EulerAngles setpoint{0.3f, -0.2f, 0.5f};
+    types::ThrustAndTorque float_demand{};
+    types::ThrustAndTorque fixed_point_demand{};
+    ASSERT_EQ(float_controller.Update(setpoint, plant.GetAttitude(), plant.GetRate(), THRUST, float_demand), types::DriverStatus::OK);
+    ASSERT_EQ(fixed_point_controller.Update(setpoint, plant.GetAttitude(), plant.GetRate(), THRUST, fixed_point_demand), types::DriverStatus::OK);
+    largest_difference = std::fmax(largest_difference, std::fabs(float_demand.roll - fixed_point_demand.roll));
+    largest_difference = std::fmax(largest_difference, std::fabs(float_demand.pitch - fixed_point_demand.pitch));
+    largest_difference = std::fmax(largest_difference, std::fabs(float_demand.yaw - fixed_point_demand.yaw));
+    plant.Step(float_demand);
+  }
+
+  EXPECT_LT(largest_difference, 2e-3f);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
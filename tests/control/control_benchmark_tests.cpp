@@ -0,0 +1,114 @@
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "attitude_controller.hpp"
+#include "gtest/gtest.h"
+#include "motor_mixer.hpp"
+
+namespace {
+
+/// Every feature of the loops is active, so the benchmark covers the longest path
+constexpr control::PidGains ANGLE_GAINS{8.0f, 0.5f, 0.0f, 0.0f, 0.0f, 1.0f, 8.0f, control::FLAT_GAIN_SCHEDULE};
+constexpr control::PidGains RATE_GAINS{0.25f, 1.0f, 0.005f, 0.05f, 100.0f, 0.3f, 1.0f, control::GainSchedule{{1.0f, 1.0f, 0.9f, 0.8f, 0.7f}}};
+constexpr control::AttitudeGains ATTITUDE_GAINS{{{ANGLE_GAINS, RATE_GAINS}, {ANGLE_GAINS, RATE_GAINS}, {ANGLE_GAINS, RATE_GAINS}}};
+constexpr std::uint32_t ATTITUDE_LOOP_FREQUENCY_IN_HZ = 4000;
+
+/**
+ * Measures the host time of one Mix with and without airmode on random demands, and of one
+ * loop of the cascaded attitude controller with either backend on random attitudes.
+ * The times compare the variants on the build machine only, they are no cycle count of the target.
+ */
+class ControlBenchmarkTests : public ::testing::Test {
+ protected:
+  static constexpr int MIXES = 1000000;
+
+  void SetUp() override {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> thrust(0.0f, 1.0f);
+    std::uniform_real_distribution<float> torque(-1.0f, 1.0f);
+    demands_.reserve(MIXES);
+    for (int mix = 0; mix < MIXES; mix++)
+      demands_.push_back(types::ThrustAndTorque{thrust(generator), torque(generator), torque(generator), torque(generator)});
+  }
+
+  auto MeasureMixInNanoSeconds(const control::MotorMixer& mixer) -> double {
+    std::array<float, control::NUMBER_OF_MOTORS> throttle{};
+    float checksum = 0.0f;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& demand : demands_) {
+      mixer.Mix(demand, throttle);
+      checksum += throttle[0];
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    // Keeps the compiler from dropping the loop
+    EXPECT_GE(checksum, 0.0f);
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / MIXES;
+  }
+
+  template <typename CONTROLLER>
+  auto MeasureAttitudeLoopInNanoSeconds(CONTROLLER& controller) -> double {
+    const types::EulerAngles setpoint{0.1f, -0.1f, 0.5f};
+    types::ThrustAndTorque demand{};
+    float checksum = 0.0f;
+
+    const auto start = std::chrono::steady_clock::now();
+    for (const auto& sample : demands_) {
+      const types::EulerAngles attitude{sample.roll, sample.pitch, sample.yaw};
+      const types::EuclideanVector<float> rate(sample.pitch, sample.yaw, sample.roll);
+      controller.Update(setpoint, attitude, rate, sample.thrust, demand);
+      checksum += demand.roll;
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    // Keeps the compiler from dropping the loop
+    EXPECT_TRUE(std::isfinite(checksum));
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / MIXES;
+  }
+
+  auto Report(const std::string& name, const double value, const std::string& unit) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << value << " " << unit << std::endl;
+    RecordProperty(name, std::to_string(value));
+  }
+
+  std::vector<types::ThrustAndTorque> demands_;
+};
+
+TEST_F(ControlBenchmarkTests, mix_time_with_and_without_airmode) {
+  const control::MotorMixer airmode_mixer(control::QUAD_X_MIXING, true);
+  const control::MotorMixer clipping_mixer(control::QUAD_X_MIXING, false);
+
+  const auto airmode_latency = MeasureMixInNanoSeconds(airmode_mixer);
+  const auto clipping_latency = MeasureMixInNanoSeconds(clipping_mixer);
+
+  Report("motor_mixer_airmode", airmode_latency, "ns per mix");
+  Report("motor_mixer_clipping", clipping_latency, "ns per mix");
+
+  EXPECT_GT(airmode_latency, 0.0);
+  EXPECT_GT(clipping_latency, 0.0);
+}
+
+TEST_F(ControlBenchmarkTests, attitude_loop_time_of_float_and_fixed_point_backend) {
+  control::AttitudeController float_controller(ATTITUDE_GAINS, ATTITUDE_LOOP_FREQUENCY_IN_HZ);
+  control::AttitudeControllerFixedPoint fixed_point_controller(ATTITUDE_GAINS, ATTITUDE_LOOP_FREQUENCY_IN_HZ);
+
+  const auto float_latency = MeasureAttitudeLoopInNanoSeconds(float_controller);
+  const auto fixed_point_latency = MeasureAttitudeLoopInNanoSeconds(fixed_point_controller);
+
+  Report("attitude_controller_float", float_latency, "ns per loop");
+  Report("attitude_controller_fixed_point", fixed_point_latency, "ns per loop");
+
+  EXPECT_GT(float_latency, 0.0);
+  EXPECT_GT(fixed_point_latency, 0.0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
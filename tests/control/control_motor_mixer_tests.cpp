@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <array>
+#include <limits>
+#include "gtest/gtest.h"
+#include "motor_mixer.hpp"
+
+namespace {
+
+class MotorMixerTests : public ::testing::Test {
+ protected:
+  static constexpr float TOLERANCE = 1e-4f;
+
+  auto ExpectThrottles(const std::array<float, control::NUMBER_OF_MOTORS>& expected) -> void {
+    for (std::uint8_t motor = 0; motor < control::NUMBER_OF_MOTORS; motor++)
+      EXPECT_NEAR(throttle_[motor], expected[motor], TOLERANCE) << "motor " << static_cast<int>(motor);
+  }
+
+  std::array<float, control::NUMBER_OF_MOTORS> throttle_{};
+};
+
+TEST_F(MotorMixerTests, hover_without_torque_gives_every_motor_the_thrust) {
+  control::MotorMixer unit_under_test;
+
+  EXPECT_EQ(unit_under_test.Mix(types::ThrustAndTorque{0.5f, 0.0f, 0.0f, 0.0f}, throttle_), types::DriverStatus::OK);
+
+  ExpectThrottles({50.0f, 50.0f, 50.0f, 50.0f});
+}
+
+TEST_F(MotorMixerTests, quad_x_roll_pitch_and_yaw_raise_the_right_motors) {
+  control::MotorMixer unit_under_test;
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.5f, 0.1f, 0.0f, 0.0f}, throttle_);
+  ExpectThrottles({60.0f, 40.0f, 40.0f, 60.0f});
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.5f, 0.0f, 0.1f, 0.0f}, throttle_);
+  ExpectThrottles({60.0f, 60.0f, 40.0f, 40.0f});
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.5f, 0.0f, 0.0f, 0.1f}, throttle_);
+  ExpectThrottles({40.0f, 60.0f, 40.0f, 60.0f});
+}
+
+TEST_F(MotorMixerTests, quad_plus_pitch_uses_front_and_rear_motor_only) {
+  control::MotorMixer unit_under_test(control::QUAD_PLUS_MIXING);
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.5f, 0.0f, 0.2f, 0.0f}, throttle_);
+  ExpectThrottles({70.0f, 50.0f, 30.0f, 50.0f});
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.5f, 0.2f, 0.0f, 0.0f}, throttle_);
+  ExpectThrottles({50.0f, 30.0f, 50.0f, 70.0f});
+}
+
+TEST_F(MotorMixerTests, airmode_keeps_the_torque_at_zero_thrust) {
+  control::MotorMixer unit_under_test;
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.0f, 0.2f, 0.0f, 0.0f}, throttle_);
+
+  ExpectThrottles({40.0f, 0.0f, 0.0f, 40.0f});
+}
+
+TEST_F(MotorMixerTests, airmode_keeps_the_torque_at_full_thrust) {
+  control::MotorMixer unit_under_test;
+
+  unit_under_test.Mix(types::ThrustAndTorque{1.0f, 0.2f, 0.0f, 0.0f}, throttle_);
+
+  ExpectThrottles({100.0f, 60.0f, 60.0f, 100.0f});
+}
+
+TEST_F(MotorMixerTests, airmode_scales_oversaturated_torques_and_keeps_their_ratio) {
+  control::MotorMixer unit_under_test;
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.8f, 1.0f, 0.5f, 0.0f}, throttle_);
+
+  // Torques 1.5, -0.5, -1.5, 0.5 span 3, so they are scaled by a third around a thrust of 0.5
+  ExpectThrottles({100.0f, 33.3333f, 0.0f, 66.6667f});
+}
+
+TEST_F(MotorMixerTests, without_airmode_every_motor_is_clipped) {
+  control::MotorMixer unit_under_test(control::QUAD_X_MIXING, false);
+
+  unit_under_test.Mix(types::ThrustAndTorque{0.0f, 0.2f, 0.0f, 0.0f}, throttle_);
+  ExpectThrottles({20.0f, 0.0f, 0.0f, 20.0f});
+
+  unit_under_test.Mix(types::ThrustAndTorque{1.0f, 0.2f, 0.0f, 0.0f}, throttle_);
+  ExpectThrottles({100.0f, 80.0f, 80.0f, 100.0f});
+}
+
+TEST_F(MotorMixerTests, airmode_can_be_switched) {
+  control::MotorMixer unit_under_test;
+  EXPECT_TRUE(unit_under_test.IsAirmode());
+
+  unit_under_test.SetAirmode(false);
+
+  EXPECT_FALSE(unit_under_test.IsAirmode());
+  unit_under_test.Mix(types::ThrustAndTorque{0.0f, 0.2f, 0.0f, 0.0f}, throttle_);
+  ExpectThrottles({20.0f, 0.0f, 0.0f, 20.0f});
+}
+
+TEST_F(MotorMixerTests, demand_out_of_range_is_rejected_and_keeps_the_throttles) {
+  control::MotorMixer unit_under_test;
+  const std::array<float, control::NUMBER_OF_MOTORS> previous{11.0f, 12.0f, 13.0f, 14.0f};
+  const auto not_a_number = std::numeric_limits<float>::quiet_NaN();
+  const types::ThrustAndTorque invalid_demands[] = {
+      {-0.1f, 0.0f, 0.0f, 0.0f},
+      {1.1f, 0.0f, 0.0f, 0.0f},
+      {0.5f, 1.1f, 0.0f, 0.0f},
+      {0.5f, 0.0f, -1.1f, 0.0f},
+      {0.5f, 0.0f, 0.0f, 1.1f},
+      {not_a_number, 0.0f, 0.0f, 0.0f},
+      {0.5f, 0.0f, 0.0f, not_a_number}};
+
+  for (const auto& demand : invalid_demands) {
+    throttle_ = previous;
+    EXPECT_EQ(unit_under_test.Mix(demand, throttle_), types::DriverStatus::INPUT_ERROR);
+    ExpectThrottles(previous);
+  }
+}
+
+TEST_F(MotorMixerTests, sweep_stays_in_range_and_keeps_the_torque_differences_while_they_fit) {
+  control::MotorMixer unit_under_test;
+  constexpr int STEPS = 8;
+
+  for (int thrust_step = 0; thrust_step <= STEPS; thrust_step++) {
+    for (int roll_step = -STEPS; roll_step <= STEPS; roll_step++) {
+      for (int pitch_step = -STEPS; pitch_step <= STEPS; pitch_step++) {
+        for (int yaw_step = -STEPS; yaw_step <= STEPS; yaw_step++) {
+          const types::ThrustAndTorque demand{static_cast<float>(thrust_step) / STEPS,
+                                              static_cast<float>(roll_step) / STEPS,
+                                              static_cast<float>(pitch_step) / STEPS,
+                                              static_cast<float>(yaw_step) / STEPS};
+          ASSERT_EQ(unit_under_test.Mix(demand, throttle_), types::DriverStatus::OK);
+
+          std::array<float, control::NUMBER_OF_MOTORS> torque{};
+          for (std::uint8_t motor = 0; motor < control::NUMBER_OF_MOTORS; motor++) {
+            const auto& row = control::QUAD_X_MIXING[motor];
+            torque[motor] = row.roll * demand.roll + row.pitch * demand.pitch + row.yaw * demand.yaw;
+            ASSERT_GE(throttle_[motor], 0.0f);
+            ASSERT_LE(throttle_[motor], 100.0f);
+          }
+
+          const auto span = *std::max_element(torque.cbegin(), torque.cend()) - *std::min_element(torque.cbegin(), torque.cend());
+          if (span > 1.0f)
+            continue;
+
+          for (std::uint8_t motor = 1; motor < control::NUMBER_OF_MOTORS; motor++)
+            ASSERT_NEAR(throttle_[motor] - throttle_[0], 100.0f * (torque[motor] - torque[0]), 1e-3f);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,163 @@
+#include <cmath>
+#include <cstdint>
+#include "gtest/gtest.h"
+#include "pid_controller.hpp"
+#include "pid_controller_fixed_point.hpp"
+
+namespace {
+
+constexpr std::uint32_t SAMPLE_FREQUENCY_IN_HZ = 4000;
+/// Covers the rounding of Q16
+constexpr float TOLERANCE = 1e-4f;
+
+auto MakeGains(const float proportional, const float integral, const float derivative, const float feed_forward = 0.0f, const float derivative_cutoff_in_hz = 0.0f) -> control::PidGains {
+  return control::PidGains{proportional, integral, derivative, feed_forward, derivative_cutoff_in_hz, 10.0f, 10.0f, control::FLAT_GAIN_SCHEDULE};
+}
+
+template <class T>
+class PidControllerTests : public ::testing::Test {};
+
+using Controllers = ::testing::Types<control::PidController, control::PidControllerFixedPoint>;
+TYPED_TEST_CASE(PidControllerTests, Controllers);
+
+TYPED_TEST(PidControllerTests, proportional_output_is_gain_times_error) {
+  TypeParam pid(MakeGains(2.0f, 0.0f, 0.0f), SAMPLE_FREQUENCY_IN_HZ);
+
+  EXPECT_NEAR(pid.Update(1.0f, 0.75f, 0.5f), 0.5f, TOLERANCE);
+  EXPECT_NEAR(pid.Update(-1.0f, 0.0f, 0.5f), -2.0f, TOLERANCE);
+}
+
+TYPED_TEST(PidControllerTests, setpoint_step_does_not_kick_the_derivative) {
+  TypeParam pid(MakeGains(0.0f, 0.0f, 0.01f), SAMPLE_FREQUENCY_IN_HZ);
+
+  EXPECT_EQ(pid.Update(0.0f, 0.0f, 0.5f), 0.0f);
+  EXPECT_EQ(pid.Update(1.0f, 0.0f, 0.5f), 0.0f);
+  EXPECT_EQ(pid.Update(-1.0f, 0.0f, 0.5f), 0.0f);
+}
+
+TYPED_TEST(PidControllerTests, derivative_opposes_the_change_of_the_measurement) {
+  TypeParam pid(MakeGains(0.0f, 0.0f, 0.001f), SAMPLE_FREQUENCY_IN_HZ);
+
+  // The first sample has no previous measurement, so it has no derivative either
+  EXPECT_EQ(pid.Update(0.0f, 0.0f, 0.5f), 0.0f);
+  EXPECT_NEAR(pid.Update(0.0f, 0.001f, 0.5f), -0.001f * 0.001f * SAMPLE_FREQUENCY_IN_HZ, TOLERANCE);
+}
+
+TYPED_TEST(PidControllerTests, derivative_low_pass_attenuates_noise) {
+  TypeParam unfiltered(MakeGains(0.0f, 0.0f, 0.001f), SAMPLE_FREQUENCY_IN_HZ);
+  TypeParam filtered(MakeGains(0.0f, 0.0f, 0.001f, 0.0f, 50.0f), SAMPLE_FREQUENCY_IN_HZ);
+
+  float largest_unfiltered = 0.0f;
+  float largest_filtered = 0.0f;
+  for (int sample = 0; sample < 400; sample++) {
+    const auto noise = (sample % 2 == 0) ? 0.01f : -0.01f;
+    largest_unfiltered = std::fmax(largest_unfiltered, std::fabs(unfiltered.Update(0.0f, noise, 0.5f)));
+    if (sample >= 200)
+      largest_filtered = std::fmax(largest_filtered, std::fabs(filtered.Update(0.0f, noise, 0.5f)));
+    else
+      filtered.Update(0.0f, noise, 0.5f);
+  }
+
+  EXPECT_LT(largest_filtered, 0.1f * largest_unfiltered);
+}
+
+TYPED_TEST(PidControllerTests, integral_accumulates_the_error_over_time) {
+  TypeParam pid(MakeGains(0.0f, 2.0f, 0.0f), SAMPLE_FREQUENCY_IN_HZ);
+
+  for (std::uint32_t sample = 0; sample < SAMPLE_FREQUENCY_IN_HZ; sample++)
+    pid.Update(0.5f, 0.0f, 0.5f);
+
+  EXPECT_NEAR(pid.GetIntegral(), 1.0f, 1e-3f);
+  EXPECT_NEAR(pid.Update(0.0f, 0.0f, 0.5f), 1.0f, 1e-3f);
+}
+
+TYPED_TEST(PidControllerTests, integral_is_clamped_to_its_limit) {
+  auto gains = MakeGains(0.0f, 10.0f, 0.0f);
+  gains.integral_limit = 0.3f;
+  TypeParam pid(gains, SAMPLE_FREQUENCY_IN_HZ);
+
+  for (std::uint32_t sample = 0; sample < SAMPLE_FREQUENCY_IN_HZ; sample++)
+    pid.Update(1.0f, 0.0f, 0.5f);
+
+  EXPECT_NEAR(pid.GetIntegral(), 0.3f, TOLERANCE);
+}
+
+TYPED_TEST(PidControllerTests, saturated_output_stops_the_integration_into_the_saturation) {
+  auto gains = MakeGains(1.0f, 10.0f, 0.0f);
+  gains.output_limit = 0.5f;
+  TypeParam pid(gains, SAMPLE_FREQUENCY_IN_HZ);
+
+  for (std::uint32_t sample = 0; sample < SAMPLE_FREQUENCY_IN_HZ; sample++)
+    EXPECT_NEAR(pid.Update(2.0f, 0.0f, 0.5f), 0.5f, TOLERANCE);
+
+  // Only the first sample integrated, so the output follows a reversed error at once
+  EXPECT_NEAR(pid.GetIntegral(), 10.0f * 2.0f / SAMPLE_FREQUENCY_IN_HZ, TOLERANCE);
+  EXPECT_LT(pid.Update(-0.1f, 0.0f, 0.5f), 0.0f);
+}
+
+TYPED_TEST(PidControllerTests, feed_forward_passes_the_setpoint) {
+  TypeParam pid(MakeGains(1.0f, 0.0f, 0.0f, 0.5f), SAMPLE_FREQUENCY_IN_HZ);
+
+  EXPECT_NEAR(pid.Update(0.6f, 0.6f, 0.5f), 0.3f, TOLERANCE);
+}
+
+TYPED_TEST(PidControllerTests, gain_schedule_scales_proportional_and_derivative_with_the_thrust) {
+  auto gains = MakeGains(1.0f, 0.0f, 0.001f);
+  gains.schedule = control::GainSchedule{{1.0f, 1.0f, 1.0f, 0.75f, 0.5f}};
+  TypeParam pid(gains, SAMPLE_FREQUENCY_IN_HZ);
+
+  EXPECT_NEAR(pid.Update(1.0f, 0.0f, 0.5f), 1.0f, TOLERANCE);
+  EXPECT_NEAR(pid.Update(1.0f, 0.0f, 1.0f), 0.5f, TOLERANCE);
+  EXPECT_NEAR(pid.Update(1.0f, 0.0f, 0.875f), 0.625f, TOLERANCE);
+  // The derivative of the change to 0.001 is -0.004 at full gain
+  EXPECT_NEAR(pid.Update(0.001f, 0.001f, 1.0f), -0.002f, TOLERANCE);
+  // Thrust out of range takes the nearest end of the schedule
+  EXPECT_NEAR(pid.Update(1.0f, 0.001f, 2.0f), 0.4995f, TOLERANCE);
+}
+
+TYPED_TEST(PidControllerTests, output_is_clamped_to_its_limit) {
+  auto gains = MakeGains(100.0f, 0.0f, 0.0f);
+  gains.output_limit = 1.0f;
+  TypeParam pid(gains, SAMPLE_FREQUENCY_IN_HZ);
+
+  EXPECT_NEAR(pid.Update(1.0f, 0.0f, 0.5f), 1.0f, TOLERANCE);
+  EXPECT_NEAR(pid.Update(-1.0f, 0.0f, 0.5f), -1.0f, TOLERANCE);
+}
+
+TYPED_TEST(PidControllerTests, reset_clears_integral_and_derivative) {
+  TypeParam pid(MakeGains(0.0f, 2.0f, 0.001f), SAMPLE_FREQUENCY_IN_HZ);
+  pid.Update(1.0f, 0.0f, 0.5f);
+  pid.Update(1.0f, 0.5f, 0.5f);
+
+  pid.Reset();
+
+  EXPECT_EQ(pid.GetIntegral(), 0.0f);
+  EXPECT_NEAR(pid.Update(0.0f, 0.0f, 0.5f), 0.0f, TOLERANCE);
+}
+
+TEST(PidControllerFixedPointTests, outputs_match_the_bits_of_the_reference_build) {
+  // Every feature is active, the measurement is a deterministic pseudo random walk
+  control::PidGains gains{0.8f, 3.0f, 0.002f, 0.1f, 80.0f, 0.4f, 1.0f, control::GainSchedule{{1.2f, 1.0f, 0.9f, 0.8f, 0.6f}}};
+  control::PidControllerFixedPoint pid(gains, SAMPLE_FREQUENCY_IN_HZ);
+  std::uint32_t random = 12345;
+  std::int32_t measurement_q16 = 0;
+  std::uint32_t checksum = 2166136261u;
+
+  for (std::int32_t sample = 0; sample < 10000; sample++) {
+    random = random * 1664525u + 1013904223u;
+    measurement_q16 += static_cast<std::int32_t>(random >> 24) - 128;
+    const std::int32_t setpoint_q16 = (sample / 1000 % 2 == 0) ? 32768 : -32768;
+    const auto output_q16 = pid.UpdateFixedPoint(setpoint_q16, measurement_q16, sample * 6);
+    checksum = (checksum ^ static_cast<std::uint32_t>(output_q16)) * 16777619u;
+  }
+
+  // FNV-1a of the outputs computed by the reference build, the target has to compute the same bits
+  EXPECT_EQ(checksum, 2791434557u);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
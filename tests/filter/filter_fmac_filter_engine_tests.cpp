@@ -0,0 +1,215 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "filter_design.hpp"
+#include "fmac_filter_engine.hpp"
+#include "imu_filter_pipeline.hpp"
+#include "software_filter_engine.hpp"
+
+namespace {
+
+class FmacFilterEngineTests : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    MX_FMAC_Init();
+  }
+
+  static auto RandomSamples(const std::size_t length, const unsigned int seed) -> std::vector<std::int16_t> {
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> distribution(-32768, 32767);
+    std::vector<std::int16_t> samples(length);
+    for (auto& sample : samples)
+      sample = static_cast<std::int16_t>(distribution(generator));
+    return samples;
+  }
+
+  /// Runs the same stream through both engines in blocks of the given lengths and expects identical samples
+  auto ExpectSampleExactAgreement(const filter::FilterCoefficients& coefficients, const std::vector<std::int16_t>& input, const std::vector<std::uint16_t>& block_lengths) -> void {
+    filter::FilterState fmac_state;
+    filter::FilterState software_state;
+    std::vector<std::int16_t> fmac_output(input.size());
+    std::vector<std::int16_t> software_output(input.size());
+
+    std::size_t offset = 0;
+    for (std::size_t block = 0; offset < input.size(); block++) {
+      const auto length = static_cast<std::uint16_t>(std::min<std::size_t>(block_lengths[block % block_lengths.size()], input.size() - offset));
+      ASSERT_EQ(fmac_engine_.Filter(coefficients, fmac_state, &input[offset], &fmac_output[offset], length), types::DriverStatus::OK);
+      ASSERT_EQ(software_engine_.Filter(coefficients, software_state, &input[offset], &software_output[offset], length), types::DriverStatus::OK);
+      offset += length;
+    }
+
+    EXPECT_EQ(fmac_output, software_output);
+  }
+
+  /// Runs the stream sample by sample through both engines and compares each with the reference
+  auto ExpectReference(const filter::FilterCoefficients& coefficients, const std::vector<std::int16_t>& input, const std::vector<std::int16_t>& reference) -> void {
+    filter::FilterState fmac_state;
+    filter::FilterState software_state;
+    std::vector<std::int16_t> fmac_output(input.size());
+    std::vector<std::int16_t> software_output(input.size());
+
+    for (std::size_t sample = 0; sample < input.size(); sample++) {
+      ASSERT_EQ(fmac_engine_.Filter(coefficients, fmac_state, &input[sample], &fmac_output[sample], 1), types::DriverStatus::OK);
+      ASSERT_EQ(software_engine_.Filter(coefficients, software_state, &input[sample], &software_output[sample], 1), types::DriverStatus::OK);
+    }
+
+    EXPECT_EQ(fmac_output, reference);
+    EXPECT_EQ(software_output, reference);
+  }
+
+  filter::FmacFilterEngine fmac_engine_;
+  filter::SoftwareFilterEngine software_engine_;
+};
+
+TEST_F(FmacFilterEngineTests, biquad_agrees_sample_exact_with_the_software_engine) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassBiquad(90.0f, 1000.0f, coefficients), types::DriverStatus::OK);
+
+  ExpectSampleExactAgreement(coefficients, RandomSamples(1000, 1), {64, 1, 17, 3, 64});
+}
+
+TEST_F(FmacFilterEngineTests, fir_agrees_sample_exact_with_the_software_engine) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassFir(120.0f, 1000.0f, 16, coefficients), types::DriverStatus::OK);
+
+  ExpectSampleExactAgreement(coefficients, RandomSamples(1000, 2), {5, 64, 2, 33});
+}
+
+TEST_F(FmacFilterEngineTests, wrapping_accumulator_agrees_with_the_software_engine) {
+  filter::FilterCoefficients coefficients;
+  coefficients.structure = filter::FilterStructure::IIR_DIRECT_FORM_1;
+  coefficients.feedforward_taps = 8;
+  coefficients.feedforward = {32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768};
+  coefficients.feedback_taps = 3;
+  coefficients.feedback = {32767, -32768, 32767};
+  coefficients.gain_shift = 7;
+
+  ExpectSampleExactAgreement(coefficients, RandomSamples(500, 3), {7, 64});
+}
+
+/*
+ * The expected samples below are worked out by hand from the FMAC description in RM0440
+ * (q3.22 products, floor truncation, 2^R gain, saturation to q1.15), so they do not depend
+ * on the simulated FMAC of the tests, which shares the arithmetic of the software engine.
+ */
+TEST_F(FmacFilterEngineTests, fir_matches_hand_computed_reference) {
+  filter::FilterCoefficients coefficients;
+  coefficients.feedforward_taps = 2;
+  coefficients.feedforward = {16384, -8192};
+
+  // e.g. y[3] = (floor(-16384 / 2^8) + floor(-8192000 / 2^8)) / 2^7 = -32064 / 128 = -250.5, truncated to -251
+  ExpectReference(coefficients, {32767, -32768, 1000, -1, 3}, {16383, -24576, 8692, -251, 1});
+}
+
+TEST_F(FmacFilterEngineTests, gain_shift_saturates_to_the_reference) {
+  filter::FilterCoefficients coefficients;
+  coefficients.feedforward_taps = 1;
+  coefficients.feedforward = {32767};
+  coefficients.gain_shift = 1;
+
+  ExpectReference(coefficients, {20000, -20000, 100}, {32767, -32768, 199});
+}
+
+TEST_F(FmacFilterEngineTests, iir_matches_hand_computed_reference) {
+  filter::FilterCoefficients coefficients;
+  coefficients.structure = filter::FilterStructure::IIR_DIRECT_FORM_1;
+  coefficients.feedforward_taps = 2;
+  coefficients.feedforward = {16384, 0};
+  coefficients.feedback_taps = 1;
+  coefficients.feedback = {16384};
+
+  // Impulse response halves with every sample, the truncation rounds every .5 down
+  ExpectReference(coefficients, {32767, 0, 0, 0}, {16383, 8191, 4095, 2047});
+}
+
+TEST_F(FmacFilterEngineTests, fmac_is_stopped_after_a_failed_block) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassBiquad(90.0f, 1000.0f, coefficients), types::DriverStatus::OK);
+  filter::FilterState state;
+  std::int16_t samples[4] = {1, 2, 3, 4};
+
+  MockFmacFailNextPoll(HAL_TIMEOUT);
+  EXPECT_EQ(fmac_engine_.Filter(coefficients, state, samples, samples, 4), types::DriverStatus::TIMEOUT);
+  EXPECT_EQ(MockFmacIsRunning(), 0);
+  EXPECT_EQ(state.inputs[0], 0);
+
+  EXPECT_EQ(fmac_engine_.Filter(coefficients, state, samples, samples, 4), types::DriverStatus::OK);
+}
+
+TEST_F(FmacFilterEngineTests, pipeline_keeps_an_own_history_per_channel) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassBiquad(50.0f, 1000.0f, coefficients), types::DriverStatus::OK);
+
+  filter::ImuFilterPipeline pipeline{fmac_engine_};
+  ASSERT_EQ(pipeline.SetGyroscopeFilter(coefficients), types::DriverStatus::OK);
+
+  constexpr std::uint16_t BLOCK_LENGTH = 10;
+  filter::FilterState state_x;
+  filter::FilterState state_z;
+  for (int block = 0; block < 10; block++) {
+    types::EuclideanVector<std::int16_t> gyroscope[BLOCK_LENGTH];
+    types::EuclideanVector<std::int16_t> accelerometer[BLOCK_LENGTH];
+    std::int16_t input_x[BLOCK_LENGTH];
+    std::int16_t input_z[BLOCK_LENGTH];
+    for (std::uint16_t sample = 0; sample < BLOCK_LENGTH; sample++) {
+      input_x[sample] = static_cast<std::int16_t>(1000 + 10 * sample);
+      input_z[sample] = static_cast<std::int16_t>(-3000 - sample);
+      gyroscope[sample].x = input_x[sample];
+      gyroscope[sample].y = 0;
+      gyroscope[sample].z = input_z[sample];
+      accelerometer[sample].x = 5;
+      accelerometer[sample].y = 6;
+      accelerometer[sample].z = 7;
+    }
+    ASSERT_EQ(pipeline.Filter(gyroscope, accelerometer, BLOCK_LENGTH), types::DriverStatus::OK);
+
+    std::int16_t expected_x[BLOCK_LENGTH];
+    std::int16_t expected_z[BLOCK_LENGTH];
+    software_engine_.Filter(coefficients, state_x, input_x, expected_x, BLOCK_LENGTH);
+    software_engine_.Filter(coefficients, state_z, input_z, expected_z, BLOCK_LENGTH);
+
+    for (std::uint16_t sample = 0; sample < BLOCK_LENGTH; sample++) {
+      EXPECT_EQ(gyroscope[sample].x, expected_x[sample]);
+      EXPECT_EQ(gyroscope[sample].y, 0);
+      EXPECT_EQ(gyroscope[sample].z, expected_z[sample]);
+      EXPECT_EQ(accelerometer[sample].x, 5);
+      EXPECT_EQ(accelerometer[sample].z, 7);
+    }
+  }
+}
+
+TEST_F(FmacFilterEngineTests, pipeline_configures_the_fmac_once_per_channel_and_block) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassBiquad(50.0f, 1000.0f, coefficients), types::DriverStatus::OK);
+
+  filter::ImuFilterPipeline pipeline{fmac_engine_};
+  ASSERT_EQ(pipeline.SetGyroscopeFilter(coefficients), types::DriverStatus::OK);
+  ASSERT_EQ(pipeline.SetAccelerometerFilter(coefficients), types::DriverStatus::OK);
+
+  types::EuclideanVector<std::int16_t> gyroscope[filter::FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH];
+  types::EuclideanVector<std::int16_t> accelerometer[filter::FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH];
+  for (auto& sample : gyroscope)
+    sample.x = sample.y = sample.z = 100;
+  for (auto& sample : accelerometer)
+    sample.x = sample.y = sample.z = -100;
+
+  const auto config_count = MockFmacGetConfigCount();
+  ASSERT_EQ(pipeline.Filter(gyroscope, accelerometer, filter::FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH), types::DriverStatus::OK);
+  EXPECT_EQ(MockFmacGetConfigCount() - config_count, filter::ImuFilterPipeline::NUMBER_OF_CHANNELS);
+
+  EXPECT_EQ(pipeline.Filter(gyroscope, accelerometer, filter::FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH + 1), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(FmacFilterEngineTests, pipeline_rejects_invalid_coefficients) {
+  filter::ImuFilterPipeline pipeline{fmac_engine_};
+  filter::FilterCoefficients coefficients;
+
+  EXPECT_EQ(pipeline.SetFilter(filter::ImuChannel::ACCELEROMETER_Y, coefficients), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(pipeline.SetAccelerometerFilter(coefficients), types::DriverStatus::INPUT_ERROR);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
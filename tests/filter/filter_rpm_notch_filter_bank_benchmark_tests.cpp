@@ -0,0 +1,77 @@
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "rpm_notch_filter_bank.hpp"
+
+namespace {
+
+/**
+ * Measures the cost of the RPM notch filter bank per control loop on the host:
+ * moving all notches to new motor frequencies and filtering one gyroscope sample.
+ * The numbers only compare the two parts, the Cortex-M4 float unit has to be measured on target.
+ */
+class RpmNotchFilterBankBenchmarkTests : public ::testing::Test {
+ protected:
+  static constexpr float SAMPLE_FREQUENCY_IN_HZ = 4000.0f;
+  static constexpr int LOOPS = 20000;
+  static constexpr int MOTOR_FREQUENCY_SETS = 400;
+
+  void SetUp() override {
+    for (int set = 0; set < MOTOR_FREQUENCY_SETS; set++) {
+      const auto sweep = static_cast<float>(set);
+      motor_frequencies_[set] = {150.0f + sweep, 170.0f + sweep, 190.0f + sweep, 210.0f + sweep};
+    }
+  }
+
+  template <typename Function>
+  auto MeasureInNanoSecondsPerLoop(Function function) -> double {
+    const auto start = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < LOOPS; loop++)
+      function(loop);
+    const auto stop = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / LOOPS;
+  }
+
+  auto Report(const std::string& name, const double latency_in_ns) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << latency_in_ns << " ns per loop" << std::endl;
+    RecordProperty(name, std::to_string(latency_in_ns));
+  }
+
+  filter::RpmNotchFilterBank bank_{SAMPLE_FREQUENCY_IN_HZ};
+  std::array<std::array<float, filter::RPM_NOTCH_MOTORS>, MOTOR_FREQUENCY_SETS> motor_frequencies_{};
+  volatile float sink_ = 0.0f;
+};
+
+TEST_F(RpmNotchFilterBankBenchmarkTests, update_versus_apply_per_control_loop) {
+  const auto update = MeasureInNanoSecondsPerLoop([&](const int loop) {
+    bank_.Update(motor_frequencies_[loop % MOTOR_FREQUENCY_SETS]);
+  });
+  const auto apply = MeasureInNanoSecondsPerLoop([&](const int loop) {
+    types::EuclideanVector<float> gyroscope(static_cast<float>(loop % 7), -1.0f, 0.5f);
+    bank_.Apply(gyroscope);
+    sink_ = gyroscope.x;
+  });
+  const auto both = MeasureInNanoSecondsPerLoop([&](const int loop) {
+    bank_.Update(motor_frequencies_[loop % MOTOR_FREQUENCY_SETS]);
+    types::EuclideanVector<float> gyroscope(static_cast<float>(loop % 7), -1.0f, 0.5f);
+    bank_.Apply(gyroscope);
+    sink_ = gyroscope.x;
+  });
+
+  Report("rpm_notch_update_12_notches", update);
+  Report("rpm_notch_apply_36_biquads", apply);
+  Report("rpm_notch_update_and_apply", both);
+
+  EXPECT_GT(both, 0.0);
+  EXPECT_TRUE(std::isfinite(sink_));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
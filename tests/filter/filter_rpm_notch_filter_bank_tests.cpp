@@ -0,0 +1,129 @@
+#include <array>
+#include <cmath>
+#include <limits>
+#include "gtest/gtest.h"
+#include "rpm_notch_filter_bank.hpp"
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+constexpr float SAMPLE_FREQUENCY_IN_HZ = 4000.0f;
+
+class RpmNotchFilterBankTests : public ::testing::Test {
+ protected:
+  /// Amplitude of a sine on the x axis after the bank, measured once the notches settled
+  auto GetAmplitude(const double frequency_in_hz) -> double {
+    constexpr int SETTLING_SAMPLES = 4000;
+    constexpr int MEASURED_SAMPLES = 4000;
+    bank_.Reset();
+
+    double largest_output = 0.0;
+    for (int sample = 0; sample < SETTLING_SAMPLES + MEASURED_SAMPLES; sample++) {
+      types::EuclideanVector<float> gyroscope(static_cast<float>(std::sin(2.0 * PI * frequency_in_hz * sample / SAMPLE_FREQUENCY_IN_HZ)), 0.0f, 0.0f);
+      bank_.Apply(gyroscope);
+      if (sample >= SETTLING_SAMPLES)
+        largest_output = std::fmax(largest_output, std::fabs(gyroscope.x));
+    }
+    return largest_output;
+  }
+
+  static auto IsPassthrough(const filter::BiquadCoefficients& coefficients) -> bool {
+    return coefficients.b0 == 1.0f && coefficients.b1 == 0.0f && coefficients.b2 == 0.0f && coefficients.a1 == 0.0f && coefficients.a2 == 0.0f;
+  }
+
+  filter::RpmNotchFilterBank bank_{SAMPLE_FREQUENCY_IN_HZ};
+};
+
+TEST_F(RpmNotchFilterBankTests, bank_passes_its_input_before_the_first_update) {
+  types::EuclideanVector<float> gyroscope(1.0f, -2.0f, 3.0f);
+
+  bank_.Apply(gyroscope);
+
+  EXPECT_FLOAT_EQ(gyroscope.x, 1.0f);
+  EXPECT_FLOAT_EQ(gyroscope.y, -2.0f);
+  EXPECT_FLOAT_EQ(gyroscope.z, 3.0f);
+}
+
+TEST_F(RpmNotchFilterBankTests, every_harmonic_of_every_motor_is_attenuated_by_more_than_20_db) {
+  const std::array<float, filter::RPM_NOTCH_MOTORS> motor_frequency_in_hz{150.0f, 170.0f, 190.0f, 210.0f};
+  ASSERT_EQ(bank_.Update(motor_frequency_in_hz), types::DriverStatus::OK);
+
+  for (const auto frequency : motor_frequency_in_hz)
+    for (int harmonic = 1; harmonic <= filter::RPM_NOTCH_HARMONICS; harmonic++)
+      EXPECT_LT(GetAmplitude(frequency * harmonic), 0.1) << frequency * harmonic;
+}
+
+TEST_F(RpmNotchFilterBankTests, frequencies_between_the_notches_pass) {
+  ASSERT_EQ(bank_.Update({300.0f, 300.0f, 300.0f, 300.0f}), types::DriverStatus::OK);
+
+  EXPECT_GT(GetAmplitude(20.0), 0.99);
+  EXPECT_GT(GetAmplitude(1800.0), 0.9);
+}
+
+TEST_F(RpmNotchFilterBankTests, axes_are_filtered_independently) {
+  ASSERT_EQ(bank_.Update({200.0f, 200.0f, 200.0f, 200.0f}), types::DriverStatus::OK);
+
+  double largest_y = 0.0;
+  for (int sample = 0; sample < 8000; sample++) {
+    const auto phase = 2.0 * PI * 200.0 * sample / SAMPLE_FREQUENCY_IN_HZ;
+    types::EuclideanVector<float> gyroscope(static_cast<float>(std::sin(phase)), 1.0f, 0.0f);
+    bank_.Apply(gyroscope);
+    if (sample >= 4000)
+      largest_y = std::fmax(largest_y, std::fabs(gyroscope.y - 1.0f));
+  }
+
+  EXPECT_LT(largest_y, 1e-3);
+}
+
+TEST_F(RpmNotchFilterBankTests, notches_follow_a_changing_motor_frequency) {
+  // The motors speed up from 150 Hz to 250 Hz within one second, the notches follow every sample
+  double phase = 0.0;
+  double largest_output = 0.0;
+  for (int sample = 0; sample < static_cast<int>(SAMPLE_FREQUENCY_IN_HZ); sample++) {
+    const auto frequency = 150.0f + 100.0f * static_cast<float>(sample) / SAMPLE_FREQUENCY_IN_HZ;
+    ASSERT_EQ(bank_.Update({frequency, frequency, frequency, frequency}), types::DriverStatus::OK);
+    phase += 2.0 * PI * frequency / SAMPLE_FREQUENCY_IN_HZ;
+
+    types::EuclideanVector<float> gyroscope(static_cast<float>(std::sin(phase)), 0.0f, 0.0f);
+    bank_.Apply(gyroscope);
+    if (sample >= 1000)
+      largest_output = std::fmax(largest_output, std::fabs(gyroscope.x));
+  }
+
+  EXPECT_LT(largest_output, 0.1);
+}
+
+TEST_F(RpmNotchFilterBankTests, slow_motors_keep_their_notches_at_the_minimum_frequency) {
+  ASSERT_EQ(bank_.Update({0.0f, 80.0f, 0.0f, 0.0f}), types::DriverStatus::OK);
+
+  const auto& stopped = bank_.GetCoefficients(0, 0);
+  const auto& minimum = bank_.GetCoefficients(1, 0);
+  EXPECT_FLOAT_EQ(stopped.b1, minimum.b1);
+  EXPECT_FLOAT_EQ(stopped.a2, minimum.a2);
+  EXPECT_LT(GetAmplitude(80.0), 0.1);
+}
+
+TEST_F(RpmNotchFilterBankTests, harmonics_close_to_the_nyquist_frequency_pass_their_input) {
+  ASSERT_EQ(bank_.Update({700.0f, 700.0f, 700.0f, 700.0f}), types::DriverStatus::OK);
+
+  EXPECT_FALSE(IsPassthrough(bank_.GetCoefficients(0, 0)));
+  EXPECT_FALSE(IsPassthrough(bank_.GetCoefficients(0, 1)));
+  EXPECT_TRUE(IsPassthrough(bank_.GetCoefficients(0, 2)));
+}
+
+TEST_F(RpmNotchFilterBankTests, invalid_frequencies_are_rejected) {
+  ASSERT_EQ(bank_.Update({200.0f, 200.0f, 200.0f, 200.0f}), types::DriverStatus::OK);
+  const auto b1 = bank_.GetCoefficients(2, 0).b1;
+
+  EXPECT_EQ(bank_.Update({200.0f, 200.0f, -1.0f, 200.0f}), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(bank_.Update({200.0f, 200.0f, std::numeric_limits<float>::quiet_NaN(), 200.0f}), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(bank_.Update({200.0f, 200.0f, std::numeric_limits<float>::infinity(), 200.0f}), types::DriverStatus::INPUT_ERROR);
+  EXPECT_FLOAT_EQ(bank_.GetCoefficients(2, 0).b1, b1);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+#include <cmath>
+#include <random>
+#include "gtest/gtest.h"
+#include "filter_design.hpp"
+#include "software_filter_engine.hpp"
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+
+class SoftwareFilterEngineTests : public ::testing::Test {
+ protected:
+  /// Direct form 1 in double with the quantized coefficients, the engine may only differ by its truncation
+  static auto ReferenceFilter(const filter::FilterCoefficients& coefficients, const std::vector<std::int16_t>& input) -> std::vector<double> {
+    const double gain = static_cast<double>(1 << coefficients.gain_shift) / 32768.0;
+    std::vector<double> output(input.size(), 0.0);
+
+    for (std::size_t sample = 0; sample < input.size(); sample++) {
+      double sum = 0.0;
+      for (std::size_t tap = 0; tap < coefficients.feedforward_taps && tap <= sample; tap++)
+        sum += coefficients.feedforward[tap] * gain * input[sample - tap];
+      for (std::size_t tap = 0; tap < coefficients.feedback_taps && tap + 1 <= sample; tap++)
+        sum += coefficients.feedback[tap] * gain * output[sample - tap - 1];
+      output[sample] = sum;
+    }
+
+    return output;
+  }
+
+  filter::SoftwareFilterEngine engine_;
+  filter::FilterState state_;
+};
+
+TEST_F(SoftwareFilterEngineTests, low_pass_biquad_is_quantized_with_the_smallest_gain_shift) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassBiquad(100.0f, 1000.0f, coefficients), types::DriverStatus::OK);
+
+  EXPECT_EQ(coefficients.structure, filter::FilterStructure::IIR_DIRECT_FORM_1);
+  EXPECT_EQ(coefficients.feedforward_taps, 3);
+  EXPECT_EQ(coefficients.feedback_taps, 2);
+  EXPECT_EQ(coefficients.gain_shift, 1);
+  EXPECT_TRUE(filter::AreCoefficientsValid(coefficients));
+
+  const double gain = 2.0 / 32768.0;
+  const double dc_gain = (coefficients.feedforward[0] + coefficients.feedforward[1] + coefficients.feedforward[2]) * gain /
+                         (1.0 - (coefficients.feedback[0] + coefficients.feedback[1]) * gain);
+  EXPECT_NEAR(dc_gain, 1.0, 1.0e-3);
+}
+
+TEST_F(SoftwareFilterEngineTests, design_rejects_frequencies_above_nyquist_and_too_many_taps) {
+  filter::FilterCoefficients coefficients;
+
+  EXPECT_EQ(filter::DesignLowPassBiquad(500.0f, 1000.0f, coefficients), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(filter::DesignLowPassBiquad(0.0f, 1000.0f, coefficients), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(filter::DesignLowPassFir(100.0f, 1000.0f, filter::MAX_FEEDFORWARD_TAPS + 1, coefficients), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(SoftwareFilterEngineTests, biquad_follows_the_double_precision_reference) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassBiquad(80.0f, 1000.0f, coefficients), types::DriverStatus::OK);
+
+  std::mt19937 generator(7);
+  std::normal_distribution<double> noise(0.0, 1500.0);
+  std::vector<std::int16_t> input(512);
+  for (std::size_t sample = 0; sample < input.size(); sample++)
+    input[sample] = static_cast<std::int16_t>(std::lround(8000.0 * std::sin(2.0 * PI * 10.0 * sample / 1000.0) + noise(generator)));
+
+  std::vector<std::int16_t> output(input.size());
+  for (std::size_t offset = 0; offset < input.size(); offset += 64)
+    ASSERT_EQ(engine_.Filter(coefficients, state_, &input[offset], &output[offset], 64), types::DriverStatus::OK);
+
+  const auto reference = ReferenceFilter(coefficients, input);
+  for (std::size_t sample = 0; sample < input.size(); sample++)
+    EXPECT_NEAR(output[sample], reference[sample], 8.0) << "sample " << sample;
+}
+
+TEST_F(SoftwareFilterEngineTests, fir_step_response_settles_to_the_step) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassFir(100.0f, 1000.0f, 15, coefficients), types::DriverStatus::OK);
+
+  std::vector<std::int16_t> input(32, 10000);
+  std::vector<std::int16_t> output(32);
+  ASSERT_EQ(engine_.Filter(coefficients, state_, input.data(), output.data(), 32), types::DriverStatus::OK);
+
+  EXPECT_LT(output[0], 1000);
+  EXPECT_NEAR(output[31], 10000, 10);
+}
+
+TEST_F(SoftwareFilterEngineTests, block_length_does_not_change_the_output) {
+  filter::FilterCoefficients coefficients;
+  ASSERT_EQ(filter::DesignLowPassBiquad(150.0f, 1000.0f, coefficients), types::DriverStatus::OK);
+
+  std::vector<std::int16_t> input(200);
+  for (std::size_t sample = 0; sample < input.size(); sample++)
+    input[sample] = static_cast<std::int16_t>((sample * 7919) % 20000 - 10000);
+
+  std::vector<std::int16_t> in_one_go(input.size());
+  for (std::size_t offset = 0; offset < input.size(); offset += 50)
+    ASSERT_EQ(engine_.Filter(coefficients, state_, &input[offset], &in_one_go[offset], 50), types::DriverStatus::OK);
+
+  filter::FilterState state;
+  std::vector<std::int16_t> sample_by_sample(input.size());
+  for (std::size_t sample = 0; sample < input.size(); sample++)
+    ASSERT_EQ(engine_.Filter(coefficients, state, &input[sample], &sample_by_sample[sample], 1), types::DriverStatus::OK);
+
+  EXPECT_EQ(in_one_go, sample_by_sample);
+}
+
+TEST_F(SoftwareFilterEngineTests, output_saturates_instead_of_overflowing) {
+  filter::FilterCoefficients coefficients;
+  coefficients.structure = filter::FilterStructure::FIR;
+  coefficients.feedforward_taps = 2;
+  coefficients.feedforward = {32767, 32767};
+
+  const std::int16_t input[] = {30000, 30000, -30000, -30000};
+  std::int16_t output[4];
+  ASSERT_EQ(engine_.Filter(coefficients, state_, input, output, 4), types::DriverStatus::OK);
+
+  EXPECT_EQ(output[1], 32767);
+  EXPECT_EQ(output[3], -32768);
+}
+
+TEST_F(SoftwareFilterEngineTests, invalid_coefficients_are_rejected) {
+  filter::FilterCoefficients coefficients;
+  coefficients.structure = filter::FilterStructure::IIR_DIRECT_FORM_1;
+  coefficients.feedforward_taps = 2;
+  coefficients.feedback_taps = 2;
+
+  std::int16_t sample = 0;
+  EXPECT_EQ(engine_.Filter(coefficients, state_, &sample, &sample, 1), types::DriverStatus::INPUT_ERROR);
+
+  coefficients.feedback_taps = 1;
+  EXPECT_EQ(engine_.Filter(coefficients, state_, &sample, &sample, filter::FilterEngineInterface::MAX_FILTER_BLOCK_LENGTH + 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(engine_.Filter(coefficients, state_, nullptr, &sample, 1), types::DriverStatus::INPUT_ERROR);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
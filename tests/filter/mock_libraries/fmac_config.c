@@ -0,0 +1,9 @@
+#include "stm32g4xx_hal.h"
+#include "fmac_config.h"
+
+FMAC_HandleTypeDef hfmac;
+
+void MX_FMAC_Init(void)
+{
+  hfmac.dummy = 0;
+}
@@ -0,0 +1,16 @@
+#ifndef MOCK_MCU_CONFIG_FMAC_CONFIG_H_
+#define MOCK_MCU_CONFIG_FMAC_CONFIG_H_
+
+#ifdef __cplusplus
+	extern "C" {
+#endif
+
+extern FMAC_HandleTypeDef hfmac;
+
+void MX_FMAC_Init(void);
+
+#ifdef __cplusplus
+	}
+#endif
+
+#endif
@@ -0,0 +1,195 @@
+#include "stm32g4xx_hal.h"
+
+/*
+ * Simulates the FMAC on its 256 word memory: the coefficients are read back from X2,
+ * the inputs and outputs run through the circular buffers X1 and Y. Every product is
+ * truncated to q3.22 and the 26 bit accumulator wraps after every addition, the result
+ * is shifted by R, truncated to q1.15 and saturated.
+ */
+
+#define FMAC_MEMORY_SIZE 256
+
+static int16_t memory[FMAC_MEMORY_SIZE];
+static FMAC_FilterConfigTypeDef configuration;
+static uint8_t is_configured = 0;
+static uint8_t is_running = 0;
+static uint8_t input_write = 0;
+static uint8_t output_write = 0;
+static int16_t *output_buffer = 0;
+static uint16_t output_size = 0;
+static int16_t *input_buffer = 0;
+static uint16_t input_size = 0;
+static uint32_t config_count = 0;
+static HAL_StatusTypeDef next_poll_status = HAL_OK;
+
+static int32_t WrapToAccumulator(int32_t value) {
+  return (int32_t)((uint32_t)value << 6) >> 6;
+}
+
+static int16_t InputAt(uint8_t age) {
+  const uint8_t index = (uint8_t)((input_write + configuration.InputBufferSize - 1 - age) % configuration.InputBufferSize);
+  return memory[configuration.InputBaseAddress + index];
+}
+
+static int16_t OutputAt(uint8_t age) {
+  const uint8_t index = (uint8_t)((output_write + configuration.OutputBufferSize - 1 - age) % configuration.OutputBufferSize);
+  return memory[configuration.OutputBaseAddress + index];
+}
+
+static void PushInput(int16_t value) {
+  memory[configuration.InputBaseAddress + input_write] = value;
+  input_write = (uint8_t)((input_write + 1) % configuration.InputBufferSize);
+}
+
+static void PushOutput(int16_t value) {
+  memory[configuration.OutputBaseAddress + output_write] = value;
+  output_write = (uint8_t)((output_write + 1) % configuration.OutputBufferSize);
+}
+
+static int16_t Calculate(void) {
+  const uint8_t feedback_taps = (configuration.Filter == FMAC_FUNC_IIR_DIRECT_FORM_1) ? configuration.Q : 0;
+  int32_t accumulator = 0;
+
+  for (uint8_t tap = 0; tap < configuration.P; tap++) {
+    const int32_t product = ((int32_t)memory[configuration.CoeffBaseAddress + tap] * InputAt(tap)) >> 8;
+    accumulator = WrapToAccumulator(accumulator + product);
+  }
+
+  for (uint8_t tap = 0; tap < feedback_taps; tap++) {
+    const int32_t product = ((int32_t)memory[configuration.CoeffBaseAddress + configuration.P + tap] * OutputAt(tap)) >> 8;
+    accumulator = WrapToAccumulator(accumulator + product);
+  }
+
+  const int64_t result = ((int64_t)accumulator * ((int64_t)1 << configuration.R)) >> 7;
+  if (configuration.Clip == FMAC_CLIP_ENABLED) {
+    if (result > INT16_MAX)
+      return INT16_MAX;
+    if (result < INT16_MIN)
+      return INT16_MIN;
+  }
+  return (int16_t)result;
+}
+
+HAL_StatusTypeDef HAL_FMAC_FilterConfig(FMAC_HandleTypeDef *hfmac, FMAC_FilterConfigTypeDef *pConfig) {
+  (void)hfmac;
+
+  if (is_running)
+    return HAL_BUSY;
+
+  const uint8_t is_iir = (pConfig->Filter == FMAC_FUNC_IIR_DIRECT_FORM_1);
+  const uint32_t coefficients = (uint32_t)pConfig->CoeffBSize + (is_iir ? pConfig->CoeffASize : 0U);
+  if (pConfig->P == 0 || pConfig->CoeffBSize != pConfig->P || (is_iir && pConfig->CoeffASize != pConfig->Q) ||
+      pConfig->R > 7 || pConfig->pCoeffB == 0 || (is_iir && pConfig->pCoeffA == 0) ||
+      pConfig->CoeffBufferSize < coefficients || pConfig->InputBufferSize < pConfig->P ||
+      (is_iir && pConfig->OutputBufferSize < pConfig->Q) || pConfig->OutputBufferSize == 0 ||
+      (uint32_t)pConfig->OutputBaseAddress + pConfig->OutputBufferSize > FMAC_MEMORY_SIZE ||
+      (uint32_t)pConfig->InputBaseAddress < (uint32_t)pConfig->CoeffBaseAddress + pConfig->CoeffBufferSize ||
+      (uint32_t)pConfig->OutputBaseAddress < (uint32_t)pConfig->InputBaseAddress + pConfig->InputBufferSize)
+    return HAL_ERROR;
+
+  configuration = *pConfig;
+  for (uint8_t tap = 0; tap < pConfig->CoeffBSize; tap++)
+    memory[pConfig->CoeffBaseAddress + tap] = pConfig->pCoeffB[tap];
+  for (uint8_t tap = 0; is_iir && tap < pConfig->CoeffASize; tap++)
+    memory[pConfig->CoeffBaseAddress + pConfig->CoeffBSize + tap] = pConfig->pCoeffA[tap];
+
+  for (uint8_t index = 0; index < pConfig->InputBufferSize; index++)
+    memory[pConfig->InputBaseAddress + index] = 0;
+  for (uint8_t index = 0; index < pConfig->OutputBufferSize; index++)
+    memory[pConfig->OutputBaseAddress + index] = 0;
+
+  input_write = 0;
+  output_write = 0;
+  is_configured = 1;
+  config_count++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FMAC_FilterPreload(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint8_t InputSize, int16_t *pOutput, uint8_t OutputSize) {
+  (void)hfmac;
+
+  if (!is_configured || is_running)
+    return HAL_ERROR;
+  if ((InputSize > 0 && pInput == 0) || (OutputSize > 0 && pOutput == 0) ||
+      InputSize > configuration.InputBufferSize || OutputSize > configuration.OutputBufferSize)
+    return HAL_ERROR;
+
+  for (uint8_t index = 0; index < InputSize; index++)
+    PushInput(pInput[index]);
+  for (uint8_t index = 0; index < OutputSize; index++)
+    PushOutput(pOutput[index]);
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FMAC_FilterStart(FMAC_HandleTypeDef *hfmac, int16_t *pOutput, uint16_t *pOutputSize) {
+  (void)hfmac;
+
+  if (!is_configured || is_running || pOutput == 0 || pOutputSize == 0)
+    return HAL_ERROR;
+
+  output_buffer = pOutput;
+  output_size = *pOutputSize;
+  input_buffer = 0;
+  input_size = 0;
+  is_running = 1;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FMAC_AppendFilterData(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint16_t *pInputSize) {
+  (void)hfmac;
+
+  if (!is_running || pInput == 0 || pInputSize == 0 || configuration.InputAccess == FMAC_BUFFER_ACCESS_NONE)
+    return HAL_ERROR;
+
+  input_buffer = pInput;
+  input_size = *pInputSize;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FMAC_PollFilterData(FMAC_HandleTypeDef *hfmac, uint32_t Timeout) {
+  (void)hfmac;
+  (void)Timeout;
+
+  if (next_poll_status != HAL_OK) {
+    const HAL_StatusTypeDef status = next_poll_status;
+    next_poll_status = HAL_OK;
+    return status;
+  }
+
+  if (!is_running || configuration.InputAccess != FMAC_BUFFER_ACCESS_POLLING || configuration.OutputAccess != FMAC_BUFFER_ACCESS_POLLING)
+    return HAL_ERROR;
+
+  /* Without enough input the output buffer is never filled */
+  if (input_size < output_size)
+    return HAL_TIMEOUT;
+
+  for (uint16_t sample = 0; sample < output_size; sample++) {
+    PushInput(input_buffer[sample]);
+    const int16_t output = Calculate();
+    PushOutput(output);
+    output_buffer[sample] = output;
+  }
+
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FMAC_FilterStop(FMAC_HandleTypeDef *hfmac) {
+  (void)hfmac;
+
+  is_running = 0;
+  is_configured = 0;
+  return HAL_OK;
+}
+
+uint32_t MockFmacGetConfigCount(void) {
+  return config_count;
+}
+
+uint8_t MockFmacIsRunning(void) {
+  return is_running;
+}
+
+void MockFmacFailNextPoll(HAL_StatusTypeDef status) {
+  next_poll_status = status;
+}
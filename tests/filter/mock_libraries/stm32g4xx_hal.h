@@ -0,0 +1,73 @@
+#ifndef MOCK_STM32G4xx_HAL_H_
+#define MOCK_STM32G4xx_HAL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct __FMAC_HandleTypeDef
+{
+  int dummy;
+} FMAC_HandleTypeDef;
+
+typedef struct
+{
+  uint8_t    InputBaseAddress;
+  uint8_t    InputBufferSize;
+  uint32_t   InputThreshold;
+  uint8_t    CoeffBaseAddress;
+  uint8_t    CoeffBufferSize;
+  uint8_t    OutputBaseAddress;
+  uint8_t    OutputBufferSize;
+  uint32_t   OutputThreshold;
+  int16_t   *pCoeffA;
+  uint8_t    CoeffASize;
+  int16_t   *pCoeffB;
+  uint8_t    CoeffBSize;
+  uint8_t    InputAccess;
+  uint8_t    OutputAccess;
+  uint32_t   Clip;
+  uint32_t   Filter;
+  uint8_t    P;
+  uint8_t    Q;
+  uint8_t    R;
+} FMAC_FilterConfigTypeDef;
+
+#define FMAC_FUNC_CONVO_FIR             (0x08000000U)
+#define FMAC_FUNC_IIR_DIRECT_FORM_1     (0x09000000U)
+
+#define FMAC_THRESHOLD_1                (0x00000000U)
+#define FMAC_BUFFER_ACCESS_NONE         (0x00U)
+#define FMAC_BUFFER_ACCESS_DMA          (0x01U)
+#define FMAC_BUFFER_ACCESS_POLLING      (0x02U)
+#define FMAC_BUFFER_ACCESS_IT           (0x03U)
+#define FMAC_CLIP_DISABLED              (0x00000000U)
+#define FMAC_CLIP_ENABLED               (0x00008000U)
+
+HAL_StatusTypeDef HAL_FMAC_FilterConfig(FMAC_HandleTypeDef *hfmac, FMAC_FilterConfigTypeDef *pConfig);
+HAL_StatusTypeDef HAL_FMAC_FilterPreload(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint8_t InputSize, int16_t *pOutput, uint8_t OutputSize);
+HAL_StatusTypeDef HAL_FMAC_FilterStart(FMAC_HandleTypeDef *hfmac, int16_t *pOutput, uint16_t *pOutputSize);
+HAL_StatusTypeDef HAL_FMAC_AppendFilterData(FMAC_HandleTypeDef *hfmac, int16_t *pInput, uint16_t *pInputSize);
+HAL_StatusTypeDef HAL_FMAC_PollFilterData(FMAC_HandleTypeDef *hfmac, uint32_t Timeout);
+HAL_StatusTypeDef HAL_FMAC_FilterStop(FMAC_HandleTypeDef *hfmac);
+
+/* Inspection of the simulated accelerator for the tests */
+uint32_t MockFmacGetConfigCount(void);
+uint8_t MockFmacIsRunning(void);
+void MockFmacFailNextPoll(HAL_StatusTypeDef status);
+
+#ifdef __cplusplus
+  }
+#endif
+
+#endif /* MOCK_STM32G4xx_HAL_H_ */
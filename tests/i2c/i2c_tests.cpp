@@ -170,6 +170,42 @@ TEST_F(I2CTests, read_register_content_invalid_register) {
   EXPECT_EQ(result_status, types::DriverStatus::HAL_ERROR);
 }
 
+TEST_F(I2CTests, read_register_content_into_buffer_OK) {
+  address = 0x14;
+  std::uint8_t content_of_register[4] = {0, 0, 0, 0};
+
+  result_status = unit_under_test_->ReadContentFromRegisterIntoBuffer(address, register_, content_of_register, 4, timeout);
+
+  EXPECT_EQ(result_status, types::DriverStatus::OK);
+  EXPECT_THAT(content_of_register, testing::ElementsAre(5, 5, 6, 7));
+}
+
+TEST_F(I2CTests, read_register_content_into_buffer_wrong_address) {
+  address = 0x78;
+  std::uint8_t content_of_register[1] = {0};
+
+  result_status = unit_under_test_->ReadContentFromRegisterIntoBuffer(address, register_, content_of_register, 1, timeout);
+
+  EXPECT_EQ(result_status, types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(I2CTests, read_register_content_into_buffer_without_buffer) {
+  address = 0x14;
+
+  result_status = unit_under_test_->ReadContentFromRegisterIntoBuffer(address, register_, nullptr, 1, timeout);
+
+  EXPECT_EQ(result_status, types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(I2CTests, read_register_content_into_buffer_timeout) {
+  address = 0x12;
+  std::uint8_t content_of_register[1] = {0};
+
+  result_status = unit_under_test_->ReadContentFromRegisterIntoBuffer(address, register_, content_of_register, 1, timeout);
+
+  EXPECT_EQ(result_status, types::DriverStatus::TIMEOUT);
+}
+
 }  // namespace
 
 int main(int argc, char **argv) {
@@ -0,0 +1,61 @@
+#include "allocation_counter.hpp"
+#include "gtest/gtest.h"
+#include "mpu9255.hpp"
+#include "mpu9255_spi_transport.hpp"
+#include "simulated_mpu9255.hpp"
+
+namespace {
+
+/**
+ * Counts the heap allocations of Mpu9255::Update on the simulated device.
+ * Init may allocate, the periodic update must not.
+ */
+class ImuAllocationTests : public ::testing::Test {
+ protected:
+  static constexpr int UPDATES = 10;
+
+  template <typename Mpu9255Type>
+  auto CountUpdateAllocations(Mpu9255Type& mpu9255) -> std::size_t {
+    EXPECT_EQ(mpu9255.Init(), types::DriverStatus::OK);
+
+    utilities::AllocationCounter::Reset();
+    for (int update = 0; update < UPDATES; update++)
+      EXPECT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+
+    return utilities::AllocationCounter::Get();
+  }
+
+  imu::SimulatedMpu9255 device_;
+};
+
+TEST_F(ImuAllocationTests, update_i2c_bypass_does_not_allocate) {
+  imu::Mpu9255 unit_under_test(std::make_shared<imu::SimulatedI2CBus>(device_), types::MagnetometerReadMode::BYPASS);
+
+  EXPECT_EQ(CountUpdateAllocations(unit_under_test), 0u);
+}
+
+TEST_F(ImuAllocationTests, update_i2c_auxiliary_i2c_master_does_not_allocate) {
+  imu::Mpu9255 unit_under_test(std::make_shared<imu::SimulatedI2CBus>(device_), types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+
+  EXPECT_EQ(CountUpdateAllocations(unit_under_test), 0u);
+}
+
+TEST_F(ImuAllocationTests, update_spi_auxiliary_i2c_master_does_not_allocate) {
+  auto spi = std::make_shared<imu::SimulatedSPIBus>(device_);
+  imu::Mpu9255 unit_under_test(std::make_shared<imu::Mpu9255SpiTransport>(spi), types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+
+  EXPECT_EQ(CountUpdateAllocations(unit_under_test), 0u);
+}
+
+TEST_F(ImuAllocationTests, update_static_composition_does_not_allocate) {
+  imu::StaticMpu9255 unit_under_test(std::make_shared<imu::SimulatedI2CBus>(device_), types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+
+  EXPECT_EQ(CountUpdateAllocations(unit_under_test), 0u);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
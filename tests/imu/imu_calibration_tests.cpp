@@ -0,0 +1,147 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "calibration_store.hpp"
+#include "mpu9255.hpp"
+#include "simulated_mpu9255.hpp"
+#include "startup_calibration.hpp"
+
+namespace {
+
+class CalibrationTests : public ::testing::Test {
+ protected:
+  static constexpr std::uint16_t NUMBER_OF_SAMPLES = 200;
+
+  virtual void SetUp() {
+    imu::InvalidateCalibration();
+  }
+
+  auto AddStationarySamples(imu::StartupCalibration& calibration, const int amount) -> types::ImuCalibrationState {
+    auto state = types::ImuCalibrationState::COLLECTING;
+    for (int sample = 0; sample < amount; sample++)
+      state = calibration.AddSample(types::EuclideanVector<float>{1.5f + gyroscope_noise_(generator_), -0.7f + gyroscope_noise_(generator_), 0.2f + gyroscope_noise_(generator_)},
+                                    types::EuclideanVector<float>{0.02f + accelerometer_noise_(generator_), -0.01f + accelerometer_noise_(generator_), -1.03f + accelerometer_noise_(generator_)});
+    return state;
+  }
+
+  std::mt19937 generator_{5};
+  std::normal_distribution<float> gyroscope_noise_{0.0f, 0.2f};
+  std::normal_distribution<float> accelerometer_noise_{0.0f, 0.005f};
+};
+
+TEST_F(CalibrationTests, stationary_samples_give_gyroscope_bias_and_accelerometer_offset) {
+  imu::StartupCalibration calibration{NUMBER_OF_SAMPLES};
+
+  EXPECT_EQ(AddStationarySamples(calibration, NUMBER_OF_SAMPLES - 1), types::ImuCalibrationState::COLLECTING);
+  EXPECT_EQ(AddStationarySamples(calibration, 1), types::ImuCalibrationState::CALIBRATED);
+
+  const auto gyroscope = calibration.GetGyroscopeCalibration();
+  EXPECT_NEAR(gyroscope.bias.x, 1.5f, 0.05f);
+  EXPECT_NEAR(gyroscope.bias.y, -0.7f, 0.05f);
+  EXPECT_NEAR(gyroscope.bias.z, 0.2f, 0.05f);
+  EXPECT_FLOAT_EQ(gyroscope.scale.x, 1.0f);
+
+  // Gravity points along -z, only the deviation from 1 g is an offset
+  const auto accelerometer = calibration.GetAccelerometerCalibration();
+  EXPECT_NEAR(accelerometer.bias.x, 0.02f, 0.002f);
+  EXPECT_NEAR(accelerometer.bias.y, -0.01f, 0.002f);
+  EXPECT_NEAR(accelerometer.bias.z, -0.03f, 0.002f);
+}
+
+TEST_F(CalibrationTests, motion_restarts_the_collection) {
+  imu::StartupCalibration calibration{NUMBER_OF_SAMPLES};
+  AddStationarySamples(calibration, NUMBER_OF_SAMPLES / 2);
+
+  calibration.AddSample(types::EuclideanVector<float>{40.0f, 0.0f, 0.0f}, types::EuclideanVector<float>{0.0f, 0.0f, -1.0f});
+
+  EXPECT_EQ(calibration.GetRestartCount(), 1);
+  EXPECT_EQ(AddStationarySamples(calibration, NUMBER_OF_SAMPLES - 1), types::ImuCalibrationState::COLLECTING);
+  EXPECT_EQ(AddStationarySamples(calibration, 1), types::ImuCalibrationState::CALIBRATED);
+  EXPECT_NEAR(calibration.GetGyroscopeCalibration().bias.x, 1.5f, 0.05f);
+}
+
+TEST_F(CalibrationTests, stored_calibration_is_loaded_until_invalidated) {
+  types::SensorCalibration gyroscope;
+  gyroscope.bias.y = 2.5f;
+  types::SensorCalibration accelerometer;
+  accelerometer.scale.z = 1.01f;
+  imu::StoreCalibration(gyroscope, accelerometer);
+
+  types::SensorCalibration loaded_gyroscope;
+  types::SensorCalibration loaded_accelerometer;
+  ASSERT_EQ(imu::LoadCalibration(loaded_gyroscope, loaded_accelerometer), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(loaded_gyroscope.bias.y, 2.5f);
+  EXPECT_FLOAT_EQ(loaded_accelerometer.scale.z, 1.01f);
+
+  imu::InvalidateCalibration();
+  EXPECT_EQ(imu::LoadCalibration(loaded_gyroscope, loaded_accelerometer), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(CalibrationTests, calibration_requires_an_initialized_imu) {
+  imu::SimulatedMpu9255 device;
+  imu::StaticMpu9255 mpu9255(std::make_shared<imu::SimulatedI2CBus>(device));
+
+  EXPECT_EQ(mpu9255.StartCalibration(), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(mpu9255.GetCalibrationState(), types::ImuCalibrationState::UNCALIBRATED);
+}
+
+TEST_F(CalibrationTests, cold_boot_collects_and_warm_boot_reuses_the_calibration) {
+  imu::SimulatedMpu9255 cold_device;
+  imu::StaticMpu9255 cold_boot(std::make_shared<imu::SimulatedI2CBus>(cold_device));
+  ASSERT_EQ(cold_boot.Init(), types::DriverStatus::OK);
+  ASSERT_EQ(cold_boot.StartCalibration(), types::DriverStatus::OK);
+  EXPECT_EQ(cold_boot.GetCalibrationState(), types::ImuCalibrationState::COLLECTING);
+
+  ASSERT_EQ(cold_boot.Update(), types::DriverStatus::OK);
+  EXPECT_NE(cold_boot.GetGyroscope().x, 0);
+
+  for (std::uint16_t update = 1; update < imu::StartupCalibration::DEFAULT_NUMBER_OF_SAMPLES; update++)
+    ASSERT_EQ(cold_boot.Update(), types::DriverStatus::OK);
+  EXPECT_EQ(cold_boot.GetCalibrationState(), types::ImuCalibrationState::CALIBRATED);
+
+  cold_boot.Update();
+  EXPECT_EQ(cold_boot.GetGyroscope().x, 0);
+  EXPECT_EQ(cold_boot.GetGyroscope().z, 0);
+  EXPECT_EQ(cold_boot.GetAccelerometer().z, 1);
+
+  imu::SimulatedMpu9255 warm_device;
+  imu::StaticMpu9255 warm_boot(std::make_shared<imu::SimulatedI2CBus>(warm_device));
+  ASSERT_EQ(warm_boot.Init(), types::DriverStatus::OK);
+  ASSERT_EQ(warm_boot.StartCalibration(), types::DriverStatus::OK);
+  EXPECT_EQ(warm_boot.GetCalibrationState(), types::ImuCalibrationState::CALIBRATED);
+
+  warm_boot.Update();
+  EXPECT_EQ(warm_boot.GetGyroscope().x, 0);
+  EXPECT_EQ(warm_boot.GetAccelerometer().z, 1);
+}
+
+TEST_F(CalibrationTests, offsets_below_one_output_unit_are_removed_from_the_calibrated_values) {
+  imu::SimulatedMpu9255 device;
+  // About 0.03 g and 0.43 dps, which truncate to zero in the whole units of GetAccelerometer() and GetGyroscope()
+  device.SetMeasurement(imu::ACCEL_MEASUREMENT_DATA, {0x00, 0x3D, 0x00, 0x00, 0x08, 0x00});
+  device.SetMeasurement(imu::GYRO_MEASUREMENT_DATA, {0x00, 0x07, 0xFF, 0xF9, 0x00, 0x00});
+  imu::StaticMpu9255 mpu9255(std::make_shared<imu::SimulatedI2CBus>(device));
+  ASSERT_EQ(mpu9255.Init(), types::DriverStatus::OK);
+  ASSERT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+
+  EXPECT_EQ(mpu9255.GetAccelerometer().x, 0);
+  EXPECT_NEAR(mpu9255.GetCalibratedAccelerometer().x, 0.03f, 0.001f);
+  EXPECT_NEAR(mpu9255.GetCalibratedGyroscope().x, 0.43f, 0.005f);
+  EXPECT_NEAR(mpu9255.GetCalibratedGyroscope().y, -0.43f, 0.005f);
+
+  ASSERT_EQ(mpu9255.StartCalibration(), types::DriverStatus::OK);
+  for (std::uint16_t update = 0; update <= imu::StartupCalibration::DEFAULT_NUMBER_OF_SAMPLES; update++)
+    ASSERT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+  ASSERT_EQ(mpu9255.GetCalibrationState(), types::ImuCalibrationState::CALIBRATED);
+
+  EXPECT_NEAR(mpu9255.GetCalibratedAccelerometer().x, 0.0f, 1e-5f);
+  EXPECT_NEAR(mpu9255.GetCalibratedAccelerometer().z, 1.0f, 1e-5f);
+  EXPECT_NEAR(mpu9255.GetCalibratedGyroscope().x, 0.0f, 1e-5f);
+  EXPECT_NEAR(mpu9255.GetCalibratedGyroscope().y, 0.0f, 1e-5f);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+#include <cmath>
+#include <random>
+#include "gtest/gtest.h"
+#include "ellipsoid_fit_calibration.hpp"
+#include "mpu9255.hpp"
+#include "simulated_mpu9255.hpp"
+
+namespace {
+
+constexpr float FIELD_STRENGTH_IN_MICRO_TESLA = 48.0f;
+
+/**
+ * Samples the earth field in random orientations and distorts it as the frame would:
+ * soft iron as a non orthogonal 3x3 matrix, hard iron as an offset, plus sensor noise.
+ */
+class EllipsoidFitCalibrationTests : public ::testing::Test {
+ protected:
+  auto AddDistortedSphere(imu::EllipsoidFitCalibration& calibration, const int amount) -> void {
+    std::normal_distribution<float> direction(0.0f, 1.0f);
+    std::normal_distribution<float> noise(0.0f, 0.1f);
+
+    for (int sample = 0; sample < amount; sample++) {
+      float field[3] = {direction(generator_), direction(generator_), direction(generator_)};
+      const auto norm = std::sqrt(field[0] * field[0] + field[1] * field[1] + field[2] * field[2]);
+      for (auto& axis : field)
+        axis *= FIELD_STRENGTH_IN_MICRO_TESLA / norm;
+
+      calibration.AddSample(Distort(field, noise(generator_), noise(generator_), noise(generator_)));
+    }
+  }
+
+  auto Distort(const float* field, const float noise_x, const float noise_y, const float noise_z) -> types::EuclideanVector<float> {
+    return types::EuclideanVector<float>{
+        SOFT_IRON[0] * field[0] + SOFT_IRON[1] * field[1] + SOFT_IRON[2] * field[2] + HARD_IRON[0] + noise_x,
+        SOFT_IRON[3] * field[0] + SOFT_IRON[4] * field[1] + SOFT_IRON[5] * field[2] + HARD_IRON[1] + noise_y,
+        SOFT_IRON[6] * field[0] + SOFT_IRON[7] * field[1] + SOFT_IRON[8] * field[2] + HARD_IRON[2] + noise_z};
+  }
+
+  static auto Apply(const types::HardAndSoftIronCalibration& calibration, const types::EuclideanVector<float>& measured) -> std::array<float, 3> {
+    const float shifted[3] = {measured.x - calibration.offset.x, measured.y - calibration.offset.y, measured.z - calibration.offset.z};
+    std::array<float, 3> corrected{};
+    for (int row = 0; row < 3; row++)
+      for (int column = 0; column < 3; column++)
+        corrected[row] += calibration.correction[row * 3 + column] * shifted[column];
+    return corrected;
+  }
+
+  static constexpr float SOFT_IRON[9] = {1.25f, 0.10f, -0.05f, 0.10f, 0.85f, 0.08f, -0.05f, 0.08f, 1.05f};
+  static constexpr float HARD_IRON[3] = {35.0f, -20.0f, 60.0f};
+
+  std::mt19937 generator_{3};
+};
+
+constexpr float EllipsoidFitCalibrationTests::SOFT_IRON[9];
+constexpr float EllipsoidFitCalibrationTests::HARD_IRON[3];
+
+TEST_F(EllipsoidFitCalibrationTests, too_few_samples_are_rejected) {
+  imu::EllipsoidFitCalibration calibration;
+  AddDistortedSphere(calibration, imu::EllipsoidFitCalibration::MIN_NUMBER_OF_SAMPLES - 1);
+
+  types::HardAndSoftIronCalibration result;
+  EXPECT_EQ(calibration.Solve(result), types::DriverStatus::INPUT_ERROR);
+  EXPECT_FLOAT_EQ(result.correction[0], 1.0f);
+}
+
+TEST_F(EllipsoidFitCalibrationTests, samples_of_a_single_direction_are_rejected) {
+  imu::EllipsoidFitCalibration calibration;
+  for (std::uint32_t sample = 0; sample < 2 * imu::EllipsoidFitCalibration::MIN_NUMBER_OF_SAMPLES; sample++)
+    calibration.AddSample(types::EuclideanVector<float>{10.0f, 20.0f, 30.0f});
+
+  types::HardAndSoftIronCalibration result;
+  EXPECT_EQ(calibration.Solve(result), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(EllipsoidFitCalibrationTests, distorted_sphere_is_mapped_back_onto_a_sphere) {
+  imu::EllipsoidFitCalibration calibration;
+  AddDistortedSphere(calibration, 2000);
+  EXPECT_EQ(calibration.GetSampleCount(), 2000u);
+
+  types::HardAndSoftIronCalibration result;
+  ASSERT_EQ(calibration.Solve(result), types::DriverStatus::OK);
+
+  EXPECT_NEAR(result.offset.x, HARD_IRON[0], 0.5f);
+  EXPECT_NEAR(result.offset.y, HARD_IRON[1], 0.5f);
+  EXPECT_NEAR(result.offset.z, HARD_IRON[2], 0.5f);
+
+  // Without the calibration the magnitude spreads by several ten percent
+  std::normal_distribution<float> direction(0.0f, 1.0f);
+  float smallest = 1.0e6f;
+  float largest = 0.0f;
+  for (int sample = 0; sample < 500; sample++) {
+    float field[3] = {direction(generator_), direction(generator_), direction(generator_)};
+    const auto norm = std::sqrt(field[0] * field[0] + field[1] * field[1] + field[2] * field[2]);
+    for (auto& axis : field)
+      axis *= FIELD_STRENGTH_IN_MICRO_TESLA / norm;
+
+    const auto corrected = Apply(result, Distort(field, 0.0f, 0.0f, 0.0f));
+    const auto magnitude = std::sqrt(corrected[0] * corrected[0] + corrected[1] * corrected[1] + corrected[2] * corrected[2]);
+    smallest = std::fmin(smallest, magnitude);
+    largest = std::fmax(largest, magnitude);
+  }
+
+  EXPECT_LT((largest - smallest) / FIELD_STRENGTH_IN_MICRO_TESLA, 0.02f);
+  EXPECT_NEAR(0.5f * (largest + smallest), FIELD_STRENGTH_IN_MICRO_TESLA, 0.05f * FIELD_STRENGTH_IN_MICRO_TESLA);
+}
+
+TEST_F(EllipsoidFitCalibrationTests, reset_discards_the_samples) {
+  imu::EllipsoidFitCalibration calibration;
+  AddDistortedSphere(calibration, 200);
+
+  calibration.Reset();
+
+  types::HardAndSoftIronCalibration result;
+  EXPECT_EQ(calibration.GetSampleCount(), 0u);
+  EXPECT_EQ(calibration.Solve(result), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(EllipsoidFitCalibrationTests, magnetometer_applies_offset_and_correction_in_update) {
+  imu::SimulatedMpu9255 device;
+  imu::StaticMpu9255 mpu9255(std::make_shared<imu::SimulatedI2CBus>(device));
+  ASSERT_EQ(mpu9255.Init(), types::DriverStatus::OK);
+  ASSERT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+  const auto uncalibrated = mpu9255.MagnetometerSensor().GetUncalibrated();
+
+  types::HardAndSoftIronCalibration calibration;
+  calibration.offset.x = 100.0f;
+  calibration.offset.z = -50.0f;
+  calibration.correction = {0.5f, 0.0f, 0.0f, 0.0f, 1.0f, 0.25f, 0.0f, 0.0f, 2.0f};
+  mpu9255.MagnetometerSensor().SetHardAndSoftIronCalibration(calibration);
+  ASSERT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+
+  const auto magnetometer = mpu9255.GetMagnetometer();
+  EXPECT_EQ(magnetometer.x, static_cast<std::int16_t>(0.5f * (uncalibrated.x - 100.0f)));
+  EXPECT_EQ(magnetometer.y, static_cast<std::int16_t>(uncalibrated.y + 0.25f * (uncalibrated.z + 50.0f)));
+  EXPECT_EQ(magnetometer.z, static_cast<std::int16_t>(2.0f * (uncalibrated.z + 50.0f)));
+
+  const auto calibrated = mpu9255.GetCalibratedMagnetometer();
+  EXPECT_NEAR(calibrated.x, 0.5f * (uncalibrated.x - 100.0f), 1e-3f);
+  EXPECT_NEAR(calibrated.y, uncalibrated.y + 0.25f * (uncalibrated.z + 50.0f), 1e-3f);
+  EXPECT_NEAR(calibrated.z, 2.0f * (uncalibrated.z + 50.0f), 1e-3f);
+}
+
+TEST_F(EllipsoidFitCalibrationTests, finishing_without_rotation_keeps_the_magnetometer_uncorrected) {
+  imu::SimulatedMpu9255 device;
+  imu::StaticMpu9255 mpu9255(std::make_shared<imu::SimulatedI2CBus>(device));
+
+  EXPECT_EQ(mpu9255.StartMagnetometerCalibration(), types::DriverStatus::HAL_ERROR);
+  ASSERT_EQ(mpu9255.Init(), types::DriverStatus::OK);
+  EXPECT_EQ(mpu9255.FinishMagnetometerCalibration(), types::DriverStatus::HAL_ERROR);
+
+  ASSERT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+  const auto before = mpu9255.GetMagnetometer();
+
+  ASSERT_EQ(mpu9255.StartMagnetometerCalibration(), types::DriverStatus::OK);
+  for (std::uint32_t update = 0; update < 2 * imu::EllipsoidFitCalibration::MIN_NUMBER_OF_SAMPLES; update++)
+    ASSERT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+  EXPECT_EQ(mpu9255.FinishMagnetometerCalibration(), types::DriverStatus::INPUT_ERROR);
+
+  ASSERT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+  EXPECT_EQ(mpu9255.GetMagnetometer().x, before.x);
+  EXPECT_EQ(mpu9255.GetMagnetometer().z, before.z);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -175,6 +175,23 @@ TEST_F(GyroscopeTests, full_roughest) {
   EXPECT_EQ(get_return.z, expected_value.z);
 }
 
+TEST_F(GyroscopeTests, failed_SetSensitivity_keeps_scale) {
+  ConfigureUnitUnderTest();
+
+  types::EuclideanVector<std::int16_t> expected_value{500, 0, -500};
+  unit_under_test_->Init(i2c_address_);
+  unit_under_test_->SetSensitivity(types::ImuSensitivity::ROUGHER);
+  ON_CALL(*i2c_handler_, Write(_, _, _))
+      .WillByDefault(Return(types::DriverStatus::HAL_ERROR));
+  unit_under_test_->SetSensitivity(types::ImuSensitivity::FINEST);
+  unit_under_test_->Update();
+  auto get_return = unit_under_test_->Get();
+
+  EXPECT_EQ(get_return.x, expected_value.x);
+  EXPECT_EQ(get_return.y, expected_value.y);
+  EXPECT_EQ(get_return.z, expected_value.z);
+}
+
 TEST_F(GyroscopeTests, SetSensitivity_finest) {
   const std::vector<std::uint8_t> expected_data_finest{imu::GYRO_CONFIG, 0b11100111};
   EXPECT_CALL(*i2c_handler_, Write(i2c_address_, expected_data_finest, _))
@@ -4,6 +4,7 @@
 #include "inertial_measurement.hpp"
 #include "mock_i2c.hpp"
 #include "mock_mpu9255.hpp"
+#include "simulated_mpu9255.hpp"
 
 using ::testing::_;
 using ::testing::NiceMock;
@@ -192,6 +193,28 @@ TEST_F(ImuIntegrationTests, integration_SetAccelerometerSensitivity) {
   EXPECT_EQ(unit_under_test_->GetAccelerometerSensitivity(), types::ImuSensitivity::ROUGHEST);
 }
 
+TEST_F(ImuIntegrationTests, integration_history_records_gyroscope_and_accelerometer_without_new_magnetometer_sample) {
+  for (const auto read_mode : {types::MagnetometerReadMode::BYPASS, types::MagnetometerReadMode::AUXILIARY_I2C_MASTER}) {
+    imu::SimulatedMpu9255 device;
+    imu::InertialMeasurement unit_under_test(std::make_shared<imu::SimulatedI2CBus>(device), read_mode);
+    ASSERT_EQ(unit_under_test.Init(), types::DriverStatus::OK);
+
+    device.SetMagnetometerDataReady(false);
+    for (std::uint32_t timestamp_in_us = 1000; timestamp_in_us <= 5000; timestamp_in_us += 1000)
+      EXPECT_EQ(unit_under_test.Update(timestamp_in_us), types::DriverStatus::OK);
+
+    EXPECT_EQ(unit_under_test.GetGyroscopeHistory().GetSize(), 5);
+    EXPECT_EQ(unit_under_test.GetAccelerometerHistory().GetSize(), 5);
+    EXPECT_EQ(unit_under_test.GetMagnetometerHistory().GetSize(), 0);
+
+    device.SetMagnetometerDataReady(true);
+    EXPECT_EQ(unit_under_test.Update(6000), types::DriverStatus::OK);
+
+    EXPECT_EQ(unit_under_test.GetGyroscopeHistory().GetSize(), 6);
+    EXPECT_EQ(unit_under_test.GetMagnetometerHistory().GetSize(), 1);
+  }
+}
+
 }  // namespace
 
 int main(int argc, char **argv) {
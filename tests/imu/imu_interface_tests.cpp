@@ -25,6 +25,12 @@ class ImuInterfaceTests : public ::testing::Test {
         .WillByDefault(Return(sensor_values_magnetometer));
     ON_CALL(*mock_mpu9255_, GetTemperature)
         .WillByDefault(Return(17));
+    ON_CALL(*mock_mpu9255_, GetCalibratedGyroscope)
+        .WillByDefault(Return(calibrated_values_gyroscope));
+    ON_CALL(*mock_mpu9255_, GetCalibratedAccelerometer)
+        .WillByDefault(Return(calibrated_values_accelerometer));
+    ON_CALL(*mock_mpu9255_, GetCalibratedMagnetometer)
+        .WillByDefault(Return(calibrated_values_magnetometer));
   }
 
   virtual void ConfigureUnitUnderTest() {
@@ -38,6 +44,9 @@ class ImuInterfaceTests : public ::testing::Test {
   types::EuclideanVector<std::int16_t> sensor_values_gyroscope{1, 2, 3};
   types::EuclideanVector<std::int16_t> sensor_values_accelerometer{4, 5, 6};
   types::EuclideanVector<std::int16_t> sensor_values_magnetometer{7, 8, 9};
+  types::EuclideanVector<float> calibrated_values_gyroscope{1.25f, 2.5f, 3.75f};
+  types::EuclideanVector<float> calibrated_values_accelerometer{0.03f, -0.02f, 0.98f};
+  types::EuclideanVector<float> calibrated_values_magnetometer{7.5f, 8.5f, 9.5f};
 };
 
 TEST_F(ImuInterfaceTests, interface_Init) {
@@ -49,6 +58,15 @@ TEST_F(ImuInterfaceTests, interface_Init) {
   EXPECT_EQ(unit_under_test_->Init(), types::DriverStatus::OK);
 }
 
+TEST_F(ImuInterfaceTests, interface_set_sample_rate) {
+  EXPECT_CALL(*mock_mpu9255_, SetSampleRate(500, types::ImuLowPassFilter::BANDWIDTH_92_HZ, 250))
+      .WillOnce(Return(types::DriverStatus::OK));
+
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->SetSampleRate(500, types::ImuLowPassFilter::BANDWIDTH_92_HZ, 250), types::DriverStatus::OK);
+}
+
 TEST_F(ImuInterfaceTests, interface_Update) {
   ON_CALL(*mock_mpu9255_, Update)
       .WillByDefault(Return(types::DriverStatus::OK));
@@ -58,6 +76,55 @@ TEST_F(ImuInterfaceTests, interface_Update) {
   EXPECT_EQ(unit_under_test_->Update(), types::DriverStatus::OK);
 }
 
+TEST_F(ImuInterfaceTests, interface_update_with_timestamp_records_history) {
+  ON_CALL(*mock_mpu9255_, Update)
+      .WillByDefault(Return(types::DriverStatus::OK));
+  ON_CALL(*mock_mpu9255_, GetSensorUpdate)
+      .WillByDefault(Return(types::ImuSensorUpdate{true, true, true, true}));
+  EXPECT_CALL(*mock_mpu9255_, GetCalibratedAccelerometer)
+      .WillOnce(Return(types::EuclideanVector<float>{0.03f, -0.02f, 0.98f}))
+      .WillOnce(Return(types::EuclideanVector<float>{0.05f, -0.04f, 1.02f}));
+
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->Update(1000), types::DriverStatus::OK);
+  EXPECT_EQ(unit_under_test_->Update(2000), types::DriverStatus::OK);
+
+  // The calibrated values keep the fraction of a g the rounded GetAccelerometer() drops
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+  EXPECT_EQ(unit_under_test_->GetAccelerometerHistory().GetAt(1500, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 0.04f);
+  EXPECT_FLOAT_EQ(sample.y, -0.03f);
+  EXPECT_FLOAT_EQ(sample.z, 1.0f);
+  EXPECT_EQ(unit_under_test_->GetGyroscopeHistory().GetSize(), 2);
+  EXPECT_EQ(unit_under_test_->GetMagnetometerHistory().GetSize(), 2);
+}
+
+TEST_F(ImuInterfaceTests, interface_failed_update_with_timestamp_records_nothing) {
+  ON_CALL(*mock_mpu9255_, Update)
+      .WillByDefault(Return(types::DriverStatus::HAL_ERROR));
+
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->Update(1000), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(unit_under_test_->GetGyroscopeHistory().GetSize(), 0);
+}
+
+TEST_F(ImuInterfaceTests, interface_update_with_timestamp_records_each_sensor_on_its_own) {
+  ON_CALL(*mock_mpu9255_, Update)
+      .WillByDefault(Return(types::DriverStatus::HAL_ERROR));
+  ON_CALL(*mock_mpu9255_, GetSensorUpdate)
+      .WillByDefault(Return(types::ImuSensorUpdate{true, true, false, false}));
+
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->Update(1000), types::DriverStatus::HAL_ERROR);
+
+  EXPECT_EQ(unit_under_test_->GetGyroscopeHistory().GetSize(), 1);
+  EXPECT_EQ(unit_under_test_->GetAccelerometerHistory().GetSize(), 1);
+  EXPECT_EQ(unit_under_test_->GetMagnetometerHistory().GetSize(), 0);
+}
+
 TEST_F(ImuInterfaceTests, interface_set_gyroscope_sensitivity_finest) {
   ON_CALL(*mock_mpu9255_, GetGyroscopeSensitivity)
       .WillByDefault(Return(types::ImuSensitivity::FINEST));
@@ -192,6 +259,17 @@ TEST_F(ImuInterfaceTests, interface_get_accelerometer) {
   EXPECT_EQ(accelerometer_return.z, expected_value.z);
 }
 
+TEST_F(ImuInterfaceTests, interface_get_calibrated_gyroscope_and_accelerometer) {
+  EXPECT_CALL(*mock_mpu9255_, GetCalibratedGyroscope).WillOnce(Return(types::EuclideanVector<float>{0.25f, -0.5f, 1.5f}));
+  EXPECT_CALL(*mock_mpu9255_, GetCalibratedAccelerometer).WillOnce(Return(types::EuclideanVector<float>{0.03f, 0.0f, -1.0f}));
+  ConfigureUnitUnderTest();
+
+  auto gyroscope_return = unit_under_test_->GetCalibratedGyroscope();
+  auto accelerometer_return = unit_under_test_->GetCalibratedAccelerometer();
+  EXPECT_FLOAT_EQ(gyroscope_return.y, -0.5f);
+  EXPECT_FLOAT_EQ(accelerometer_return.x, 0.03f);
+}
+
 TEST_F(ImuInterfaceTests, interface_get_magnetometer) {
   ConfigureUnitUnderTest();
 
@@ -4,6 +4,7 @@
 #include "mock_i2c.hpp"
 
 using ::testing::_;
+using ::testing::AnyNumber;
 using ::testing::NiceMock;
 using ::testing::Return;
 
@@ -27,6 +28,8 @@ class MagnetometerTests : public ::testing::Test {
         .WillByDefault(Return(answer_to_who_am_i_AK8963));
     ON_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::MAGNETOMETER_MEASUREMENT_DATA, _, _))
         .WillByDefault(Return(answer_to_update));
+    ON_CALL(*i2c_handler_, ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::EXT_SENS_DATA_00, _, _))
+        .WillByDefault(Return(answer_to_external_sensor_data));
   }
 
   virtual void ConfigureUnitUnderTest() {
@@ -45,6 +48,12 @@ class MagnetometerTests : public ::testing::Test {
       types::DriverStatus::OK, {0b11111000, 0b01111111, 0, 0, 0b00001000, 0b10000000, 0}};
   std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_to_update_magnetic_overflow{
       types::DriverStatus::OK, {0b11111000, 0b01111111, 0, 0, 0b00001000, 0b10000000, 0x08}};
+  std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_to_external_sensor_data{
+      types::DriverStatus::OK, {0b00000001, 0b11111000, 0b01111111, 0, 0, 0b00001000, 0b10000000, 0}};
+  std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_to_external_sensor_data_not_ready{
+      types::DriverStatus::OK, {0b00000000, 0b11111000, 0b01111111, 0, 0, 0b00001000, 0b10000000, 0}};
+  std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_to_external_sensor_data_magnetic_overflow{
+      types::DriverStatus::OK, {0b00000001, 0b11111000, 0b01111111, 0, 0, 0b00001000, 0b10000000, 0x08}};
   std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_to_measurement_ready{
       types::DriverStatus::OK, {0b00000001}};
   std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_to_measurement_not_ready{
@@ -53,6 +62,8 @@ class MagnetometerTests : public ::testing::Test {
       types::DriverStatus::OK, {0, 15}};
   std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_calibration_values{
       types::DriverStatus::OK, {128, 128, 128}};
+  std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_uneven_calibration_values{
+      types::DriverStatus::OK, {0, 255, 77}};
   std::pair<types::DriverStatus, std::vector<std::uint8_t>> answer_invalid{
       types::DriverStatus::HAL_ERROR, {}};
 };
@@ -82,6 +93,7 @@ TEST_F(MagnetometerTests, Update) {
   unit_under_test_->Init(i2c_address_);
   auto update_return = unit_under_test_->Update();
   EXPECT_EQ(update_return, types::DriverStatus::OK);
+  EXPECT_TRUE(unit_under_test_->HasNewSample());
 }
 
 TEST_F(MagnetometerTests, Update_without_Init_first) {
@@ -117,6 +129,24 @@ TEST_F(MagnetometerTests, Get_without_Update_first) {
 TEST_F(MagnetometerTests, Update_but_measurement_is_not_ready) {
   ON_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::AK8963_ST1, _, _))
       .WillByDefault(Return(answer_to_measurement_not_ready));
+  EXPECT_CALL(*i2c_handler_, ReadContentFromRegister(_, _, _, _))
+      .Times(AnyNumber());
+  EXPECT_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::MAGNETOMETER_MEASUREMENT_DATA, _, _))
+      .Times(0);
+
+  ConfigureUnitUnderTest();
+
+  unit_under_test_->Init(i2c_address_);
+  auto update_return = unit_under_test_->Update();
+
+  EXPECT_EQ(update_return, types::DriverStatus::OK);
+  EXPECT_FALSE(unit_under_test_->HasNewSample());
+  EXPECT_EQ(unit_under_test_->Get().x, 0);
+}
+
+TEST_F(MagnetometerTests, Update_status_read_fails) {
+  ON_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::AK8963_ST1, _, _))
+      .WillByDefault(Return(answer_invalid));
 
   ConfigureUnitUnderTest();
 
@@ -124,6 +154,7 @@ TEST_F(MagnetometerTests, Update_but_measurement_is_not_ready) {
   auto update_return = unit_under_test_->Update();
 
   EXPECT_EQ(update_return, types::DriverStatus::HAL_ERROR);
+  EXPECT_FALSE(unit_under_test_->HasNewSample());
 }
 
 TEST_F(MagnetometerTests, Update_magnetic_overflow_occured) {
@@ -151,6 +182,46 @@ TEST_F(MagnetometerTests, full) {
   EXPECT_EQ(get_return.z, expected_value.z);
 }
 
+TEST_F(MagnetometerTests, full_with_sensitivity_adjustment) {
+  ON_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::AK8963_ASAX, _, _))
+      .WillByDefault(Return(answer_uneven_calibration_values));
+
+  ConfigureUnitUnderTest();
+
+  // Reference is the per update conversion: factor ADC to micro tesla, then sensitivity adjustment
+  const auto adc_2_magnetometer = static_cast<float>(4912.0f / 32760.0f);
+  const auto adjust = [](std::uint8_t asa) { return static_cast<float>((asa - 128) * 0.5 / 128.0 + 1.0); };
+  types::EuclideanVector<std::int16_t> expected_value{
+      static_cast<std::int16_t>(adc_2_magnetometer * static_cast<float>(32760) * adjust(0)),
+      static_cast<std::int16_t>(adc_2_magnetometer * static_cast<float>(0) * adjust(255)),
+      static_cast<std::int16_t>(adc_2_magnetometer * static_cast<float>(-32760) * adjust(77))};
+  unit_under_test_->Init(i2c_address_);
+  unit_under_test_->Update();
+  auto get_return = unit_under_test_->Get();
+
+  EXPECT_EQ(get_return.x, expected_value.x);
+  EXPECT_EQ(get_return.y, expected_value.y);
+  EXPECT_EQ(get_return.z, expected_value.z);
+}
+
+TEST_F(MagnetometerTests, sensitivity_adjustment_keeps_the_rounding_of_the_per_update_conversion) {
+  // Raw values and adjustments where the cached product of both factors would round to the next unit
+  ON_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::AK8963_ASAX, _, _))
+      .WillByDefault(Return(std::pair<types::DriverStatus, std::vector<std::uint8_t>>{types::DriverStatus::OK, {3, 4, 5}}));
+  ON_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::MAGNETOMETER_MEASUREMENT_DATA, _, _))
+      .WillByDefault(Return(std::pair<types::DriverStatus, std::vector<std::uint8_t>>{types::DriverStatus::OK, {0xD1, 0x2A, 0x9C, 0x52, 0x6D, 0x90, 0}}));
+
+  ConfigureUnitUnderTest();
+
+  unit_under_test_->Init(i2c_address_);
+  EXPECT_EQ(unit_under_test_->Update(), types::DriverStatus::OK);
+  auto get_return = unit_under_test_->Get();
+
+  EXPECT_EQ(get_return.x, 840);
+  EXPECT_EQ(get_return.y, 1634);
+  EXPECT_EQ(get_return.z, -2225);
+}
+
 TEST_F(MagnetometerTests, connection_failed_after_successful_init) {
   ON_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::MAGNETOMETER_MEASUREMENT_DATA, _, _))
       .WillByDefault(Return(answer_invalid));
@@ -174,6 +245,80 @@ TEST_F(MagnetometerTests, read_bytesize_mismatch) {
   EXPECT_EQ(init_return, types::DriverStatus::HAL_ERROR);
 }
 
+TEST_F(MagnetometerTests, SetReadMode_without_Init_first) {
+  ConfigureUnitUnderTest();
+
+  auto set_return = unit_under_test_->SetReadMode(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  EXPECT_EQ(set_return, types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(MagnetometerTests, auxiliary_i2c_master_full) {
+  EXPECT_CALL(*i2c_handler_, ReadContentFromRegister(_, _, _, _))
+      .Times(AnyNumber());
+  EXPECT_CALL(*i2c_handler_, ReadContentFromRegister(_, imu::AK8963_ST1, _, _))
+      .Times(0);
+  EXPECT_CALL(*i2c_handler_, ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::EXT_SENS_DATA_00, imu::AK8963_ST1_TO_ST2_LENGTH_IN_BYTES, _))
+      .Times(1);
+
+  ConfigureUnitUnderTest();
+
+  types::EuclideanVector<std::int16_t> expected_value{4912, 0, -4912};
+  unit_under_test_->Init(i2c_address_);
+  auto set_return = unit_under_test_->SetReadMode(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  auto update_return = unit_under_test_->Update();
+  auto get_return = unit_under_test_->Get();
+
+  EXPECT_EQ(set_return, types::DriverStatus::OK);
+  EXPECT_EQ(update_return, types::DriverStatus::OK);
+  EXPECT_EQ(get_return.x, expected_value.x);
+  EXPECT_EQ(get_return.y, expected_value.y);
+  EXPECT_EQ(get_return.z, expected_value.z);
+}
+
+TEST_F(MagnetometerTests, auxiliary_i2c_master_measurement_is_not_ready) {
+  ON_CALL(*i2c_handler_, ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::EXT_SENS_DATA_00, _, _))
+      .WillByDefault(Return(answer_to_external_sensor_data_not_ready));
+
+  ConfigureUnitUnderTest();
+
+  unit_under_test_->Init(i2c_address_);
+  unit_under_test_->SetReadMode(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  auto update_return = unit_under_test_->Update();
+
+  EXPECT_EQ(update_return, types::DriverStatus::OK);
+  EXPECT_FALSE(unit_under_test_->HasNewSample());
+  EXPECT_EQ(unit_under_test_->Get().x, 0);
+}
+
+TEST_F(MagnetometerTests, auxiliary_i2c_master_magnetic_overflow_occured) {
+  ON_CALL(*i2c_handler_, ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::EXT_SENS_DATA_00, _, _))
+      .WillByDefault(Return(answer_to_external_sensor_data_magnetic_overflow));
+
+  ConfigureUnitUnderTest();
+
+  unit_under_test_->Init(i2c_address_);
+  unit_under_test_->SetReadMode(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  auto update_return = unit_under_test_->Update();
+
+  EXPECT_EQ(update_return, types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(MagnetometerTests, back_to_bypass_after_auxiliary_i2c_master) {
+  ConfigureUnitUnderTest();
+
+  unit_under_test_->Init(i2c_address_);
+  unit_under_test_->SetReadMode(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  unit_under_test_->SetReadMode(types::MagnetometerReadMode::BYPASS);
+
+  EXPECT_CALL(*i2c_handler_, ReadContentFromRegister(_, _, _, _))
+      .Times(AnyNumber());
+  EXPECT_CALL(*i2c_handler_, ReadContentFromRegister(imu::AK8963_ADDRESS, imu::MAGNETOMETER_MEASUREMENT_DATA, 7, _))
+      .Times(1);
+  auto update_return = unit_under_test_->Update();
+
+  EXPECT_EQ(update_return, types::DriverStatus::OK);
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
@@ -0,0 +1,212 @@
+#include <gmock/gmock.h>
+#include <array>
+#include "gtest/gtest.h"
+#include "mock_spi.hpp"
+#include "mpu9255_spi_transport.hpp"
+#include "simulated_mpu9255.hpp"
+
+using ::testing::_;
+using ::testing::DoAll;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SaveArg;
+
+namespace {
+
+class Mpu9255SpiTransportTests : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    ON_CALL(*spi_, Write)
+        .WillByDefault(Return(types::DriverStatus::OK));
+    ON_CALL(*spi_, Transfer)
+        .WillByDefault(Return(types::DriverStatus::OK));
+    ON_CALL(*spi_, SetClock)
+        .WillByDefault(Return(types::DriverStatus::OK));
+  }
+
+  virtual void ConfigureUnitUnderTest() {
+    unit_under_test_ = std::make_unique<imu::Mpu9255SpiTransport>(spi_);
+  }
+
+  std::shared_ptr<spi::MockSPI> spi_ = std::make_shared<NiceMock<spi::MockSPI>>();
+  std::unique_ptr<imu::Mpu9255SpiTransport> unit_under_test_;
+};
+
+TEST_F(Mpu9255SpiTransportTests, read_sets_read_bit_and_strips_address_byte) {
+  std::vector<std::uint8_t> mosi_data;
+  EXPECT_CALL(*spi_, Transfer)
+      .WillOnce([&mosi_data](std::vector<std::uint8_t>& mosi, std::vector<std::uint8_t>& miso) {
+        mosi_data = mosi;
+        miso = {0xFF, 0x12, 0x34};
+        return types::DriverStatus::OK;
+      });
+
+  ConfigureUnitUnderTest();
+
+  auto read_return = unit_under_test_->ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::TEMP_MEASUREMENT_DATA, 2);
+
+  EXPECT_EQ(read_return.first, types::DriverStatus::OK);
+  EXPECT_EQ(read_return.second, std::vector<std::uint8_t>({0x12, 0x34}));
+  EXPECT_EQ(mosi_data, std::vector<std::uint8_t>({imu::TEMP_MEASUREMENT_DATA | 0x80, 0, 0}));
+}
+
+TEST_F(Mpu9255SpiTransportTests, read_spi_error_is_forwarded) {
+  ON_CALL(*spi_, Transfer)
+      .WillByDefault(Return(types::DriverStatus::TIMEOUT));
+
+  ConfigureUnitUnderTest();
+
+  auto read_return = unit_under_test_->ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::TEMP_MEASUREMENT_DATA, 2);
+
+  EXPECT_EQ(read_return.first, types::DriverStatus::TIMEOUT);
+  EXPECT_TRUE(read_return.second.empty());
+}
+
+TEST_F(Mpu9255SpiTransportTests, read_from_unknown_address) {
+  EXPECT_CALL(*spi_, Transfer)
+      .Times(0);
+
+  ConfigureUnitUnderTest();
+
+  auto read_return = unit_under_test_->ReadContentFromRegister(0x42, imu::TEMP_MEASUREMENT_DATA, 2);
+
+  EXPECT_EQ(read_return.first, types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(Mpu9255SpiTransportTests, write_clears_read_bit) {
+  std::vector<std::uint8_t> mosi_data;
+  EXPECT_CALL(*spi_, Write)
+      .WillOnce(DoAll(SaveArg<0>(&mosi_data), Return(types::DriverStatus::OK)));
+
+  ConfigureUnitUnderTest();
+
+  auto write_return = unit_under_test_->Write(imu::MPU9255_ADDRESS, {imu::GYRO_CONFIG, 0x18});
+
+  EXPECT_EQ(write_return, types::DriverStatus::OK);
+  EXPECT_EQ(mosi_data, std::vector<std::uint8_t>({imu::GYRO_CONFIG, 0x18}));
+}
+
+TEST_F(Mpu9255SpiTransportTests, write_user_ctrl_keeps_i2c_interface_disabled) {
+  std::vector<std::uint8_t> mosi_data;
+  EXPECT_CALL(*spi_, Write)
+      .WillOnce(DoAll(SaveArg<0>(&mosi_data), Return(types::DriverStatus::OK)));
+
+  ConfigureUnitUnderTest();
+
+  unit_under_test_->Write(imu::MPU9255_ADDRESS, {imu::USER_CTRL, 0x20});
+
+  EXPECT_EQ(mosi_data, std::vector<std::uint8_t>({imu::USER_CTRL, 0x30}));
+}
+
+TEST_F(Mpu9255SpiTransportTests, write_without_data) {
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->Write(imu::MPU9255_ADDRESS, {imu::USER_CTRL}), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test_->Write(imu::AK8963_ADDRESS, {imu::AK8963_CNTL, 0x01, 0x02}), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(Mpu9255SpiTransportTests, ak8963_read_is_tunnelled_through_slave4) {
+  imu::SimulatedMpu9255 device;
+  auto spi = std::make_shared<imu::SimulatedSPIBus>(device);
+  auto unit_under_test = std::make_unique<imu::Mpu9255SpiTransport>(spi);
+
+  auto read_return = unit_under_test->ReadContentFromRegister(imu::AK8963_ADDRESS, imu::AK8963_ASAX, 3);
+
+  EXPECT_EQ(read_return.first, types::DriverStatus::OK);
+  EXPECT_EQ(read_return.second, std::vector<std::uint8_t>({128, 128, 128}));
+  EXPECT_EQ(device.GetRegister(imu::MPU9255_ADDRESS, imu::USER_CTRL), 0x30);
+}
+
+TEST_F(Mpu9255SpiTransportTests, ak8963_write_is_tunnelled_through_slave4) {
+  imu::SimulatedMpu9255 device;
+  auto spi = std::make_shared<imu::SimulatedSPIBus>(device);
+  auto unit_under_test = std::make_unique<imu::Mpu9255SpiTransport>(spi);
+
+  auto write_return = unit_under_test->Write(imu::AK8963_ADDRESS, {imu::AK8963_CNTL, 0x12});
+
+  EXPECT_EQ(write_return, types::DriverStatus::OK);
+  EXPECT_EQ(device.GetRegister(imu::AK8963_ADDRESS, imu::AK8963_CNTL), 0x12);
+}
+
+TEST_F(Mpu9255SpiTransportTests, ak8963_slave4_never_done) {
+  ON_CALL(*spi_, Transfer)
+      .WillByDefault([](std::vector<std::uint8_t>& mosi, std::vector<std::uint8_t>& miso) {
+        std::fill(miso.begin(), miso.end(), 0);
+        return types::DriverStatus::OK;
+      });
+
+  ConfigureUnitUnderTest();
+
+  auto read_return = unit_under_test_->ReadContentFromRegister(imu::AK8963_ADDRESS, imu::WHO_AM_I_AK8963_REGISTER, 1);
+
+  EXPECT_EQ(read_return.first, types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(Mpu9255SpiTransportTests, ak8963_slave4_nack) {
+  ON_CALL(*spi_, Transfer)
+      .WillByDefault([](std::vector<std::uint8_t>& mosi, std::vector<std::uint8_t>& miso) {
+        std::fill(miso.begin(), miso.end(), 0x10);
+        return types::DriverStatus::OK;
+      });
+  EXPECT_CALL(*spi_, Transfer)
+      .Times(1);
+
+  ConfigureUnitUnderTest();
+
+  auto read_return = unit_under_test_->ReadContentFromRegister(imu::AK8963_ADDRESS, imu::WHO_AM_I_AK8963_REGISTER, 1);
+
+  EXPECT_EQ(read_return.first, types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(Mpu9255SpiTransportTests, sensor_reads_use_fast_clock_and_everything_else_slow_clock) {
+  std::vector<std::uint32_t> clocks;
+  ON_CALL(*spi_, SetClock)
+      .WillByDefault([&clocks](std::uint32_t clock_in_hz) {
+        clocks.push_back(clock_in_hz);
+        return types::DriverStatus::OK;
+      });
+
+  ConfigureUnitUnderTest();
+
+  unit_under_test_->Write(imu::MPU9255_ADDRESS, {imu::GYRO_CONFIG, 0x18});
+  unit_under_test_->ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::SENSOR_DATA_BURST_START, imu::SENSOR_DATA_BURST_WITH_MAGNETOMETER_LENGTH_IN_BYTES);
+  std::array<std::uint8_t, imu::SENSOR_DATA_BURST_LENGTH_IN_BYTES> burst{};
+  unit_under_test_->ReadContentFromRegisterIntoBuffer(imu::MPU9255_ADDRESS, imu::SENSOR_DATA_BURST_START, burst.data(), burst.size());
+  unit_under_test_->ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::WHO_AM_I_MPU9255_REGISTER, 1);
+  unit_under_test_->ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::I2C_MST_STATUS, 2);
+
+  EXPECT_EQ(clocks, std::vector<std::uint32_t>({1000000, 20000000, 1000000}));
+}
+
+TEST_F(Mpu9255SpiTransportTests, clock_error_aborts_the_transaction) {
+  ON_CALL(*spi_, SetClock)
+      .WillByDefault(Return(types::DriverStatus::HAL_ERROR));
+  EXPECT_CALL(*spi_, Write)
+      .Times(0);
+  EXPECT_CALL(*spi_, Transfer)
+      .Times(0);
+
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->Write(imu::MPU9255_ADDRESS, {imu::GYRO_CONFIG, 0x18}), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(unit_under_test_->ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::TEMP_MEASUREMENT_DATA, 2).first, types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(Mpu9255SpiTransportTests, ak8963_tunnel_keeps_mpu9255_clock_limits) {
+  imu::SimulatedMpu9255 device;
+  auto spi = std::make_shared<imu::SimulatedSPIBus>(device);
+  auto unit_under_test = std::make_unique<imu::Mpu9255SpiTransport>(spi);
+
+  unit_under_test->Write(imu::AK8963_ADDRESS, {imu::AK8963_CNTL, 0x12});
+  unit_under_test->ReadContentFromRegister(imu::MPU9255_ADDRESS, imu::SENSOR_DATA_BURST_START, imu::SENSOR_DATA_BURST_WITH_MAGNETOMETER_LENGTH_IN_BYTES);
+  unit_under_test->ReadContentFromRegister(imu::AK8963_ADDRESS, imu::AK8963_ASAX, 3);
+
+  EXPECT_EQ(spi->GetClockViolations(), 0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -8,6 +8,7 @@
 #include "mpu9255.hpp"
 
 using ::testing::_;
+using ::testing::AnyNumber;
 using ::testing::NiceMock;
 using ::testing::Return;
 
@@ -135,6 +136,127 @@ TEST_F(Mpu9255Tests, mpu9255_Update_accelerometer_failed) {
   EXPECT_EQ(unit_under_test_->Update(), types::DriverStatus::HAL_ERROR);
 }
 
+TEST_F(Mpu9255Tests, mpu9255_Init_bypass_does_not_touch_read_mode) {
+  EXPECT_CALL(*mock_magnetometer_, SetReadMode)
+      .Times(0);
+
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->Init(), types::DriverStatus::OK);
+}
+
+TEST_F(Mpu9255Tests, mpu9255_Init_auxiliary_i2c_master) {
+  ON_CALL(*i2c_handler_, Write)
+      .WillByDefault(Return(types::DriverStatus::OK));
+  EXPECT_CALL(*i2c_handler_, Write(_, _, _))
+      .Times(AnyNumber());
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::I2C_MST_CTRL, 0x4D}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::I2C_SLV0_ADDR, 0x80 | imu::AK8963_ADDRESS}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::I2C_SLV0_REG, imu::AK8963_ST1}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::I2C_SLV0_CTRL, 0x80 | imu::AK8963_ST1_TO_ST2_LENGTH_IN_BYTES}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::USER_CTRL, 0x20}), _))
+      .Times(1);
+  EXPECT_CALL(*mock_magnetometer_, SetReadMode(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER))
+      .WillOnce(Return(types::DriverStatus::OK));
+
+  unit_under_test_ = std::make_unique<imu::Mpu9255>(i2c_handler_, types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  unit_under_test_->UnitTestSetGyroscope(std::move(mock_gyroscope_));
+  unit_under_test_->UnitTestSetAccelerometer(std::move(mock_accelerometer_));
+  unit_under_test_->UnitTestSetMagnetometer(std::move(mock_magnetometer_));
+  unit_under_test_->UnitTestSetTemperature(std::move(mock_temperature_));
+
+  EXPECT_EQ(unit_under_test_->Init(), types::DriverStatus::OK);
+  EXPECT_EQ(unit_under_test_->IsInitialized(), true);
+}
+
+TEST_F(Mpu9255Tests, mpu9255_Init_auxiliary_i2c_master_failed) {
+  ON_CALL(*i2c_handler_, Write)
+      .WillByDefault(Return(types::DriverStatus::HAL_ERROR));
+
+  unit_under_test_ = std::make_unique<imu::Mpu9255>(i2c_handler_, types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  unit_under_test_->UnitTestSetGyroscope(std::move(mock_gyroscope_));
+  unit_under_test_->UnitTestSetAccelerometer(std::move(mock_accelerometer_));
+  unit_under_test_->UnitTestSetMagnetometer(std::move(mock_magnetometer_));
+  unit_under_test_->UnitTestSetTemperature(std::move(mock_temperature_));
+
+  EXPECT_EQ(unit_under_test_->Init(), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(unit_under_test_->IsInitialized(), false);
+}
+
+TEST_F(Mpu9255Tests, mpu9255_SetSampleRate) {
+  ON_CALL(*i2c_handler_, Write)
+      .WillByDefault(Return(types::DriverStatus::OK));
+
+  ConfigureUnitUnderTest();
+  unit_under_test_->Init();
+
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::CONFIG, 2}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::ACCEL_CONFIG2, 2}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::SMPLRT_DIV, 1}), _))
+      .Times(1);
+
+  EXPECT_EQ(unit_under_test_->SetSampleRate(500, types::ImuLowPassFilter::BANDWIDTH_92_HZ, 250), types::DriverStatus::OK);
+}
+
+TEST_F(Mpu9255Tests, mpu9255_SetSampleRate_lowest_output_data_rate) {
+  ConfigureUnitUnderTest();
+  unit_under_test_->Init();
+
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::SMPLRT_DIV, 49}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::CONFIG, 6}), _))
+      .Times(1);
+  EXPECT_CALL(*i2c_handler_, Write(imu::MPU9255_ADDRESS, std::vector<std::uint8_t>({imu::ACCEL_CONFIG2, 6}), _))
+      .Times(1);
+
+  // Even the narrowest filter aliases below a loop frequency of 10.1 Hz
+  EXPECT_EQ(unit_under_test_->SetSampleRate(4, types::ImuLowPassFilter::BANDWIDTH_5_HZ, 4), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test_->SetSampleRate(10, types::ImuLowPassFilter::BANDWIDTH_5_HZ, 10), types::DriverStatus::INPUT_ERROR);
+  // Sample rate divider is limited to 256
+  EXPECT_EQ(unit_under_test_->SetSampleRate(2, types::ImuLowPassFilter::BANDWIDTH_5_HZ, 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test_->SetSampleRate(20, types::ImuLowPassFilter::BANDWIDTH_5_HZ, 20), types::DriverStatus::OK);
+}
+
+TEST_F(Mpu9255Tests, mpu9255_SetSampleRate_not_matching_loop) {
+  ConfigureUnitUnderTest();
+  unit_under_test_->Init();
+
+  EXPECT_CALL(*i2c_handler_, Write)
+      .Times(0);
+
+  // Output data rate is no divider of 1 kHz
+  EXPECT_EQ(unit_under_test_->SetSampleRate(300, types::ImuLowPassFilter::BANDWIDTH_41_HZ, 100), types::DriverStatus::INPUT_ERROR);
+  // Loop is faster than the output data rate and reads the same sample twice
+  EXPECT_EQ(unit_under_test_->SetSampleRate(250, types::ImuLowPassFilter::BANDWIDTH_41_HZ, 500), types::DriverStatus::INPUT_ERROR);
+  // Output data rate is no multiple of the loop frequency
+  EXPECT_EQ(unit_under_test_->SetSampleRate(500, types::ImuLowPassFilter::BANDWIDTH_41_HZ, 200), types::DriverStatus::INPUT_ERROR);
+  // Filter bandwidth is above the Nyquist frequency of the loop
+  EXPECT_EQ(unit_under_test_->SetSampleRate(1000, types::ImuLowPassFilter::BANDWIDTH_184_HZ, 250), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test_->SetSampleRate(0, types::ImuLowPassFilter::BANDWIDTH_184_HZ, 0), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(Mpu9255Tests, mpu9255_SetSampleRate_without_Init) {
+  ConfigureUnitUnderTest();
+
+  EXPECT_EQ(unit_under_test_->SetSampleRate(1000, types::ImuLowPassFilter::BANDWIDTH_41_HZ, 500), types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(Mpu9255Tests, mpu9255_SetSampleRate_write_failed) {
+  ON_CALL(*i2c_handler_, Write)
+      .WillByDefault(Return(types::DriverStatus::HAL_ERROR));
+
+  ConfigureUnitUnderTest();
+  unit_under_test_->Init();
+
+  EXPECT_EQ(unit_under_test_->SetSampleRate(1000, types::ImuLowPassFilter::BANDWIDTH_41_HZ, 500), types::DriverStatus::HAL_ERROR);
+}
+
 TEST_F(Mpu9255Tests, mpu9255_SetGyroscopeSensitivity) {
   ON_CALL(*mock_gyroscope_, GetSensitivity)
       .WillByDefault(Return(types::ImuSensitivity::FINEST));
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "mpu9255.hpp"
+#include "simulated_mpu9255.hpp"
+
+namespace {
+
+/**
+ * Runs the interface composed and the statically composed MPU9255 against the same
+ * simulated device and compares their results and the host time per Update().
+ */
+class StaticCompositionTests : public ::testing::Test {
+ protected:
+  static constexpr int UPDATES = 20000;
+
+  virtual void SetUp() {
+    interface_bus_ = std::make_shared<imu::SimulatedI2CBus>(interface_device_);
+    static_bus_ = std::make_shared<imu::SimulatedI2CBus>(static_device_);
+  }
+
+  template <typename Mpu9255Type>
+  auto MeasureUpdateTimeInNanoSeconds(Mpu9255Type& mpu9255) -> double {
+    EXPECT_EQ(mpu9255.Init(), types::DriverStatus::OK);
+
+    const auto start = std::chrono::steady_clock::now();
+    for (int update = 0; update < UPDATES; update++)
+      mpu9255.Update();
+    const auto duration = std::chrono::steady_clock::now() - start;
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count()) / UPDATES;
+  }
+
+  auto Report(const std::string& name, const double time_in_ns) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << time_in_ns << " ns host time per update" << std::endl;
+    RecordProperty(name, std::to_string(time_in_ns));
+  }
+
+  // Separate devices, the auxiliary I2C master of one initialization would disable the bypass of the other
+  imu::SimulatedMpu9255 interface_device_;
+  imu::SimulatedMpu9255 static_device_;
+  std::shared_ptr<imu::SimulatedI2CBus> interface_bus_;
+  std::shared_ptr<imu::SimulatedI2CBus> static_bus_;
+};
+
+TEST_F(StaticCompositionTests, update_before_init_fails) {
+  imu::StaticMpu9255 unit_under_test(static_bus_);
+
+  EXPECT_EQ(unit_under_test.Update(), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(unit_under_test.GetGyroscope().x, -1);
+  EXPECT_EQ(unit_under_test.GetTemperature(), -1);
+}
+
+TEST_F(StaticCompositionTests, both_compositions_deliver_the_same_measurements) {
+  for (const auto read_mode : {types::MagnetometerReadMode::BYPASS, types::MagnetometerReadMode::AUXILIARY_I2C_MASTER}) {
+    imu::SimulatedMpu9255 interface_device;
+    imu::SimulatedMpu9255 static_device;
+    imu::Mpu9255 interface_composed(std::make_shared<imu::SimulatedI2CBus>(interface_device), read_mode);
+    imu::StaticMpu9255 statically_composed(std::make_shared<imu::SimulatedI2CBus>(static_device), read_mode);
+
+    ASSERT_EQ(interface_composed.Init(), types::DriverStatus::OK);
+    ASSERT_EQ(interface_composed.Update(), types::DriverStatus::OK);
+    ASSERT_EQ(statically_composed.Init(), types::DriverStatus::OK);
+    ASSERT_EQ(statically_composed.Update(), types::DriverStatus::OK);
+
+    EXPECT_EQ(statically_composed.GetGyroscope().x, interface_composed.GetGyroscope().x);
+    EXPECT_EQ(statically_composed.GetGyroscope().z, interface_composed.GetGyroscope().z);
+    EXPECT_EQ(statically_composed.GetAccelerometer().y, interface_composed.GetAccelerometer().y);
+    EXPECT_EQ(statically_composed.GetMagnetometer().x, interface_composed.GetMagnetometer().x);
+    EXPECT_EQ(statically_composed.GetMagnetometer().z, interface_composed.GetMagnetometer().z);
+    EXPECT_EQ(statically_composed.GetTemperature(), interface_composed.GetTemperature());
+  }
+}
+
+TEST_F(StaticCompositionTests, sensitivity_is_forwarded_to_the_sensors) {
+  imu::StaticMpu9255 unit_under_test(static_bus_);
+  ASSERT_EQ(unit_under_test.Init(), types::DriverStatus::OK);
+
+  EXPECT_EQ(unit_under_test.SetGyroscopeSensitivity(types::ImuSensitivity::ROUGHEST), types::DriverStatus::OK);
+  EXPECT_EQ(unit_under_test.SetAccelerometerSensitivity(types::ImuSensitivity::FINER), types::DriverStatus::OK);
+
+  EXPECT_EQ(unit_under_test.GetGyroscopeSensitivity(), types::ImuSensitivity::ROUGHEST);
+  EXPECT_EQ(unit_under_test.GetAccelerometerSensitivity(), types::ImuSensitivity::FINER);
+}
+
+TEST_F(StaticCompositionTests, benchmark_interface_against_static_composition) {
+  imu::Mpu9255 interface_composed(interface_bus_, types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  imu::StaticMpu9255 statically_composed(static_bus_, types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+
+  Report("interface_composition", MeasureUpdateTimeInNanoSeconds(interface_composed));
+  Report("static_composition", MeasureUpdateTimeInNanoSeconds(statically_composed));
+  RecordProperty("interface_composition_size_in_bytes", static_cast<int>(sizeof(imu::Mpu9255)));
+  RecordProperty("static_composition_size_in_bytes", static_cast<int>(sizeof(imu::StaticMpu9255)));
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
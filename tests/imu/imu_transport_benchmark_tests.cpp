@@ -0,0 +1,101 @@
+#include <iostream>
+#include "gtest/gtest.h"
+#include "mpu9255.hpp"
+#include "mpu9255_spi_transport.hpp"
+#include "simulated_mpu9255.hpp"
+
+namespace {
+
+/**
+ * Compares the bus time of one Mpu9255::Update on the host bus timing model.
+ * The numbers are pure wire time, HAL and CPU overhead are not part of the model.
+ */
+class TransportBenchmarkTests : public ::testing::Test {
+ protected:
+  static constexpr int UPDATES = 100;
+
+  template <typename Bus>
+  auto MeasureUpdateLatencyInNanoSeconds(imu::Mpu9255& mpu9255, Bus& bus) -> std::uint64_t {
+    EXPECT_EQ(mpu9255.Init(), types::DriverStatus::OK);
+    bus.ResetBusTime();
+
+    for (int update = 0; update < UPDATES; update++)
+      EXPECT_EQ(mpu9255.Update(), types::DriverStatus::OK);
+
+    return bus.GetBusTimeInNanoSeconds() / UPDATES;
+  }
+
+  auto MeasureI2C(const types::MagnetometerReadMode read_mode) -> std::uint64_t {
+    auto i2c = std::make_shared<imu::SimulatedI2CBus>(device_);
+    imu::Mpu9255 mpu9255(i2c, read_mode);
+    return MeasureUpdateLatencyInNanoSeconds(mpu9255, *i2c);
+  }
+
+  auto MeasureSPI(const types::MagnetometerReadMode read_mode) -> std::uint64_t {
+    auto spi = std::make_shared<imu::SimulatedSPIBus>(device_);
+    imu::Mpu9255 mpu9255(std::make_shared<imu::Mpu9255SpiTransport>(spi), read_mode);
+    return MeasureUpdateLatencyInNanoSeconds(mpu9255, *spi);
+  }
+
+  auto Report(const std::string& name, const std::uint64_t latency_in_ns) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << latency_in_ns << " ns bus time per update" << std::endl;
+    RecordProperty(name, std::to_string(latency_in_ns));
+  }
+
+  imu::SimulatedMpu9255 device_;
+};
+
+TEST_F(TransportBenchmarkTests, both_transports_deliver_the_same_measurements) {
+  auto i2c = std::make_shared<imu::SimulatedI2CBus>(device_);
+  imu::Mpu9255 mpu9255_i2c(i2c, types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  auto spi = std::make_shared<imu::SimulatedSPIBus>(device_);
+  imu::Mpu9255 mpu9255_spi(std::make_shared<imu::Mpu9255SpiTransport>(spi), types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+
+  ASSERT_EQ(mpu9255_i2c.Init(), types::DriverStatus::OK);
+  ASSERT_EQ(mpu9255_i2c.Update(), types::DriverStatus::OK);
+  ASSERT_EQ(mpu9255_spi.Init(), types::DriverStatus::OK);
+  ASSERT_EQ(mpu9255_spi.Update(), types::DriverStatus::OK);
+
+  EXPECT_EQ(mpu9255_spi.GetGyroscope().x, mpu9255_i2c.GetGyroscope().x);
+  EXPECT_EQ(mpu9255_spi.GetGyroscope().z, mpu9255_i2c.GetGyroscope().z);
+  EXPECT_EQ(mpu9255_spi.GetAccelerometer().y, mpu9255_i2c.GetAccelerometer().y);
+  EXPECT_EQ(mpu9255_spi.GetMagnetometer().x, mpu9255_i2c.GetMagnetometer().x);
+  EXPECT_EQ(mpu9255_spi.GetMagnetometer().z, mpu9255_i2c.GetMagnetometer().z);
+  EXPECT_NE(mpu9255_spi.GetMagnetometer().x, 0);
+  EXPECT_EQ(mpu9255_spi.GetTemperature(), mpu9255_i2c.GetTemperature());
+}
+
+TEST_F(TransportBenchmarkTests, update_latency_i2c_versus_spi) {
+  const auto i2c_bypass = MeasureI2C(types::MagnetometerReadMode::BYPASS);
+  const auto i2c_auxiliary = MeasureI2C(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+  const auto spi_auxiliary = MeasureSPI(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+
+  Report("i2c_400kHz_bypass", i2c_bypass);
+  Report("i2c_400kHz_auxiliary_i2c_master", i2c_auxiliary);
+  Report("spi_20MHz_auxiliary_i2c_master", spi_auxiliary);
+
+  EXPECT_LT(i2c_auxiliary, i2c_bypass);
+  EXPECT_LT(spi_auxiliary * 10, i2c_auxiliary);
+}
+
+TEST_F(TransportBenchmarkTests, auxiliary_update_reads_all_sensors_in_one_burst) {
+  // Address and register Byte, repeated start with address, 22 data Bytes from ACCEL_XOUT_H to EXT_SENS_DATA_07
+  constexpr std::uint64_t burst_clocks = 9 * (3 + 22) + 3;
+
+  EXPECT_EQ(MeasureI2C(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER), burst_clocks * 1000000000ULL / 400000);
+}
+
+TEST_F(TransportBenchmarkTests, spi_bypass_falls_back_to_the_auxiliary_i2c_master) {
+  const auto spi_bypass = MeasureSPI(types::MagnetometerReadMode::BYPASS);
+  const auto spi_auxiliary = MeasureSPI(types::MagnetometerReadMode::AUXILIARY_I2C_MASTER);
+
+  // Bypass would tunnel every magnetometer read through slave 4
+  EXPECT_EQ(spi_bypass, spi_auxiliary);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -13,7 +13,10 @@ class MockMagnetometer : public MagnetometerInterface {
   MockMagnetometer() : MagnetometerInterface(std::move(std::make_unique<i2c::MockI2C>())) {}
   MOCK_METHOD(types::DriverStatus, Init, (std::uint8_t i2c_address), (noexcept));
   MOCK_METHOD(types::DriverStatus, Update, (), (noexcept));
+  MOCK_METHOD(types::DriverStatus, SetReadMode, (types::MagnetometerReadMode read_mode), (noexcept));
+  MOCK_METHOD(void, SetHardAndSoftIronCalibration, (const types::HardAndSoftIronCalibration& calibration), (noexcept));
   MOCK_METHOD(types::EuclideanVector<std::int16_t>, Get, (), (noexcept));
+  MOCK_METHOD(bool, HasNewSample, (), (noexcept));
 };
 }  // namespace imu
 
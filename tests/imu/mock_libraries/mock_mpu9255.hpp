@@ -13,14 +13,23 @@ class MockMpu9255 : public GenericInertialMeasurementUnit {
   MockMpu9255() : GenericInertialMeasurementUnit(std::move(std::make_unique<i2c::MockI2C>())) {}
   MOCK_METHOD(types::DriverStatus, Init, (), (noexcept));
   MOCK_METHOD(types::DriverStatus, Update, (), (noexcept));
+  MOCK_METHOD(types::ImuSensorUpdate, GetSensorUpdate, (), (noexcept));
   MOCK_METHOD(types::DriverStatus, SetGyroscopeSensitivity, (types::ImuSensitivity gyroscope_sensitivity), (noexcept));
   MOCK_METHOD(types::ImuSensitivity, GetGyroscopeSensitivity, (), (noexcept));
   MOCK_METHOD(types::DriverStatus, SetAccelerometerSensitivity, (types::ImuSensitivity accelerometer_sensitivity), (noexcept));
   MOCK_METHOD(types::ImuSensitivity, GetAccelerometerSensitivity, (), (noexcept));
+  MOCK_METHOD(types::DriverStatus, SetSampleRate, (std::uint16_t output_data_rate_in_hz, types::ImuLowPassFilter low_pass_filter, std::uint16_t loop_frequency_in_hz), (noexcept));
   MOCK_METHOD(types::EuclideanVector<std::int16_t>, GetGyroscope, (), (noexcept));
   MOCK_METHOD(types::EuclideanVector<std::int16_t>, GetAccelerometer, (), (noexcept));
   MOCK_METHOD(types::EuclideanVector<std::int16_t>, GetMagnetometer, (), (noexcept));
+  MOCK_METHOD(types::EuclideanVector<float>, GetCalibratedGyroscope, (), (noexcept));
+  MOCK_METHOD(types::EuclideanVector<float>, GetCalibratedAccelerometer, (), (noexcept));
+  MOCK_METHOD(types::EuclideanVector<float>, GetCalibratedMagnetometer, (), (noexcept));
   MOCK_METHOD(int, GetTemperature, (), (noexcept));
+  MOCK_METHOD(types::DriverStatus, StartCalibration, (), (noexcept));
+  MOCK_METHOD(types::ImuCalibrationState, GetCalibrationState, (), (noexcept));
+  MOCK_METHOD(types::DriverStatus, StartMagnetometerCalibration, (), (noexcept));
+  MOCK_METHOD(types::DriverStatus, FinishMagnetometerCalibration, (), (noexcept));
 };
 }  // namespace imu
 
@@ -0,0 +1,18 @@
+#ifndef MOCK_SPI_HPP_
+#define MOCK_SPI_HPP_
+
+#include <gmock/gmock.h>
+#include <memory>
+#include "spi_interface.hpp"
+
+namespace spi {
+
+class MockSPI : public SPIInterface {
+ public:
+  MOCK_METHOD(types::DriverStatus, Write, (std::vector<std::uint8_t> & mosi_data_buffer), (noexcept));
+  MOCK_METHOD(types::DriverStatus, Transfer, (std::vector<std::uint8_t> & mosi_data_buffer, std::vector<std::uint8_t>& miso_data_buffer), (noexcept));
+  MOCK_METHOD(types::DriverStatus, SetClock, (std::uint32_t clock_in_hz), (noexcept));
+};
+}  // namespace spi
+
+#endif
@@ -0,0 +1,282 @@
+#ifndef SIMULATED_MPU9255_HPP_
+#define SIMULATED_MPU9255_HPP_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "i2c_interface.hpp"
+#include "mpu9255_data.hpp"
+#include "spi_interface.hpp"
+
+namespace imu {
+
+/**
+ * @brief Register map model of a MPU9255 with its AK8963, including the auxiliary I2C master
+ *        (slave 0 mirroring into EXT_SENS_DATA and single Byte slave 4 transfers).
+ * 
+ */
+class SimulatedMpu9255 {
+ public:
+  SimulatedMpu9255() {
+    mpu9255_registers_.at(WHO_AM_I_MPU9255_REGISTER) = WHO_AM_I_MPU9255_VALUE;
+    ak8963_registers_.at(WHO_AM_I_AK8963_REGISTER) = WHO_AM_I_AK8963_VALUE;
+    ak8963_registers_.at(AK8963_ST1) = 0x01;
+    for (std::uint8_t offset = 0; offset < 3; offset++)
+      ak8963_registers_.at(AK8963_ASAX + offset) = 128;
+
+    SetMeasurement(GYRO_MEASUREMENT_DATA, {0x10, 0x00, 0x20, 0x00, 0xF0, 0x00});
+    SetMeasurement(ACCEL_MEASUREMENT_DATA, {0x08, 0x00, 0xF8, 0x00, 0x40, 0x00});
+    SetMeasurement(TEMP_MEASUREMENT_DATA, {0x0D, 0x0A});
+    ak8963_registers_.at(MAGNETOMETER_MEASUREMENT_DATA + 0) = 0x00;
+    ak8963_registers_.at(MAGNETOMETER_MEASUREMENT_DATA + 1) = 0x10;
+    ak8963_registers_.at(MAGNETOMETER_MEASUREMENT_DATA + 2) = 0x00;
+    ak8963_registers_.at(MAGNETOMETER_MEASUREMENT_DATA + 3) = 0xF0;
+    ak8963_registers_.at(MAGNETOMETER_MEASUREMENT_DATA + 4) = 0x00;
+    ak8963_registers_.at(MAGNETOMETER_MEASUREMENT_DATA + 5) = 0x08;
+  }
+
+  auto Responds(const std::uint8_t address) const noexcept -> bool {
+    return address == MPU9255_ADDRESS || (address == AK8963_ADDRESS && IsBypassEnabled());
+  }
+
+  auto ReadRegister(const std::uint8_t address, const std::uint8_t register_) noexcept -> std::uint8_t {
+    if (address == AK8963_ADDRESS)
+      return ak8963_registers_.at(register_ % ak8963_registers_.size());
+
+    if (IsMirroredBySlave0(register_))
+      return ak8963_registers_.at((mpu9255_registers_.at(I2C_SLV0_REG) + register_ - EXT_SENS_DATA_00) % ak8963_registers_.size());
+
+    const auto content = mpu9255_registers_.at(register_ % mpu9255_registers_.size());
+    if (register_ == I2C_MST_STATUS)
+      mpu9255_registers_.at(I2C_MST_STATUS) = 0;
+
+    return content;
+  }
+
+  auto WriteRegister(const std::uint8_t address, const std::uint8_t register_, const std::uint8_t register_content) noexcept -> void {
+    if (address == AK8963_ADDRESS) {
+      ak8963_registers_.at(register_ % ak8963_registers_.size()) = register_content;
+      return;
+    }
+
+    mpu9255_registers_.at(register_ % mpu9255_registers_.size()) = register_content;
+    if (register_ == I2C_SLV4_CTRL && (register_content & SLAVE_ENABLE) != 0)
+      ExecuteSlave4Transfer();
+  }
+
+  /// Sets the output registers of a sensor, e.g. to replace the default measurement
+  auto SetMeasurement(const std::uint8_t register_, const std::vector<std::uint8_t>& data) noexcept -> void {
+    for (std::size_t offset = 0; offset < data.size(); offset++)
+      mpu9255_registers_.at(register_ + offset) = data.at(offset);
+  }
+
+  /// Sets or clears DRDY in ST1 of the AK8963, which samples slower than the MPU9255
+  auto SetMagnetometerDataReady(const bool data_ready) noexcept -> void {
+    ak8963_registers_.at(AK8963_ST1) = data_ready ? 0x01 : 0x00;
+  }
+
+  auto GetRegister(const std::uint8_t address, const std::uint8_t register_) const noexcept -> std::uint8_t {
+    if (address == AK8963_ADDRESS)
+      return ak8963_registers_.at(register_);
+
+    return mpu9255_registers_.at(register_);
+  }
+
+ private:
+  auto IsBypassEnabled(void) const noexcept -> bool {
+    return (mpu9255_registers_.at(INT_PIN_CFG) & 0x02) != 0 && (mpu9255_registers_.at(USER_CTRL) & I2C_MASTER_ENABLE) == 0;
+  }
+
+  auto IsMirroredBySlave0(const std::uint8_t register_) const noexcept -> bool {
+    const auto slave0_control = mpu9255_registers_.at(I2C_SLV0_CTRL);
+    const auto slave0_length = slave0_control & 0x0F;
+    return (mpu9255_registers_.at(USER_CTRL) & I2C_MASTER_ENABLE) != 0 &&
+           (slave0_control & SLAVE_ENABLE) != 0 &&
+           (mpu9255_registers_.at(I2C_SLV0_ADDR) & 0x7F) == AK8963_ADDRESS &&
+           register_ >= EXT_SENS_DATA_00 && register_ < EXT_SENS_DATA_00 + slave0_length;
+  }
+
+  auto ExecuteSlave4Transfer(void) noexcept -> void {
+    mpu9255_registers_.at(I2C_SLV4_CTRL) &= static_cast<std::uint8_t>(~SLAVE_ENABLE);
+
+    const auto slave4_address = mpu9255_registers_.at(I2C_SLV4_ADDR);
+    if ((mpu9255_registers_.at(USER_CTRL) & I2C_MASTER_ENABLE) == 0 || (slave4_address & 0x7F) != AK8963_ADDRESS) {
+      mpu9255_registers_.at(I2C_MST_STATUS) |= SLAVE4_NACK;
+      return;
+    }
+
+    auto& ak8963_register = ak8963_registers_.at(mpu9255_registers_.at(I2C_SLV4_REG) % ak8963_registers_.size());
+    if ((slave4_address & 0x80) != 0)
+      mpu9255_registers_.at(I2C_SLV4_DI) = ak8963_register;
+    else
+      ak8963_register = mpu9255_registers_.at(I2C_SLV4_DO);
+
+    mpu9255_registers_.at(I2C_MST_STATUS) |= SLAVE4_DONE;
+  }
+
+  static constexpr std::uint8_t SLAVE_ENABLE = 0x80;
+  static constexpr std::uint8_t I2C_MASTER_ENABLE = 0x20;
+  static constexpr std::uint8_t SLAVE4_DONE = 0x40;
+  static constexpr std::uint8_t SLAVE4_NACK = 0x10;
+
+  std::array<std::uint8_t, 128> mpu9255_registers_{};
+  std::array<std::uint8_t, 32> ak8963_registers_{};
+};
+
+/**
+ * @brief I2C bus in front of a SimulatedMpu9255, which accumulates the time the transfers occupy the bus.
+ *        Every Byte takes 9 clocks (8 data bits plus ACK), start, repeated start and stop condition one clock each.
+ * 
+ */
+class SimulatedI2CBus final : public i2c::I2CInterface {
+ public:
+  explicit SimulatedI2CBus(SimulatedMpu9255& device, const std::uint32_t clock_in_hz = 400000) : device_(device), clock_in_hz_(clock_in_hz) {}
+
+  auto Read(std::uint8_t address, std::uint16_t byte_size, std::uint32_t timeout) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> override {
+    AddClocks(CLOCKS_PER_BYTE * (1 + byte_size) + 2);
+    return {types::DriverStatus::HAL_ERROR, {}};
+  }
+
+  auto ReadContentFromRegister(std::uint8_t address, std::uint8_t register_, std::uint16_t byte_size, std::uint32_t timeout) noexcept -> std::pair<types::DriverStatus, std::vector<std::uint8_t>> override {
+    if (!device_.Responds(address)) {
+      AddClocks(CLOCKS_PER_BYTE + 2);
+      return {types::DriverStatus::HAL_ERROR, {}};
+    }
+
+    AddClocks(CLOCKS_PER_BYTE * (3 + byte_size) + 3);
+    std::vector<std::uint8_t> content_of_register;
+    for (std::uint16_t offset = 0; offset < byte_size; offset++)
+      content_of_register.push_back(device_.ReadRegister(address, static_cast<std::uint8_t>(register_ + offset)));
+
+    return {types::DriverStatus::OK, content_of_register};
+  }
+
+  auto ReadContentFromRegisterIntoBuffer(std::uint8_t address, std::uint8_t register_, std::uint8_t* buffer, std::uint16_t byte_size, std::uint32_t timeout) noexcept -> types::DriverStatus override {
+    if (!device_.Responds(address)) {
+      AddClocks(CLOCKS_PER_BYTE + 2);
+      return types::DriverStatus::HAL_ERROR;
+    }
+
+    AddClocks(CLOCKS_PER_BYTE * (3 + byte_size) + 3);
+    for (std::uint16_t offset = 0; offset < byte_size; offset++)
+      buffer[offset] = device_.ReadRegister(address, static_cast<std::uint8_t>(register_ + offset));
+
+    return types::DriverStatus::OK;
+  }
+
+  auto Write(std::uint8_t address, const std::vector<std::uint8_t>& data, std::uint32_t timeout) noexcept -> types::DriverStatus override {
+    if (!device_.Responds(address) || data.empty()) {
+      AddClocks(CLOCKS_PER_BYTE + 2);
+      return types::DriverStatus::HAL_ERROR;
+    }
+
+    AddClocks(CLOCKS_PER_BYTE * (1 + data.size()) + 2);
+    for (std::size_t offset = 1; offset < data.size(); offset++)
+      device_.WriteRegister(address, static_cast<std::uint8_t>(data.at(0) + offset - 1), data.at(offset));
+
+    return types::DriverStatus::OK;
+  }
+
+  auto GetBusTimeInNanoSeconds(void) const noexcept -> std::uint64_t {
+    return clocks_ * 1000000000ULL / clock_in_hz_;
+  }
+
+  auto ResetBusTime(void) noexcept -> void {
+    clocks_ = 0;
+  }
+
+ private:
+  auto AddClocks(const std::uint64_t clocks) noexcept -> void {
+    clocks_ += clocks;
+  }
+
+  static constexpr std::uint64_t CLOCKS_PER_BYTE = 9;
+
+  SimulatedMpu9255& device_;
+  std::uint32_t clock_in_hz_;
+  std::uint64_t clocks_ = 0;
+};
+
+/**
+ * @brief SPI bus in front of a SimulatedMpu9255, which accumulates the time the transfers occupy the bus.
+ *        Every Byte takes 8 clocks at the clock set with SetClock. Transfers faster than the MPU9255 allows,
+ *        1 MHz for all registers and 20 MHz for reading sensor registers, are counted as clock violations.
+ * 
+ */
+class SimulatedSPIBus final : public spi::SPIInterface {
+ public:
+  explicit SimulatedSPIBus(SimulatedMpu9255& device) : device_(device) {}
+
+  auto Write(std::vector<std::uint8_t>& mosi_data_buffer) noexcept -> types::DriverStatus override {
+    if (mosi_data_buffer.empty())
+      return types::DriverStatus::INPUT_ERROR;
+
+    AddBytes(mosi_data_buffer.size());
+    if (clock_in_hz_ > ALL_REGISTERS_MAX_CLOCK_IN_HZ)
+      clock_violations_++;
+
+    const auto register_ = static_cast<std::uint8_t>(mosi_data_buffer.at(0) & 0x7F);
+    for (std::size_t offset = 1; offset < mosi_data_buffer.size(); offset++)
+      device_.WriteRegister(MPU9255_ADDRESS, static_cast<std::uint8_t>(register_ + offset - 1), mosi_data_buffer.at(offset));
+
+    return types::DriverStatus::OK;
+  }
+
+  auto Transfer(std::vector<std::uint8_t>& mosi_data_buffer, std::vector<std::uint8_t>& miso_data_buffer) noexcept -> types::DriverStatus override {
+    if (mosi_data_buffer.empty() || miso_data_buffer.size() < mosi_data_buffer.size())
+      return types::DriverStatus::INPUT_ERROR;
+
+    if ((mosi_data_buffer.at(0) & 0x80) == 0)
+      return Write(mosi_data_buffer);
+
+    AddBytes(miso_data_buffer.size());
+    const auto register_ = static_cast<std::uint8_t>(mosi_data_buffer.at(0) & 0x7F);
+    std::uint32_t max_clock_in_hz = ALL_REGISTERS_MAX_CLOCK_IN_HZ;
+    if (register_ >= INT_STATUS && register_ + miso_data_buffer.size() - 2 <= EXT_SENS_DATA_23)
+      max_clock_in_hz = SENSOR_REGISTERS_MAX_CLOCK_IN_HZ;
+    if (clock_in_hz_ > max_clock_in_hz)
+      clock_violations_++;
+
+    miso_data_buffer.at(0) = 0;
+    for (std::size_t offset = 1; offset < miso_data_buffer.size(); offset++)
+      miso_data_buffer.at(offset) = device_.ReadRegister(MPU9255_ADDRESS, static_cast<std::uint8_t>(register_ + offset - 1));
+
+    return types::DriverStatus::OK;
+  }
+
+  auto SetClock(std::uint32_t clock_in_hz) noexcept -> types::DriverStatus override {
+    clock_in_hz_ = clock_in_hz;
+    return types::DriverStatus::OK;
+  }
+
+  auto GetClockViolations(void) const noexcept -> std::uint32_t {
+    return clock_violations_;
+  }
+
+  auto GetBusTimeInNanoSeconds(void) const noexcept -> std::uint64_t {
+    return bus_time_in_ns_;
+  }
+
+  auto ResetBusTime(void) noexcept -> void {
+    bus_time_in_ns_ = 0;
+  }
+
+ private:
+  auto AddBytes(const std::size_t bytes) noexcept -> void {
+    bus_time_in_ns_ += CLOCKS_PER_BYTE * bytes * 1000000000ULL / clock_in_hz_;
+  }
+
+  static constexpr std::uint64_t CLOCKS_PER_BYTE = 8;
+  // MPU-9255 Product Specification, SPI operational features
+  static constexpr std::uint32_t ALL_REGISTERS_MAX_CLOCK_IN_HZ = 1000000;
+  static constexpr std::uint32_t SENSOR_REGISTERS_MAX_CLOCK_IN_HZ = 20000000;
+
+  SimulatedMpu9255& device_;
+  std::uint32_t clock_in_hz_ = ALL_REGISTERS_MAX_CLOCK_IN_HZ;
+  std::uint32_t clock_violations_ = 0;
+  std::uint64_t bus_time_in_ns_ = 0;
+};
+
+}  // namespace imu
+
+#endif
@@ -0,0 +1,123 @@
+#include <cmath>
+#include "gtest/gtest.h"
+#include "cordic_trigonometry.hpp"
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+constexpr double MAXIMUM_ERROR = 1.0e-8;
+
+class CordicTrigonometryTests : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    MX_CORDIC_Init();
+  }
+
+  static auto ToDouble(const std::int32_t value) -> double {
+    return static_cast<double>(value) / 2147483648.0;
+  }
+
+  static auto ToQ31(const double value) -> std::int32_t {
+    return static_cast<std::int32_t>(std::lround(value * 2147483648.0));
+  }
+
+  math::CordicTrigonometry trigonometry_;
+};
+
+TEST_F(CordicTrigonometryTests, sine_and_cosine_are_deinterleaved) {
+  const std::int32_t angles[] = {0, 1 << 30, 1 << 29, -(1 << 28)};
+  std::int32_t sines[4];
+  std::int32_t cosines[4];
+
+  ASSERT_EQ(trigonometry_.SineCosine(angles, sines, cosines, 4), types::DriverStatus::OK);
+
+  for (std::uint32_t index = 0; index < 4; index++) {
+    EXPECT_NEAR(ToDouble(sines[index]), std::sin(ToDouble(angles[index]) * PI), MAXIMUM_ERROR);
+    EXPECT_NEAR(ToDouble(cosines[index]), std::cos(ToDouble(angles[index]) * PI), MAXIMUM_ERROR);
+  }
+}
+
+TEST_F(CordicTrigonometryTests, phase_and_magnitude_are_interleaved_and_deinterleaved) {
+  const std::int32_t x[] = {ToQ31(0.5), ToQ31(-0.3), ToQ31(0.0)};
+  const std::int32_t y[] = {ToQ31(0.5), ToQ31(0.4), ToQ31(-0.7)};
+  std::int32_t phases[3];
+  std::int32_t magnitudes[3];
+
+  ASSERT_EQ(trigonometry_.PhaseMagnitude(x, y, phases, magnitudes, 3), types::DriverStatus::OK);
+
+  EXPECT_NEAR(ToDouble(phases[0]), 0.25, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(magnitudes[1]), 0.5, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(phases[2]), -0.5, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(magnitudes[2]), 0.7, MAXIMUM_ERROR);
+}
+
+TEST_F(CordicTrigonometryTests, sine_and_cosine_after_phase_have_unit_modulus) {
+  // The phase batch leaves its last y in ARG2 of the coprocessor
+  const std::int32_t x[] = {ToQ31(0.1)};
+  const std::int32_t y[] = {ToQ31(0.2)};
+  std::int32_t phase;
+  const std::int32_t angles[] = {1 << 29, -(1 << 30)};
+  std::int32_t sines[2];
+  std::int32_t cosines[2];
+
+  ASSERT_EQ(trigonometry_.PhaseMagnitude(x, y, &phase, nullptr, 1), types::DriverStatus::OK);
+  ASSERT_EQ(trigonometry_.SineCosine(angles, sines, cosines, 2), types::DriverStatus::OK);
+
+  for (std::uint32_t index = 0; index < 2; index++) {
+    EXPECT_NEAR(ToDouble(sines[index]), std::sin(ToDouble(angles[index]) * PI), MAXIMUM_ERROR);
+    EXPECT_NEAR(ToDouble(cosines[index]), std::cos(ToDouble(angles[index]) * PI), MAXIMUM_ERROR);
+  }
+}
+
+TEST_F(CordicTrigonometryTests, square_root_normalizes_into_the_coprocessor_range) {
+  const std::int32_t values[] = {0, 1, ToQ31(0.0001), ToQ31(0.02), ToQ31(0.3), ToQ31(0.75), INT32_MAX};
+  std::int32_t roots[7];
+
+  ASSERT_EQ(trigonometry_.SquareRoot(values, roots, 7), types::DriverStatus::OK);
+
+  for (std::uint32_t index = 0; index < 7; index++)
+    EXPECT_NEAR(ToDouble(roots[index]), std::sqrt(ToDouble(values[index])), 1.0e-7) << "value " << values[index];
+}
+
+TEST_F(CordicTrigonometryTests, function_is_only_configured_when_it_changes) {
+  const std::int32_t angle = 0;
+  std::int32_t sine;
+  std::int32_t root;
+  const auto configure_count = MockCordicGetConfigureCount();
+
+  trigonometry_.SineCosine(&angle, &sine, nullptr, 1);
+  trigonometry_.SineCosine(&angle, &sine, nullptr, 1);
+  EXPECT_EQ(MockCordicGetConfigureCount(), configure_count + 1);
+
+  trigonometry_.SquareRoot(&angle, &root, 1);
+  trigonometry_.SineCosine(&angle, &sine, nullptr, 1);
+  EXPECT_EQ(MockCordicGetConfigureCount(), configure_count + 3);
+}
+
+TEST_F(CordicTrigonometryTests, hal_errors_are_forwarded) {
+  const std::int32_t angle = 0;
+  std::int32_t sine;
+
+  MockCordicFailNextCalculation(HAL_TIMEOUT);
+  EXPECT_EQ(trigonometry_.SineCosine(&angle, &sine, nullptr, 1), types::DriverStatus::TIMEOUT);
+  MockCordicFailNextCalculation(HAL_ERROR);
+  EXPECT_EQ(trigonometry_.SineCosine(&angle, &sine, nullptr, 1), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(trigonometry_.SineCosine(&angle, &sine, nullptr, 1), types::DriverStatus::OK);
+}
+
+TEST_F(CordicTrigonometryTests, invalid_requests_are_rejected) {
+  const std::int32_t negative = -1;
+  std::int32_t result[2];
+
+  EXPECT_EQ(trigonometry_.SquareRoot(&negative, result, 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(trigonometry_.SineCosine(nullptr, result, result, 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(trigonometry_.SineCosine(result, result, result, math::MAX_TRIGONOMETRY_BATCH_LENGTH + 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(trigonometry_.PhaseMagnitude(nullptr, result, result, result, 1), types::DriverStatus::INPUT_ERROR);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
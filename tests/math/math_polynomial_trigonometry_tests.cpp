@@ -0,0 +1,140 @@
+#include <cmath>
+#include "gtest/gtest.h"
+#include "fixed_point.hpp"
+#include "polynomial_trigonometry.hpp"
+
+namespace {
+
+constexpr double PI = 3.14159265358979323846;
+constexpr double MAXIMUM_ERROR = 1.0e-6;
+
+class PolynomialTrigonometryTests : public ::testing::Test {
+ protected:
+  static auto ToDouble(const std::int32_t value) -> double {
+    return static_cast<double>(value) / 2147483648.0;
+  }
+
+  static auto ToQ31(const double value) -> std::int32_t {
+    return static_cast<std::int32_t>(std::lround(value * 2147483648.0));
+  }
+
+  math::PolynomialTrigonometry trigonometry_;
+};
+
+TEST_F(PolynomialTrigonometryTests, sine_and_cosine_over_the_full_turn) {
+  constexpr std::uint32_t LENGTH = math::MAX_TRIGONOMETRY_BATCH_LENGTH;
+  std::int32_t angles[LENGTH];
+  std::int32_t sines[LENGTH];
+  std::int32_t cosines[LENGTH];
+
+  double maximum_error = 0.0;
+  for (std::int64_t start = INT32_MIN; start < INT32_MAX; start += 8388593) {
+    for (std::uint32_t index = 0; index < LENGTH; index++)
+      angles[index] = static_cast<std::int32_t>(std::max<std::int64_t>(INT32_MIN, std::min<std::int64_t>(INT32_MAX, start + index * 131071)));
+
+    ASSERT_EQ(trigonometry_.SineCosine(angles, sines, cosines, LENGTH), types::DriverStatus::OK);
+
+    for (std::uint32_t index = 0; index < LENGTH; index++) {
+      const auto radians = ToDouble(angles[index]) * PI;
+      maximum_error = std::max(maximum_error, std::fabs(ToDouble(sines[index]) - std::sin(radians)));
+      maximum_error = std::max(maximum_error, std::fabs(ToDouble(cosines[index]) - std::cos(radians)));
+    }
+  }
+
+  EXPECT_LT(maximum_error, MAXIMUM_ERROR);
+}
+
+TEST_F(PolynomialTrigonometryTests, quadrant_boundaries) {
+  const std::int32_t angles[] = {0, 1 << 30, INT32_MIN, -(1 << 30), 1 << 29};
+  std::int32_t sines[5];
+  std::int32_t cosines[5];
+
+  ASSERT_EQ(trigonometry_.SineCosine(angles, sines, cosines, 5), types::DriverStatus::OK);
+
+  EXPECT_NEAR(ToDouble(sines[0]), 0.0, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(cosines[0]), 1.0, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(sines[1]), 1.0, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(cosines[1]), 0.0, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(sines[2]), 0.0, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(cosines[2]), -1.0, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(sines[3]), -1.0, MAXIMUM_ERROR);
+  EXPECT_NEAR(ToDouble(sines[4]), std::sqrt(0.5), MAXIMUM_ERROR);
+}
+
+TEST_F(PolynomialTrigonometryTests, only_requested_results_are_written) {
+  const std::int32_t angle = 1 << 29;
+  std::int32_t sine = 0;
+
+  EXPECT_EQ(trigonometry_.SineCosine(&angle, &sine, nullptr, 1), types::DriverStatus::OK);
+  EXPECT_NEAR(ToDouble(sine), std::sqrt(0.5), MAXIMUM_ERROR);
+}
+
+TEST_F(PolynomialTrigonometryTests, phase_and_magnitude_around_the_circle) {
+  double maximum_phase_error = 0.0;
+  double maximum_magnitude_error = 0.0;
+
+  for (int step = 0; step < 3600; step++) {
+    const double angle = -PI + step * (2.0 * PI / 3600.0);
+    const double radius = 0.05 + 0.9 * (step % 10) / 10.0;
+    const std::int32_t x = ToQ31(radius * std::cos(angle));
+    const std::int32_t y = ToQ31(radius * std::sin(angle));
+    std::int32_t phase;
+    std::int32_t magnitude;
+
+    ASSERT_EQ(trigonometry_.PhaseMagnitude(&x, &y, &phase, &magnitude, 1), types::DriverStatus::OK);
+
+    // -pi and pi are the same direction
+    const auto expected_phase = std::atan2(ToDouble(y), ToDouble(x)) / PI;
+    auto phase_error = std::fabs(ToDouble(phase) - expected_phase);
+    phase_error = std::min(phase_error, 2.0 - phase_error);
+    maximum_phase_error = std::max(maximum_phase_error, phase_error);
+    maximum_magnitude_error = std::max(maximum_magnitude_error, std::fabs(ToDouble(magnitude) - std::hypot(ToDouble(x), ToDouble(y))));
+  }
+
+  EXPECT_LT(maximum_phase_error, MAXIMUM_ERROR);
+  EXPECT_LT(maximum_magnitude_error, MAXIMUM_ERROR);
+}
+
+TEST_F(PolynomialTrigonometryTests, phase_of_zero_vector_is_zero) {
+  const std::int32_t zero = 0;
+  std::int32_t phase = 1;
+
+  EXPECT_EQ(trigonometry_.PhaseMagnitude(&zero, &zero, &phase, nullptr, 1), types::DriverStatus::OK);
+  EXPECT_EQ(phase, 0);
+}
+
+TEST_F(PolynomialTrigonometryTests, square_root) {
+  const std::int32_t values[] = {0, 1 << 29, ToQ31(0.01), ToQ31(0.9), INT32_MAX};
+  std::int32_t roots[5];
+
+  ASSERT_EQ(trigonometry_.SquareRoot(values, roots, 5), types::DriverStatus::OK);
+
+  for (std::uint32_t index = 0; index < 5; index++)
+    EXPECT_NEAR(ToDouble(roots[index]), std::sqrt(ToDouble(values[index])), MAXIMUM_ERROR);
+}
+
+TEST_F(PolynomialTrigonometryTests, invalid_requests_are_rejected) {
+  const std::int32_t negative = -1;
+  std::int32_t result[math::MAX_TRIGONOMETRY_BATCH_LENGTH + 1] = {};
+
+  EXPECT_EQ(trigonometry_.SquareRoot(&negative, result, 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(trigonometry_.SquareRoot(nullptr, result, 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(trigonometry_.SineCosine(nullptr, result, result, 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(trigonometry_.SineCosine(result, result, nullptr, math::MAX_TRIGONOMETRY_BATCH_LENGTH + 1), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(trigonometry_.PhaseMagnitude(result, nullptr, result, nullptr, 1), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST(TrigonometryAngleTests, radians_wrap_into_half_open_interval) {
+  EXPECT_EQ(math::RadiansToAngle(0.0f), 0);
+  EXPECT_NEAR(math::RadiansToAngle(static_cast<float>(PI / 2.0)), 1 << 30, 256);
+  EXPECT_NEAR(math::RadiansToAngle(static_cast<float>(-PI / 2.0)), -(1 << 30), 256);
+  EXPECT_NEAR(math::RadiansToAngle(static_cast<float>(2.5 * PI)), 1 << 30, 1024);
+  EXPECT_NEAR(math::AngleToRadians(1 << 30), PI / 2.0, 1.0e-6);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
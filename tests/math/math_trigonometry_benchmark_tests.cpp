@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include "gtest/gtest.h"
+#include "polynomial_trigonometry.hpp"
+
+namespace {
+
+/**
+ * Compares the portable trigonometry service with libm on the host.
+ * The CORDIC itself can only be measured on target: in zero-overhead mode
+ * sine and cosine together take 6 cycles of the coprocessor per angle at the chosen precision.
+ */
+class TrigonometryBenchmarkTests : public ::testing::Test {
+ protected:
+  static constexpr std::uint32_t LENGTH = math::MAX_TRIGONOMETRY_BATCH_LENGTH;
+  static constexpr int REPETITIONS = 20000;
+
+  void SetUp() override {
+    for (std::uint32_t index = 0; index < LENGTH; index++) {
+      angles_[index] = static_cast<std::int32_t>(static_cast<std::uint32_t>(index) * 67108859u);
+      radians_[index] = math::AngleToRadians(angles_[index]);
+    }
+  }
+
+  template <typename Function>
+  auto MeasureInNanoSecondsPerValue(Function function) -> double {
+    const auto start = std::chrono::steady_clock::now();
+    for (int repetition = 0; repetition < REPETITIONS; repetition++)
+      function();
+    const auto stop = std::chrono::steady_clock::now();
+
+    return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count()) / (REPETITIONS * LENGTH);
+  }
+
+  auto Report(const std::string& name, const double latency_in_ns) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << latency_in_ns << " ns per value" << std::endl;
+    RecordProperty(name, std::to_string(latency_in_ns));
+  }
+
+  std::int32_t angles_[LENGTH];
+  float radians_[LENGTH];
+  std::int32_t sines_[LENGTH];
+  std::int32_t cosines_[LENGTH];
+  volatile float sink_ = 0.0f;
+};
+
+TEST_F(TrigonometryBenchmarkTests, sine_cosine_polynomial_versus_libm) {
+  math::PolynomialTrigonometry trigonometry;
+
+  const auto polynomial = MeasureInNanoSecondsPerValue([&]() {
+    trigonometry.SineCosine(angles_, sines_, cosines_, LENGTH);
+  });
+  const auto libm = MeasureInNanoSecondsPerValue([&]() {
+    float sum = 0.0f;
+    for (std::uint32_t index = 0; index < LENGTH; index++)
+      sum += std::sin(radians_[index]) + std::cos(radians_[index]);
+    sink_ = sum;
+  });
+
+  Report("sine_cosine_polynomial", polynomial);
+  Report("sine_cosine_libm", libm);
+
+  EXPECT_GT(polynomial, 0.0);
+}
+
+TEST_F(TrigonometryBenchmarkTests, phase_magnitude_polynomial_versus_libm) {
+  math::PolynomialTrigonometry trigonometry;
+  std::int32_t phases[LENGTH];
+  std::int32_t magnitudes[LENGTH];
+  trigonometry.SineCosine(angles_, sines_, cosines_, LENGTH);
+  for (std::uint32_t index = 0; index < LENGTH; index++) {
+    sines_[index] /= 2;
+    cosines_[index] /= 2;
+  }
+
+  const auto polynomial = MeasureInNanoSecondsPerValue([&]() {
+    trigonometry.PhaseMagnitude(cosines_, sines_, phases, magnitudes, LENGTH);
+  });
+  const auto libm = MeasureInNanoSecondsPerValue([&]() {
+    float sum = 0.0f;
+    for (std::uint32_t index = 0; index < LENGTH; index++) {
+      const auto x = static_cast<float>(cosines_[index]);
+      const auto y = static_cast<float>(sines_[index]);
+      sum += std::atan2(y, x) + std::sqrt(x * x + y * y);
+    }
+    sink_ = sum;
+  });
+
+  Report("phase_magnitude_polynomial", polynomial);
+  Report("phase_magnitude_libm", libm);
+
+  EXPECT_GT(polynomial, 0.0);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
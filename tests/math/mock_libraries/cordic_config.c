@@ -0,0 +1,9 @@
+#include "stm32g4xx_hal.h"
+#include "cordic_config.h"
+
+CORDIC_HandleTypeDef hcordic;
+
+void MX_CORDIC_Init(void)
+{
+  hcordic.dummy = 0;
+}
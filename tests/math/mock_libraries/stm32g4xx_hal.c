@@ -0,0 +1,90 @@
+#include "stm32g4xx_hal.h"
+#include <math.h>
+
+/* Simulates the CORDIC with double precision libm, rounded to q1.31 like the coprocessor output.
+   Like the coprocessor, ARG2 keeps the last value written to it when a function reads only ARG1. */
+
+static CORDIC_ConfigTypeDef configuration;
+static uint32_t configure_count = 0;
+static HAL_StatusTypeDef next_calculation_status = HAL_OK;
+/* Reset value of ARG2 is +1 */
+static int32_t second_argument = INT32_MAX;
+
+static const double PI = 3.14159265358979323846;
+static const double Q31 = 2147483648.0;
+
+static int32_t ToQ31(double value) {
+  const double scaled = value * Q31;
+
+  if (scaled >= Q31 - 1.0)
+    return INT32_MAX;
+  if (scaled <= -Q31)
+    return INT32_MIN;
+
+  return (int32_t)lround(scaled);
+}
+
+static double FromQ31(int32_t value) {
+  return (double)value / Q31;
+}
+
+HAL_StatusTypeDef HAL_CORDIC_Configure(CORDIC_HandleTypeDef *hcordic, CORDIC_ConfigTypeDef *sConfig) {
+  (void)hcordic;
+  configuration = *sConfig;
+  configure_count++;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_CORDIC_CalculateZO(CORDIC_HandleTypeDef *hcordic, int32_t *pInBuff, int32_t *pOutBuff, uint32_t NbCalc, uint32_t Timeout) {
+  (void)hcordic;
+  (void)Timeout;
+
+  if (next_calculation_status != HAL_OK) {
+    const HAL_StatusTypeDef status = next_calculation_status;
+    next_calculation_status = HAL_OK;
+    return status;
+  }
+
+  const uint32_t arguments = (configuration.NbWrite == CORDIC_NBWRITE_2) ? 2 : 1;
+  const uint32_t results = (configuration.NbRead == CORDIC_NBREAD_2) ? 2 : 1;
+
+  for (uint32_t calculation = 0; calculation < NbCalc; calculation++) {
+    const int32_t *in = pInBuff + calculation * arguments;
+    int32_t *out = pOutBuff + calculation * results;
+
+    if (arguments == 2)
+      second_argument = in[1];
+
+    switch (configuration.Function) {
+      case CORDIC_FUNCTION_COSINE:
+        out[0] = ToQ31(FromQ31(second_argument) * cos(FromQ31(in[0]) * PI));
+        if (results == 2)
+          out[1] = ToQ31(FromQ31(second_argument) * sin(FromQ31(in[0]) * PI));
+        break;
+      case CORDIC_FUNCTION_PHASE:
+        out[0] = ToQ31(atan2(FromQ31(second_argument), FromQ31(in[0])) / PI);
+        if (results == 2)
+          out[1] = ToQ31(hypot(FromQ31(in[0]), FromQ31(second_argument)));
+        break;
+      case CORDIC_FUNCTION_SQUAREROOT:
+        /* Outside of its input range without scaling the coprocessor result is useless */
+        if (FromQ31(in[0]) < 0.027 || FromQ31(in[0]) >= 0.75)
+          out[0] = 0;
+        else
+          out[0] = ToQ31(sqrt(FromQ31(in[0])));
+        break;
+      default:
+        return HAL_ERROR;
+    }
+  }
+
+  return HAL_OK;
+}
+
+uint32_t MockCordicGetConfigureCount(void) {
+  return configure_count;
+}
+
+void MockCordicFailNextCalculation(HAL_StatusTypeDef status) {
+  next_calculation_status = status;
+}
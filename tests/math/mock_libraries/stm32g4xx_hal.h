@@ -0,0 +1,60 @@
+#ifndef MOCK_STM32G4xx_HAL_H_
+#define MOCK_STM32G4xx_HAL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+  extern "C" {
+#endif
+
+typedef enum
+{
+  HAL_OK       = 0x00U,
+  HAL_ERROR    = 0x01U,
+  HAL_BUSY     = 0x02U,
+  HAL_TIMEOUT  = 0x03U
+} HAL_StatusTypeDef;
+
+typedef struct __CORDIC_HandleTypeDef
+{
+  int dummy;
+} CORDIC_HandleTypeDef;
+
+typedef struct
+{
+  uint32_t   Function;
+  uint32_t   Scale;
+  uint32_t   InSize;
+  uint32_t   OutSize;
+  uint32_t   NbWrite;
+  uint32_t   NbRead;
+  uint32_t   Precision;
+} CORDIC_ConfigTypeDef;
+
+#define CORDIC_FUNCTION_COSINE      (0x00000000U)
+#define CORDIC_FUNCTION_SINE        (0x00000001U)
+#define CORDIC_FUNCTION_PHASE       (0x00000002U)
+#define CORDIC_FUNCTION_MODULUS     (0x00000003U)
+#define CORDIC_FUNCTION_SQUAREROOT  (0x00000009U)
+
+#define CORDIC_PRECISION_6CYCLES    (0x00000060U)
+#define CORDIC_SCALE_0              (0x00000000U)
+#define CORDIC_INSIZE_32BITS        (0x00000000U)
+#define CORDIC_OUTSIZE_32BITS       (0x00000000U)
+#define CORDIC_NBWRITE_1            (0x00000000U)
+#define CORDIC_NBWRITE_2            (0x00100000U)
+#define CORDIC_NBREAD_1             (0x00000000U)
+#define CORDIC_NBREAD_2             (0x00080000U)
+
+HAL_StatusTypeDef HAL_CORDIC_Configure(CORDIC_HandleTypeDef *hcordic, CORDIC_ConfigTypeDef *sConfig);
+HAL_StatusTypeDef HAL_CORDIC_CalculateZO(CORDIC_HandleTypeDef *hcordic, int32_t *pInBuff, int32_t *pOutBuff, uint32_t NbCalc, uint32_t Timeout);
+
+/* Inspection of the simulated coprocessor for the tests */
+uint32_t MockCordicGetConfigureCount(void);
+void MockCordicFailNextCalculation(HAL_StatusTypeDef status);
+
+#ifdef __cplusplus
+  }
+#endif
+
+#endif /* MOCK_STM32G4xx_HAL_H_ */
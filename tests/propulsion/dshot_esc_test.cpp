@@ -0,0 +1,233 @@
+#include "dshot_esc.hpp"
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include "gtest/gtest.h"
+#include "stm32g4xx.h"
+
+namespace {
+
+class DshotEscTests : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    timer_.Instance = &timer_registers_;
+    hal_tim_pwm_init_mock_values.which_return = 0;
+    hal_tim_pwm_init_mock_values.return_value[0] = HAL_OK;
+    hal_tim_pwm_config_channel_mock_values.return_value = HAL_OK;
+    hal_tim_pwm_start_mock_values.return_value = HAL_OK;
+    dshot_timer_ = std::make_shared<propulsion::DshotTimer>(&timer_, propulsion::DshotDmaConfig{&dma_channel_, &request_router_, DMA_REQUEST_TIM3_UP}, types::DshotSpeed::DSHOT_600);
+    first_esc_ = std::make_unique<propulsion::DshotEsc>(dshot_timer_, TIM_CHANNEL_1);
+    second_esc_ = std::make_unique<propulsion::DshotEsc>(dshot_timer_, TIM_CHANNEL_3);
+  }
+
+  auto FinishBurst() -> void {
+    dma_channel_.CNDTR = 0;
+  }
+
+  TIM_TypeDef timer_registers_{};
+  TIM_HandleTypeDef timer_{};
+  DMA_Channel_TypeDef dma_channel_{};
+  DMAMUX_Channel_TypeDef request_router_{};
+  std::shared_ptr<propulsion::DshotTimer> dshot_timer_;
+  std::unique_ptr<propulsion::DshotEsc> first_esc_;
+  std::unique_ptr<propulsion::DshotEsc> second_esc_;
+};
+
+TEST_F(DshotEscTests, throttle_range_replaces_the_pulse_duration) {
+  EXPECT_EQ(first_esc_->GetMinPulseDurationInMicroSeconds(), 48);
+  EXPECT_EQ(first_esc_->GetMaxPulseDurationInMicroSeconds(), 2047);
+}
+
+TEST_F(DshotEscTests, illegal_throttle_values_are_rejected) {
+  EXPECT_EQ(first_esc_->SetPulseDuration(47, 0), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(first_esc_->SetPulseDuration(2048, 0), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(first_esc_->SetCommand(48), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(DshotEscTests, channels_which_are_not_part_of_the_burst_are_rejected) {
+  propulsion::DshotEsc fifth_channel_esc(dshot_timer_, TIM_CHANNEL_5);
+
+  EXPECT_EQ(fifth_channel_esc.SetPulseDuration(1000, 0), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(DshotEscTests, frames_are_sent_when_all_escs_of_the_timer_are_updated) {
+  EXPECT_EQ(first_esc_->SetPulseDuration(1000, 0), types::DriverStatus::OK);
+  EXPECT_EQ(dma_channel_.CCR & DMA_CCR_EN, 0u);
+
+  EXPECT_EQ(second_esc_->SetPulseDuration(2000, 0), types::DriverStatus::OK);
+  EXPECT_NE(dma_channel_.CCR & DMA_CCR_EN, 0u);
+  EXPECT_EQ(dma_channel_.CNDTR, propulsion::DSHOT_BIT_SLOTS * 4u);
+  EXPECT_EQ(dma_channel_.CMAR, static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(dshot_timer_->GetBurstBuffer().data())));
+}
+
+TEST_F(DshotEscTests, timer_and_dma_are_configured_for_a_burst_into_the_compare_registers) {
+  first_esc_->SetPulseDuration(1000, 0);
+  second_esc_->SetPulseDuration(1000, 0);
+
+  EXPECT_EQ(timer_.Init.Prescaler, 0u);
+  EXPECT_EQ(timer_.Init.Period, 282u);
+  EXPECT_NE(timer_registers_.CR1 & TIM_CR1_ARPE, 0u);
+  EXPECT_NE(timer_registers_.CCMR1 & TIM_CCMR1_OC1PE, 0u);
+  EXPECT_NE(timer_registers_.CCMR2 & TIM_CCMR2_OC3PE, 0u);
+  EXPECT_EQ(timer_registers_.DCR, TIM_DMABASE_CCR1 | TIM_DMABURSTLENGTH_4TRANSFERS);
+  EXPECT_NE(timer_registers_.DIER & TIM_DIER_UDE, 0u);
+  EXPECT_EQ(dma_channel_.CPAR, static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&timer_registers_.DMAR)));
+  EXPECT_EQ(dma_channel_.CCR, DMA_CCR_EN | DMA_CCR_DIR | DMA_CCR_MINC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1);
+  EXPECT_EQ(request_router_.CCR, DMA_REQUEST_TIM3_UP);
+}
+
+TEST_F(DshotEscTests, burst_buffer_interleaves_the_frames_per_bit_slot) {
+  first_esc_->SetPulseDuration(1000, 0);
+  second_esc_->SetCommand(0);
+  const auto first_bits = propulsion::EncodeDshotBits(propulsion::EncodeDshotFrame(1000, false), dshot_timer_->GetBitTiming());
+  const auto second_bits = propulsion::EncodeDshotBits(propulsion::EncodeDshotFrame(0, false), dshot_timer_->GetBitTiming());
+  const auto& buffer = dshot_timer_->GetBurstBuffer();
+
+  for (int slot = 0; slot < propulsion::DSHOT_BIT_SLOTS; slot++) {
+    EXPECT_EQ(buffer[slot * 4 + 0], first_bits[slot]);
+    EXPECT_EQ(buffer[slot * 4 + 1], 0u);
+    EXPECT_EQ(buffer[slot * 4 + 2], second_bits[slot]);
+    EXPECT_EQ(buffer[slot * 4 + 3], 0u);
+  }
+}
+
+TEST_F(DshotEscTests, running_burst_is_not_interrupted) {
+  first_esc_->SetPulseDuration(1000, 0);
+  second_esc_->SetPulseDuration(1000, 0);
+
+  first_esc_->SetPulseDuration(1100, 0);
+  EXPECT_EQ(second_esc_->SetPulseDuration(1100, 0), types::DriverStatus::TIMEOUT);
+
+  FinishBurst();
+  first_esc_->SetPulseDuration(1200, 0);
+  EXPECT_EQ(second_esc_->SetPulseDuration(1200, 0), types::DriverStatus::OK);
+}
+
+TEST_F(DshotEscTests, timer_configuration_error_is_reported) {
+  hal_tim_pwm_init_mock_values.return_value[0] = HAL_ERROR;
+
+  first_esc_->SetPulseDuration(1000, 0);
+  EXPECT_EQ(second_esc_->SetPulseDuration(1000, 0), types::DriverStatus::HAL_ERROR);
+}
+
+class BidirectionalDshotEscTests : public DshotEscTests {
+ protected:
+  virtual void SetUp() {
+    DshotEscTests::SetUp();
+    dshot_timer_ = std::make_shared<propulsion::DshotTimer>(&timer_, propulsion::DshotDmaConfig{&dma_channel_, &request_router_, DMA_REQUEST_TIM3_UP}, types::DshotSpeed::DSHOT_600, true);
+    first_esc_ = std::make_unique<propulsion::DshotEsc>(dshot_timer_, TIM_CHANNEL_1, propulsion::DshotDmaConfig{&capture_dma_channel_, &capture_request_router_, DMA_REQUEST_TIM3_CH1});
+    second_esc_ = std::make_unique<propulsion::DshotEsc>(dshot_timer_, TIM_CHANNEL_3);
+  }
+
+  auto SendAndCapture() -> void {
+    first_esc_->SetPulseDuration(1046, 0);
+    second_esc_->SetPulseDuration(1046, 0);
+    FinishBurst();
+    dshot_timer_->StartTelemetryCapture();
+  }
+
+  /// Plays the capture DMA, which writes the counter values of the edges into the capture buffer
+  auto CaptureEdges(const std::vector<std::uint32_t>& edges) -> void {
+    auto& buffer = const_cast<std::array<std::uint32_t, propulsion::DSHOT_TELEMETRY_MAX_EDGES>&>(dshot_timer_->GetCaptureBuffer(TIM_CHANNEL_1));
+    std::copy(edges.begin(), edges.end(), buffer.begin());
+    capture_dma_channel_.CNDTR = static_cast<std::uint32_t>(propulsion::DSHOT_TELEMETRY_MAX_EDGES - edges.size());
+  }
+
+  /// Answer of an ESC turning with an electrical period of 1000 us, captured at 170 MHz
+  const std::vector<std::uint32_t> period_of_1000_us_{5094, 5328, 6004, 6236, 6690, 6903, 7128, 7375, 7588, 7814, 8059, 8499, 8735, 9179, 9410, 9625};
+
+  DMA_Channel_TypeDef capture_dma_channel_{};
+  DMAMUX_Channel_TypeDef capture_request_router_{};
+};
+
+TEST_F(BidirectionalDshotEscTests, frames_have_an_inverted_checksum_and_idle_high) {
+  first_esc_->SetPulseDuration(1046, 0);
+  second_esc_->SetPulseDuration(1046, 0);
+  const auto bits = propulsion::EncodeDshotBits(0x82C9, dshot_timer_->GetBitTiming());
+
+  for (std::uint8_t slot = 0; slot < propulsion::DSHOT_BIT_SLOTS; slot++)
+    EXPECT_EQ(dshot_timer_->GetBurstBuffer()[slot * 4], bits[slot]) << static_cast<int>(slot);
+  EXPECT_NE(timer_registers_.CCER & TIM_CCER_CC1P, 0u);
+  EXPECT_NE(timer_registers_.CCER & (TIM_CCER_CC1P << 8), 0u);
+}
+
+TEST_F(BidirectionalDshotEscTests, telemetry_needs_a_bidirectional_timer) {
+  auto unidirectional_timer = std::make_shared<propulsion::DshotTimer>(&timer_, propulsion::DshotDmaConfig{&dma_channel_, &request_router_, DMA_REQUEST_TIM3_UP}, types::DshotSpeed::DSHOT_600);
+  propulsion::DshotEsc esc(unidirectional_timer, TIM_CHANNEL_1, propulsion::DshotDmaConfig{&capture_dma_channel_, &capture_request_router_, DMA_REQUEST_TIM3_CH1});
+  std::uint32_t erpm = 0;
+
+  EXPECT_EQ(esc.SetPulseDuration(1000, 0), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(esc.GetErpm(erpm), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unidirectional_timer->StartTelemetryCapture(), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(BidirectionalDshotEscTests, channel_turns_into_an_input_capturing_both_edges_after_the_burst) {
+  SendAndCapture();
+
+  EXPECT_EQ(timer_registers_.CCMR1 & 0xFF, TIM_CCMR1_CC1S_0);
+  EXPECT_EQ(timer_registers_.CCER & 0x0F, TIM_CCER_CC1P | TIM_CCER_CC1NP | TIM_CCER_CC1E);
+  EXPECT_NE(timer_registers_.DIER & TIM_DIER_CC1DE, 0u);
+  EXPECT_EQ(timer_registers_.DIER & TIM_DIER_UDE, 0u);
+  EXPECT_EQ(timer_registers_.ARR, 0xFFFFu);
+  EXPECT_NE(timer_registers_.CR1 & TIM_CR1_CEN, 0u);
+  EXPECT_EQ(capture_dma_channel_.CPAR, static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&timer_registers_.CCR1)));
+  EXPECT_EQ(capture_dma_channel_.CMAR, static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(dshot_timer_->GetCaptureBuffer(TIM_CHANNEL_1).data())));
+  EXPECT_EQ(capture_dma_channel_.CNDTR, propulsion::DSHOT_TELEMETRY_MAX_EDGES);
+  EXPECT_EQ(capture_dma_channel_.CCR, DMA_CCR_EN | DMA_CCR_MINC | DMA_CCR_PSIZE_1 | DMA_CCR_MSIZE_1);
+  EXPECT_EQ(capture_request_router_.CCR, DMA_REQUEST_TIM3_CH1);
+}
+
+TEST_F(BidirectionalDshotEscTests, channels_without_telemetry_stay_outputs) {
+  SendAndCapture();
+
+  EXPECT_NE(timer_registers_.CCMR2 & TIM_CCMR2_OC3PE, 0u);
+  EXPECT_EQ(timer_registers_.CCMR2 & TIM_CCMR1_CC1S_0, 0u);
+  EXPECT_EQ(timer_registers_.DIER & (TIM_DIER_CC1DE << 2), 0u);
+}
+
+TEST_F(BidirectionalDshotEscTests, captured_answer_gives_the_erpm) {
+  std::uint32_t erpm = 0;
+  SendAndCapture();
+  CaptureEdges(period_of_1000_us_);
+
+  EXPECT_EQ(first_esc_->GetErpm(erpm), types::DriverStatus::OK);
+  EXPECT_EQ(erpm, 60000u);
+}
+
+TEST_F(BidirectionalDshotEscTests, missing_or_corrupted_answers_are_reported) {
+  std::uint32_t erpm = 42;
+  EXPECT_EQ(first_esc_->GetErpm(erpm), types::DriverStatus::TIMEOUT);
+
+  SendAndCapture();
+  EXPECT_EQ(first_esc_->GetErpm(erpm), types::DriverStatus::TIMEOUT);
+
+  auto corrupted = period_of_1000_us_;
+  corrupted[5] += 120;
+  CaptureEdges(corrupted);
+  EXPECT_EQ(first_esc_->GetErpm(erpm), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(second_esc_->GetErpm(erpm), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(erpm, 42u);
+}
+
+TEST_F(BidirectionalDshotEscTests, next_transmission_restores_the_outputs) {
+  SendAndCapture();
+
+  first_esc_->SetPulseDuration(1046, 0);
+  second_esc_->SetPulseDuration(1046, 0);
+
+  EXPECT_EQ(timer_registers_.CCMR1 & 0xFF, TIM_CCMR1_OC1M_2 | TIM_CCMR1_OC1M_1 | TIM_CCMR1_OC1PE);
+  EXPECT_EQ(timer_registers_.CCER & 0x0F, TIM_CCER_CC1P | TIM_CCER_CC1E);
+  EXPECT_EQ(timer_registers_.CCR1, 0u);
+  EXPECT_EQ(timer_registers_.DIER & TIM_DIER_CC1DE, 0u);
+  EXPECT_NE(timer_registers_.DIER & TIM_DIER_UDE, 0u);
+  EXPECT_EQ(timer_registers_.ARR, 282u);
+  EXPECT_EQ(capture_dma_channel_.CCR & DMA_CCR_EN, 0u);
+  EXPECT_NE(dma_channel_.CCR & DMA_CCR_EN, 0u);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
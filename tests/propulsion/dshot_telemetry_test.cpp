@@ -0,0 +1,149 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "dshot.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+constexpr std::uint32_t TIMER_CLOCK_IN_HZ = 170000000;
+/// Telemetry value of an electrical period of 1000 us: exponent 1, mantissa 500
+constexpr std::uint16_t PERIOD_OF_1000_US = (1 << 9) | 500;
+
+/// Answers captured on a timer at 170 MHz, with up to 12 ticks (DShot600) and 20 ticks (DShot300) jitter
+const std::vector<std::uint32_t> CAPTURED_DSHOT_600_PERIOD_OF_1000_US{5094, 5328, 6004, 6236, 6690, 6903, 7128, 7375, 7588, 7814, 8059, 8499, 8735, 9179, 9410, 9625};
+const std::vector<std::uint32_t> CAPTURED_DSHOT_600_ACROSS_COUNTER_WRAP{65003, 65235, 371, 603, 1055, 1267, 1510, 1733, 1953, 2173, 2419, 2863, 3096, 3553, 3776, 4007};
+const std::vector<std::uint32_t> CAPTURED_DSHOT_300_MOTOR_STOPPED{5096, 6019, 6458, 6931, 7382, 8257, 8712, 9169, 9652, 10537, 10998, 11439, 11900, 12349, 12801, 14170};
+
+/// GCR symbols of the nibbles 0 - F
+constexpr std::uint8_t GCR_SYMBOLS[16] = {0x19, 0x1B, 0x12, 0x13, 0x1D, 0x15, 0x16, 0x17, 0x1A, 0x09, 0x0A, 0x0B, 0x1E, 0x0D, 0x0E, 0x0F};
+
+/// Answer of an ESC as the 21 bits after the start of the answer, which are NRZI coded on the line
+auto EncodeAnswer(const std::uint16_t telemetry) -> std::uint32_t {
+  const auto checksum = ~(telemetry ^ (telemetry >> 4) ^ (telemetry >> 8)) & 0x0F;
+  const auto value = static_cast<std::uint32_t>((telemetry << 4) | checksum);
+  std::uint32_t bits = 1;
+  for (int nibble = 3; nibble >= 0; nibble--)
+    bits = (bits << 5) | GCR_SYMBOLS[(value >> (4 * nibble)) & 0x0F];
+  return bits;
+}
+
+/// Counter values of the level changes of an answer on the line, which idles high
+auto ToEdges(const std::uint32_t bits, const double start, const double bit_ticks, const double jitter, std::mt19937& generator) -> std::vector<std::uint32_t> {
+  std::uniform_real_distribution<double> noise(-jitter, jitter);
+  std::vector<std::uint32_t> edges;
+  bool is_high = true;
+  for (int bit = 0; bit <= propulsion::DSHOT_TELEMETRY_BITS; bit++) {
+    // After the last bit the line returns to idle
+    const bool changes = bit < propulsion::DSHOT_TELEMETRY_BITS ? ((bits >> (propulsion::DSHOT_TELEMETRY_BITS - 1 - bit)) & 1) != 0 : !is_high;
+    if (!changes)
+      continue;
+    edges.push_back(static_cast<std::uint32_t>(std::lround(start + bit * bit_ticks + noise(generator))) & 0xFFFF);
+    is_high = !is_high;
+  }
+  return edges;
+}
+
+class DshotTelemetryTests : public ::testing::Test {
+ protected:
+  auto Decode(const std::vector<std::uint32_t>& edges, const types::DshotSpeed speed, std::uint16_t& telemetry) -> bool {
+    std::uint32_t bits = 0;
+    const auto bit_ticks = propulsion::GetDshotTelemetryBitTicksInSixteenths(TIMER_CLOCK_IN_HZ, speed);
+    return propulsion::DecodeDshotTelemetryEdges(edges.data(), static_cast<std::uint8_t>(edges.size()), bit_ticks, bits) &&
+           propulsion::DecodeDshotTelemetryBits(bits, telemetry);
+  }
+
+  std::mt19937 generator_{7};
+};
+
+TEST_F(DshotTelemetryTests, bidirectional_frame_has_an_inverted_checksum) {
+  const auto frame = propulsion::EncodeBidirectionalDshotFrame(1046, false);
+  std::uint16_t throttle = 0;
+  bool request_telemetry = false;
+
+  EXPECT_EQ(frame, 0x82C9);
+  EXPECT_FALSE(propulsion::DecodeDshotFrame(frame, throttle, request_telemetry));
+}
+
+TEST_F(DshotTelemetryTests, answer_bit_is_four_fifths_of_a_frame_bit) {
+  EXPECT_EQ(propulsion::GetDshotTelemetryBitTicksInSixteenths(TIMER_CLOCK_IN_HZ, types::DshotSpeed::DSHOT_600), 3627u);
+  EXPECT_EQ(propulsion::GetDshotTelemetryBitTicksInSixteenths(TIMER_CLOCK_IN_HZ, types::DshotSpeed::DSHOT_300), 7253u);
+}
+
+TEST_F(DshotTelemetryTests, captured_answer_is_decoded) {
+  std::uint16_t telemetry = 0;
+
+  ASSERT_TRUE(Decode(CAPTURED_DSHOT_600_PERIOD_OF_1000_US, types::DshotSpeed::DSHOT_600, telemetry));
+
+  EXPECT_EQ(telemetry, PERIOD_OF_1000_US);
+  EXPECT_EQ(propulsion::GetDshotErpm(telemetry), 60000u);
+}
+
+TEST_F(DshotTelemetryTests, captured_answer_across_the_counter_wrap_is_decoded) {
+  std::uint16_t telemetry = 0;
+
+  ASSERT_TRUE(Decode(CAPTURED_DSHOT_600_ACROSS_COUNTER_WRAP, types::DshotSpeed::DSHOT_600, telemetry));
+
+  EXPECT_EQ(telemetry, PERIOD_OF_1000_US);
+}
+
+TEST_F(DshotTelemetryTests, captured_answer_of_a_stopped_motor_gives_no_rotation) {
+  std::uint16_t telemetry = 0;
+
+  ASSERT_TRUE(Decode(CAPTURED_DSHOT_300_MOTOR_STOPPED, types::DshotSpeed::DSHOT_300, telemetry));
+
+  EXPECT_EQ(telemetry, propulsion::DSHOT_TELEMETRY_MOTOR_STOPPED);
+  EXPECT_EQ(propulsion::GetDshotErpm(telemetry), 0u);
+}
+
+TEST_F(DshotTelemetryTests, every_telemetry_value_survives_jittered_edges) {
+  const double bit_ticks = TIMER_CLOCK_IN_HZ / 750000.0;
+
+  for (std::uint16_t expected = 0; expected <= 0x0FFF; expected++) {
+    const auto edges = ToEdges(EncodeAnswer(expected), 1000.0 + expected * 13.0, bit_ticks, 0.2 * bit_ticks, generator_);
+    std::uint16_t telemetry = 0;
+
+    ASSERT_TRUE(Decode(edges, types::DshotSpeed::DSHOT_600, telemetry)) << expected;
+    ASSERT_EQ(telemetry, expected);
+  }
+}
+
+TEST_F(DshotTelemetryTests, flipped_bits_are_detected) {
+  std::uint16_t telemetry = 0;
+  const auto bits = EncodeAnswer(PERIOD_OF_1000_US);
+
+  for (int bit = 0; bit < 20; bit++)
+    EXPECT_FALSE(propulsion::DecodeDshotTelemetryBits(bits ^ (1u << bit), telemetry)) << bit;
+}
+
+TEST_F(DshotTelemetryTests, incomplete_answers_are_rejected) {
+  std::uint32_t bits = 0;
+  const auto bit_ticks = propulsion::GetDshotTelemetryBitTicksInSixteenths(TIMER_CLOCK_IN_HZ, types::DshotSpeed::DSHOT_600);
+  const auto& edges = CAPTURED_DSHOT_600_PERIOD_OF_1000_US;
+
+  EXPECT_FALSE(propulsion::DecodeDshotTelemetryEdges(edges.data(), 0, bit_ticks, bits));
+  EXPECT_FALSE(propulsion::DecodeDshotTelemetryEdges(edges.data(), 8, bit_ticks, bits));
+  EXPECT_FALSE(propulsion::DecodeDshotTelemetryEdges(nullptr, 16, bit_ticks, bits));
+}
+
+TEST_F(DshotTelemetryTests, intervals_longer_than_gcr_allows_are_rejected) {
+  std::uint32_t bits = 0;
+  const auto bit_ticks = propulsion::GetDshotTelemetryBitTicksInSixteenths(TIMER_CLOCK_IN_HZ, types::DshotSpeed::DSHOT_600);
+  const std::vector<std::uint32_t> edges{1000, 1000 + 4 * 227};
+
+  EXPECT_FALSE(propulsion::DecodeDshotTelemetryEdges(edges.data(), static_cast<std::uint8_t>(edges.size()), bit_ticks, bits));
+}
+
+TEST_F(DshotTelemetryTests, erpm_is_turned_into_the_motor_frequency) {
+  EXPECT_EQ(propulsion::GetDshotErpm(PERIOD_OF_1000_US), 60000u);
+  EXPECT_EQ(propulsion::GetDshotErpm((7 << 9) | 1), 468750u);
+  EXPECT_NEAR(propulsion::GetMotorFrequencyInHz(60000, 7), 142.857f, 1e-3f);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+#include "dshot.hpp"
+#include "gtest/gtest.h"
+
+namespace {
+
+auto ReferenceChecksum(std::uint16_t throttle_and_telemetry) -> std::uint16_t {
+  std::uint16_t checksum = 0;
+  for (int nibble = 0; nibble < 3; nibble++) {
+    checksum ^= throttle_and_telemetry & 0x0F;
+    throttle_and_telemetry >>= 4;
+  }
+  return checksum;
+}
+
+TEST(DshotTests, known_frame_is_encoded) {
+  EXPECT_EQ(propulsion::EncodeDshotFrame(1046, false), 0x82C6);
+  EXPECT_EQ(propulsion::EncodeDshotFrame(0, false), 0x0000);
+}
+
+TEST(DshotTests, every_throttle_value_has_a_correct_checksum) {
+  for (std::uint16_t throttle = 0; throttle <= propulsion::DSHOT_MAX_THROTTLE; throttle++) {
+    for (const bool telemetry : {false, true}) {
+      const auto frame = propulsion::EncodeDshotFrame(throttle, telemetry);
+      const auto throttle_and_telemetry = static_cast<std::uint16_t>((throttle << 1) | (telemetry ? 1 : 0));
+
+      ASSERT_EQ(frame >> 4, throttle_and_telemetry);
+      ASSERT_EQ(frame & 0x0F, ReferenceChecksum(throttle_and_telemetry));
+    }
+  }
+}
+
+TEST(DshotTests, every_frame_is_decoded_to_its_fields) {
+  for (std::uint16_t throttle = 0; throttle <= propulsion::DSHOT_MAX_THROTTLE; throttle++) {
+    for (const bool telemetry : {false, true}) {
+      std::uint16_t decoded_throttle = 0;
+      bool decoded_telemetry = !telemetry;
+
+      ASSERT_TRUE(propulsion::DecodeDshotFrame(propulsion::EncodeDshotFrame(throttle, telemetry), decoded_throttle, decoded_telemetry));
+      ASSERT_EQ(decoded_throttle, throttle);
+      ASSERT_EQ(decoded_telemetry, telemetry);
+    }
+  }
+}
+
+TEST(DshotTests, every_single_bit_error_is_detected) {
+  std::uint16_t throttle = 0;
+  bool telemetry = false;
+  for (std::uint16_t value = 0; value <= propulsion::DSHOT_MAX_THROTTLE; value++) {
+    const auto frame = propulsion::EncodeDshotFrame(value, false);
+    for (int bit = 0; bit < propulsion::DSHOT_FRAME_BITS; bit++)
+      ASSERT_FALSE(propulsion::DecodeDshotFrame(static_cast<std::uint16_t>(frame ^ (1 << bit)), throttle, telemetry));
+  }
+}
+
+TEST(DshotTests, bit_timing_of_dshot_600_at_170_mhz) {
+  const auto timing = propulsion::GetDshotBitTiming(170000000, types::DshotSpeed::DSHOT_600);
+
+  EXPECT_EQ(timing.period_in_ticks, 283u);
+  EXPECT_EQ(timing.zero_high_ticks, 106u);
+  EXPECT_EQ(timing.one_high_ticks, 212u);
+}
+
+TEST(DshotTests, bit_timing_of_dshot_300_at_170_mhz) {
+  const auto timing = propulsion::GetDshotBitTiming(170000000, types::DshotSpeed::DSHOT_300);
+
+  EXPECT_EQ(timing.period_in_ticks, 567u);
+  EXPECT_EQ(timing.zero_high_ticks, 213u);
+  EXPECT_EQ(timing.one_high_ticks, 425u);
+}
+
+TEST(DshotTests, bit_timing_stays_within_the_protocol_tolerance) {
+  for (const auto speed : {types::DshotSpeed::DSHOT_300, types::DshotSpeed::DSHOT_600}) {
+    const auto timing = propulsion::GetDshotBitTiming(170000000, speed);
+    const auto period = static_cast<double>(timing.period_in_ticks);
+
+    EXPECT_NEAR(170000000.0 / period, propulsion::GetDshotBitRate(speed), propulsion::GetDshotBitRate(speed) * 0.01);
+    EXPECT_NEAR(timing.zero_high_ticks / period, 0.375, 0.01);
+    EXPECT_NEAR(timing.one_high_ticks / period, 0.75, 0.01);
+  }
+}
+
+TEST(DshotTests, bits_are_sent_msb_first_followed_by_low_reset_slots) {
+  const auto timing = propulsion::GetDshotBitTiming(170000000, types::DshotSpeed::DSHOT_600);
+
+  for (std::uint16_t throttle = 0; throttle <= propulsion::DSHOT_MAX_THROTTLE; throttle++) {
+    const auto frame = propulsion::EncodeDshotFrame(throttle, false);
+    const auto compare_values = propulsion::EncodeDshotBits(frame, timing);
+
+    std::uint16_t received = 0;
+    for (int slot = 0; slot < propulsion::DSHOT_FRAME_BITS; slot++) {
+      ASSERT_TRUE(compare_values[slot] == timing.one_high_ticks || compare_values[slot] == timing.zero_high_ticks);
+      received = static_cast<std::uint16_t>((received << 1) | (compare_values[slot] == timing.one_high_ticks ? 1 : 0));
+    }
+    ASSERT_EQ(received, frame);
+    ASSERT_EQ(compare_values[16], 0u);
+    ASSERT_EQ(compare_values[17], 0u);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include "dshot_esc.hpp"
+#include "globals.hpp"
+#include "gtest/gtest.h"
+#include "little_bee_20_a.hpp"
+#include "multishot_esc.hpp"
+#include "oneshot_42_esc.hpp"
+#include "simulated_timer.hpp"
+#include "stm32g4xx.h"
+
+namespace {
+
+/**
+ * Measures the latency from a command to the first pulse or frame carrying it on the simulated timer,
+ * for commands at random points of the running period. The jitter is the spread of these latencies.
+ * All times are virtual, they show the timing of the target and not of the build machine.
+ */
+class EscSignalBenchmarkTests : public ::testing::Test {
+ protected:
+  static constexpr int COMMANDS = 100;
+  static constexpr double CLOCKS_PER_MICROSECOND = TIMER_CLOCK / 1000000.0;
+  static constexpr int REPETITION_PERIOD_IN_US = 500;
+
+  struct LatencyStatistics {
+    double mean_in_us;
+    double max_in_us;
+    double jitter_in_us;
+  };
+
+  virtual void SetUp() {
+    timer_.Instance = &timer_registers_;
+    hal_tim_pwm_stop_mock_values.which_return = 0;
+    hal_tim_pwm_init_mock_values.which_return = 0;
+    for (std::uint8_t index = 0; index < NUM_RETURN_VALUES; index++) {
+      hal_tim_pwm_stop_mock_values.return_value[index] = HAL_OK;
+      hal_tim_pwm_init_mock_values.return_value[index] = HAL_OK;
+    }
+    hal_tim_pwm_config_channel_mock_values.return_value = HAL_OK;
+    hal_tim_pwm_start_mock_values.return_value = HAL_OK;
+    hal_tim_set_compare_hook = nullptr;
+  }
+
+  static auto GetStatistics(const std::vector<std::uint64_t>& latencies_in_clocks) -> LatencyStatistics {
+    const auto minmax = std::minmax_element(latencies_in_clocks.begin(), latencies_in_clocks.end());
+    double sum = 0.0;
+    for (const auto latency : latencies_in_clocks)
+      sum += static_cast<double>(latency);
+    return LatencyStatistics{sum / static_cast<double>(latencies_in_clocks.size()) / CLOCKS_PER_MICROSECOND,
+                             static_cast<double>(*minmax.second) / CLOCKS_PER_MICROSECOND,
+                             static_cast<double>(*minmax.second - *minmax.first) / CLOCKS_PER_MICROSECOND};
+  }
+
+  /// Alternates between two pulse durations, so every command changes the waveform
+  auto MeasurePulseEsc(propulsion::PulseEsc& esc, const std::uint32_t timer_clock_rate) -> LatencyStatistics {
+    hal_tim_calc_psc_mock_values.return_value = TIMER_CLOCK / timer_clock_rate - 1;
+    const auto period_in_clocks = static_cast<std::uint64_t>(REPETITION_PERIOD_IN_US * CLOCKS_PER_MICROSECOND);
+    const int pulse_durations[2] = {esc.GetMinPulseDurationInMicroSeconds(), esc.GetMaxPulseDurationInMicroSeconds()};
+    std::uniform_int_distribution<std::uint64_t> phase(0, period_in_clocks);
+    std::vector<std::uint64_t> latencies;
+
+    EXPECT_EQ(esc.SetPulseDuration(pulse_durations[0], REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+    simulated_timer_.TickUntilPeriodEnd();
+    for (int command = 1; command <= COMMANDS; command++) {
+      simulated_timer_.RunUntil(simulated_timer_.GetTimeInClocks() + phase(generator_));
+      const auto pulse_duration = pulse_durations[command % 2];
+      const auto command_time = simulated_timer_.GetTimeInClocks();
+      EXPECT_EQ(esc.SetPulseDuration(pulse_duration, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+      simulated_timer_.RunUntil(command_time + 2 * period_in_clocks);
+
+      const auto pulses = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_1));
+      const auto width_in_clocks = static_cast<std::uint64_t>(pulse_duration * CLOCKS_PER_MICROSECOND);
+      const auto pulse = propulsion::FindPulse(pulses, command_time, width_in_clocks);
+      if (pulse == pulses.size()) {
+        ADD_FAILURE() << "No pulse of " << pulse_duration << " us after command " << command;
+        break;
+      }
+      latencies.push_back(pulses[pulse].start_in_clocks - command_time);
+    }
+    return GetStatistics(latencies);
+  }
+
+  auto MeasureDshotEsc(const types::DshotSpeed speed) -> LatencyStatistics {
+    DMA_Channel_TypeDef dma_channel{};
+    DMAMUX_Channel_TypeDef request_router{};
+    auto dshot_timer = std::make_shared<propulsion::DshotTimer>(&timer_, propulsion::DshotDmaConfig{&dma_channel, &request_router, DMA_REQUEST_TIM3_UP}, speed);
+    propulsion::DshotEsc esc(dshot_timer, TIM_CHANNEL_1);
+    const auto& burst_buffer = dshot_timer->GetBurstBuffer();
+    simulated_timer_.AttachBurstDma(dma_channel, burst_buffer.data(), static_cast<std::uint32_t>(burst_buffer.size()));
+    const auto bit_period = static_cast<std::uint64_t>(dshot_timer->GetBitTiming().period_in_ticks);
+    const auto frame_period = propulsion::DSHOT_BIT_SLOTS * bit_period;
+    std::uniform_int_distribution<std::uint64_t> phase(0, frame_period);
+    std::vector<std::uint64_t> latencies;
+
+    for (int command = 0; command < COMMANDS; command++) {
+      simulated_timer_.RunUntil(simulated_timer_.GetTimeInClocks() + phase(generator_));
+      const auto command_time = simulated_timer_.GetTimeInClocks();
+      const auto first_new_pulse = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_1)).size();
+      EXPECT_EQ(esc.SetPulseDuration(command % 2 == 0 ? 48 : 2047, 0), types::DriverStatus::OK);
+      simulated_timer_.RunUntil(command_time + frame_period + 4 * bit_period);
+
+      const auto pulses = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_1));
+      if (pulses.size() != first_new_pulse + propulsion::DSHOT_FRAME_BITS) {
+        ADD_FAILURE() << "Frame " << command << " has " << pulses.size() - first_new_pulse << " bits";
+        break;
+      }
+      latencies.push_back(pulses[first_new_pulse].start_in_clocks - command_time);
+    }
+    return GetStatistics(latencies);
+  }
+
+  auto Report(const std::string& name, const LatencyStatistics& statistics) -> void {
+    Report(name + "_latency_mean", statistics.mean_in_us, "us");
+    Report(name + "_latency_max", statistics.max_in_us, "us");
+    Report(name + "_jitter", statistics.jitter_in_us, "us");
+  }
+
+  auto Report(const std::string& name, const double value, const std::string& unit) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << value << " " << unit << std::endl;
+    RecordProperty(name, std::to_string(value));
+  }
+
+  std::mt19937_64 generator_{42};
+  TIM_TypeDef timer_registers_{};
+  TIM_HandleTypeDef timer_{};
+  propulsion::SimulatedTimer simulated_timer_{timer_registers_};
+};
+
+TEST_F(EscSignalBenchmarkTests, oneshot_125_command_to_pulse_latency) {
+  propulsion::LittleBee20A esc(&timer_, TIM_CHANNEL_1);
+  const auto statistics = MeasurePulseEsc(esc, propulsion::ONESHOT_125_PROTOCOL.timer_clock_rate);
+
+  Report("oneshot_125", statistics);
+  EXPECT_LE(statistics.max_in_us, REPETITION_PERIOD_IN_US + 1.0);
+}
+
+TEST_F(EscSignalBenchmarkTests, oneshot_42_command_to_pulse_latency) {
+  propulsion::Oneshot42Esc esc(&timer_, TIM_CHANNEL_1);
+  const auto statistics = MeasurePulseEsc(esc, propulsion::ONESHOT_42_PROTOCOL.timer_clock_rate);
+
+  Report("oneshot_42", statistics);
+  EXPECT_LE(statistics.max_in_us, REPETITION_PERIOD_IN_US + 1.0);
+}
+
+TEST_F(EscSignalBenchmarkTests, multishot_command_to_pulse_latency) {
+  propulsion::MultishotEsc esc(&timer_, TIM_CHANNEL_1);
+  const auto statistics = MeasurePulseEsc(esc, propulsion::MULTISHOT_PROTOCOL.timer_clock_rate);
+
+  Report("multishot", statistics);
+  EXPECT_LE(statistics.max_in_us, REPETITION_PERIOD_IN_US + 1.0);
+}
+
+TEST_F(EscSignalBenchmarkTests, dshot_600_command_to_frame_latency) {
+  const auto statistics = MeasureDshotEsc(types::DshotSpeed::DSHOT_600);
+
+  Report("dshot_600", statistics);
+  // The frame starts with the second update event after the command, at most two bit periods later
+  EXPECT_LE(statistics.max_in_us, 2 * 1000000.0 / 600000.0 + 0.01);
+}
+
+TEST_F(EscSignalBenchmarkTests, dshot_300_command_to_frame_latency) {
+  const auto statistics = MeasureDshotEsc(types::DshotSpeed::DSHOT_300);
+
+  Report("dshot_300", statistics);
+  EXPECT_LE(statistics.max_in_us, 2 * 1000000.0 / 300000.0 + 0.01);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,171 @@
+#include <memory>
+#include <vector>
+#include "dshot_esc.hpp"
+#include "globals.hpp"
+#include "gtest/gtest.h"
+#include "little_bee_20_a.hpp"
+#include "multishot_esc.hpp"
+#include "oneshot_42_esc.hpp"
+#include "simulated_timer.hpp"
+#include "stm32g4xx.h"
+
+namespace {
+
+/**
+ * Runs the ESCs on the simulated timer and checks the waveform a motor sees, in kernel clocks of the timer.
+ */
+class EscSignalTests : public ::testing::Test {
+ protected:
+  static constexpr std::uint64_t CLOCKS_PER_MICROSECOND = TIMER_CLOCK / 1000000;
+  static constexpr int REPETITION_PERIOD_IN_US = 500;
+
+  virtual void SetUp() {
+    timer_.Instance = &timer_registers_;
+    hal_tim_pwm_stop_mock_values.which_return = 0;
+    hal_tim_pwm_init_mock_values.which_return = 0;
+    for (std::uint8_t index = 0; index < NUM_RETURN_VALUES; index++) {
+      hal_tim_pwm_stop_mock_values.return_value[index] = HAL_OK;
+      hal_tim_pwm_init_mock_values.return_value[index] = HAL_OK;
+    }
+    hal_tim_pwm_config_channel_mock_values.return_value = HAL_OK;
+    hal_tim_pwm_start_mock_values.return_value = HAL_OK;
+    hal_tim_set_compare_hook = nullptr;
+  }
+
+  /// The HAL divides the kernel clock down to the timer clock rate of the protocol
+  static auto SetTimerClockRate(const std::uint32_t timer_clock_rate) -> void {
+    hal_tim_calc_psc_mock_values.return_value = TIMER_CLOCK / timer_clock_rate - 1;
+  }
+
+  static auto InClocks(const int microseconds) -> std::uint64_t {
+    return static_cast<std::uint64_t>(microseconds) * CLOCKS_PER_MICROSECOND;
+  }
+
+  TIM_TypeDef timer_registers_{};
+  TIM_HandleTypeDef timer_{};
+  propulsion::SimulatedTimer simulated_timer_{timer_registers_};
+};
+
+TEST_F(EscSignalTests, oneshot_125_pulses_have_the_commanded_width_and_period) {
+  SetTimerClockRate(propulsion::ONESHOT_125_PROTOCOL.timer_clock_rate);
+  propulsion::LittleBee20A esc(&timer_, TIM_CHANNEL_1);
+
+  ASSERT_EQ(esc.SetPulseDuration(200, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  simulated_timer_.RunUntil(InClocks(3 * REPETITION_PERIOD_IN_US));
+
+  const auto pulses = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_1));
+  ASSERT_GE(pulses.size(), 2u);
+  for (std::size_t pulse = 0; pulse < pulses.size(); pulse++) {
+    EXPECT_EQ(pulses[pulse].width_in_clocks, InClocks(200));
+    EXPECT_EQ(pulses[pulse].start_in_clocks - pulses[0].start_in_clocks, pulse * InClocks(REPETITION_PERIOD_IN_US));
+  }
+}
+
+TEST_F(EscSignalTests, command_during_a_pulse_takes_effect_with_the_next_period_without_truncation) {
+  SetTimerClockRate(propulsion::MULTISHOT_PROTOCOL.timer_clock_rate);
+  propulsion::MultishotEsc esc(&timer_, TIM_CHANNEL_1);
+  ASSERT_EQ(esc.SetPulseDuration(25, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  simulated_timer_.TickUntilPeriodEnd();
+  simulated_timer_.TickUntilCounter(1000);
+
+  const auto command_time = simulated_timer_.GetTimeInClocks();
+  ASSERT_EQ(esc.SetPulseDuration(5, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  simulated_timer_.RunUntil(command_time + InClocks(3 * REPETITION_PERIOD_IN_US));
+
+  const auto pulses = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_1));
+  const auto first_new_pulse = propulsion::FindPulse(pulses, command_time, InClocks(5));
+  ASSERT_LT(first_new_pulse, pulses.size());
+  ASSERT_GE(first_new_pulse, 1u);
+  EXPECT_EQ(pulses[first_new_pulse - 1].width_in_clocks, InClocks(25));
+  EXPECT_LE(pulses[first_new_pulse].start_in_clocks - command_time, InClocks(REPETITION_PERIOD_IN_US));
+  for (const auto& pulse : pulses)
+    EXPECT_TRUE(pulse.width_in_clocks == InClocks(25) || pulse.width_in_clocks == InClocks(5)) << pulse.width_in_clocks;
+}
+
+TEST_F(EscSignalTests, first_command_of_a_second_esc_on_the_timer_leaves_the_running_pulse_untouched) {
+  SetTimerClockRate(propulsion::ONESHOT_125_PROTOCOL.timer_clock_rate);
+  propulsion::LittleBee20A first_esc(&timer_, TIM_CHANNEL_1);
+  propulsion::LittleBee20A second_esc(&timer_, TIM_CHANNEL_2);
+  ASSERT_EQ(first_esc.SetPulseDuration(250, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  simulated_timer_.TickUntilPeriodEnd();
+  simulated_timer_.TickUntilCounter(1000);
+  const auto initializations = hal_tim_pwm_init_mock_values.which_return;
+
+  // The shared counter keeps running in the middle of the pulse of the first ESC
+  ASSERT_EQ(second_esc.SetPulseDuration(125, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  for (int period = 0; period < 3; period++)
+    simulated_timer_.TickUntilPeriodEnd();
+
+  EXPECT_EQ(hal_tim_pwm_init_mock_values.which_return, initializations);
+  const auto first_pulses = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_1));
+  ASSERT_EQ(first_pulses.size(), 4u);
+  for (const auto& pulse : first_pulses)
+    EXPECT_EQ(pulse.width_in_clocks, InClocks(250));
+  // The second ESC starts with a whole pulse at the next period instead of the remainder of this one
+  const auto second_pulses = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_2));
+  ASSERT_EQ(second_pulses.size(), 2u);
+  for (std::size_t pulse = 0; pulse < second_pulses.size(); pulse++) {
+    EXPECT_EQ(second_pulses[pulse].width_in_clocks, InClocks(125));
+    EXPECT_EQ(second_pulses[pulse].start_in_clocks, first_pulses[pulse + 2].start_in_clocks);
+  }
+}
+
+TEST_F(EscSignalTests, second_esc_with_another_period_on_the_running_timer_is_rejected) {
+  SetTimerClockRate(propulsion::ONESHOT_125_PROTOCOL.timer_clock_rate);
+  propulsion::LittleBee20A first_esc(&timer_, TIM_CHANNEL_1);
+  propulsion::LittleBee20A second_esc(&timer_, TIM_CHANNEL_2);
+  ASSERT_EQ(first_esc.SetPulseDuration(250, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  simulated_timer_.TickUntilPeriodEnd();
+  const auto auto_reload = timer_registers_.ARR;
+
+  EXPECT_EQ(second_esc.SetPulseDuration(125, 2 * REPETITION_PERIOD_IN_US), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(timer_registers_.ARR, auto_reload);
+  EXPECT_EQ(timer_registers_.CCER & (TIM_CCER_CC1E << TIM_CHANNEL_2), 0u);
+}
+
+TEST_F(EscSignalTests, second_esc_with_another_timer_clock_on_the_running_timer_is_rejected) {
+  SetTimerClockRate(propulsion::ONESHOT_125_PROTOCOL.timer_clock_rate);
+  propulsion::LittleBee20A first_esc(&timer_, TIM_CHANNEL_1);
+  propulsion::Oneshot42Esc second_esc(&timer_, TIM_CHANNEL_2);
+  ASSERT_EQ(first_esc.SetPulseDuration(250, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  simulated_timer_.TickUntilPeriodEnd();
+  const auto prescaler = timer_registers_.PSC;
+
+  SetTimerClockRate(propulsion::ONESHOT_42_PROTOCOL.timer_clock_rate);
+  EXPECT_EQ(second_esc.SetPulseDuration(42, REPETITION_PERIOD_IN_US), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(timer_registers_.PSC, prescaler);
+  EXPECT_EQ(timer_registers_.CCER & (TIM_CCER_CC1E << TIM_CHANNEL_2), 0u);
+}
+
+TEST_F(EscSignalTests, dshot_frame_is_reconstructed_from_the_waveform) {
+  DMA_Channel_TypeDef dma_channel{};
+  DMAMUX_Channel_TypeDef request_router{};
+  auto dshot_timer = std::make_shared<propulsion::DshotTimer>(&timer_, propulsion::DshotDmaConfig{&dma_channel, &request_router, DMA_REQUEST_TIM3_UP}, types::DshotSpeed::DSHOT_600);
+  propulsion::DshotEsc esc(dshot_timer, TIM_CHANNEL_1);
+  const auto& burst_buffer = dshot_timer->GetBurstBuffer();
+  simulated_timer_.AttachBurstDma(dma_channel, burst_buffer.data(), static_cast<std::uint32_t>(burst_buffer.size()));
+  const auto bit_period = static_cast<std::uint64_t>(dshot_timer->GetBitTiming().period_in_ticks);
+
+  const auto command_time = simulated_timer_.GetTimeInClocks();
+  ASSERT_EQ(esc.SetPulseDuration(1046, 0), types::DriverStatus::OK);
+  simulated_timer_.RunUntil(command_time + (propulsion::DSHOT_BIT_SLOTS + 4) * bit_period);
+
+  const auto pulses = propulsion::GetHighPulses(simulated_timer_.GetEdges(TIM_CHANNEL_1));
+  ASSERT_EQ(pulses.size(), static_cast<std::size_t>(propulsion::DSHOT_FRAME_BITS));
+  std::uint16_t frame = 0;
+  for (std::size_t bit = 0; bit < pulses.size(); bit++) {
+    EXPECT_EQ(pulses[bit].start_in_clocks - pulses[0].start_in_clocks, bit * bit_period);
+    frame = static_cast<std::uint16_t>((frame << 1) | (2 * pulses[bit].width_in_clocks > bit_period ? 1 : 0));
+  }
+  EXPECT_EQ(frame, propulsion::EncodeDshotFrame(1046, false));
+  // The first update event loads the first slot into the preload registers, the second one makes it active
+  EXPECT_EQ(pulses[0].start_in_clocks - command_time, bit_period);
+  EXPECT_EQ(dma_channel.CNDTR, 0u);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
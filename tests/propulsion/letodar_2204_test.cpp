@@ -3,6 +3,8 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+using ::testing::_;
+using ::testing::FloatNear;
 using ::testing::NiceMock;
 using ::testing::Return;
 
@@ -48,6 +50,13 @@ TEST_F(Letodar2204Tests, set_speed_in_percent_legal_range) {
   ASSERT_EQ(types::DriverStatus::OK, set_speed_return);
 }
 
+TEST_F(Letodar2204Tests, set_speed_in_percent_keeps_fractions_of_a_microsecond) {
+  EXPECT_CALL(*esc_, SetPulseDuration(FloatNear(55.45f, 1e-4f), _)).WillOnce(Return(types::DriverStatus::OK));
+  ConfigureUnitUnderTest();
+  auto set_speed_return = unit_under_test_->SetSpeedInPercent(50.5);
+  ASSERT_EQ(types::DriverStatus::OK, set_speed_return);
+}
+
 TEST_F(Letodar2204Tests, set_speed_in_percent_hal_error_triggered) {
   EXPECT_CALL(*esc_, SetPulseDuration).WillOnce(Return(types::DriverStatus::HAL_ERROR));
   ConfigureUnitUnderTest();
@@ -2,6 +2,7 @@
 #include <memory>
 #include <utility>
 #include "gtest/gtest.h"
+#include "simulated_timer.hpp"
 #include "stm32g4xx.h"
 
 namespace {
@@ -9,6 +10,7 @@ namespace {
 class LittleBeeEscTests : public ::testing::Test {
  protected:
   virtual void SetUp() {
+    mock_timer.Instance = &timer_registers;
     unit_under_test_ = std::make_unique<propulsion::LittleBee20A>(&mock_timer, 2);
     legal_pulse_duration = 150;
     legal_repetition_period = 2000;
@@ -25,6 +27,7 @@ class LittleBeeEscTests : public ::testing::Test {
     hal_tim_pwm_start_mock_values.return_value = HAL_OK;
   }
 
+  TIM_TypeDef timer_registers{};
   TIM_HandleTypeDef mock_timer;
   std::uint32_t mock_channel;
   std::unique_ptr<propulsion::LittleBee20A> unit_under_test_;
@@ -174,6 +177,89 @@ TEST_F(LittleBeeEscTests, set_pulse_duration_both_parameters_upper_bounds) {
   auto set_pulse_duration_return = unit_under_test_->SetPulseDuration(max_allowed_pulse_duration, max_allowed_repitition_period);
   ASSERT_EQ(set_pulse_duration_return, types::DriverStatus::OK);
 }
+
+class LittleBeeEscSimulatedTimerTests : public LittleBeeEscTests {
+ protected:
+  virtual void SetUp() {
+    LittleBeeEscTests::SetUp();
+    SetHalOk();
+    unit_under_test_ = std::make_unique<propulsion::LittleBee20A>(&mock_timer, TIM_CHANNEL_1);
+  }
+
+  propulsion::SimulatedTimer simulated_timer_{timer_registers};
+};
+
+TEST_F(LittleBeeEscSimulatedTimerTests, later_pulse_durations_only_write_the_compare_register) {
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(150, 2000), types::DriverStatus::OK);
+  const auto stop_calls = hal_tim_pwm_stop_mock_values.which_return;
+  const auto init_calls = hal_tim_pwm_init_mock_values.which_return;
+  hal_tim_pwm_start_mock_values.htim = nullptr;
+  hal_tim_pwm_config_channel_mock_values.htim = nullptr;
+
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(200, 2000), types::DriverStatus::OK);
+
+  EXPECT_EQ(timer_registers.CCR1, 2000u);
+  EXPECT_EQ(hal_tim_pwm_stop_mock_values.which_return, stop_calls);
+  EXPECT_EQ(hal_tim_pwm_init_mock_values.which_return, init_calls);
+  EXPECT_EQ(hal_tim_pwm_start_mock_values.htim, nullptr);
+  EXPECT_EQ(hal_tim_pwm_config_channel_mock_values.htim, nullptr);
+}
+
+TEST_F(LittleBeeEscSimulatedTimerTests, timer_is_started_with_preloaded_registers) {
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(150, 2000), types::DriverStatus::OK);
+
+  EXPECT_NE(timer_registers.CR1 & TIM_CR1_ARPE, 0u);
+  EXPECT_NE(timer_registers.CCMR1 & TIM_CCMR1_OC1PE, 0u);
+  EXPECT_NE(timer_registers.CR1 & TIM_CR1_CEN, 0u);
+}
+
+TEST_F(LittleBeeEscSimulatedTimerTests, shorter_pulse_during_a_pulse_is_not_truncated) {
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(250, 2000), types::DriverStatus::OK);
+  simulated_timer_.TickUntilCounter(2000);
+
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(150, 2000), types::DriverStatus::OK);
+  simulated_timer_.Tick(3 * 20001);
+
+  const std::vector<std::uint32_t> expected_pulses{2500, 1500, 1500};
+  EXPECT_EQ(simulated_timer_.GetPulses(TIM_CHANNEL_1), expected_pulses);
+}
+
+TEST_F(LittleBeeEscSimulatedTimerTests, longer_pulse_after_a_pulse_is_not_repeated) {
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(150, 2000), types::DriverStatus::OK);
+  simulated_timer_.TickUntilCounter(2000);
+
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(250, 2000), types::DriverStatus::OK);
+  simulated_timer_.Tick(2 * 20001);
+
+  const std::vector<std::uint32_t> expected_pulses{1500, 2500};
+  EXPECT_EQ(simulated_timer_.GetPulses(TIM_CHANNEL_1), expected_pulses);
+}
+
+TEST_F(LittleBeeEscSimulatedTimerTests, unbuffered_compare_register_would_truncate_the_pulse) {
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(250, 2000), types::DriverStatus::OK);
+  timer_registers.CCMR1 &= ~TIM_CCMR1_OC1PE;
+  simulated_timer_.TickUntilCounter(2000);
+
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(150, 2000), types::DriverStatus::OK);
+  simulated_timer_.Tick(20001);
+
+  EXPECT_EQ(simulated_timer_.GetPulses(TIM_CHANNEL_1).at(0), 2000u);
+}
+
+TEST_F(LittleBeeEscSimulatedTimerTests, new_repetition_period_starts_with_the_next_period) {
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(150, 2000), types::DriverStatus::OK);
+  simulated_timer_.TickUntilCounter(15000);
+
+  ASSERT_EQ(unit_under_test_->SetPulseDuration(200, 1000), types::DriverStatus::OK);
+  simulated_timer_.Tick(5001 + 2 * 10001);
+
+  const std::vector<std::uint32_t> expected_periods{20000, 10000, 10000};
+  const std::vector<std::uint32_t> expected_pulses{1500, 2000, 2000};
+  EXPECT_EQ(simulated_timer_.GetPeriods(), expected_periods);
+  EXPECT_EQ(simulated_timer_.GetPulses(TIM_CHANNEL_1), expected_pulses);
+  EXPECT_EQ(mock_timer.Init.Period, 9999u);
+}
+
 }  // namespace
 
 int main(int argc, char **argv) {
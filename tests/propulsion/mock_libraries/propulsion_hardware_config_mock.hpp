@@ -11,6 +11,8 @@ enum class MotorType : int {
 
 enum class EscType : int {
   LITTLE_BEE_20_A,
+  ONESHOT_42,
+  MULTISHOT,
   NONE
 };
 
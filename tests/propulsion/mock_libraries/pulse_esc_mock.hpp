@@ -0,0 +1,12 @@
+#ifndef TESTS_MOCK_LIBRARIES_PROPULSION_PULSE_ESC_MOCK_HPP_
+#define TESTS_MOCK_LIBRARIES_PROPULSION_PULSE_ESC_MOCK_HPP_
+
+#include "esc_mock.hpp"
+
+namespace propulsion {
+
+using Oneshot42Esc = MockEsc;
+using MultishotEsc = MockEsc;
+}  // namespace propulsion
+
+#endif
@@ -0,0 +1,233 @@
+#ifndef TESTS_MOCK_LIBRARIES_PROPULSION_SIMULATED_TIMER_HPP_
+#define TESTS_MOCK_LIBRARIES_PROPULSION_SIMULATED_TIMER_HPP_
+
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "stm32g4xx.h"
+
+namespace propulsion {
+
+/**
+ * @brief Level change of a simulated output, at the virtual time in timer kernel clocks
+ *
+ */
+struct SignalEdge {
+  std::uint64_t time_in_clocks;
+  bool is_high;
+};
+
+/**
+ * @brief High time of a simulated output between a rising and the following falling edge
+ *
+ */
+struct SignalPulse {
+  std::uint64_t start_in_clocks;
+  std::uint64_t width_in_clocks;
+};
+
+/// Collects the completed high pulses of a recorded waveform
+inline auto GetHighPulses(const std::vector<SignalEdge>& edges) -> std::vector<SignalPulse> {
+  std::vector<SignalPulse> pulses;
+  for (std::size_t edge = 1; edge < edges.size(); edge++)
+    if (edges[edge - 1].is_high && !edges[edge].is_high)
+      pulses.push_back(SignalPulse{edges[edge - 1].time_in_clocks, edges[edge].time_in_clocks - edges[edge - 1].time_in_clocks});
+  return pulses;
+}
+
+/**
+ * @brief Finds the first pulse starting at or after a point in time with the given width
+ * @return Index of the pulse, the amount of pulses if there is none
+ */
+inline auto FindPulse(const std::vector<SignalPulse>& pulses, const std::uint64_t after_in_clocks, const std::uint64_t width_in_clocks) -> std::size_t {
+  for (std::size_t pulse = 0; pulse < pulses.size(); pulse++)
+    if (pulses[pulse].start_in_clocks >= after_in_clocks && pulses[pulse].width_in_clocks == width_in_clocks)
+      return pulse;
+  return pulses.size();
+}
+
+/**
+ * @brief Model of the up counting PWM mode 1 channels 1 - 4 of a timer register block.
+ *        Auto reload and compare values have shadow registers like the hardware: with preload
+ *        enabled they are loaded at the update event only, otherwise the registers act at once.
+ *        The prescaler is always loaded at the update event. UDIS suppresses the update event,
+ *        so the shadow registers keep their values.
+ *        The outputs are high while the counter is below the active compare value, inverted by
+ *        CCxP, and low while CCxE is cleared. The high time of every completed period is recorded
+ *        per channel in counter ticks, every level change as SignalEdge in kernel clocks.
+ *        The virtual time runs on while the counter is stopped.
+ *        An attached DMA channel is served by the update event like the burst through DMAR.
+ *
+ */
+class SimulatedTimer {
+ public:
+  explicit SimulatedTimer(TIM_TypeDef& registers) : registers_(registers) {}
+
+  /// Runs the given amount of counter ticks, each lasts prescaler + 1 kernel clocks
+  auto Tick(const std::uint32_t ticks = 1) -> void {
+    for (std::uint32_t tick = 0; tick < ticks; tick++)
+      TickOnce();
+  }
+
+  /// Runs until the virtual time reached the given amount of kernel clocks, the last counter tick may end later
+  auto RunUntil(const std::uint64_t time_in_clocks) -> void {
+    while (time_in_clocks_ < time_in_clocks)
+      TickOnce();
+  }
+
+  /// Ticks until the counter of the running period reached the given value
+  auto TickUntilCounter(const std::uint32_t counter) -> void {
+    while (registers_.CNT != counter)
+      TickOnce();
+  }
+
+  /// Ticks until the running period is completed, its update event included. Returns at once if the counter is stopped.
+  auto TickUntilPeriodEnd(void) -> void {
+    const auto completed_periods = periods_.size();
+    while (periods_.size() == completed_periods && (registers_.CR1 & TIM_CR1_CEN) != 0)
+      TickOnce();
+  }
+
+  /**
+   * @brief Feeds the DMA channel of the DShot burst: every update event with UDE copies four words into CCR1 - CCR4
+   * @param dma The channel programmed by the code under test, its CMAR holds a truncated address on the host
+   * @param memory What the DMA channel reads, starting at the word CNDTR was set to length for
+   * @param length Amount of words the code under test transfers per run
+   */
+  auto AttachBurstDma(DMA_Channel_TypeDef& dma, const std::uint32_t* memory, const std::uint32_t length) -> void {
+    dma_ = &dma;
+    dma_memory_ = memory;
+    dma_length_ = length;
+  }
+
+  auto GetTimeInClocks(void) const -> std::uint64_t {
+    return time_in_clocks_;
+  }
+
+  auto GetPulses(const std::uint32_t channel) const -> const std::vector<std::uint32_t>& {
+    return pulses_.at(GetIndex(channel));
+  }
+
+  auto GetPeriods(void) const -> const std::vector<std::uint32_t>& {
+    return periods_;
+  }
+
+  auto GetEdges(const std::uint32_t channel) const -> const std::vector<SignalEdge>& {
+    return edges_.at(GetIndex(channel));
+  }
+
+ private:
+  static constexpr std::uint8_t NUMBER_OF_CHANNELS = 4;
+  static constexpr std::uint32_t BURST_LENGTH = 4;
+
+  static auto GetIndex(const std::uint32_t channel) -> std::uint8_t {
+    return static_cast<std::uint8_t>(channel / TIM_CHANNEL_2);
+  }
+
+  auto TickOnce(void) -> void {
+    if ((registers_.CR1 & TIM_CR1_CEN) == 0) {
+      RecordEdges();
+      time_in_clocks_ += shadow_prescaler_ + 1;
+      return;
+    }
+
+    if ((registers_.EGR & TIM_EGR_UG) != 0) {
+      registers_.EGR &= ~TIM_EGR_UG;
+      registers_.CNT = 0;
+      UpdateEvent();
+      high_ticks_.fill(0);
+    }
+
+    RecordEdges();
+    time_in_clocks_ += shadow_prescaler_ + 1;
+    for (std::uint8_t index = 0; index < NUMBER_OF_CHANNELS; index++)
+      if (registers_.CNT < ActiveCompare(index))
+        high_ticks_[index]++;
+
+    if (registers_.CNT >= ActiveAutoReload()) {
+      for (std::uint8_t index = 0; index < NUMBER_OF_CHANNELS; index++)
+        pulses_[index].push_back(high_ticks_[index]);
+      periods_.push_back(registers_.CNT + 1);
+      high_ticks_.fill(0);
+      registers_.CNT = 0;
+      UpdateEvent();
+    } else {
+      registers_.CNT++;
+    }
+  }
+
+  auto UpdateEvent(void) -> void {
+    if ((registers_.CR1 & TIM_CR1_UDIS) != 0)
+      return;
+
+    shadow_prescaler_ = registers_.PSC;
+    shadow_auto_reload_ = registers_.ARR;
+    for (std::uint8_t index = 0; index < NUMBER_OF_CHANNELS; index++)
+      shadow_compare_[index] = Compare(index);
+
+    // The DMA request follows the update, so its words act from the next update event on
+    if (dma_ != nullptr && (registers_.DIER & TIM_DIER_UDE) != 0 && (dma_->CCR & DMA_CCR_EN) != 0 && dma_->CNDTR >= BURST_LENGTH) {
+      volatile std::uint32_t* compare_registers[NUMBER_OF_CHANNELS] = {&registers_.CCR1, &registers_.CCR2, &registers_.CCR3, &registers_.CCR4};
+      const auto first_word = dma_length_ - dma_->CNDTR;
+      for (std::uint32_t word = 0; word < BURST_LENGTH; word++)
+        *compare_registers[word] = dma_memory_[first_word + word];
+      dma_->CNDTR -= BURST_LENGTH;
+    }
+  }
+
+  auto RecordEdges(void) -> void {
+    for (std::uint8_t index = 0; index < NUMBER_OF_CHANNELS; index++) {
+      const auto is_high = OutputIsHigh(index);
+      if (is_high != output_is_high_[index]) {
+        edges_[index].push_back(SignalEdge{time_in_clocks_, is_high});
+        output_is_high_[index] = is_high;
+      }
+    }
+  }
+
+  auto OutputIsHigh(const std::uint8_t index) const -> bool {
+    const auto shift = index * TIM_CHANNEL_2;
+    if ((registers_.CCER & (TIM_CCER_CC1E << shift)) == 0)
+      return false;
+    const bool is_active = registers_.CNT < ActiveCompare(index);
+    const bool is_inverted = (registers_.CCER & (TIM_CCER_CC1P << shift)) != 0;
+    return is_active != is_inverted;
+  }
+
+  auto ActiveAutoReload(void) const -> std::uint32_t {
+    return (registers_.CR1 & TIM_CR1_ARPE) != 0 ? shadow_auto_reload_ : registers_.ARR;
+  }
+
+  auto ActiveCompare(const std::uint8_t index) const -> std::uint32_t {
+    return IsComparePreloaded(index) ? shadow_compare_[index] : Compare(index);
+  }
+
+  auto Compare(const std::uint8_t index) const -> std::uint32_t {
+    const volatile std::uint32_t* compare_registers[NUMBER_OF_CHANNELS] = {&registers_.CCR1, &registers_.CCR2, &registers_.CCR3, &registers_.CCR4};
+    return *compare_registers[index];
+  }
+
+  auto IsComparePreloaded(const std::uint8_t index) const -> bool {
+    const std::uint32_t preload_bits[NUMBER_OF_CHANNELS] = {TIM_CCMR1_OC1PE, TIM_CCMR1_OC2PE, TIM_CCMR2_OC3PE, TIM_CCMR2_OC4PE};
+    const auto mode_register = index < 2 ? registers_.CCMR1 : registers_.CCMR2;
+    return (mode_register & preload_bits[index]) != 0;
+  }
+
+  TIM_TypeDef& registers_;
+  std::uint64_t time_in_clocks_ = 0;
+  std::uint32_t shadow_prescaler_ = 0;
+  std::uint32_t shadow_auto_reload_ = 0;
+  std::array<std::uint32_t, NUMBER_OF_CHANNELS> shadow_compare_{};
+  std::array<std::uint32_t, NUMBER_OF_CHANNELS> high_ticks_{};
+  std::array<bool, NUMBER_OF_CHANNELS> output_is_high_{};
+  std::array<std::vector<std::uint32_t>, NUMBER_OF_CHANNELS> pulses_;
+  std::array<std::vector<SignalEdge>, NUMBER_OF_CHANNELS> edges_;
+  std::vector<std::uint32_t> periods_;
+  DMA_Channel_TypeDef* dma_ = nullptr;
+  const std::uint32_t* dma_memory_ = nullptr;
+  std::uint32_t dma_length_ = 0;
+};
+
+}  // namespace propulsion
+
+#endif
@@ -5,8 +5,32 @@
 extern "C" {
 #endif
 
+#include <stdint.h>
 #include "stm32g4xx_hal_tim.h"
 
+#define DMA_CCR_EN 0x00000001U
+#define DMA_CCR_DIR 0x00000010U
+#define DMA_CCR_MINC 0x00000080U
+#define DMA_CCR_PSIZE_1 0x00000200U
+#define DMA_CCR_MSIZE_1 0x00000800U
+#define DMAMUX_CxCR_DMAREQ_ID 0x0000007FU
+#define DMA_REQUEST_TIM3_CH1 61U
+#define DMA_REQUEST_TIM3_CH3 63U
+#define DMA_REQUEST_TIM3_UP 65U
+
+typedef struct
+{
+  volatile uint32_t CCR;
+  volatile uint32_t CNDTR;
+  volatile uint32_t CPAR;
+  volatile uint32_t CMAR;
+} DMA_Channel_TypeDef;
+
+typedef struct
+{
+  volatile uint32_t CCR;
+} DMAMUX_Channel_TypeDef;
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,3 +1,4 @@
+#include <stddef.h>
 #include <stdint.h>
 #include "stm32g4xx_hal_tim.h"
 #include "stm32g4xx_hal_def.h"
@@ -10,6 +11,12 @@ HAL_StatusTypeDef HAL_TIM_PWM_Stop(TIM_HandleTypeDef *htim, uint32_t Channel){
   hal_tim_pwm_stop_mock_values.channel = Channel;
   HAL_StatusTypeDef return_value = hal_tim_pwm_stop_mock_values.return_value[hal_tim_pwm_stop_mock_values.which_return];
   hal_tim_pwm_stop_mock_values.which_return ++;
+  if (return_value == HAL_OK && htim->Instance != NULL) {
+    /* Like the HAL the output is disabled, the counter stops once no output is left */
+    htim->Instance->CCER &= ~(TIM_CCER_CC1E << Channel);
+    if ((htim->Instance->CCER & TIM_CCER_CCxE_MASK) == 0)
+      htim->Instance->CR1 &= ~TIM_CR1_CEN;
+  }
   return return_value;
 }
 
@@ -27,6 +34,19 @@ HAL_StatusTypeDef HAL_TIM_PWM_ConfigChannel(TIM_HandleTypeDef *htim, TIM_OC_Init
   hal_tim_pwm_config_channel_mock_values.htim = htim;
   hal_tim_pwm_config_channel_mock_values.sconfig = sConfig;
   hal_tim_pwm_config_channel_mock_values.channel = Channel;
+  if (hal_tim_pwm_config_channel_mock_values.return_value == HAL_OK && htim->Instance != NULL) {
+    /* Like the HAL the compare value and the polarity are written and the compare preload is enabled */
+    __HAL_TIM_SET_COMPARE(htim, Channel, sConfig->Pulse);
+    htim->Instance->CCER = (htim->Instance->CCER & ~(TIM_CCER_CC1P << Channel)) | (sConfig->OCPolarity << Channel);
+    if (Channel == TIM_CHANNEL_1)
+      htim->Instance->CCMR1 |= TIM_CCMR1_OC1PE;
+    else if (Channel == TIM_CHANNEL_2)
+      htim->Instance->CCMR1 |= TIM_CCMR1_OC2PE;
+    else if (Channel == TIM_CHANNEL_3)
+      htim->Instance->CCMR2 |= TIM_CCMR2_OC3PE;
+    else if (Channel == TIM_CHANNEL_4)
+      htim->Instance->CCMR2 |= TIM_CCMR2_OC4PE;
+  }
   return hal_tim_pwm_config_channel_mock_values.return_value;
 }
 
@@ -36,6 +56,12 @@ HAL_StatusTypeDef HAL_TIM_PWM_Init(TIM_HandleTypeDef *htim){
   hal_tim_pwm_init_mock_values.htim = htim;
   HAL_StatusTypeDef return_value = hal_tim_pwm_init_mock_values.return_value[hal_tim_pwm_init_mock_values.which_return];
   hal_tim_pwm_init_mock_values.which_return ++;
+  if (return_value == HAL_OK && htim->Instance != NULL) {
+    htim->Instance->CR1 = (htim->Instance->CR1 & ~TIM_CR1_ARPE) | htim->Init.AutoReloadPreload;
+    htim->Instance->PSC = htim->Init.Prescaler;
+    htim->Instance->ARR = htim->Init.Period;
+    htim->Instance->EGR = TIM_EGR_UG;
+  }
   return return_value;
 }
 
@@ -44,5 +70,28 @@ HalTimPwmStartMockValues hal_tim_pwm_start_mock_values;
 HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel){
   hal_tim_pwm_start_mock_values.htim = htim;
   hal_tim_pwm_start_mock_values.channel = Channel;
+  if (hal_tim_pwm_start_mock_values.return_value == HAL_OK && htim->Instance != NULL) {
+    htim->Instance->CCER |= TIM_CCER_CC1E << Channel;
+    htim->Instance->CR1 |= TIM_CR1_CEN;
+  }
   return hal_tim_pwm_start_mock_values.return_value;
 }
+
+void (*hal_tim_set_compare_hook)(void) = NULL;
+
+void HAL_TIM_MockSetCompare(TIM_HandleTypeDef *htim, uint32_t Channel, uint32_t Compare){
+  if (Channel == TIM_CHANNEL_1)
+    htim->Instance->CCR1 = Compare;
+  else if (Channel == TIM_CHANNEL_2)
+    htim->Instance->CCR2 = Compare;
+  else if (Channel == TIM_CHANNEL_3)
+    htim->Instance->CCR3 = Compare;
+  else if (Channel == TIM_CHANNEL_4)
+    htim->Instance->CCR4 = Compare;
+  else if (Channel == TIM_CHANNEL_5)
+    htim->Instance->CCR5 = Compare;
+  else
+    htim->Instance->CCR6 = Compare;
+  if (hal_tim_set_compare_hook != NULL)
+    hal_tim_set_compare_hook();
+}
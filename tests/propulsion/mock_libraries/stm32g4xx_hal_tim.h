@@ -12,14 +12,64 @@ extern "C" {
 #define NUM_RETURN_VALUES 2U
 
 #define TIM_OCPOLARITY_HIGH 0x00000000U
+#define TIM_OCPOLARITY_LOW 0x00000002U
 #define TIM_OCFAST_DISABLE 0x00000000U
 #define TIM_OCMODE_PWM1 0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_DISABLE 0x00000000U
+#define TIM_AUTORELOAD_PRELOAD_ENABLE TIM_CR1_ARPE
+
+#define TIM_CR1_CEN 0x00000001U
+#define TIM_CR1_UDIS 0x00000002U
+#define TIM_CR1_ARPE 0x00000080U
+#define TIM_EGR_UG 0x00000001U
+#define TIM_DIER_UDE 0x00000100U
+#define TIM_DIER_CC1DE 0x00000200U
+#define TIM_DMA_UPDATE TIM_DIER_UDE
+#define TIM_DMABASE_CCR1 0x0000000DU
+#define TIM_DMABURSTLENGTH_4TRANSFERS 0x00000300U
+#define TIM_CCMR1_CC1S_0 0x00000001U
+#define TIM_CCMR1_OC1PE 0x00000008U
+#define TIM_CCMR1_OC1M_1 0x00000020U
+#define TIM_CCMR1_OC1M_2 0x00000040U
+#define TIM_CCMR1_OC2PE 0x00000800U
+#define TIM_CCMR2_OC3PE 0x00000008U
+#define TIM_CCMR2_OC4PE 0x00000800U
+#define TIM_CCER_CC1E 0x00000001U
+#define TIM_CCER_CC1P 0x00000002U
+#define TIM_CCER_CC1NP 0x00000008U
+#define TIM_CCER_CCxE_MASK 0x00001111U
+
+/**
+ * Register block of a timer, the simulated timer of the tests runs on it.
+ * The mocked HAL functions configure it like the HAL does, if a handle has an Instance.
+ */
+typedef struct
+{
+  volatile uint32_t CR1;
+  volatile uint32_t DIER;
+  volatile uint32_t EGR;
+  volatile uint32_t CCMR1;
+  volatile uint32_t CCMR2;
+  volatile uint32_t CCER;
+  volatile uint32_t CNT;
+  volatile uint32_t PSC;
+  volatile uint32_t ARR;
+  volatile uint32_t CCR1;
+  volatile uint32_t CCR2;
+  volatile uint32_t CCR3;
+  volatile uint32_t CCR4;
+  volatile uint32_t CCR5;
+  volatile uint32_t CCR6;
+  volatile uint32_t DCR;
+  volatile uint32_t DMAR;
+} TIM_TypeDef;
 
 typedef struct
 {
   uint32_t Prescaler;
   uint32_t Period;
   uint32_t RepetitionCounter;
+  uint32_t AutoReloadPreload;
 } TIM_Base_InitTypeDef;
 
 typedef enum
@@ -41,8 +91,32 @@ typedef enum
 #define TIM_CHANNEL_6                      0x00000014U                          /*!< Compare channel 6 identifier              */
 #define TIM_CHANNEL_ALL                    0x0000003CU     
 
+/**
+ * The compare register is written by a function, so a test can let time pass after every write,
+ * e.g. an update event between the writes of two channels
+ */
+#define __HAL_TIM_SET_COMPARE(__HANDLE__, __CHANNEL__, __COMPARE__) \
+  HAL_TIM_MockSetCompare((__HANDLE__), (__CHANNEL__), (__COMPARE__))
+
+#define __HAL_TIM_GET_COMPARE(__HANDLE__, __CHANNEL__) \
+  (((__CHANNEL__) == TIM_CHANNEL_1) ? ((__HANDLE__)->Instance->CCR1) :\
+   ((__CHANNEL__) == TIM_CHANNEL_2) ? ((__HANDLE__)->Instance->CCR2) :\
+   ((__CHANNEL__) == TIM_CHANNEL_3) ? ((__HANDLE__)->Instance->CCR3) :\
+   ((__CHANNEL__) == TIM_CHANNEL_4) ? ((__HANDLE__)->Instance->CCR4) :\
+   ((__CHANNEL__) == TIM_CHANNEL_5) ? ((__HANDLE__)->Instance->CCR5) :\
+   ((__HANDLE__)->Instance->CCR6))
+
+#define __HAL_TIM_SET_AUTORELOAD(__HANDLE__, __AUTORELOAD__) \
+  do{                                                    \
+    (__HANDLE__)->Instance->ARR = (__AUTORELOAD__);  \
+    (__HANDLE__)->Init.Period = (__AUTORELOAD__);    \
+  } while(0)
+
+#define __HAL_TIM_GET_AUTORELOAD(__HANDLE__) ((__HANDLE__)->Instance->ARR)
+
 typedef struct {
   int test_member;
+  TIM_TypeDef* Instance;
   TIM_Base_InitTypeDef Init;
   HAL_TIM_ActiveChannel Channel;
 } TIM_HandleTypeDef;
@@ -108,6 +182,11 @@ extern HalTimPwmStartMockValues hal_tim_pwm_start_mock_values;
 
 HAL_StatusTypeDef HAL_TIM_PWM_Start(TIM_HandleTypeDef *htim, uint32_t Channel);
 
+/* Called after every write of a compare register, if set */
+extern void (*hal_tim_set_compare_hook)(void);
+
+void HAL_TIM_MockSetCompare(TIM_HandleTypeDef *htim, uint32_t Channel, uint32_t Compare);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,190 @@
+#include "motor_group_output.hpp"
+#include <array>
+#include <memory>
+#include <vector>
+#include "gtest/gtest.h"
+#include "simulated_timer.hpp"
+#include "stm32g4xx.h"
+
+namespace {
+
+class MotorGroupOutputTests : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    first_timer_.Instance = &first_timer_registers_;
+    second_timer_.Instance = &second_timer_registers_;
+    hal_tim_pwm_stop_mock_values.which_return = 0;
+    hal_tim_pwm_init_mock_values.which_return = 0;
+    for (std::uint8_t index = 0; index < NUM_RETURN_VALUES; index++) {
+      hal_tim_pwm_stop_mock_values.return_value[index] = HAL_OK;
+      hal_tim_pwm_init_mock_values.return_value[index] = HAL_OK;
+    }
+    hal_tim_pwm_config_channel_mock_values.return_value = HAL_OK;
+    hal_tim_pwm_start_mock_values.return_value = HAL_OK;
+    hal_tim_calc_psc_mock_values.return_value = 16;
+    hal_tim_set_compare_hook = nullptr;
+    running_test_ = this;
+  }
+
+  virtual void TearDown() {
+    hal_tim_set_compare_hook = nullptr;
+  }
+
+  /// Lets the running periods of both timers end right after the first compare write
+  static auto EndPeriodAfterFirstWrite() -> void {
+    hal_tim_set_compare_hook = nullptr;
+    running_test_->first_simulated_timer_.TickUntilPeriodEnd();
+    running_test_->second_simulated_timer_.TickUntilPeriodEnd();
+  }
+
+  auto TickBothTimers(const std::uint32_t ticks) -> void {
+    first_simulated_timer_.Tick(ticks);
+    second_simulated_timer_.Tick(ticks);
+  }
+
+  static MotorGroupOutputTests* running_test_;
+
+  TIM_TypeDef first_timer_registers_{};
+  TIM_TypeDef second_timer_registers_{};
+  TIM_HandleTypeDef first_timer_{};
+  TIM_HandleTypeDef second_timer_{};
+  propulsion::SimulatedTimer first_simulated_timer_{first_timer_registers_};
+  propulsion::SimulatedTimer second_simulated_timer_{second_timer_registers_};
+  const std::array<propulsion::MotorOutputChannel, 4> shared_timer_outputs_{{{&first_timer_, TIM_CHANNEL_1},
+                                                                             {&first_timer_, TIM_CHANNEL_2},
+                                                                             {&first_timer_, TIM_CHANNEL_3},
+                                                                             {&first_timer_, TIM_CHANNEL_4}}};
+  const std::array<propulsion::MotorOutputChannel, 4> two_timer_outputs_{{{&first_timer_, TIM_CHANNEL_1},
+                                                                          {&first_timer_, TIM_CHANNEL_2},
+                                                                          {&second_timer_, TIM_CHANNEL_2},
+                                                                          {&second_timer_, TIM_CHANNEL_3}}};
+};
+
+MotorGroupOutputTests* MotorGroupOutputTests::running_test_ = nullptr;
+
+TEST_F(MotorGroupOutputTests, illegal_repetition_period_is_rejected) {
+  propulsion::MotorGroupOutput unit_under_test(shared_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+
+  EXPECT_EQ(unit_under_test.Init(249), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test.Init(20001), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(MotorGroupOutputTests, throttle_needs_initialized_timers) {
+  propulsion::MotorGroupOutput unit_under_test(shared_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+
+  EXPECT_EQ(unit_under_test.SetThrottle({0.0f, 0.0f, 0.0f, 0.0f}), types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(MotorGroupOutputTests, timer_configuration_error_is_reported) {
+  propulsion::MotorGroupOutput unit_under_test(two_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+  hal_tim_pwm_init_mock_values.return_value[1] = HAL_ERROR;
+
+  EXPECT_EQ(unit_under_test.Init(2000), types::DriverStatus::HAL_ERROR);
+  EXPECT_EQ(unit_under_test.SetThrottle({0.0f, 0.0f, 0.0f, 0.0f}), types::DriverStatus::HAL_ERROR);
+}
+
+TEST_F(MotorGroupOutputTests, init_starts_every_timer_once_with_zero_throttle) {
+  propulsion::MotorGroupOutput unit_under_test(two_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+
+  ASSERT_EQ(unit_under_test.Init(2000), types::DriverStatus::OK);
+
+  EXPECT_EQ(hal_tim_pwm_init_mock_values.which_return, 2);
+  for (const auto* registers : {&first_timer_registers_, &second_timer_registers_}) {
+    EXPECT_EQ(registers->ARR, 19999u);
+    EXPECT_EQ(registers->PSC, 16u);
+    EXPECT_NE(registers->CR1 & TIM_CR1_ARPE, 0u);
+    EXPECT_NE(registers->CR1 & TIM_CR1_CEN, 0u);
+  }
+  EXPECT_EQ(first_timer_registers_.CCR1, 1250u);
+  EXPECT_EQ(second_timer_registers_.CCR3, 1250u);
+}
+
+TEST_F(MotorGroupOutputTests, timers_count_at_the_clock_of_the_protocol) {
+  propulsion::MotorGroupOutput unit_under_test(shared_timer_outputs_, propulsion::MULTISHOT_PROTOCOL);
+  hal_tim_calc_psc_mock_values.return_value = 1;
+
+  EXPECT_EQ(unit_under_test.Init(751), types::DriverStatus::INPUT_ERROR);
+  ASSERT_EQ(unit_under_test.Init(500), types::DriverStatus::OK);
+
+  EXPECT_EQ(hal_tim_calc_psc_mock_values.target_timer_clock_rate, propulsion::MULTISHOT_PROTOCOL.timer_clock_rate);
+  EXPECT_EQ(first_timer_registers_.ARR, 42499u);
+  EXPECT_EQ(first_timer_registers_.CCR1, 425u);
+}
+
+TEST_F(MotorGroupOutputTests, illegal_throttle_changes_no_motor) {
+  propulsion::MotorGroupOutput unit_under_test(shared_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+  ASSERT_EQ(unit_under_test.Init(2000), types::DriverStatus::OK);
+
+  EXPECT_EQ(unit_under_test.SetThrottle({50.0f, 50.0f, 50.0f, 100.1f}), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test.SetThrottle({-0.1f, 50.0f, 50.0f, 50.0f}), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(first_timer_registers_.CCR1, 1250u);
+}
+
+TEST_F(MotorGroupOutputTests, throttle_is_converted_to_oneshot_125_pulses) {
+  propulsion::MotorGroupOutput unit_under_test(shared_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+  ASSERT_EQ(unit_under_test.Init(2000), types::DriverStatus::OK);
+
+  ASSERT_EQ(unit_under_test.SetThrottle({0.0f, 50.0f, 100.0f, 10.0f}), types::DriverStatus::OK);
+
+  EXPECT_EQ(first_timer_registers_.CCR1, 1250u);
+  EXPECT_EQ(first_timer_registers_.CCR2, 1875u);
+  EXPECT_EQ(first_timer_registers_.CCR3, 2500u);
+  EXPECT_EQ(first_timer_registers_.CCR4, 1375u);
+  EXPECT_EQ(first_timer_registers_.CR1 & TIM_CR1_UDIS, 0u);
+}
+
+TEST_F(MotorGroupOutputTests, update_event_during_commit_keeps_all_old_pulses) {
+  propulsion::MotorGroupOutput unit_under_test(shared_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+  ASSERT_EQ(unit_under_test.Init(2000), types::DriverStatus::OK);
+  first_simulated_timer_.TickUntilCounter(5000);
+
+  hal_tim_set_compare_hook = EndPeriodAfterFirstWrite;
+  ASSERT_EQ(unit_under_test.SetThrottle({100.0f, 50.0f, 20.0f, 100.0f}), types::DriverStatus::OK);
+  first_simulated_timer_.Tick(3 * 20000);
+
+  const std::vector<std::uint32_t> expected_first{1250, 1250, 2500, 2500};
+  const std::vector<std::uint32_t> expected_second{1250, 1250, 1875, 1875};
+  const std::vector<std::uint32_t> expected_third{1250, 1250, 1500, 1500};
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_1), expected_first);
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_2), expected_second);
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_3), expected_third);
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_4), expected_first);
+}
+
+TEST_F(MotorGroupOutputTests, update_event_between_unprotected_writes_would_mix_the_pulses) {
+  propulsion::MotorGroupOutput unit_under_test(shared_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+  ASSERT_EQ(unit_under_test.Init(2000), types::DriverStatus::OK);
+  first_simulated_timer_.TickUntilCounter(5000);
+
+  hal_tim_set_compare_hook = EndPeriodAfterFirstWrite;
+  __HAL_TIM_SET_COMPARE(&first_timer_, TIM_CHANNEL_1, 2500);
+  __HAL_TIM_SET_COMPARE(&first_timer_, TIM_CHANNEL_2, 2500);
+  first_simulated_timer_.TickUntilPeriodEnd();
+
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_1).back(), 2500u);
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_2).back(), 1250u);
+}
+
+TEST_F(MotorGroupOutputTests, motors_on_two_timers_change_in_the_same_period) {
+  propulsion::MotorGroupOutput unit_under_test(two_timer_outputs_, propulsion::ONESHOT_125_PROTOCOL);
+  ASSERT_EQ(unit_under_test.Init(2000), types::DriverStatus::OK);
+  TickBothTimers(5000);
+
+  hal_tim_set_compare_hook = EndPeriodAfterFirstWrite;
+  ASSERT_EQ(unit_under_test.SetThrottle({100.0f, 100.0f, 100.0f, 100.0f}), types::DriverStatus::OK);
+  TickBothTimers(3 * 20000);
+
+  const std::vector<std::uint32_t> expected{1250, 1250, 2500, 2500};
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_1), expected);
+  EXPECT_EQ(first_simulated_timer_.GetPulses(TIM_CHANNEL_2), expected);
+  EXPECT_EQ(second_simulated_timer_.GetPulses(TIM_CHANNEL_2), expected);
+  EXPECT_EQ(second_simulated_timer_.GetPulses(TIM_CHANNEL_3), expected);
+  EXPECT_EQ(first_simulated_timer_.GetPeriods(), second_simulated_timer_.GetPeriods());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -32,6 +32,18 @@ TEST_F(MotorBuilderTest, creates_correct_object) {
   ASSERT_TRUE(upcast_object_pointer != nullptr);
 }
 
+TEST_F(MotorBuilderTest, creates_motor_with_oneshot_42_esc) {
+  config.esc_type = types::EscType::ONESHOT_42;
+  auto motor_object = unit_under_test.Create(config);
+  ASSERT_NE(motor_object, nullptr);
+}
+
+TEST_F(MotorBuilderTest, creates_motor_with_multishot_esc) {
+  config.esc_type = types::EscType::MULTISHOT;
+  auto motor_object = unit_under_test.Create(config);
+  ASSERT_NE(motor_object, nullptr);
+}
+
 TEST_F(MotorBuilderTest, channel_is_not_in_allowed_channels) {
   config.channel = 666;
   auto motor_object = unit_under_test.Create(config);
@@ -0,0 +1,134 @@
+#include <memory>
+#include <vector>
+#include "globals.hpp"
+#include "gtest/gtest.h"
+#include "little_bee_20_a.hpp"
+#include "multishot_esc.hpp"
+#include "oneshot_42_esc.hpp"
+#include "simulated_timer.hpp"
+#include "stm32g4xx.h"
+
+namespace {
+
+class PulseEscTests : public ::testing::Test {
+ protected:
+  static constexpr std::uint32_t TIMER_CLOCK_RATE = 85000000;
+  static constexpr std::uint32_t MICROSECONDS_PER_SECOND = 1000000;
+  static constexpr int REPETITION_PERIOD_IN_US = 500;
+
+  virtual void SetUp() {
+    mock_timer.Instance = &timer_registers;
+    hal_tim_pwm_stop_mock_values.which_return = 0;
+    hal_tim_pwm_init_mock_values.which_return = 0;
+    hal_tim_pwm_stop_mock_values.return_value[0] = HAL_OK;
+    hal_tim_pwm_init_mock_values.return_value[0] = HAL_OK;
+    hal_tim_pwm_stop_mock_values.return_value[1] = HAL_OK;
+    hal_tim_pwm_init_mock_values.return_value[1] = HAL_OK;
+    hal_tim_pwm_config_channel_mock_values.return_value = HAL_OK;
+    hal_tim_pwm_start_mock_values.return_value = HAL_OK;
+    hal_tim_calc_psc_mock_values.return_value = TIMER_CLOCK / TIMER_CLOCK_RATE - 1;
+  }
+
+  /// Plays every legal pulse duration for one period and checks its high time in timer clocks.
+  /// A pulse duration set during a period is taken over with the next one.
+  auto ExpectTickAccuratePulses(propulsion::PulseEsc& esc) -> void {
+    const auto min_pulse_duration = esc.GetMinPulseDurationInMicroSeconds();
+    const auto max_pulse_duration = esc.GetMaxPulseDurationInMicroSeconds();
+    const auto prescaler = hal_tim_calc_psc_mock_values.return_value;
+
+    ASSERT_EQ(esc.SetPulseDuration(min_pulse_duration, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+    // Lets the update event of the timer initialization load the first pulse
+    simulated_timer_.Tick();
+    for (auto pulse_duration = min_pulse_duration + 1; pulse_duration <= max_pulse_duration; pulse_duration++) {
+      ASSERT_EQ(esc.SetPulseDuration(pulse_duration, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+      simulated_timer_.TickUntilPeriodEnd();
+    }
+    simulated_timer_.TickUntilPeriodEnd();
+
+    const auto& pulses = simulated_timer_.GetPulses(TIM_CHANNEL_1);
+    ASSERT_EQ(pulses.size(), static_cast<std::size_t>(max_pulse_duration - min_pulse_duration + 1));
+    for (std::size_t period = 0; period < pulses.size(); period++) {
+      const auto pulse_duration = static_cast<std::uint32_t>(min_pulse_duration) + period;
+      EXPECT_EQ(static_cast<std::uint64_t>(pulses.at(period)) * (prescaler + 1) * MICROSECONDS_PER_SECOND,
+                static_cast<std::uint64_t>(pulse_duration) * TIMER_CLOCK)
+          << pulse_duration << " us";
+    }
+  }
+
+  TIM_TypeDef timer_registers{};
+  TIM_HandleTypeDef mock_timer;
+  propulsion::SimulatedTimer simulated_timer_{timer_registers};
+};
+
+TEST_F(PulseEscTests, oneshot_42_limits) {
+  propulsion::Oneshot42Esc unit_under_test(&mock_timer, TIM_CHANNEL_1);
+
+  EXPECT_EQ(unit_under_test.GetMinPulseDurationInMicroSeconds(), 42);
+  EXPECT_EQ(unit_under_test.GetMaxPulseDurationInMicroSeconds(), 84);
+  EXPECT_EQ(unit_under_test.SetPulseDuration(41, REPETITION_PERIOD_IN_US), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test.SetPulseDuration(85, REPETITION_PERIOD_IN_US), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(PulseEscTests, multishot_limits) {
+  propulsion::MultishotEsc unit_under_test(&mock_timer, TIM_CHANNEL_1);
+
+  EXPECT_EQ(unit_under_test.GetMinPulseDurationInMicroSeconds(), 5);
+  EXPECT_EQ(unit_under_test.GetMaxPulseDurationInMicroSeconds(), 25);
+  EXPECT_EQ(unit_under_test.SetPulseDuration(4, REPETITION_PERIOD_IN_US), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test.SetPulseDuration(26, REPETITION_PERIOD_IN_US), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(PulseEscTests, timer_clock_is_divided_to_85_mhz) {
+  propulsion::MultishotEsc unit_under_test(&mock_timer, TIM_CHANNEL_1);
+
+  ASSERT_EQ(unit_under_test.SetPulseDuration(10, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+
+  EXPECT_EQ(hal_tim_calc_psc_mock_values.timer_clock, TIMER_CLOCK);
+  EXPECT_EQ(hal_tim_calc_psc_mock_values.target_timer_clock_rate, static_cast<int>(TIMER_CLOCK_RATE));
+  EXPECT_EQ(unit_under_test.GetTicksPerMicroSecond(), 85u);
+  EXPECT_EQ(timer_registers.CCR1, 850u);
+}
+
+TEST_F(PulseEscTests, fractional_pulse_duration_is_rounded_to_the_nearest_tick) {
+  propulsion::MultishotEsc unit_under_test(&mock_timer, TIM_CHANNEL_1);
+
+  ASSERT_EQ(unit_under_test.SetPulseDuration(10.2f, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  EXPECT_EQ(timer_registers.CCR1, 867u);
+  ASSERT_EQ(unit_under_test.SetPulseDuration(24.99f, REPETITION_PERIOD_IN_US), types::DriverStatus::OK);
+  EXPECT_EQ(timer_registers.CCR1, 2124u);
+  EXPECT_EQ(unit_under_test.SetPulseDuration(25.01f, REPETITION_PERIOD_IN_US), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(PulseEscTests, longest_repetition_period_fits_a_16_bit_counter) {
+  propulsion::Oneshot42Esc unit_under_test(&mock_timer, TIM_CHANNEL_1);
+
+  EXPECT_EQ(unit_under_test.SetPulseDuration(84, 751), types::DriverStatus::INPUT_ERROR);
+  ASSERT_EQ(unit_under_test.SetPulseDuration(84, 750), types::DriverStatus::OK);
+  EXPECT_LE(mock_timer.Init.Period, 0xFFFFu);
+}
+
+TEST_F(PulseEscTests, oneshot_42_pulses_are_tick_accurate) {
+  propulsion::Oneshot42Esc unit_under_test(&mock_timer, TIM_CHANNEL_1);
+  ExpectTickAccuratePulses(unit_under_test);
+}
+
+TEST_F(PulseEscTests, multishot_pulses_are_tick_accurate) {
+  propulsion::MultishotEsc unit_under_test(&mock_timer, TIM_CHANNEL_1);
+  ExpectTickAccuratePulses(unit_under_test);
+}
+
+TEST_F(PulseEscTests, full_throttle_pulse_is_shorter_than_oneshot_125) {
+  propulsion::LittleBee20A oneshot_125(&mock_timer, TIM_CHANNEL_1);
+  propulsion::Oneshot42Esc oneshot_42(&mock_timer, TIM_CHANNEL_1);
+  propulsion::MultishotEsc multishot(&mock_timer, TIM_CHANNEL_1);
+
+  EXPECT_GE(oneshot_125.GetMaxPulseDurationInMicroSeconds(), 3 * oneshot_42.GetMaxPulseDurationInMicroSeconds() - 2);
+  EXPECT_EQ(oneshot_125.GetMaxPulseDurationInMicroSeconds(), 10 * multishot.GetMaxPulseDurationInMicroSeconds());
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,88 @@
+#include "static_motor_builder.hpp"
+#include "globals.hpp"
+#include "gtest/gtest.h"
+#include "stm32g4xx.h"
+
+namespace {
+
+TIM_HandleTypeDef first_timer;
+TIM_HandleTypeDef second_timer;
+
+using FrontLeft = propulsion::StaticMotorConfig<types::MotorType::LETODAR_2204, types::EscType::LITTLE_BEE_20_A, &first_timer, TIM_CHANNEL_1>;
+using FrontRight = propulsion::StaticMotorConfig<types::MotorType::LETODAR_2204, types::EscType::LITTLE_BEE_20_A, &first_timer, TIM_CHANNEL_2>;
+using RearLeft = propulsion::StaticMotorConfig<types::MotorType::LETODAR_2204, types::EscType::MULTISHOT, &second_timer, TIM_CHANNEL_1>;
+using RearRight = propulsion::StaticMotorConfig<types::MotorType::LETODAR_2204, types::EscType::ONESHOT_42, &second_timer, TIM_CHANNEL_4>;
+using SharedOutput = propulsion::StaticMotorConfig<types::MotorType::LETODAR_2204, types::EscType::MULTISHOT, &first_timer, TIM_CHANNEL_1>;
+using MixedProtocol = propulsion::StaticMotorConfig<types::MotorType::LETODAR_2204, types::EscType::ONESHOT_42, &first_timer, TIM_CHANNEL_3>;
+
+using QuadMotors = propulsion::StaticMotorBuilder<FrontLeft, FrontRight, RearLeft, RearRight>;
+
+static_assert(propulsion::IsMotorChannel(TIM_CHANNEL_6), "The runtime builder accepts all compare channels");
+static_assert(!propulsion::IsMotorChannel(TIM_CHANNEL_6 + TIM_CHANNEL_2), "There are only six channels");
+static_assert(!propulsion::IsMotorChannel(TIM_CHANNEL_2 + 1), "Channels are multiples of four");
+static_assert(!propulsion::IsOutputChannel(TIM_CHANNEL_5), "Channel 5 has no pin");
+static_assert(propulsion::HaveDistinctOutputs<FrontLeft, FrontRight, RearLeft, RearRight>(), "Same channel on different timers is fine");
+static_assert(!propulsion::HaveDistinctOutputs<FrontLeft, RearLeft, SharedOutput>(), "Same channel on the same timer is rejected");
+static_assert(propulsion::HaveOneProtocolPerTimer<FrontLeft, FrontRight, RearLeft, RearRight>(), "Multishot and Oneshot42 count at the same clock");
+static_assert(!propulsion::HaveOneProtocolPerTimer<FrontLeft, MixedProtocol>(), "Oneshot125 and Oneshot42 on one timer are rejected");
+static_assert(QuadMotors::MOTORS == 4, "One motor per config");
+
+class StaticMotorBuilderTests : public ::testing::Test {
+ protected:
+  virtual void SetUp() {
+    first_timer.Instance = &first_timer_registers_;
+    second_timer.Instance = &second_timer_registers_;
+    hal_tim_pwm_stop_mock_values.which_return = 0;
+    hal_tim_pwm_init_mock_values.which_return = 0;
+    hal_tim_pwm_stop_mock_values.return_value[0] = HAL_OK;
+    hal_tim_pwm_init_mock_values.return_value[0] = HAL_OK;
+    hal_tim_pwm_stop_mock_values.return_value[1] = HAL_OK;
+    hal_tim_pwm_init_mock_values.return_value[1] = HAL_OK;
+    hal_tim_pwm_config_channel_mock_values.return_value = HAL_OK;
+    hal_tim_pwm_start_mock_values.return_value = HAL_OK;
+    hal_tim_calc_psc_mock_values.return_value = 0;
+  }
+
+  TIM_TypeDef first_timer_registers_{};
+  TIM_TypeDef second_timer_registers_{};
+};
+
+TEST_F(StaticMotorBuilderTests, every_call_gives_the_same_motors) {
+  const auto motors = QuadMotors::Create();
+  const auto motors_again = QuadMotors::Create();
+
+  EXPECT_EQ(motors, motors_again);
+  for (const auto* motor : motors)
+    EXPECT_NE(motor, nullptr);
+}
+
+TEST_F(StaticMotorBuilderTests, builders_with_the_same_config_share_its_motor) {
+  const auto motors = QuadMotors::Create();
+  const auto rear_motors = propulsion::StaticMotorBuilder<RearLeft, RearRight>::Create();
+
+  EXPECT_EQ(rear_motors[0], motors[2]);
+  EXPECT_EQ(rear_motors[1], motors[3]);
+}
+
+TEST_F(StaticMotorBuilderTests, motors_drive_the_channels_of_their_config) {
+  const auto motors = QuadMotors::Create();
+
+  EXPECT_EQ(motors[0]->SetSpeedInPercent(50.0f), types::DriverStatus::OK);
+  // Every ESC stops and initializes its timer twice on its first pulse
+  hal_tim_pwm_stop_mock_values.which_return = 0;
+  hal_tim_pwm_init_mock_values.which_return = 0;
+  EXPECT_EQ(motors[3]->SetSpeedInPercent(50.0f), types::DriverStatus::OK);
+
+  EXPECT_NE(first_timer_registers_.CCR1, 0u);
+  EXPECT_EQ(first_timer_registers_.CCR2, 0u);
+  EXPECT_EQ(second_timer_registers_.CCR1, 0u);
+  EXPECT_NE(second_timer_registers_.CCR4, 0u);
+  EXPECT_FLOAT_EQ(motors[0]->GetCurrentSpeedInPercent(), 50.0f);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,142 @@
+#include "thrust_linearization.hpp"
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include "gtest/gtest.h"
+
+namespace {
+
+constexpr std::uint16_t CURVE_SIZE = 65;
+constexpr float QUADRATIC_SHARE = 0.7f;
+constexpr auto CURVE = propulsion::MakeThrustCurve<CURVE_SIZE>(QUADRATIC_SHARE);
+
+static_assert(CURVE.command[0] == 0.0f, "No thrust needs no command");
+static_assert(CURVE.command[CURVE_SIZE - 1] > 0.9999f && CURVE.command[CURVE_SIZE - 1] < 1.0001f, "Full thrust needs full command");
+static_assert(!std::is_constructible<propulsion::ThrustLinearization<CURVE_SIZE>, propulsion::ThrustCurve<CURVE_SIZE>>::value,
+              "A temporary curve would dangle");
+static_assert(!std::is_constructible<propulsion::ThrustLinearization<CURVE_SIZE>, propulsion::ThrustCurve<CURVE_SIZE>, float>::value,
+              "A temporary curve would dangle");
+static_assert(std::is_constructible<propulsion::ThrustLinearization<CURVE_SIZE>, const propulsion::ThrustCurve<CURVE_SIZE>&, float>::value,
+              "A curve with static storage is referenced");
+
+/// Thrust of the model the curve inverts
+auto ThrustForCommand(const double command, const double quadratic_share) -> double {
+  return (1.0 - quadratic_share) * command + quadratic_share * command * command;
+}
+
+class ThrustLinearizationTests : public ::testing::Test {
+ protected:
+  static constexpr int SWEEP_STEPS = 10000;
+};
+
+TEST_F(ThrustLinearizationTests, curve_is_strictly_monotonic) {
+  for (std::uint16_t index = 1; index < CURVE_SIZE; index++)
+    EXPECT_GT(CURVE.command[index], CURVE.command[index - 1]) << index;
+}
+
+TEST_F(ThrustLinearizationTests, curve_inverts_the_thrust_model) {
+  for (std::uint16_t index = 0; index < CURVE_SIZE; index++)
+    EXPECT_NEAR(ThrustForCommand(CURVE.command[index], QUADRATIC_SHARE), static_cast<double>(index) / (CURVE_SIZE - 1), 1e-6);
+}
+
+TEST_F(ThrustLinearizationTests, linear_thrust_model_gives_the_identity) {
+  constexpr auto linear_curve = propulsion::MakeThrustCurve<5>(0.0f);
+
+  for (std::uint16_t index = 0; index < 5; index++)
+    EXPECT_FLOAT_EQ(linear_curve.command[index], static_cast<float>(index) / 4.0f);
+}
+
+TEST_F(ThrustLinearizationTests, interpolation_error_is_within_the_bound_of_the_curvature) {
+  propulsion::ThrustLinearization<CURVE_SIZE> unit_under_test(CURVE);
+  // |command''| is largest at zero thrust with 2 * a / (1 - a)^3, linear interpolation is off by at most spacing^2 / 8 times that
+  const auto spacing = 1.0 / (CURVE_SIZE - 1);
+  const auto linear_share = 1.0 - QUADRATIC_SHARE;
+  const auto error_bound = spacing * spacing / 8.0 * 2.0 * QUADRATIC_SHARE / (linear_share * linear_share * linear_share);
+
+  double largest_error = 0.0;
+  for (int step = 0; step <= SWEEP_STEPS; step++) {
+    const auto thrust_in_percent = 100.0f * static_cast<float>(step) / SWEEP_STEPS;
+    float command_in_percent = -1.0f;
+    ASSERT_EQ(unit_under_test.GetCommand(thrust_in_percent, command_in_percent), types::DriverStatus::OK);
+
+    const auto exact_command = propulsion::thrust_curve::CommandForThrust(thrust_in_percent / 100.0, QUADRATIC_SHARE);
+    const auto error = std::fabs(command_in_percent / 100.0 - exact_command);
+    largest_error = error > largest_error ? error : largest_error;
+  }
+
+  EXPECT_LE(largest_error, error_bound + 1e-6);
+  EXPECT_LT(largest_error, 2e-3);
+}
+
+TEST_F(ThrustLinearizationTests, resulting_thrust_is_linear_in_the_throttle) {
+  propulsion::ThrustLinearization<CURVE_SIZE> unit_under_test(CURVE);
+
+  for (int step = 0; step <= SWEEP_STEPS; step++) {
+    const auto thrust_in_percent = 100.0f * static_cast<float>(step) / SWEEP_STEPS;
+    float command_in_percent = 0.0f;
+    unit_under_test.GetCommand(thrust_in_percent, command_in_percent);
+
+    EXPECT_NEAR(100.0 * ThrustForCommand(command_in_percent / 100.0, QUADRATIC_SHARE), thrust_in_percent, 0.1);
+  }
+}
+
+TEST_F(ThrustLinearizationTests, end_points_are_exact) {
+  propulsion::ThrustLinearization<CURVE_SIZE> unit_under_test(CURVE);
+  float command_in_percent = -1.0f;
+
+  unit_under_test.GetCommand(0.0f, command_in_percent);
+  EXPECT_FLOAT_EQ(command_in_percent, 0.0f);
+
+  unit_under_test.GetCommand(100.0f, command_in_percent);
+  EXPECT_NEAR(command_in_percent, 100.0f, 1e-3f);
+}
+
+TEST_F(ThrustLinearizationTests, thrust_out_of_range_is_rejected) {
+  propulsion::ThrustLinearization<CURVE_SIZE> unit_under_test(CURVE);
+  float command_in_percent = 42.0f;
+
+  EXPECT_EQ(unit_under_test.GetCommand(-0.1f, command_in_percent), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test.GetCommand(100.1f, command_in_percent), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(unit_under_test.GetCommand(std::numeric_limits<float>::quiet_NaN(), command_in_percent), types::DriverStatus::INPUT_ERROR);
+  EXPECT_FLOAT_EQ(command_in_percent, 42.0f);
+}
+
+TEST_F(ThrustLinearizationTests, sagging_battery_raises_the_command) {
+  propulsion::ThrustLinearization<CURVE_SIZE> unit_under_test(CURVE, 16.8f);
+  float nominal_command = 0.0f;
+  float sagged_command = 0.0f;
+  unit_under_test.GetCommand(50.0f, nominal_command);
+
+  ASSERT_EQ(unit_under_test.SetBatteryVoltage(14.0f), types::DriverStatus::OK);
+  unit_under_test.GetCommand(50.0f, sagged_command);
+
+  EXPECT_NEAR(sagged_command, nominal_command * 16.8f / 14.0f, 1e-3f);
+  // Thrust scales with the motor speed, which is proportional to voltage times command
+  EXPECT_NEAR(100.0 * ThrustForCommand(sagged_command / 100.0 * 14.0 / 16.8, QUADRATIC_SHARE), 50.0, 0.1);
+}
+
+TEST_F(ThrustLinearizationTests, compensated_command_is_clipped_at_full_throttle) {
+  propulsion::ThrustLinearization<CURVE_SIZE> unit_under_test(CURVE, 16.8f);
+  float command_in_percent = 0.0f;
+
+  ASSERT_EQ(unit_under_test.SetBatteryVoltage(13.0f), types::DriverStatus::OK);
+  unit_under_test.GetCommand(100.0f, command_in_percent);
+
+  EXPECT_FLOAT_EQ(command_in_percent, 100.0f);
+}
+
+TEST_F(ThrustLinearizationTests, battery_voltage_needs_a_nominal_voltage_and_a_positive_value) {
+  propulsion::ThrustLinearization<CURVE_SIZE> uncompensated(CURVE);
+  propulsion::ThrustLinearization<CURVE_SIZE> compensated(CURVE, 16.8f);
+
+  EXPECT_EQ(uncompensated.SetBatteryVoltage(14.0f), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(compensated.SetBatteryVoltage(0.0f), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(compensated.SetBatteryVoltage(std::numeric_limits<float>::quiet_NaN()), types::DriverStatus::INPUT_ERROR);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,182 @@
+#include <array>
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+#include "scheduler.hpp"
+#include "virtual_time_source.hpp"
+
+namespace {
+
+constexpr std::uint32_t TICK_PERIOD_IN_US = 250;
+constexpr std::uint64_t ONE_SECOND_IN_US = 1000000;
+
+/**
+ * @brief Task of the tests, it takes its costs in turn as execution time of the virtual time
+ *
+ */
+struct SimulatedTask {
+  scheduler::VirtualTimeSource* time;
+  std::vector<std::uint32_t> costs_in_us;
+  types::DriverStatus status = types::DriverStatus::OK;
+  std::vector<std::uint64_t> start_times_in_us;
+};
+
+auto Simulate(void* context) -> types::DriverStatus {
+  auto& task = *static_cast<SimulatedTask*>(context);
+  const auto cost = task.costs_in_us[task.start_times_in_us.size() % task.costs_in_us.size()];
+  task.start_times_in_us.push_back(task.time->GetTimeInUs());
+  task.time->Advance(cost);
+  return task.status;
+}
+
+/**
+ * Runs a flight controller like table at 4 kHz: the fast group every tick, radio at 100 Hz,
+ * magnetometer at 50 Hz and telemetry at 10 Hz, each slow group in a tick of its own.
+ */
+class SchedulerTests : public ::testing::Test {
+ protected:
+  static constexpr std::size_t FAST = 0;
+  static constexpr std::size_t RADIO = 1;
+  static constexpr std::size_t MAGNETOMETER = 2;
+  static constexpr std::size_t TELEMETRY = 3;
+
+  template <std::size_t TASKS>
+  auto Connect(scheduler::Scheduler<TASKS>& tick_scheduler) -> void {
+    time_.AttachInterrupt([](void* context) { static_cast<scheduler::Scheduler<TASKS>*>(context)->OnTick(); }, &tick_scheduler);
+  }
+
+  auto RunOneSecond(void) -> void {
+    Connect(scheduler_);
+    scheduler::RunInVirtualTime(scheduler_, time_, ONE_SECOND_IN_US);
+  }
+
+  scheduler::VirtualTimeSource time_{TICK_PERIOD_IN_US};
+  std::array<SimulatedTask, 4> tasks_{{{&time_, {60}}, {&time_, {30}}, {&time_, {20}}, {&time_, {80}}}};
+  const std::array<scheduler::Task, 4> table_{{{"fast", Simulate, &tasks_[FAST], 1, 0, 100},
+                                               {"radio", Simulate, &tasks_[RADIO], 40, 1, 0},
+                                               {"magnetometer", Simulate, &tasks_[MAGNETOMETER], 80, 2, 0},
+                                               {"telemetry", Simulate, &tasks_[TELEMETRY], 400, 3, 0}}};
+  scheduler::Scheduler<4> scheduler_{table_, time_, TICK_PERIOD_IN_US};
+};
+
+constexpr std::size_t SchedulerTests::FAST;
+constexpr std::size_t SchedulerTests::RADIO;
+constexpr std::size_t SchedulerTests::MAGNETOMETER;
+constexpr std::size_t SchedulerTests::TELEMETRY;
+
+TEST_F(SchedulerTests, rate_groups_run_at_their_rates) {
+  RunOneSecond();
+
+  EXPECT_EQ(scheduler_.GetTaskStatistics(FAST).runs, 4000u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(RADIO).runs, 100u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(MAGNETOMETER).runs, 50u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(TELEMETRY).runs, 10u);
+  EXPECT_EQ(scheduler_.GetTickOverruns(), 0u);
+  EXPECT_EQ(scheduler_.GetSkippedTicks(), 0u);
+}
+
+TEST_F(SchedulerTests, fast_group_starts_with_every_tick_without_jitter) {
+  RunOneSecond();
+
+  const auto& starts = tasks_[FAST].start_times_in_us;
+  ASSERT_EQ(starts.size(), 4000u);
+  for (std::size_t run = 0; run < starts.size(); run++)
+    EXPECT_EQ(starts[run], (run + 1) * TICK_PERIOD_IN_US);
+}
+
+TEST_F(SchedulerTests, slow_groups_run_in_the_tick_of_their_phase_after_the_fast_group) {
+  RunOneSecond();
+
+  for (const auto index : {RADIO, MAGNETOMETER, TELEMETRY})
+    for (const auto start : tasks_[index].start_times_in_us) {
+      const auto tick = start / TICK_PERIOD_IN_US - 1;
+      EXPECT_EQ(tick % table_[index].divider, table_[index].phase) << table_[index].name;
+      EXPECT_EQ(start % TICK_PERIOD_IN_US, 60u) << table_[index].name;
+    }
+}
+
+TEST_F(SchedulerTests, execution_times_are_measured_per_task) {
+  tasks_[FAST].costs_in_us = {40, 80};
+
+  RunOneSecond();
+
+  const auto statistics = scheduler_.GetTaskStatistics(FAST);
+  EXPECT_FLOAT_EQ(statistics.last_in_us, 80.0f);
+  EXPECT_FLOAT_EQ(statistics.max_in_us, 80.0f);
+  EXPECT_NEAR(statistics.mean_in_us, 60.0f, 1e-3f);
+  EXPECT_FLOAT_EQ(scheduler_.GetTaskStatistics(TELEMETRY).mean_in_us, 80.0f);
+}
+
+TEST_F(SchedulerTests, runs_over_the_budget_are_counted_per_task) {
+  tasks_[FAST].costs_in_us = {60, 60, 60, 120};
+
+  RunOneSecond();
+
+  EXPECT_EQ(scheduler_.GetTaskStatistics(FAST).overruns, 1000u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(TELEMETRY).overruns, 0u);
+  EXPECT_EQ(scheduler_.GetTickOverruns(), 0u);
+}
+
+TEST_F(SchedulerTests, failed_runs_are_counted) {
+  tasks_[RADIO].status = types::DriverStatus::HAL_ERROR;
+
+  RunOneSecond();
+
+  EXPECT_EQ(scheduler_.GetTaskStatistics(RADIO).failures, 100u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(FAST).failures, 0u);
+}
+
+TEST_F(SchedulerTests, load_is_the_share_of_the_ticks_spent_in_tasks) {
+  RunOneSecond();
+
+  const auto busy_in_us = 4000.0f * 60.0f + 100.0f * 30.0f + 50.0f * 20.0f + 10.0f * 80.0f;
+  EXPECT_NEAR(scheduler_.GetLoadInPercent(), 100.0f * busy_in_us / static_cast<float>(ONE_SECOND_IN_US), 1e-3f);
+}
+
+TEST_F(SchedulerTests, tick_that_lasts_longer_than_two_periods_skips_the_tick_in_between) {
+  // 60 us fast group and 600 us telemetry end 160 us after the second tick that followed
+  tasks_[TELEMETRY].costs_in_us = {600};
+
+  RunOneSecond();
+
+  EXPECT_EQ(scheduler_.GetTickOverruns(), 10u);
+  EXPECT_EQ(scheduler_.GetSkippedTicks(), 10u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(FAST).runs, 3990u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(RADIO).runs, 100u);
+  EXPECT_EQ(scheduler_.GetTaskStatistics(MAGNETOMETER).runs, 50u);
+}
+
+TEST_F(SchedulerTests, overrun_of_a_tick_is_reported_by_its_run) {
+  tasks_[FAST].costs_in_us = {300};
+  Connect(scheduler_);
+
+  EXPECT_EQ(scheduler_.RunPending(), types::DriverStatus::OK);
+  EXPECT_EQ(tasks_[FAST].start_times_in_us.size(), 0u);
+
+  time_.Advance(TICK_PERIOD_IN_US);
+  EXPECT_EQ(scheduler_.RunPending(), types::DriverStatus::TIMEOUT);
+  EXPECT_TRUE(scheduler_.HasPendingTick());
+  EXPECT_EQ(scheduler_.GetTickOverruns(), 1u);
+  EXPECT_EQ(scheduler_.GetSkippedTicks(), 0u);
+}
+
+TEST_F(SchedulerTests, invalid_task_table_runs_nothing) {
+  static_assert(!scheduler::IsValidTask(scheduler::Task{"no function", nullptr, nullptr, 1, 0, 0}), "A task needs a function");
+  static_assert(!scheduler::IsValidTask(scheduler::Task{"no rate", Simulate, nullptr, 0, 0, 0}), "A task needs a divider");
+  const std::array<scheduler::Task, 2> table{{{"fast", Simulate, &tasks_[FAST], 1, 0, 0},
+                                              {"phase out of range", Simulate, &tasks_[RADIO], 4, 4, 0}}};
+  scheduler::Scheduler<2> invalid_scheduler(table, time_, TICK_PERIOD_IN_US);
+  Connect(invalid_scheduler);
+
+  time_.Advance(TICK_PERIOD_IN_US);
+
+  EXPECT_EQ(invalid_scheduler.RunPending(), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(tasks_[FAST].start_times_in_us.size(), 0u);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
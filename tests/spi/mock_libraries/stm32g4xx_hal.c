@@ -1,5 +1,14 @@
 #include "stm32g4xx_hal.h"
 
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi) {
+  hspi->mock_init_count++;
+  return hspi->mock_return_value;
+}
+
+uint32_t HAL_RCC_GetPCLK2Freq(void) {
+  return 170000000U;
+}
+
 HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size,
                                           uint32_t Timeout) {
   return hspi->mock_return_value;
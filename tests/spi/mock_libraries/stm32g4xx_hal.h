@@ -14,10 +14,29 @@ typedef enum {
   HAL_TIMEOUT = 0x03U
 } HAL_StatusTypeDef;
 
+#define SPI_BAUDRATEPRESCALER_2 (0x00000000U)
+#define SPI_BAUDRATEPRESCALER_4 (0x00000008U)
+#define SPI_BAUDRATEPRESCALER_8 (0x00000010U)
+#define SPI_BAUDRATEPRESCALER_16 (0x00000018U)
+#define SPI_BAUDRATEPRESCALER_32 (0x00000020U)
+#define SPI_BAUDRATEPRESCALER_64 (0x00000028U)
+#define SPI_BAUDRATEPRESCALER_128 (0x00000030U)
+#define SPI_BAUDRATEPRESCALER_256 (0x00000038U)
+
+typedef struct {
+  uint32_t BaudRatePrescaler;
+} SPI_InitTypeDef;
+
 typedef struct __SPI_HandleTypeDef {
+  SPI_InitTypeDef Init;
   HAL_StatusTypeDef mock_return_value;
+  uint32_t mock_init_count;
 } SPI_HandleTypeDef;
 
+HAL_StatusTypeDef HAL_SPI_Init(SPI_HandleTypeDef *hspi);
+
+uint32_t HAL_RCC_GetPCLK2Freq(void);
+
 HAL_StatusTypeDef HAL_SPI_TransmitReceive(SPI_HandleTypeDef *hspi, uint8_t *pTxData, uint8_t *pRxData, uint16_t Size,
                                           uint32_t Timeout);
 
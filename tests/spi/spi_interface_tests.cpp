@@ -11,6 +11,9 @@ class ConcreteSPIInterface final : public spi::SPIInterface {
   auto Transfer(std::vector<std::uint8_t> &TxData, std::vector<std::uint8_t> &RxData) noexcept -> types::DriverStatus override {
     return types::DriverStatus::OK;
   };
+  auto SetClock(std::uint32_t clock_in_hz) noexcept -> types::DriverStatus override {
+    return types::DriverStatus::OK;
+  }
 };
 
 class SpiInterfaceTests : public ::testing::Test {
@@ -32,6 +35,11 @@ TEST_F(SpiInterfaceTests, write) {
   auto rv = unit_under_test_->Write(Tx);
   ASSERT_EQ(rv, types::DriverStatus::OK);
 }
+TEST_F(SpiInterfaceTests, set_clock) {
+  unit_under_test_ = std::make_unique<ConcreteSPIInterface>();
+  auto rv = unit_under_test_->SetClock(1000000);
+  ASSERT_EQ(rv, types::DriverStatus::OK);
+}
 }  // namespace
 
 int main(int argc, char **argv) {
@@ -116,6 +116,40 @@ TEST_F(SPITests, write_spi_hal_busy) {
   EXPECT_EQ(rv, types::DriverStatus::HAL_ERROR);
 }
 
+TEST_F(SPITests, set_clock_uses_highest_clock_not_exceeding_the_limit) {
+  hspi1.mock_return_value = HAL_StatusTypeDef::HAL_OK;
+
+  EXPECT_EQ(unit_under_test_->SetClock(1000000), types::DriverStatus::OK);
+  EXPECT_EQ(hspi1.Init.BaudRatePrescaler, SPI_BAUDRATEPRESCALER_256);
+
+  EXPECT_EQ(unit_under_test_->SetClock(20000000), types::DriverStatus::OK);
+  EXPECT_EQ(hspi1.Init.BaudRatePrescaler, SPI_BAUDRATEPRESCALER_16);
+
+  EXPECT_EQ(unit_under_test_->SetClock(100000000), types::DriverStatus::OK);
+  EXPECT_EQ(hspi1.Init.BaudRatePrescaler, SPI_BAUDRATEPRESCALER_2);
+}
+
+TEST_F(SPITests, set_clock_keeps_the_peripheral_if_the_prescaler_is_unchanged) {
+  hspi1.mock_return_value = HAL_StatusTypeDef::HAL_OK;
+  unit_under_test_->SetClock(20000000);
+  const auto init_count = hspi1.mock_init_count;
+
+  EXPECT_EQ(unit_under_test_->SetClock(20000000), types::DriverStatus::OK);
+  EXPECT_EQ(hspi1.mock_init_count, init_count);
+}
+
+TEST_F(SPITests, set_clock_below_slowest_clock) {
+  hspi1.mock_return_value = HAL_StatusTypeDef::HAL_OK;
+  EXPECT_EQ(unit_under_test_->SetClock(100000), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST_F(SPITests, set_clock_spi_hal_error) {
+  hspi1.mock_return_value = HAL_StatusTypeDef::HAL_OK;
+  unit_under_test_->SetClock(1000000);
+  hspi1.mock_return_value = HAL_StatusTypeDef::HAL_ERROR;
+  EXPECT_EQ(unit_under_test_->SetClock(20000000), types::DriverStatus::HAL_ERROR);
+}
+
 int main(int argc, char **argv) {
   ::testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
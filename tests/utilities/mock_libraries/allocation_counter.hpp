@@ -0,0 +1,46 @@
+#ifndef TESTS_UTILITIES_MOCK_LIBRARIES_ALLOCATION_COUNTER_HPP_
+#define TESTS_UTILITIES_MOCK_LIBRARIES_ALLOCATION_COUNTER_HPP_
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+/**
+ * Replaces the global operator new and delete to count heap allocations.
+ * Include this header in exactly one translation unit per test binary.
+ */
+namespace utilities {
+
+struct AllocationCounter {
+  static std::size_t allocations;
+
+  static auto Reset(void) noexcept -> void {
+    allocations = 0;
+  }
+
+  static auto Get(void) noexcept -> std::size_t {
+    return allocations;
+  }
+};
+
+std::size_t AllocationCounter::allocations = 0;
+
+}  // namespace utilities
+
+void* operator new(std::size_t size) {
+  utilities::AllocationCounter::allocations++;
+  void* memory = std::malloc(size == 0 ? 1 : size);
+  if (memory == nullptr)
+    throw std::bad_alloc();
+  return memory;
+}
+
+void operator delete(void* memory) noexcept {
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+  std::free(memory);
+}
+
+#endif
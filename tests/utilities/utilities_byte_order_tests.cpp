@@ -0,0 +1,166 @@
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "allocation_counter.hpp"
+#include "gtest/gtest.h"
+#include "utilities/byte_order.hpp"
+
+namespace {
+
+/**
+ * Copy of the former GeneralSensor conversion, kept as reference for
+ * equivalence and as baseline for the benchmark.
+ */
+auto LegacyConvertUint8BytesIntoInt16(std::uint8_t first_byte, std::uint8_t second_byte, const bool little_endian) -> std::int16_t {
+  if (little_endian == true) {
+    std::swap(first_byte, second_byte);
+  }
+
+  return static_cast<std::int16_t>(first_byte << 8 | second_byte);
+}
+
+auto LegacyConvertUint8BytesIntoInt16SensorValue(const std::vector<std::uint8_t>& raw_vector, const bool little_endian) -> std::vector<std::int16_t> {
+  std::vector<std::int16_t> int16_vector;
+
+  for (size_t i = 0; i < raw_vector.size() - 1; i += 2) {
+    auto first_byte = raw_vector.at(i);
+    auto second_byte = raw_vector.at(i + 1);
+    int16_vector.push_back(LegacyConvertUint8BytesIntoInt16(first_byte, second_byte, little_endian));
+  }
+  return int16_vector;
+}
+
+class UtilityByteOrderTests : public ::testing::Test {
+ protected:
+  static constexpr int BENCHMARK_DECODES = 100000;
+
+  auto Report(const std::string& name, const double time_in_ns, const std::size_t allocations) -> void {
+    std::cout << "[ BENCH    ] " << name << ": " << time_in_ns << " ns and "
+              << allocations << " allocations per decode" << std::endl;
+    RecordProperty(name, std::to_string(time_in_ns));
+  }
+
+  types::EuclideanVector<std::int16_t> decoded_{0, 0, 0};
+};
+
+TEST_F(UtilityByteOrderTests, decode_int16_big_endian) {
+  const std::uint8_t bytes[] = {0x12, 0x34};
+
+  EXPECT_EQ(0x1234, utilities::DecodeInt16(bytes, false));
+}
+
+TEST_F(UtilityByteOrderTests, decode_int16_little_endian) {
+  const std::uint8_t bytes[] = {0x12, 0x34};
+
+  EXPECT_EQ(0x3412, utilities::DecodeInt16(bytes, true));
+}
+
+TEST_F(UtilityByteOrderTests, decode_int16_sign_limits) {
+  const std::uint8_t minimum[] = {0x80, 0x00};
+  const std::uint8_t minus_one[] = {0xFF, 0xFF};
+  const std::uint8_t maximum[] = {0x7F, 0xFF};
+
+  EXPECT_EQ(INT16_MIN, utilities::DecodeInt16(minimum, false));
+  EXPECT_EQ(-1, utilities::DecodeInt16(minus_one, false));
+  EXPECT_EQ(INT16_MAX, utilities::DecodeInt16(maximum, false));
+  EXPECT_EQ(static_cast<std::int16_t>(0xFF7F), utilities::DecodeInt16(maximum, true));
+}
+
+TEST_F(UtilityByteOrderTests, decode_triple_big_endian) {
+  const std::uint8_t bytes[] = {0x00, 0x01, 0xFF, 0xFE, 0x80, 0x00};
+
+  utilities::DecodeInt16Triple(bytes, false, decoded_);
+
+  EXPECT_EQ(1, decoded_.x);
+  EXPECT_EQ(-2, decoded_.y);
+  EXPECT_EQ(INT16_MIN, decoded_.z);
+}
+
+TEST_F(UtilityByteOrderTests, decode_triple_little_endian) {
+  const std::uint8_t bytes[] = {0x01, 0x00, 0xFE, 0xFF, 0x00, 0x80};
+
+  utilities::DecodeInt16Triple(bytes, true, decoded_);
+
+  EXPECT_EQ(1, decoded_.x);
+  EXPECT_EQ(-2, decoded_.y);
+  EXPECT_EQ(INT16_MIN, decoded_.z);
+}
+
+TEST_F(UtilityByteOrderTests, decode_triple_from_unaligned_offset) {
+  const std::uint8_t bytes[] = {0xAA, 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xAA};
+
+  utilities::DecodeInt16Triple(bytes + 1, true, decoded_);
+
+  EXPECT_EQ(0x3412, decoded_.x);
+  EXPECT_EQ(0x7856, decoded_.y);
+  EXPECT_EQ(static_cast<std::int16_t>(0xBC9A), decoded_.z);
+}
+
+TEST_F(UtilityByteOrderTests, decode_triple_matches_legacy_conversion_for_all_byte_values) {
+  for (int value = 0; value <= 0xFF; value++) {
+    const auto byte = static_cast<std::uint8_t>(value);
+    const auto other = static_cast<std::uint8_t>(0xFF - value);
+    const std::vector<std::uint8_t> bytes = {byte, other, other, byte, byte, byte};
+
+    for (const bool little_endian : {false, true}) {
+      const auto expected = LegacyConvertUint8BytesIntoInt16SensorValue(bytes, little_endian);
+      utilities::DecodeInt16Triple(bytes.data(), little_endian, decoded_);
+
+      EXPECT_EQ(expected.at(0), decoded_.x);
+      EXPECT_EQ(expected.at(1), decoded_.y);
+      EXPECT_EQ(expected.at(2), decoded_.z);
+    }
+  }
+}
+
+TEST_F(UtilityByteOrderTests, decode_triple_does_not_allocate) {
+  const std::uint8_t bytes[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+
+  utilities::AllocationCounter::Reset();
+  utilities::DecodeInt16Triple(bytes, false, decoded_);
+  utilities::DecodeInt16Triple(bytes, true, decoded_);
+
+  EXPECT_EQ(0u, utilities::AllocationCounter::Get());
+}
+
+TEST_F(UtilityByteOrderTests, benchmark_legacy_against_decode_triple) {
+  std::vector<std::uint8_t> bytes = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06};
+  std::int32_t checksum = 0;
+
+  utilities::AllocationCounter::Reset();
+  auto start = std::chrono::steady_clock::now();
+  for (int decode = 0; decode < BENCHMARK_DECODES; decode++) {
+    bytes.at(0) = static_cast<std::uint8_t>(decode);
+    checksum += LegacyConvertUint8BytesIntoInt16SensorValue(bytes, decode & 1).at(0);
+  }
+  auto legacy_time = std::chrono::steady_clock::now() - start;
+  const auto legacy_allocations = utilities::AllocationCounter::Get();
+
+  utilities::AllocationCounter::Reset();
+  start = std::chrono::steady_clock::now();
+  for (int decode = 0; decode < BENCHMARK_DECODES; decode++) {
+    bytes.at(0) = static_cast<std::uint8_t>(decode);
+    utilities::DecodeInt16Triple(bytes.data(), decode & 1, decoded_);
+    checksum -= decoded_.x;
+  }
+  auto decode_time = std::chrono::steady_clock::now() - start;
+  const auto decode_allocations = utilities::AllocationCounter::Get();
+
+  Report("legacy_vector_conversion",
+         static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(legacy_time).count()) / BENCHMARK_DECODES,
+         legacy_allocations / BENCHMARK_DECODES);
+  Report("decode_int16_triple",
+         static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(decode_time).count()) / BENCHMARK_DECODES,
+         decode_allocations / BENCHMARK_DECODES);
+
+  EXPECT_EQ(0, checksum);
+  EXPECT_EQ(0u, decode_allocations);
+  EXPECT_GT(legacy_allocations, 0u);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -122,6 +122,48 @@ TEST_F(UtilityByteTests, byte_is_bit_3_low_false) {
   EXPECT_EQ(true, unit_under_test->IsBitLow(3));
 }
 
+TEST_F(UtilityByteTests, bitfield_mask_at_compile_time) {
+  static_assert(utilities::BitField<0>::MASK == 0b00000001, "single bit field");
+  static_assert(utilities::BitField<3, 2>::MASK == 0b00011000, "two bit field");
+  static_assert(utilities::BitField<0, 8>::MASK == 0b11111111, "full Byte field");
+
+  EXPECT_EQ(0b01110000, (utilities::BitField<4, 3>::MASK));
+}
+
+TEST_F(UtilityByteTests, bitfield_encode_truncates_to_field_width) {
+  constexpr utilities::BitField<3, 2> field{};
+
+  EXPECT_EQ(0b00010000, field.Encode(0b10));
+  EXPECT_EQ(0b00011000, field.Encode(0b111));
+}
+
+TEST_F(UtilityByteTests, bitfield_decode_and_is_set) {
+  constexpr utilities::BitField<3, 2> field{};
+
+  EXPECT_EQ(0b10, field.Decode(0b11110111));
+  EXPECT_EQ(true, field.IsSet(0b00001000));
+  EXPECT_EQ(false, field.IsSet(0b11100111));
+}
+
+TEST_F(UtilityByteTests, byte_set_field_keeps_other_bits) {
+  unit_under_test = std::make_unique<utilities::Byte>(0b11111111);
+
+  unit_under_test->Set(utilities::BitField<3, 2>{}, 0b01);
+
+  EXPECT_EQ(0b11101111, unit_under_test->Get());
+  EXPECT_EQ(0b01, unit_under_test->Get(utilities::BitField<3, 2>{}));
+}
+
+TEST_F(UtilityByteTests, byte_compose_register_value_at_compile_time) {
+  constexpr auto register_value = utilities::Byte(0)
+                                      .Set(utilities::BitField<0, 4>{}, 0x0D)
+                                      .Set(utilities::BitField<6>{}, 1)
+                                      .Get();
+  static_assert(register_value == 0x4D, "register value is composed at compile time");
+
+  EXPECT_EQ(0x4D, register_value);
+}
+
 }  // namespace
 
 int main(int argc, char** argv) {
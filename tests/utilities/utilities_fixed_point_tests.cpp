@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+#include "fixed_point.hpp"
+
+namespace {
+
+TEST(FixedPointTests, float_is_rounded_to_nearest) {
+  EXPECT_EQ(utilities::ToFixedPoint<16>(1.0f), 65536);
+  EXPECT_EQ(utilities::ToFixedPoint<16>(-0.5f), -32768);
+  EXPECT_EQ(utilities::ToFixedPoint<2>(0.3f), 1);
+  EXPECT_EQ(utilities::ToFixedPoint<2>(-0.4f), -2);
+}
+
+TEST(FixedPointTests, float_out_of_range_saturates) {
+  EXPECT_EQ(utilities::ToFixedPoint<30>(2.0f), INT32_MAX);
+  EXPECT_EQ(utilities::ToFixedPoint<30>(-3.0f), INT32_MIN);
+}
+
+TEST(FixedPointTests, conversion_back_to_float) {
+  EXPECT_FLOAT_EQ(utilities::ToFloat<30>(1 << 29), 0.5f);
+  EXPECT_FLOAT_EQ(utilities::ToFloat<16>(-98304), -1.5f);
+}
+
+TEST(FixedPointTests, saturate_to_int32) {
+  EXPECT_EQ(utilities::SaturateToInt32(INT64_C(1) << 40), INT32_MAX);
+  EXPECT_EQ(utilities::SaturateToInt32(-(INT64_C(1) << 40)), INT32_MIN);
+  EXPECT_EQ(utilities::SaturateToInt32(-1234), -1234);
+}
+
+TEST(FixedPointTests, multiplication_is_rounded_to_nearest) {
+  const auto half_q30 = 1 << 29;
+  const auto three_quarter_q30 = 3 << 28;
+  EXPECT_EQ(utilities::MultiplyFixedPoint<30>(half_q30, three_quarter_q30), 3 << 27);
+  EXPECT_EQ(utilities::MultiplyFixedPoint<30>(-half_q30, three_quarter_q30), -(3 << 27));
+  EXPECT_EQ(utilities::MultiplyFixedPoint<2>(1, 2), 1);
+}
+
+TEST(FixedPointTests, square_root_rounds_down) {
+  EXPECT_EQ(utilities::SquareRoot(0), 0u);
+  EXPECT_EQ(utilities::SquareRoot(15), 3u);
+  EXPECT_EQ(utilities::SquareRoot(16), 4u);
+  EXPECT_EQ(utilities::SquareRoot(UINT64_C(1) << 60), 1u << 30);
+  EXPECT_EQ(utilities::SquareRoot(UINT64_MAX), UINT32_MAX);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
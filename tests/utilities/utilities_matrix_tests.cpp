@@ -0,0 +1,108 @@
+#include "gtest/gtest.h"
+#include "matrix.hpp"
+
+namespace {
+
+class MatrixTests : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    float value = 1.0f;
+    for (std::uint16_t row = 0; row < 2; row++)
+      for (std::uint16_t column = 0; column < 3; column++)
+        matrix_2x3_(row, column) = value++;
+  }
+
+  utilities::Matrix<2, 3> matrix_2x3_;
+};
+
+TEST_F(MatrixTests, new_matrix_is_zero) {
+  utilities::Matrix<3, 3> matrix;
+
+  for (std::uint16_t index = 0; index < 9; index++)
+    EXPECT_EQ(matrix.Data()[index], 0.0f);
+}
+
+TEST_F(MatrixTests, identity) {
+  const auto identity = utilities::Matrix<3, 3>::Identity();
+
+  EXPECT_EQ(identity(0, 0), 1.0f);
+  EXPECT_EQ(identity(1, 1), 1.0f);
+  EXPECT_EQ(identity(2, 2), 1.0f);
+  EXPECT_EQ(identity(0, 1), 0.0f);
+  EXPECT_EQ(identity(2, 0), 0.0f);
+}
+
+TEST_F(MatrixTests, elements_are_row_major) {
+  EXPECT_EQ(matrix_2x3_.Data()[1], 2.0f);
+  EXPECT_EQ(matrix_2x3_.Data()[3], 4.0f);
+}
+
+TEST_F(MatrixTests, multiply) {
+  utilities::Matrix<3, 2> transposed;
+  utilities::Transpose(matrix_2x3_, transposed);
+  utilities::Matrix<2, 2> result;
+
+  utilities::Multiply(matrix_2x3_, transposed, result);
+
+  EXPECT_FLOAT_EQ(result(0, 0), 14.0f);
+  EXPECT_FLOAT_EQ(result(0, 1), 32.0f);
+  EXPECT_FLOAT_EQ(result(1, 0), 32.0f);
+  EXPECT_FLOAT_EQ(result(1, 1), 77.0f);
+}
+
+TEST_F(MatrixTests, add_subtract_and_scale_in_place) {
+  utilities::Matrix<2, 3> other;
+  utilities::Scale(matrix_2x3_, 2.0f, other);
+
+  utilities::Add(matrix_2x3_, other, other);
+  EXPECT_FLOAT_EQ(other(1, 2), 18.0f);
+
+  utilities::Subtract(other, matrix_2x3_, other);
+  EXPECT_FLOAT_EQ(other(1, 2), 12.0f);
+}
+
+TEST_F(MatrixTests, transpose) {
+  utilities::Matrix<3, 2> transposed;
+
+  utilities::Transpose(matrix_2x3_, transposed);
+
+  EXPECT_EQ(transposed(0, 1), 4.0f);
+  EXPECT_EQ(transposed(2, 0), 3.0f);
+}
+
+TEST_F(MatrixTests, inverse_with_pivoting) {
+  utilities::Matrix<3, 3> matrix;
+  matrix(0, 1) = 2.0f;
+  matrix(1, 0) = 1.0f;
+  matrix(1, 2) = 1.0f;
+  matrix(2, 0) = 3.0f;
+  matrix(2, 2) = 1.0f;
+  const auto original = matrix;
+  utilities::Matrix<3, 3> inverse;
+
+  ASSERT_EQ(utilities::Inverse(matrix, inverse), types::DriverStatus::OK);
+
+  utilities::Matrix<3, 3> product;
+  utilities::Multiply(original, inverse, product);
+  for (std::uint16_t row = 0; row < 3; row++)
+    for (std::uint16_t column = 0; column < 3; column++)
+      EXPECT_NEAR(product(row, column), row == column ? 1.0f : 0.0f, 1.0e-6f);
+}
+
+TEST_F(MatrixTests, inverse_of_singular_matrix_fails) {
+  utilities::Matrix<2, 2> matrix;
+  matrix(0, 0) = 1.0f;
+  matrix(0, 1) = 2.0f;
+  matrix(1, 0) = 2.0f;
+  matrix(1, 1) = 4.0f;
+  utilities::Matrix<2, 2> inverse;
+
+  EXPECT_EQ(utilities::Inverse(matrix, inverse), types::DriverStatus::INPUT_ERROR);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,177 @@
+#include <atomic>
+#include <thread>
+#include "gtest/gtest.h"
+#include "sensor_history.hpp"
+
+namespace {
+
+using TestHistory = utilities::SensorHistory<std::int32_t, 8>;
+
+auto PushLinear(TestHistory& history, const std::int32_t first, const std::int32_t amount, const std::uint32_t first_timestamp, const std::uint32_t interval) -> void {
+  for (std::int32_t index = first; index < first + amount; index++) {
+    const auto timestamp = first_timestamp + static_cast<std::uint32_t>(index - first) * interval;
+    history.Push(types::EuclideanVector<std::int32_t>{index, 2 * index, -index}, timestamp);
+  }
+}
+
+TEST(SensorHistoryTests, empty_history_has_no_samples) {
+  TestHistory history;
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+  std::uint32_t timestamp = 0;
+
+  EXPECT_EQ(history.GetSize(), 0);
+  EXPECT_EQ(history.GetLatest(sample, timestamp), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(history.GetAt(0, sample), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST(SensorHistoryTests, latest_sample_is_the_last_pushed) {
+  TestHistory history;
+  PushLinear(history, 0, 3, 100, 1000);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+  std::uint32_t timestamp = 0;
+
+  EXPECT_EQ(history.GetLatest(sample, timestamp), types::DriverStatus::OK);
+  EXPECT_EQ(timestamp, 2100u);
+  EXPECT_FLOAT_EQ(sample.x, 2.0f);
+  EXPECT_FLOAT_EQ(sample.y, 4.0f);
+  EXPECT_FLOAT_EQ(sample.z, -2.0f);
+}
+
+TEST(SensorHistoryTests, exact_timestamps_return_the_samples) {
+  TestHistory history;
+  PushLinear(history, 0, 5, 0, 1000);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+
+  for (std::int32_t index = 0; index < 5; index++) {
+    EXPECT_EQ(history.GetAt(static_cast<std::uint32_t>(index) * 1000, sample), types::DriverStatus::OK);
+    EXPECT_FLOAT_EQ(sample.x, static_cast<float>(index));
+  }
+}
+
+TEST(SensorHistoryTests, samples_in_between_are_interpolated) {
+  TestHistory history;
+  PushLinear(history, 0, 5, 0, 1000);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+
+  EXPECT_EQ(history.GetAt(2250, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 2.25f);
+  EXPECT_FLOAT_EQ(sample.y, 4.5f);
+  EXPECT_FLOAT_EQ(sample.z, -2.25f);
+}
+
+TEST(SensorHistoryTests, irregular_intervals_are_interpolated) {
+  TestHistory history;
+  const std::uint32_t timestamps[] = {0, 100, 1500, 1600, 4000};
+  for (std::int32_t index = 0; index < 5; index++)
+    history.Push(types::EuclideanVector<std::int32_t>{index * 10, 0, 0}, timestamps[index]);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+
+  EXPECT_EQ(history.GetAt(800, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 15.0f);
+  EXPECT_EQ(history.GetAt(2800, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 35.0f);
+}
+
+TEST(SensorHistoryTests, timestamps_outside_of_the_history_are_rejected) {
+  TestHistory history;
+  PushLinear(history, 0, 5, 1000, 1000);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+
+  EXPECT_EQ(history.GetAt(999, sample), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(history.GetAt(5001, sample), types::DriverStatus::INPUT_ERROR);
+}
+
+TEST(SensorHistoryTests, overflow_keeps_the_newest_samples) {
+  TestHistory history;
+  PushLinear(history, 0, 20, 0, 1000);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+
+  EXPECT_EQ(history.GetSize(), TestHistory::READABLE_SAMPLES);
+  EXPECT_EQ(history.GetAt(12999, sample), types::DriverStatus::INPUT_ERROR);
+  EXPECT_EQ(history.GetAt(13000, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 13.0f);
+  EXPECT_EQ(history.GetAt(18500, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 18.5f);
+}
+
+TEST(SensorHistoryTests, wrapping_timestamps_are_interpolated) {
+  TestHistory history;
+  PushLinear(history, 0, 6, 0xFFFFF000u, 1000);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+
+  EXPECT_EQ(history.GetAt(0xFFFFF000u + 4500u, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 4.5f);
+  EXPECT_EQ(history.GetAt(0xFFFFFFFFu, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 4.095f);
+}
+
+TEST(SensorHistoryTests, wrapping_sample_counter_keeps_the_samples_in_order) {
+  TestHistory history;
+  history.UnitTestSetWriteCount(0xFFFFFFFCu);
+  PushLinear(history, 0, 10, 0, 1000);
+  types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+
+  EXPECT_EQ(history.GetSize(), TestHistory::READABLE_SAMPLES);
+  EXPECT_EQ(history.GetAt(3000, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 3.0f);
+  EXPECT_EQ(history.GetAt(4500, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 4.5f);
+  EXPECT_EQ(history.GetAt(8250, sample), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 8.25f);
+  EXPECT_EQ(history.GetAt(2500, sample), types::DriverStatus::INPUT_ERROR);
+
+  history.UnitTestSetWriteCount(0xFFFFFFFFu);
+  PushLinear(history, 20, 1, 20000, 1000);
+  std::uint32_t timestamp = 0;
+  EXPECT_EQ(history.GetSize(), TestHistory::READABLE_SAMPLES);
+  EXPECT_EQ(history.GetLatest(sample, timestamp), types::DriverStatus::OK);
+  EXPECT_FLOAT_EQ(sample.x, 20.0f);
+}
+
+TEST(SensorHistoryTests, clear_empties_the_history) {
+  TestHistory history;
+  PushLinear(history, 0, 5, 0, 1000);
+  history.Clear();
+
+  EXPECT_EQ(history.GetSize(), 0);
+}
+
+TEST(SensorHistoryTests, concurrent_reader_sees_only_consistent_samples) {
+  TestHistory history;
+  constexpr std::int32_t amount = 200000;
+  constexpr std::uint32_t interval = 10;
+  std::atomic<bool> writing{true};
+
+  std::thread writer([&history, &writing]() {
+    PushLinear(history, 0, amount, 0, interval);
+    writing = false;
+  });
+
+  int consistent_reads = 0;
+  while (writing) {
+    types::EuclideanVector<float> sample{0.0f, 0.0f, 0.0f};
+    std::uint32_t timestamp = 0;
+    if (history.GetLatest(sample, timestamp) != types::DriverStatus::OK)
+      continue;
+    EXPECT_FLOAT_EQ(sample.x * static_cast<float>(interval), static_cast<float>(timestamp));
+
+    // Any point within the readable samples lies on the line as well, unless the writer moved past it
+    const auto requested = timestamp - interval * 3 - interval / 2;
+    if (timestamp < interval * 4 || history.GetAt(requested, sample) != types::DriverStatus::OK)
+      continue;
+    EXPECT_FLOAT_EQ(sample.x * static_cast<float>(interval), static_cast<float>(requested));
+    EXPECT_FLOAT_EQ(sample.y, 2.0f * sample.x);
+    EXPECT_FLOAT_EQ(sample.z, -sample.x);
+    consistent_reads++;
+  }
+  writer.join();
+
+  EXPECT_GT(consistent_reads, 0);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
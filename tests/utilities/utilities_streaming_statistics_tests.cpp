@@ -0,0 +1,55 @@
+#include <random>
+#include "gtest/gtest.h"
+#include "streaming_statistics.hpp"
+
+namespace {
+
+TEST(StreamingStatisticsTests, empty_statistics_are_zero) {
+  utilities::StreamingStatistics statistics;
+
+  EXPECT_EQ(statistics.GetCount(), 0u);
+  EXPECT_FLOAT_EQ(statistics.GetMean(), 0.0f);
+  EXPECT_FLOAT_EQ(statistics.GetVariance(), 0.0f);
+}
+
+TEST(StreamingStatisticsTests, mean_and_sample_variance_of_few_values) {
+  utilities::StreamingStatistics statistics;
+  for (const auto value : {2.0f, 4.0f, 4.0f, 4.0f, 5.0f, 5.0f, 7.0f, 9.0f})
+    statistics.Add(value);
+
+  EXPECT_EQ(statistics.GetCount(), 8u);
+  EXPECT_FLOAT_EQ(statistics.GetMean(), 5.0f);
+  EXPECT_FLOAT_EQ(statistics.GetVariance(), 32.0f / 7.0f);
+}
+
+TEST(StreamingStatisticsTests, variance_stays_accurate_on_a_large_offset) {
+  std::mt19937 generator(11);
+  std::normal_distribution<float> noise(0.0f, 0.1f);
+  utilities::StreamingStatistics statistics;
+
+  for (int sample = 0; sample < 10000; sample++)
+    statistics.Add(1000.0f + noise(generator));
+
+  EXPECT_NEAR(statistics.GetMean(), 1000.0f, 0.01f);
+  EXPECT_NEAR(statistics.GetVariance(), 0.01f, 0.001f);
+}
+
+TEST(StreamingStatisticsTests, reset_starts_over) {
+  utilities::StreamingStatistics statistics;
+  statistics.Add(3.0f);
+  statistics.Add(5.0f);
+
+  statistics.Reset();
+  statistics.Add(-1.0f);
+
+  EXPECT_EQ(statistics.GetCount(), 1u);
+  EXPECT_FLOAT_EQ(statistics.GetMean(), -1.0f);
+  EXPECT_FLOAT_EQ(statistics.GetVariance(), 0.0f);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}